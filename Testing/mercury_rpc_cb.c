@@ -17,12 +17,15 @@
 #include "mercury_atomic.h"
 #include "mercury_thread_mutex.h"
 #include "mercury_rpc_cb.h"
+#include "mercury_channel.h"
 
 /****************/
 /* Local Macros */
 /****************/
 #define PIPELINE_SIZE 4
 #define MIN_BUFFER_SIZE (2 << 15) /* 11 Stop at 4KB buffer size */
+#define CHANNEL_BATCH 64
+#define CHANNEL_TIMEOUT 10.0 /* Max time (s) without receiving any item */
 
 //#define HG_TEST_DEBUG
 #ifdef HG_TEST_DEBUG
@@ -38,56 +41,14 @@
 #define HG_TEST_ALLOC(size) malloc(size)
 #endif
 
-#ifdef MERCURY_TESTING_HAS_THREAD_POOL
-#define HG_TEST_RPC_CB(func_name, handle) \
-    static hg_return_t \
-    func_name ## _thread_cb(hg_handle_t handle)
-
-/* Assuming func_name_cb is defined, calling HG_TEST_THREAD_CB(func_name)
- * will define func_name_thread and func_name_thread_cb that can be used
- * to execute RPC callback from a thread
- */
-#define HG_TEST_THREAD_CB(func_name) \
-        static HG_INLINE HG_THREAD_RETURN_TYPE \
-        func_name ## _thread \
-        (void *arg) \
-        { \
-            hg_handle_t handle = (hg_handle_t) arg; \
-            hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0; \
-            \
-            func_name ## _thread_cb(handle); \
-            \
-            return thread_ret; \
-        } \
-        hg_return_t \
-        func_name ## _cb(hg_handle_t handle) \
-        { \
-            struct hg_test_info *hg_test_info = \
-                (struct hg_test_info *) HG_Class_get_data( \
-                    HG_Get_info(handle)->hg_class); \
-            hg_return_t ret = HG_SUCCESS; \
-            \
-            if (!hg_test_info->secondary_contexts) { \
-                struct hg_thread_work *work = HG_Get_data(handle); \
-                work->func = func_name ## _thread; \
-                work->args = handle; \
-                hg_thread_pool_post(hg_test_info->thread_pool, work); \
-            } else { \
-                func_name ## _thread(handle); \
-            } \
-            \
-            return ret; \
-        }
-#else
 #define HG_TEST_RPC_CB(func_name, handle) \
     hg_return_t \
     func_name ## _cb(hg_handle_t handle)
-#define HG_TEST_THREAD_CB(func_name)
-#endif
 
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
+
 #ifdef _WIN32
 #  ifndef _SSIZE_T_DEFINED
     typedef SSIZE_T ssize_t;
@@ -104,6 +65,15 @@ struct hg_test_bulk_args {
     hg_size_t target_offset;
 };
 
+struct hg_test_gather_args {
+    hg_handle_t handle;
+    hg_bulk_t origin_bulk_handle;
+    struct hg_bulk_transfer_entry *entries;
+    hg_size_t nbytes;
+    hg_atomic_int32_t remaining;
+    hg_atomic_int32_t failed;
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -113,6 +83,19 @@ hg_test_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info);
 static hg_return_t
 hg_test_bulk_bind_transfer_cb(const struct hg_cb_info *hg_cb_info);
 
+static hg_return_t
+hg_test_bulk_push_transfer_cb(const struct hg_cb_info *hg_cb_info);
+
+static hg_return_t
+hg_test_pipeline_chunk_cb(const struct hg_cb_info *hg_cb_info,
+    hg_size_t offset, hg_size_t size);
+
+static hg_return_t
+hg_test_pipeline_transfer_cb(const struct hg_cb_info *hg_cb_info);
+
+static hg_return_t
+hg_test_gather_transfer_cb(const struct hg_cb_info *hg_cb_info);
+
 static hg_return_t
 hg_test_posix_write_transfer_cb(const struct hg_cb_info *hg_cb_info);
 
@@ -122,10 +105,38 @@ hg_test_posix_read_transfer_cb(const struct hg_cb_info *hg_cb_info);
 static hg_return_t
 hg_test_perf_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info);
 
+static hg_return_t
+hg_test_codec_count_decode(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size);
+
+static hg_return_t
+hg_test_codec_fail_decode(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size);
+
 /*******************/
 /* Local Variables */
 /*******************/
 
+/* Words exposed to HG_Bulk_atomic (64-bit counter and 32-bit word) */
+static hg_uint64_t hg_test_atomic_words_g[2] = { 0, 0 };
+
+/* Handle keeping words exposed, replaced on each request */
+static hg_bulk_t hg_test_atomic_handle_g = HG_BULK_NULL;
+
+/* Consumer end of channel opened by client */
+static hg_channel_t *hg_test_channel_g = NULL;
+
+/* Codecs used by test_overflow */
+hg_atomic_int32_t hg_test_codec_decode_count_g = HG_ATOMIC_VAR_INIT(0);
+const struct hg_codec hg_test_codec_count_g = {
+    "lz_count", hg_codec_lz_bound, hg_codec_lz_encode,
+    hg_test_codec_count_decode
+};
+const struct hg_codec hg_test_codec_fail_g = {
+    "lz_fail", hg_codec_lz_bound, hg_codec_lz_encode,
+    hg_test_codec_fail_decode
+};
+
 //extern hg_id_t hg_test_nested2_id_g;
 //hg_addr_t *hg_addr_table;
 
@@ -263,6 +274,41 @@ HG_TEST_RPC_CB(hg_test_rpc_open_no_resp, handle)
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_executor, handle)
+{
+    rpc_open_out_t out_struct;
+    hg_return_t ret = HG_SUCCESS;
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    struct hg_test_info *hg_test_info =
+        (struct hg_test_info *) HG_Class_get_data(
+            HG_Get_info(handle)->hg_class);
+    struct hg_test_executor *hg_test_executor =
+        (struct hg_test_executor *) hg_thread_getspecific(
+            hg_test_info->executor_key);
+#endif
+
+    /* Report executor that is running this callback */
+    out_struct.ret = HG_SUCCESS;
+    out_struct.event_id = HG_TEST_EXECUTOR_TRIGGER;
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    if (hg_test_executor == &hg_test_info->class_executor)
+        out_struct.event_id = HG_TEST_EXECUTOR_CLASS;
+    else if (hg_test_executor == &hg_test_info->rpc_executor)
+        out_struct.event_id = HG_TEST_EXECUTOR_RPC;
+#endif
+
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        return ret;
+    }
+
+    HG_Destroy(handle);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 HG_TEST_RPC_CB(hg_test_bulk_write, handle)
 {
@@ -335,193 +381,837 @@ HG_TEST_RPC_CB(hg_test_bulk_write, handle)
 }
 
 /*---------------------------------------------------------------------------*/
-HG_TEST_RPC_CB(hg_test_bulk_bind_write, handle)
+HG_TEST_RPC_CB(hg_test_bulk_bind_write, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    hg_bulk_t origin_bulk_handle = HG_BULK_NULL;
+    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
+    struct hg_test_bulk_args *bulk_args = NULL;
+    bulk_write_in_t in_struct;
+    hg_return_t ret = HG_SUCCESS;
+    int fildes;
+
+    bulk_args = (struct hg_test_bulk_args *) malloc(
+            sizeof(struct hg_test_bulk_args));
+
+    /* Keep handle to pass to callback */
+    bulk_args->handle = handle;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get input parameters and data */
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
+        return ret;
+    }
+
+    /* Get parameters */
+    fildes = in_struct.fildes;
+    origin_bulk_handle = in_struct.bulk_handle;
+
+    bulk_args->nbytes = HG_Bulk_get_size(origin_bulk_handle);
+    bulk_args->transfer_size = in_struct.transfer_size;
+    bulk_args->origin_offset = in_struct.origin_offset;
+    bulk_args->target_offset = in_struct.target_offset;
+    bulk_args->fildes = fildes;
+
+    /* Create a new block handle to read the data */
+    HG_Bulk_create(hg_info->hg_class, 1, NULL, (hg_size_t *) &bulk_args->nbytes,
+        HG_BULK_READWRITE, &local_bulk_handle);
+
+    /* Pull bulk data */
+    HG_TEST_LOG_DEBUG("Requesting transfer_size=%zu, origin_offset=%zu, "
+        "target_offset=%zu", bulk_args->transfer_size, bulk_args->origin_offset,
+        bulk_args->target_offset);
+    ret = HG_Bulk_bind_transfer(hg_info->context, hg_test_bulk_bind_transfer_cb,
+        bulk_args, HG_BULK_PULL,
+        origin_bulk_handle, bulk_args->origin_offset, local_bulk_handle,
+        bulk_args->target_offset, bulk_args->transfer_size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not read bulk data\n");
+        return ret;
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    struct hg_test_bulk_args *bulk_args =
+        (struct hg_test_bulk_args *) hg_cb_info->arg;
+    hg_bulk_t local_bulk_handle = hg_cb_info->info.bulk.local_handle;
+    hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
+    hg_return_t ret = HG_SUCCESS;
+    bulk_write_out_t out_struct;
+    void *buf;
+    size_t write_ret;
+
+    if (hg_cb_info->ret == HG_CANCELED) {
+        printf("HG_Bulk_transfer() was successfully canceled\n");
+
+        /* Fill output structure */
+        out_struct.ret = 0;
+    } else if (hg_cb_info->ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Error in callback");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    if (hg_cb_info->ret == HG_SUCCESS) {
+        /* Call bulk_write */
+        HG_Bulk_access(local_bulk_handle, 0, bulk_args->nbytes,
+            HG_BULK_READ_ONLY, 1, &buf, NULL, NULL);
+
+        write_ret = bulk_write(bulk_args->fildes, buf, bulk_args->target_offset,
+            bulk_args->origin_offset - bulk_args->target_offset,
+            bulk_args->transfer_size, 1);
+
+        /* Fill output structure */
+        out_struct.ret = write_ret;
+    }
+
+    /* Free block handle */
+    ret = HG_Bulk_free(local_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        return ret;
+    }
+    ret = HG_Bulk_free(origin_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        return ret;
+    }
+
+    /* Send response back */
+    ret = HG_Respond(bulk_args->handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        return ret;
+    }
+
+done:
+    HG_Destroy(bulk_args->handle);
+    free(bulk_args);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_bind_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    struct hg_test_bulk_args *bulk_args =
+        (struct hg_test_bulk_args *) hg_cb_info->arg;
+    hg_bulk_t local_bulk_handle = hg_cb_info->info.bulk.local_handle;
+    hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
+    hg_return_t ret = HG_SUCCESS;
+    bulk_write_in_t in_struct = {
+        .fildes = bulk_args->fildes,
+        .transfer_size = bulk_args->transfer_size,
+        .origin_offset = bulk_args->origin_offset,
+        .target_offset = bulk_args->target_offset,
+        .bulk_handle = origin_bulk_handle
+    };
+    bulk_bind_write_out_t out_struct;
+    void *buf;
+    size_t write_ret;
+
+    if (hg_cb_info->ret == HG_CANCELED) {
+        printf("HG_Bulk_transfer() was successfully canceled\n");
+
+        /* Fill output structure */
+        out_struct.ret = 0;
+    } else if (hg_cb_info->ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Error in callback");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    if (hg_cb_info->ret == HG_SUCCESS) {
+        /* Call bulk_write */
+        HG_Bulk_access(local_bulk_handle, 0, bulk_args->nbytes,
+            HG_BULK_READ_ONLY, 1, &buf, NULL, NULL);
+
+        write_ret = bulk_write(bulk_args->fildes, buf, bulk_args->target_offset,
+            bulk_args->origin_offset - bulk_args->target_offset,
+            bulk_args->transfer_size, 1);
+
+        /* Fill output structure */
+        out_struct.ret = write_ret;
+    }
+
+    /* Try to send the bulk handle back */
+    out_struct.bulk_handle = origin_bulk_handle;
+
+    /* Free block handle */
+    ret = HG_Bulk_free(local_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        return ret;
+    }
+
+    /* Send response back */
+    ret = HG_Respond(bulk_args->handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        return ret;
+    }
+
+    /* Free input */
+    HG_Free_input(bulk_args->handle, &in_struct);
+
+done:
+    HG_Destroy(bulk_args->handle);
+    free(bulk_args);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_bulk_push, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    hg_bulk_t origin_bulk_handle = HG_BULK_NULL;
+    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
+    struct hg_test_bulk_args *bulk_args = NULL;
+    bulk_write_in_t in_struct;
+    hg_return_t ret = HG_SUCCESS;
+    char *buf;
+    hg_size_t i;
+
+    bulk_args = (struct hg_test_bulk_args *) malloc(
+            sizeof(struct hg_test_bulk_args));
+
+    /* Keep handle to pass to callback */
+    bulk_args->handle = handle;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get input parameters and data */
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
+        return ret;
+    }
+
+    /* Get parameters */
+    origin_bulk_handle = in_struct.bulk_handle;
+
+    bulk_args->nbytes = in_struct.target_offset + in_struct.transfer_size;
+    bulk_args->transfer_size = in_struct.transfer_size;
+    bulk_args->origin_offset = in_struct.origin_offset;
+    bulk_args->target_offset = in_struct.target_offset;
+    bulk_args->fildes = in_struct.fildes;
+
+    /* Free input */
+    HG_Bulk_ref_incr(origin_bulk_handle);
+    HG_Free_input(handle, &in_struct);
+
+    /* Create a new block handle to push the data */
+    HG_Bulk_create(hg_info->hg_class, 1, NULL, (hg_size_t *) &bulk_args->nbytes,
+        HG_BULK_READ_ONLY, &local_bulk_handle);
+    HG_Bulk_access(local_bulk_handle, 0, bulk_args->nbytes, HG_BULK_READWRITE,
+        1, (void **) &buf, NULL, NULL);
+    for (i = 0; i < bulk_args->nbytes; i++)
+        buf[i] = (char) i;
+
+    /* Push bulk data */
+    HG_TEST_LOG_DEBUG("Pushing transfer_size=%zu, origin_offset=%zu, "
+        "target_offset=%zu", bulk_args->transfer_size, bulk_args->origin_offset,
+        bulk_args->target_offset);
+    ret = HG_Bulk_transfer_id(hg_info->context, hg_test_bulk_push_transfer_cb,
+        bulk_args, HG_BULK_PUSH, hg_info->addr, hg_info->context_id,
+        origin_bulk_handle, bulk_args->origin_offset, local_bulk_handle,
+        bulk_args->target_offset, bulk_args->transfer_size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not push bulk data\n");
+        return ret;
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_push_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    struct hg_test_bulk_args *bulk_args =
+        (struct hg_test_bulk_args *) hg_cb_info->arg;
+    hg_bulk_t local_bulk_handle = hg_cb_info->info.bulk.local_handle;
+    hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
+    hg_return_t ret = HG_SUCCESS;
+    bulk_write_out_t out_struct;
+
+    /* Fill output structure */
+    out_struct.ret = (hg_cb_info->ret == HG_SUCCESS) ?
+        bulk_args->transfer_size : 0;
+
+    /* Free block handle */
+    ret = HG_Bulk_free(local_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        return ret;
+    }
+    ret = HG_Bulk_free(origin_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        return ret;
+    }
+
+    /* Send response back */
+    ret = HG_Respond(bulk_args->handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        return ret;
+    }
+
+    HG_Destroy(bulk_args->handle);
+    free(bulk_args);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_pipeline_write, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    struct hg_test_info *hg_test_info = NULL;
+    hg_bulk_t origin_bulk_handle = HG_BULK_NULL;
+    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
+    struct hg_test_bulk_args *bulk_args = NULL;
+    bulk_write_in_t in_struct;
+    hg_size_t chunk_size;
+    unsigned int window;
+    hg_return_t ret = HG_SUCCESS;
+
+    bulk_args = (struct hg_test_bulk_args *) malloc(
+            sizeof(struct hg_test_bulk_args));
+
+    /* Keep handle to pass to callback */
+    bulk_args->handle = handle;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get test info */
+    hg_test_info = (struct hg_test_info *) HG_Class_get_data(hg_info->hg_class);
+
+    /* Get input parameters and data */
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
+        return ret;
+    }
+
+    /* Get parameters, transfer_size is the chunk size (0 pulls data with a
+     * single transfer) and fildes the window */
+    origin_bulk_handle = in_struct.bulk_handle;
+    chunk_size = in_struct.transfer_size;
+    window = (unsigned int) in_struct.fildes;
+    bulk_args->transfer_size = HG_Bulk_get_size(origin_bulk_handle);
+    /* Bytes are accounted for as chunks complete */
+    bulk_args->nbytes = 0;
+
+    /* Free input */
+    HG_Bulk_ref_incr(origin_bulk_handle);
+    HG_Free_input(handle, &in_struct);
+
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    hg_thread_mutex_lock(&hg_test_info->bulk_handle_mutex);
+#endif
+    local_bulk_handle = hg_test_info->bulk_handle;
+
+    /* Pull bulk data */
+    if (chunk_size)
+        ret = HG_Bulk_transfer_pipelined(hg_info->context,
+            hg_test_pipeline_transfer_cb, hg_test_pipeline_chunk_cb, bulk_args,
+            HG_BULK_PULL, hg_info->addr, hg_info->context_id,
+            origin_bulk_handle, 0, local_bulk_handle, 0,
+            bulk_args->transfer_size, chunk_size, window, HG_OP_ID_IGNORE);
+    else
+        ret = HG_Bulk_transfer_id(hg_info->context,
+            hg_test_pipeline_transfer_cb, bulk_args, HG_BULK_PULL,
+            hg_info->addr, hg_info->context_id, origin_bulk_handle, 0,
+            local_bulk_handle, 0, bulk_args->transfer_size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not read bulk data\n");
+        return ret;
+    }
+
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    hg_thread_mutex_unlock(&hg_test_info->bulk_handle_mutex);
+#endif
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_pipeline_chunk_cb(const struct hg_cb_info *hg_cb_info,
+    hg_size_t offset, hg_size_t size)
+{
+    struct hg_test_bulk_args *bulk_args =
+        (struct hg_test_bulk_args *) hg_cb_info->arg;
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+    const char *buf_ptr;
+    void *buf;
+    hg_size_t i;
+#endif
+
+    if (hg_cb_info->ret != HG_SUCCESS)
+        return HG_SUCCESS;
+
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+    /* Check chunk while rest of data is still in flight */
+    HG_Bulk_access(hg_cb_info->info.bulk.local_handle, offset, size,
+        HG_BULK_READWRITE, 1, &buf, NULL, NULL);
+    buf_ptr = (const char *) buf;
+    for (i = 0; i < size; i++) {
+        if (buf_ptr[i] != (char) (offset + i)) {
+            printf("Error detected in bulk transfer, buf[%d] = %d, "
+                "was expecting %d!\n", (int) (offset + i), (char) buf_ptr[i],
+                (char) (offset + i));
+            return HG_SUCCESS;
+        }
+    }
+#endif
+    bulk_args->nbytes += size;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_pipeline_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    struct hg_test_bulk_args *bulk_args =
+        (struct hg_test_bulk_args *) hg_cb_info->arg;
+    hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
+    hg_return_t ret = HG_SUCCESS;
+    bulk_write_out_t out_struct;
+
+    /* Single transfer, data is checked as one chunk */
+    if (!bulk_args->nbytes)
+        hg_test_pipeline_chunk_cb(hg_cb_info, 0, bulk_args->transfer_size);
+
+    /* Fill output structure */
+    out_struct.ret = (hg_cb_info->ret == HG_SUCCESS) ? bulk_args->nbytes : 0;
+
+    /* Free origin handle */
+    ret = HG_Bulk_free(origin_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        goto done;
+    }
+
+    /* Send response back */
+    ret = HG_Respond(bulk_args->handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        goto done;
+    }
+
+done:
+    HG_Destroy(bulk_args->handle);
+    free(bulk_args);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_gather_write, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    struct hg_test_info *hg_test_info = NULL;
+    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
+    struct hg_test_gather_args *gather_args = NULL;
+    bulk_write_in_t in_struct;
+    hg_uint32_t count, i;
+    hg_size_t entry_size;
+    hg_bool_t multi;
+    hg_return_t ret = HG_SUCCESS;
+
+    gather_args = (struct hg_test_gather_args *) malloc(
+            sizeof(struct hg_test_gather_args));
+
+    /* Keep handle to pass to callback */
+    gather_args->handle = handle;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get test info */
+    hg_test_info = (struct hg_test_info *) HG_Class_get_data(hg_info->hg_class);
+
+    /* Get input parameters and data */
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
+        return ret;
+    }
+
+    /* Get parameters, fildes is the number of entries of transfer_size bytes
+     * gathered at the same offset in the local handle, target_offset selects
+     * a single vectored transfer instead of one transfer per entry */
+    gather_args->origin_bulk_handle = in_struct.bulk_handle;
+    count = (hg_uint32_t) in_struct.fildes;
+    entry_size = in_struct.transfer_size;
+    multi = (in_struct.target_offset) ? HG_TRUE : HG_FALSE;
+    gather_args->nbytes = count * entry_size;
+    hg_atomic_init32(&gather_args->remaining, multi ? 1 : (hg_int32_t) count);
+    hg_atomic_init32(&gather_args->failed, 0);
+
+    /* Free input */
+    HG_Bulk_ref_incr(gather_args->origin_bulk_handle);
+    HG_Free_input(handle, &in_struct);
+
+    /* Each entry emulates a separate client */
+    gather_args->entries = (struct hg_bulk_transfer_entry *) malloc(
+        count * sizeof(struct hg_bulk_transfer_entry));
+    for (i = 0; i < count; i++) {
+        gather_args->entries[i].origin_addr = hg_info->addr;
+        gather_args->entries[i].origin_id = hg_info->context_id;
+        gather_args->entries[i].origin_handle = gather_args->origin_bulk_handle;
+        gather_args->entries[i].origin_offset = i * entry_size;
+        gather_args->entries[i].local_offset = i * entry_size;
+        gather_args->entries[i].size = entry_size;
+    }
+
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    hg_thread_mutex_lock(&hg_test_info->bulk_handle_mutex);
+#endif
+    local_bulk_handle = hg_test_info->bulk_handle;
+
+    /* Pull bulk data */
+    if (multi)
+        ret = HG_Bulk_transfer_multi(hg_info->context,
+            hg_test_gather_transfer_cb, gather_args, HG_BULK_PULL,
+            local_bulk_handle, gather_args->entries, count, HG_OP_ID_IGNORE);
+    else
+        for (i = 0; i < count && ret == HG_SUCCESS; i++)
+            ret = HG_Bulk_transfer_id(hg_info->context,
+                hg_test_gather_transfer_cb, gather_args, HG_BULK_PULL,
+                gather_args->entries[i].origin_addr,
+                gather_args->entries[i].origin_id,
+                gather_args->entries[i].origin_handle,
+                gather_args->entries[i].origin_offset, local_bulk_handle,
+                gather_args->entries[i].local_offset,
+                gather_args->entries[i].size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not read bulk data\n");
+        return ret;
+    }
+
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    hg_thread_mutex_unlock(&hg_test_info->bulk_handle_mutex);
+#endif
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_gather_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    struct hg_test_gather_args *gather_args =
+        (struct hg_test_gather_args *) hg_cb_info->arg;
+    hg_return_t ret = HG_SUCCESS;
+    bulk_write_out_t out_struct;
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+    const char *buf_ptr;
+    void *buf;
+    hg_size_t i;
+#endif
+
+    if (hg_cb_info->ret != HG_SUCCESS)
+        hg_atomic_set32(&gather_args->failed, 1);
+
+    /* Respond once all transfers have completed */
+    if (hg_atomic_decr32(&gather_args->remaining) > 0)
+        return ret;
+
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+    HG_Bulk_access(hg_cb_info->info.bulk.local_handle, 0, gather_args->nbytes,
+        HG_BULK_READWRITE, 1, &buf, NULL, NULL);
+    buf_ptr = (const char *) buf;
+    for (i = 0; i < gather_args->nbytes; i++) {
+        if (buf_ptr[i] != (char) i) {
+            printf("Error detected in bulk transfer, buf[%d] = %d, "
+                "was expecting %d!\n", (int) i, (char) buf_ptr[i], (char) i);
+            hg_atomic_set32(&gather_args->failed, 1);
+            break;
+        }
+    }
+#endif
+
+    /* Fill output structure */
+    out_struct.ret = hg_atomic_get32(&gather_args->failed) ? 0 :
+        gather_args->nbytes;
+
+    /* Free origin handle */
+    ret = HG_Bulk_free(gather_args->origin_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not free HG bulk handle\n");
+        goto done;
+    }
+
+    /* Send response back */
+    ret = HG_Respond(gather_args->handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        goto done;
+    }
+
+done:
+    HG_Destroy(gather_args->handle);
+    free(gather_args->entries);
+    free(gather_args);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_atomic_handle, handle)
+{
+    const struct hg_info *hg_info = HG_Get_info(handle);
+    bulk_atomic_incr_t in_struct;
+    bulk_bind_write_out_t out_struct;
+    void *buf_ptr = hg_test_atomic_words_g;
+    hg_size_t buf_size = sizeof(hg_test_atomic_words_g);
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
+        goto done;
+    }
+    HG_Free_input(handle, &in_struct);
+
+    /* Replace handle exposing words to previous client */
+    HG_Bulk_free(hg_test_atomic_handle_g);
+    hg_test_atomic_handle_g = HG_BULK_NULL;
+
+    /* Expose words, handle is serialized with response */
+    out_struct.ret = buf_size;
+    ret = HG_Bulk_create(hg_info->hg_class, 1, &buf_ptr, &buf_size,
+        HG_BULK_READWRITE, &out_struct.bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not create bulk data handle\n");
+        goto done;
+    }
+
+    /* Words only remain writable while a read-write handle is alive, if
+     * requested by client, only keep a read-only handle on words */
+    if (in_struct.value) {
+        ret = HG_Bulk_create(hg_info->hg_class, 1, &buf_ptr, &buf_size,
+            HG_BULK_READ_ONLY, &hg_test_atomic_handle_g);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not create bulk data handle\n");
+            HG_Bulk_free(out_struct.bulk_handle);
+            goto done;
+        }
+    } else {
+        HG_Bulk_ref_incr(out_struct.bulk_handle);
+        hg_test_atomic_handle_g = out_struct.bulk_handle;
+    }
+
+    /* Send response back */
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS)
+        fprintf(stderr, "Could not respond\n");
+
+    HG_Bulk_free(out_struct.bulk_handle);
+
+done:
+    HG_Destroy(handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_atomic_incr, handle)
 {
-    const struct hg_info *hg_info = NULL;
-    hg_bulk_t origin_bulk_handle = HG_BULK_NULL;
-    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
-    struct hg_test_bulk_args *bulk_args = NULL;
-    bulk_write_in_t in_struct;
+    hg_atomic_int64_t *counter =
+        (hg_atomic_int64_t *) &hg_test_atomic_words_g[0];
+    bulk_atomic_incr_t in_struct, out_struct;
+    hg_util_int64_t value;
     hg_return_t ret = HG_SUCCESS;
-    int fildes;
-
-    bulk_args = (struct hg_test_bulk_args *) malloc(
-            sizeof(struct hg_test_bulk_args));
-
-    /* Keep handle to pass to callback */
-    bulk_args->handle = handle;
-
-    /* Get info from handle */
-    hg_info = HG_Get_info(handle);
 
-    /* Get input parameters and data */
     ret = HG_Get_input(handle, &in_struct);
     if (ret != HG_SUCCESS) {
         fprintf(stderr, "Could not get input\n");
-        return ret;
+        goto done;
     }
 
-    /* Get parameters */
-    fildes = in_struct.fildes;
-    origin_bulk_handle = in_struct.bulk_handle;
-
-    bulk_args->nbytes = HG_Bulk_get_size(origin_bulk_handle);
-    bulk_args->transfer_size = in_struct.transfer_size;
-    bulk_args->origin_offset = in_struct.origin_offset;
-    bulk_args->target_offset = in_struct.target_offset;
-    bulk_args->fildes = fildes;
+    /* Same word as the one updated by HG_Bulk_atomic() */
+    do {
+        value = hg_atomic_get64(counter);
+    } while (!hg_atomic_cas64(counter, value,
+        (hg_util_int64_t) ((hg_uint64_t) value + in_struct.value)));
+    out_struct.value = (hg_uint64_t) value;
 
-    /* Create a new block handle to read the data */
-    HG_Bulk_create(hg_info->hg_class, 1, NULL, (hg_size_t *) &bulk_args->nbytes,
-        HG_BULK_READWRITE, &local_bulk_handle);
+    HG_Free_input(handle, &in_struct);
 
-    /* Pull bulk data */
-    HG_TEST_LOG_DEBUG("Requesting transfer_size=%zu, origin_offset=%zu, "
-        "target_offset=%zu", bulk_args->transfer_size, bulk_args->origin_offset,
-        bulk_args->target_offset);
-    ret = HG_Bulk_bind_transfer(hg_info->context, hg_test_bulk_bind_transfer_cb,
-        bulk_args, HG_BULK_PULL,
-        origin_bulk_handle, bulk_args->origin_offset, local_bulk_handle,
-        bulk_args->target_offset, bulk_args->transfer_size, HG_OP_ID_IGNORE);
-    if (ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not read bulk data\n");
-        return ret;
-    }
+    /* Send response back */
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS)
+        fprintf(stderr, "Could not respond\n");
 
+done:
+    HG_Destroy(handle);
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_test_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info)
+HG_TEST_RPC_CB(hg_test_channel_open, handle)
 {
-    struct hg_test_bulk_args *bulk_args =
-        (struct hg_test_bulk_args *) hg_cb_info->arg;
-    hg_bulk_t local_bulk_handle = hg_cb_info->info.bulk.local_handle;
-    hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
+    const struct hg_info *hg_info = HG_Get_info(handle);
+    channel_open_in_t in_struct;
+    bulk_bind_write_out_t out_struct;
     hg_return_t ret = HG_SUCCESS;
-    bulk_write_out_t out_struct;
-    void *buf;
-    size_t write_ret;
-
-    if (hg_cb_info->ret == HG_CANCELED) {
-        printf("HG_Bulk_transfer() was successfully canceled\n");
 
-        /* Fill output structure */
-        out_struct.ret = 0;
-    } else if (hg_cb_info->ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Error in callback");
-        ret = HG_PROTOCOL_ERROR;
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
         goto done;
     }
 
-    if (hg_cb_info->ret == HG_SUCCESS) {
-        /* Call bulk_write */
-        HG_Bulk_access(local_bulk_handle, 0, bulk_args->nbytes,
-            HG_BULK_READ_ONLY, 1, &buf, NULL, NULL);
-
-        write_ret = bulk_write(bulk_args->fildes, buf, bulk_args->target_offset,
-            bulk_args->origin_offset - bulk_args->target_offset,
-            bulk_args->transfer_size, 1);
-
-        /* Fill output structure */
-        out_struct.ret = write_ret;
-    }
-
-    /* Free block handle */
-    ret = HG_Bulk_free(local_bulk_handle);
-    if (ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not free HG bulk handle\n");
-        return ret;
-    }
-    ret = HG_Bulk_free(origin_bulk_handle);
+    /* Replace previous channel if client did not close it */
+    HG_Channel_destroy(hg_test_channel_g);
+    hg_test_channel_g = NULL;
+    ret = HG_Channel_create(hg_info->hg_class, in_struct.size,
+        (hg_bool_t) in_struct.shared, &hg_test_channel_g);
+    HG_Free_input(handle, &in_struct);
     if (ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not free HG bulk handle\n");
-        return ret;
+        fprintf(stderr, "Could not create channel\n");
+        goto done;
     }
 
+    /* Ring handle is serialized with response, max item size is returned */
+    out_struct.ret = HG_Channel_get_max_size(hg_test_channel_g);
+    out_struct.bulk_handle = HG_Channel_get_bulk(hg_test_channel_g);
+
     /* Send response back */
-    ret = HG_Respond(bulk_args->handle, NULL, NULL, &out_struct);
-    if (ret != HG_SUCCESS) {
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS)
         fprintf(stderr, "Could not respond\n");
-        return ret;
-    }
 
 done:
-    HG_Destroy(bulk_args->handle);
-    free(bulk_args);
-
+    HG_Destroy(handle);
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_test_bulk_bind_transfer_cb(const struct hg_cb_info *hg_cb_info)
+HG_TEST_RPC_CB(hg_test_channel_drain, handle)
 {
-    struct hg_test_bulk_args *bulk_args =
-        (struct hg_test_bulk_args *) hg_cb_info->arg;
-    hg_bulk_t local_bulk_handle = hg_cb_info->info.bulk.local_handle;
-    hg_bulk_t origin_bulk_handle = hg_cb_info->info.bulk.origin_handle;
+    bulk_atomic_incr_t in_struct;
+    channel_drain_out_t out_struct;
+    void *bufs[CHANNEL_BATCH];
+    hg_size_t sizes[CHANNEL_BATCH];
+    hg_size_t max_size = HG_Channel_get_max_size(hg_test_channel_g);
+    char *buf = NULL;
+    hg_time_t last, now;
     hg_return_t ret = HG_SUCCESS;
-    bulk_write_in_t in_struct = {
-        .fildes = bulk_args->fildes,
-        .transfer_size = bulk_args->transfer_size,
-        .origin_offset = bulk_args->origin_offset,
-        .target_offset = bulk_args->target_offset,
-        .bulk_handle = origin_bulk_handle
-    };
-    bulk_bind_write_out_t out_struct;
-    void *buf;
-    size_t write_ret;
+    unsigned int i;
 
-    if (hg_cb_info->ret == HG_CANCELED) {
-        printf("HG_Bulk_transfer() was successfully canceled\n");
-
-        /* Fill output structure */
-        out_struct.ret = 0;
-    } else if (hg_cb_info->ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Error in callback");
-        ret = HG_PROTOCOL_ERROR;
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
         goto done;
     }
-
-    if (hg_cb_info->ret == HG_SUCCESS) {
-        /* Call bulk_write */
-        HG_Bulk_access(local_bulk_handle, 0, bulk_args->nbytes,
-            HG_BULK_READ_ONLY, 1, &buf, NULL, NULL);
-
-        write_ret = bulk_write(bulk_args->fildes, buf, bulk_args->target_offset,
-            bulk_args->origin_offset - bulk_args->target_offset,
-            bulk_args->transfer_size, 1);
-
-        /* Fill output structure */
-        out_struct.ret = write_ret;
+    out_struct.count = 0;
+    out_struct.bytes = 0;
+
+    buf = (char *) malloc(CHANNEL_BATCH * max_size);
+    if (!buf) {
+        fprintf(stderr, "Could not allocate buffer\n");
+        ret = HG_NOMEM_ERROR;
+        goto respond;
     }
+    for (i = 0; i < CHANNEL_BATCH; i++)
+        bufs[i] = buf + i * max_size;
+
+    /* Poll ring until count items are received, producer does not need this
+     * context to be progressed */
+    hg_time_get_current(&last);
+    while (out_struct.count < in_struct.value) {
+        unsigned int batch = (in_struct.value - out_struct.count
+            < CHANNEL_BATCH) ? (unsigned int) (in_struct.value
+                - out_struct.count) : CHANNEL_BATCH;
+        unsigned int actual_count = 0;
+
+        for (i = 0; i < batch; i++)
+            sizes[i] = max_size;
+        ret = HG_Channel_dequeue(hg_test_channel_g, batch, bufs, sizes,
+            &actual_count);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not dequeue items\n");
+            goto respond;
+        }
+        if (!actual_count) {
+            hg_time_get_current(&now);
+            if (hg_time_to_double(hg_time_subtract(now, last))
+                > CHANNEL_TIMEOUT)
+                break;
+            hg_thread_yield();
+            continue;
+        }
 
-    /* Try to send the bulk handle back */
-    out_struct.bulk_handle = origin_bulk_handle;
+        /* Items of size s hold bytes (char) (s + j) */
+        for (i = 0; i < actual_count; i++) {
+            const char *item = (const char *) bufs[i];
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+            hg_size_t j;
 
-    /* Free block handle */
-    ret = HG_Bulk_free(local_bulk_handle);
-    if (ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not free HG bulk handle\n");
-        return ret;
+            for (j = 0; j < sizes[i]; j++)
+                if (item[j] != (char) (sizes[i] + j))
+                    break;
+            if (j < sizes[i]) {
+#else
+            if (sizes[i] && (item[0] != (char) sizes[i]
+                || item[sizes[i] - 1] != (char) (2 * sizes[i] - 1))) {
+#endif
+                fprintf(stderr, "Error detected in channel item\n");
+                goto respond;
+            }
+            out_struct.count++;
+            out_struct.bytes += sizes[i];
+        }
+        hg_time_get_current(&last);
     }
 
+respond:
+    HG_Free_input(handle, &in_struct);
+
     /* Send response back */
-    ret = HG_Respond(bulk_args->handle, NULL, NULL, &out_struct);
-    if (ret != HG_SUCCESS) {
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS)
         fprintf(stderr, "Could not respond\n");
-        return ret;
-    }
-
-    /* Free input */
-    HG_Free_input(bulk_args->handle, &in_struct);
 
 done:
-    HG_Destroy(bulk_args->handle);
-    free(bulk_args);
+    free(buf);
+    HG_Destroy(handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_channel_close, handle)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_Channel_destroy(hg_test_channel_g);
+    hg_test_channel_g = NULL;
+
+    /* Send response back */
+    ret = HG_Respond(handle, NULL, NULL, NULL);
+    if (ret != HG_SUCCESS)
+        fprintf(stderr, "Could not respond\n");
 
+    HG_Destroy(handle);
     return ret;
 }
 
@@ -743,13 +1433,9 @@ HG_TEST_RPC_CB(hg_test_posix_read, handle)
     hg_bulk_t local_bulk_handle = HG_BULK_NULL;
     struct hg_test_bulk_args *bulk_args = NULL;
     read_in_t in_struct;
-
-    void *buf;
-    ssize_t read_ret;
-
-    /* for debug */
-    int i;
-    const int *buf_ptr;
+    struct stat file_stat;
+    off_t offset;
+    hg_size_t read_size = 0;
 
     bulk_args = (struct hg_test_bulk_args *) malloc(
             sizeof(struct hg_test_bulk_args));
@@ -769,7 +1455,6 @@ HG_TEST_RPC_CB(hg_test_posix_read, handle)
 
     origin_bulk_handle = in_struct.bulk_handle;
 
-    /* Create a new block handle to read the data */
     bulk_args->nbytes = HG_Bulk_get_size(origin_bulk_handle);
     bulk_args->fildes = in_struct.fd;
 
@@ -777,33 +1462,47 @@ HG_TEST_RPC_CB(hg_test_posix_read, handle)
     HG_Bulk_ref_incr(origin_bulk_handle);
     HG_Free_input(handle, &in_struct);
 
-    /* Create a new bulk handle to read the data */
-    HG_Bulk_create(hg_info->hg_class, 1, NULL, (hg_size_t *) &bulk_args->nbytes,
-            HG_BULK_READ_ONLY, &local_bulk_handle);
-
-    /* Call bulk_write */
-    HG_Bulk_access(local_bulk_handle, 0, bulk_args->nbytes, HG_BULK_READWRITE,
-            1, &buf, NULL, NULL);
-
-    printf("Calling read with fd: %d\n", in_struct.fd);
-    read_ret = read(in_struct.fd, buf, bulk_args->nbytes);
+    /* Read from current position up to end of file */
+    offset = lseek(bulk_args->fildes, 0, SEEK_CUR);
+    if (offset < 0 || fstat(bulk_args->fildes, &file_stat) < 0)
+        bulk_args->ret = -1;
+    else {
+        if (file_stat.st_size > offset)
+            read_size = (hg_size_t) (file_stat.st_size - offset);
+        if (read_size > bulk_args->nbytes)
+            read_size = bulk_args->nbytes;
+        bulk_args->ret = (ssize_t) read_size;
+    }
 
-    /* Check bulk buf */
-    buf_ptr = (const int*) buf;
-    for (i = 0; i < (int)(bulk_args->nbytes / sizeof(int)); i++) {
-        if (buf_ptr[i] != i) {
-            printf("Error detected after read, buf[%d] = %d, was expecting %d!\n", i, buf_ptr[i], i);
-            break;
-        }
+    /* Nothing to push */
+    if (!read_size) {
+        read_out_t out_struct;
+
+        out_struct.ret = bulk_args->ret;
+        HG_Bulk_free(origin_bulk_handle);
+        ret = HG_Respond(handle, NULL, NULL, &out_struct);
+        if (ret != HG_SUCCESS)
+            fprintf(stderr, "Could not respond\n");
+        HG_Destroy(handle);
+        free(bulk_args);
+        return ret;
     }
 
-    /* Fill output structure */
-    bulk_args->ret = read_ret;
+    /* Expose file range instead of reading it into a buffer, data is pushed
+     * directly from the file cache */
+    ret = HG_Bulk_create_file(hg_info->hg_class, bulk_args->fildes,
+            (hg_size_t) offset, read_size, HG_BULK_READ_ONLY,
+            &local_bulk_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not create file bulk handle\n");
+        return ret;
+    }
+    lseek(bulk_args->fildes, (off_t) read_size, SEEK_CUR);
 
     /* Push bulk data */
     ret = HG_Bulk_transfer_id(hg_info->context, hg_test_posix_read_transfer_cb,
             bulk_args, HG_BULK_PUSH, hg_info->addr, hg_info->context_id,
-            origin_bulk_handle, 0, local_bulk_handle, 0, bulk_args->nbytes,
+            origin_bulk_handle, 0, local_bulk_handle, 0, read_size,
             HG_OP_ID_IGNORE);
     if (ret != HG_SUCCESS) {
         fprintf(stderr, "Could not read bulk data\n");
@@ -1087,6 +1786,70 @@ HG_TEST_RPC_CB(hg_test_overflow, handle)
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_overflow_input, handle)
+{
+    overflow_out_t in_struct;
+    rpc_open_out_t out_struct;
+    hg_return_t ret = HG_SUCCESS;
+    size_t i;
+
+    /* Get input buffer */
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get input\n");
+        return ret;
+    }
+
+    /* Check string and report number of payloads decoded so far */
+    out_struct.ret = HG_SUCCESS;
+    if (!in_struct.string || strlen(in_struct.string) != in_struct.string_len)
+        out_struct.ret = HG_PROTOCOL_ERROR;
+    else
+        for (i = 0; i < in_struct.string_len; i++)
+            if (in_struct.string[i] != 'h') {
+                out_struct.ret = HG_PROTOCOL_ERROR;
+                break;
+            }
+    out_struct.event_id = hg_atomic_get32(&hg_test_codec_decode_count_g);
+
+    HG_Free_input(handle, &in_struct);
+
+    /* Send response back */
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not respond\n");
+        return ret;
+    }
+
+    HG_Destroy(handle);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_codec_count_decode(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size)
+{
+    hg_atomic_incr32(&hg_test_codec_decode_count_g);
+
+    return hg_codec_lz_decode(src, src_size, dest, dest_size);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_codec_fail_decode(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size)
+{
+    (void) src;
+    (void) src_size;
+    (void) dest;
+    (void) dest_size;
+
+    return HG_PROTOCOL_ERROR;
+}
+
 /*---------------------------------------------------------------------------*/
 HG_TEST_RPC_CB(hg_test_cancel_rpc, handle)
 {
@@ -1171,24 +1934,3 @@ HG_TEST_RPC_CB(hg_test_cancel_rpc, handle)
 //}
 
 /*---------------------------------------------------------------------------*/
-HG_TEST_THREAD_CB(hg_test_rpc_open)
-HG_TEST_THREAD_CB(hg_test_rpc_open_no_resp)
-HG_TEST_THREAD_CB(hg_test_bulk_write)
-HG_TEST_THREAD_CB(hg_test_bulk_bind_write)
-//HG_TEST_THREAD_CB(hg_test_pipeline_write)
-#ifndef _WIN32
-HG_TEST_THREAD_CB(hg_test_posix_open)
-HG_TEST_THREAD_CB(hg_test_posix_close)
-HG_TEST_THREAD_CB(hg_test_posix_write)
-HG_TEST_THREAD_CB(hg_test_posix_read)
-#endif
-HG_TEST_THREAD_CB(hg_test_perf_rpc)
-HG_TEST_THREAD_CB(hg_test_perf_rpc_lat)
-HG_TEST_THREAD_CB(hg_test_perf_bulk)
-HG_TEST_THREAD_CB(hg_test_perf_bulk_read)
-HG_TEST_THREAD_CB(hg_test_overflow)
-HG_TEST_THREAD_CB(hg_test_cancel_rpc)
-//HG_TEST_THREAD_CB(hg_test_nested1)
-//HG_TEST_THREAD_CB(hg_test_nested2)
-
-/*---------------------------------------------------------------------------*/
@@ -23,6 +23,12 @@ hg_test_rpc_open_cb(hg_handle_t handle);
 hg_return_t
 hg_test_rpc_open_no_resp_cb(hg_handle_t handle);
 
+/**
+ * test_rpc (executor)
+ */
+hg_return_t
+hg_test_executor_cb(hg_handle_t handle);
+
 /**
  * test_bulk
  */
@@ -30,12 +36,38 @@ hg_return_t
 hg_test_bulk_write_cb(hg_handle_t handle);
 hg_return_t
 hg_test_bulk_bind_write_cb(hg_handle_t handle);
+hg_return_t
+hg_test_bulk_push_cb(hg_handle_t handle);
 
-///**
-// * test_pipeline
-// */
-//hg_return_t
-//hg_test_pipeline_write_cb(hg_handle_t handle);
+/**
+ * test_pipeline
+ */
+hg_return_t
+hg_test_pipeline_write_cb(hg_handle_t handle);
+
+/**
+ * test_gather
+ */
+hg_return_t
+hg_test_gather_write_cb(hg_handle_t handle);
+
+/**
+ * test_atomic
+ */
+hg_return_t
+hg_test_atomic_handle_cb(hg_handle_t handle);
+hg_return_t
+hg_test_atomic_incr_cb(hg_handle_t handle);
+
+/**
+ * test_channel
+ */
+hg_return_t
+hg_test_channel_open_cb(hg_handle_t handle);
+hg_return_t
+hg_test_channel_drain_cb(hg_handle_t handle);
+hg_return_t
+hg_test_channel_close_cb(hg_handle_t handle);
 
 /**
  * test_posix
@@ -66,6 +98,15 @@ hg_test_perf_bulk_read_cb(hg_handle_t handle);
  */
 hg_return_t
 hg_test_overflow_cb(hg_handle_t handle);
+hg_return_t
+hg_test_overflow_input_cb(hg_handle_t handle);
+
+/* LZ codec counting decoded payloads and LZ codec that fails to decode */
+#define HG_TEST_CODEC_COUNT 2
+#define HG_TEST_CODEC_FAIL  3
+extern const struct hg_codec hg_test_codec_count_g;
+extern const struct hg_codec hg_test_codec_fail_g;
+extern hg_atomic_int32_t hg_test_codec_decode_count_g;
 
 /**
  * test_cancel
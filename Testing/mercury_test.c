@@ -29,6 +29,16 @@
 /* Local Type and Struct Definition */
 /************************************/
 
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+/* Work item wrapping the work of an RPC callback */
+struct hg_test_executor_work {
+    struct hg_thread_work thread_work;
+    struct hg_thread_work *work;
+    struct hg_test_executor *executor;
+    struct hg_test_executor_work *next;     /* Next free work item */
+};
+#endif
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -41,8 +51,18 @@ hg_test_parse_options(int argc, char *argv[],
     struct hg_test_info *hg_test_info);
 
 #ifdef MERCURY_TESTING_HAS_THREAD_POOL
-static hg_return_t
-hg_test_handle_create_cb(hg_handle_t handle, void *arg);
+static HG_THREAD_RETURN_TYPE
+hg_test_executor_thread(void *arg);
+
+static int
+hg_test_executor_post(void *arg, struct hg_thread_work *work);
+
+static void
+hg_test_executor_init(struct hg_test_executor *hg_test_executor,
+    struct hg_test_info *hg_test_info);
+
+static void
+hg_test_executor_destroy(struct hg_test_executor *hg_test_executor);
 #endif
 
 static hg_return_t
@@ -69,14 +89,29 @@ extern const struct na_test_opt na_test_opt_g[];
 /* test_rpc */
 hg_id_t hg_test_rpc_open_id_g = 0;
 hg_id_t hg_test_rpc_open_id_no_resp_g = 0;
+hg_id_t hg_test_executor_id_g = 0;
+hg_id_t hg_test_executor_rpc_id_g = 0;
 
 /* test_bulk */
 hg_id_t hg_test_bulk_write_id_g = 0;
 hg_id_t hg_test_bulk_bind_write_id_g = 0;
+hg_id_t hg_test_bulk_push_id_g = 0;
 
 /* test_pipeline */
 hg_id_t hg_test_pipeline_write_id_g = 0;
 
+/* test_gather */
+hg_id_t hg_test_gather_write_id_g = 0;
+
+/* test_atomic */
+hg_id_t hg_test_atomic_handle_id_g = 0;
+hg_id_t hg_test_atomic_incr_id_g = 0;
+
+/* test_channel */
+hg_id_t hg_test_channel_open_id_g = 0;
+hg_id_t hg_test_channel_drain_id_g = 0;
+hg_id_t hg_test_channel_close_id_g = 0;
+
 /* test_posix */
 hg_id_t hg_test_posix_open_id_g = 0;
 hg_id_t hg_test_posix_write_id_g = 0;
@@ -92,6 +127,10 @@ hg_id_t hg_test_perf_bulk_read_id_g = 0;
 
 /* test_overflow */
 hg_id_t hg_test_overflow_id_g = 0;
+hg_id_t hg_test_overflow_codec_id_g = 0;
+hg_id_t hg_test_overflow_input_id_g = 0;
+hg_id_t hg_test_overflow_fail_id_g = 0;
+hg_id_t hg_test_overflow_input_fail_id_g = 0;
 
 /* test_cancel */
 hg_id_t hg_test_cancel_rpc_id_g = 0;
@@ -139,10 +178,29 @@ hg_test_parse_options(int argc, char *argv[], struct hg_test_info *hg_test_info)
             case 'm': /* memory */
                 hg_test_info->auto_sm = HG_TRUE;
                 break;
+            case 'i': /* inline self */
+                hg_test_info->self_inline = HG_TRUE;
+                break;
             case 't': /* number of threads */
                 hg_test_info->thread_count =
                     (unsigned int) atoi(na_test_opt_arg_g);
                 break;
+            case 'x': /* number of local copy threads */
+                hg_test_info->copy_threads =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
+            case 'X': /* non-temporal local copy size */
+                hg_test_info->copy_nt_size =
+                    (hg_size_t) strtoull(na_test_opt_arg_g, NULL, 0);
+                break;
+            case 'R': /* number of rails */
+                hg_test_info->rail_count =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
+            case 'Z': /* size of chunks striped across rails */
+                hg_test_info->rail_chunk_size =
+                    (hg_size_t) strtoull(na_test_opt_arg_g, NULL, 0);
+                break;
             default:
                 break;
         }
@@ -155,25 +213,94 @@ hg_test_parse_options(int argc, char *argv[], struct hg_test_info *hg_test_info)
 
 /*---------------------------------------------------------------------------*/
 #ifdef MERCURY_TESTING_HAS_THREAD_POOL
-static hg_return_t
-hg_test_handle_create_cb(hg_handle_t handle, void *arg)
+static HG_THREAD_RETURN_TYPE
+hg_test_executor_thread(void *arg)
 {
-    struct hg_thread_work *hg_thread_work =
-        malloc(sizeof(struct hg_thread_work));
-    hg_return_t ret = HG_SUCCESS;
+    struct hg_test_executor_work *hg_test_executor_work =
+        (struct hg_test_executor_work *) arg;
+    struct hg_test_executor *hg_test_executor =
+        hg_test_executor_work->executor;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+
+    /* Let the RPC callback know which executor it is running from */
+    hg_thread_setspecific(hg_test_executor->key, hg_test_executor);
+    hg_test_executor_work->work->func(hg_test_executor_work->work->args);
+    hg_thread_setspecific(hg_test_executor->key, NULL);
+
+    /* Keep work item for next post */
+    hg_thread_mutex_lock(&hg_test_executor->free_works_mutex);
+    hg_test_executor_work->next = hg_test_executor->free_works;
+    hg_test_executor->free_works = hg_test_executor_work;
+    hg_thread_mutex_unlock(&hg_test_executor->free_works_mutex);
+
+    return thread_ret;
+}
 
-    if (!hg_thread_work) {
-        HG_LOG_ERROR("Could not allocate hg_thread_work");
-        ret = HG_NOMEM_ERROR;
-        goto done;
+/*---------------------------------------------------------------------------*/
+static int
+hg_test_executor_post(void *arg, struct hg_thread_work *work)
+{
+    struct hg_test_executor *hg_test_executor =
+        (struct hg_test_executor *) arg;
+    struct hg_test_executor_work *hg_test_executor_work;
+    int ret;
+
+    /* Reuse work items of callbacks that already ran */
+    hg_thread_mutex_lock(&hg_test_executor->free_works_mutex);
+    hg_test_executor_work = hg_test_executor->free_works;
+    if (hg_test_executor_work)
+        hg_test_executor->free_works = hg_test_executor_work->next;
+    hg_thread_mutex_unlock(&hg_test_executor->free_works_mutex);
+    if (!hg_test_executor_work) {
+        hg_test_executor_work = malloc(sizeof(struct hg_test_executor_work));
+        if (!hg_test_executor_work) {
+            HG_LOG_ERROR("Could not allocate executor work");
+            return HG_UTIL_FAIL;
+        }
+        hg_test_executor_work->thread_work.func = hg_test_executor_thread;
+        hg_test_executor_work->thread_work.args = hg_test_executor_work;
+        hg_test_executor_work->executor = hg_test_executor;
+    }
+    hg_test_executor_work->work = work;
+
+    ret = hg_thread_pool_post(hg_test_executor->thread_pool,
+        &hg_test_executor_work->thread_work);
+    if (ret != HG_UTIL_SUCCESS) {
+        hg_thread_mutex_lock(&hg_test_executor->free_works_mutex);
+        hg_test_executor_work->next = hg_test_executor->free_works;
+        hg_test_executor->free_works = hg_test_executor_work;
+        hg_thread_mutex_unlock(&hg_test_executor->free_works_mutex);
     }
 
-    (void) arg;
-    HG_Set_data(handle, hg_thread_work, free);
-
-done:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_test_executor_init(struct hg_test_executor *hg_test_executor,
+    struct hg_test_info *hg_test_info)
+{
+    hg_test_executor->executor.post = hg_test_executor_post;
+    hg_test_executor->executor.arg = hg_test_executor;
+    hg_test_executor->thread_pool = hg_test_info->thread_pool;
+    hg_test_executor->key = hg_test_info->executor_key;
+    hg_test_executor->free_works = NULL;
+    hg_thread_mutex_init(&hg_test_executor->free_works_mutex);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_test_executor_destroy(struct hg_test_executor *hg_test_executor)
+{
+    while (hg_test_executor->free_works) {
+        struct hg_test_executor_work *hg_test_executor_work =
+            hg_test_executor->free_works;
+
+        hg_test_executor->free_works = hg_test_executor_work->next;
+        free(hg_test_executor_work);
+    }
+    hg_thread_mutex_destroy(&hg_test_executor->free_works_mutex);
+}
 #endif
 
 /*---------------------------------------------------------------------------*/
@@ -243,8 +370,9 @@ hg_test_finalize_cb(hg_handle_t handle)
             HG_Get_info(handle)->context);
     hg_return_t ret = HG_SUCCESS;
 
-    /* Set finalize for context data */
-    hg_atomic_set32(&hg_test_context_info->finalizing, 1);
+    /* Set finalize for context data (count requests for servers that
+     * share context data among multiple contexts) */
+    hg_atomic_incr32(&hg_test_context_info->finalizing);
 
     /* Free handle and send response back */
     ret = HG_Respond(handle, NULL, NULL, NULL);
@@ -278,12 +406,48 @@ hg_test_register(hg_class_t *hg_class)
     HG_Registered_disable_response(hg_class, hg_test_rpc_open_id_no_resp_g,
         HG_TRUE);
 
+    /* Same callback, the second RPC gets its own executor in HG_Test_init() */
+    hg_test_executor_id_g = MERCURY_REGISTER(hg_class, "hg_test_executor",
+            void, rpc_open_out_t, hg_test_executor_cb);
+    hg_test_executor_rpc_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_executor_rpc", void, rpc_open_out_t, hg_test_executor_cb);
+
     /* test_bulk */
     hg_test_bulk_write_id_g = MERCURY_REGISTER(hg_class, "hg_test_bulk_write",
             bulk_write_in_t, bulk_write_out_t, hg_test_bulk_write_cb);
     hg_test_bulk_bind_write_id_g = MERCURY_REGISTER(hg_class,
         "hg_test_bulk_bind_write", bulk_write_in_t, bulk_bind_write_out_t,
         hg_test_bulk_bind_write_cb);
+    hg_test_bulk_push_id_g = MERCURY_REGISTER(hg_class, "hg_test_bulk_push",
+            bulk_write_in_t, bulk_write_out_t, hg_test_bulk_push_cb);
+
+    /* test_pipeline */
+    hg_test_pipeline_write_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_pipeline_write", bulk_write_in_t, bulk_write_out_t,
+            hg_test_pipeline_write_cb);
+
+    /* test_gather */
+    hg_test_gather_write_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_gather_write", bulk_write_in_t, bulk_write_out_t,
+            hg_test_gather_write_cb);
+
+    /* test_atomic */
+    hg_test_atomic_handle_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_atomic_handle", bulk_atomic_incr_t,
+            bulk_bind_write_out_t, hg_test_atomic_handle_cb);
+    hg_test_atomic_incr_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_atomic_incr", bulk_atomic_incr_t, bulk_atomic_incr_t,
+            hg_test_atomic_incr_cb);
+
+    /* test_channel */
+    hg_test_channel_open_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_channel_open", channel_open_in_t, bulk_bind_write_out_t,
+            hg_test_channel_open_cb);
+    hg_test_channel_drain_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_channel_drain", bulk_atomic_incr_t, channel_drain_out_t,
+            hg_test_channel_drain_cb);
+    hg_test_channel_close_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_channel_close", void, void, hg_test_channel_close_cb);
 
 #ifndef _WIN32
     /* test_posix */
@@ -313,6 +477,30 @@ hg_test_register(hg_class_t *hg_class)
     /* test_overflow */
     hg_test_overflow_id_g = MERCURY_REGISTER(hg_class, "hg_test_overflow",
             void, overflow_out_t, hg_test_overflow_cb);
+    hg_test_overflow_codec_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_overflow_codec", void, overflow_out_t,
+            hg_test_overflow_cb);
+    hg_test_overflow_input_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_overflow_input", overflow_out_t, rpc_open_out_t,
+            hg_test_overflow_input_cb);
+    hg_test_overflow_fail_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_overflow_fail", void, overflow_out_t,
+            hg_test_overflow_cb);
+    hg_test_overflow_input_fail_id_g = MERCURY_REGISTER(hg_class,
+            "hg_test_overflow_input_fail", overflow_out_t, rpc_open_out_t,
+            hg_test_overflow_input_cb);
+
+    /* Payloads are compressed by the sender (origin input, target output) */
+    HG_Register_codec(hg_class, HG_TEST_CODEC_COUNT, &hg_test_codec_count_g);
+    HG_Register_codec(hg_class, HG_TEST_CODEC_FAIL, &hg_test_codec_fail_g);
+    HG_Registered_set_codec(hg_class, hg_test_overflow_codec_id_g,
+        HG_TEST_CODEC_COUNT, 0);
+    HG_Registered_set_codec(hg_class, hg_test_overflow_input_id_g,
+        HG_TEST_CODEC_COUNT, 0);
+    HG_Registered_set_codec(hg_class, hg_test_overflow_fail_id_g,
+        HG_TEST_CODEC_FAIL, 0);
+    HG_Registered_set_codec(hg_class, hg_test_overflow_input_fail_id_g,
+        HG_TEST_CODEC_FAIL, 0);
 
     /* test_cancel */
     hg_test_cancel_rpc_id_g = MERCURY_REGISTER(hg_class, "hg_test_cancel_rpc",
@@ -384,9 +572,53 @@ HG_Test_init(int argc, char *argv[], struct hg_test_info *hg_test_info)
     if (hg_test_info->auto_sm)
         hg_init_info.auto_sm = HG_TRUE;
 
+    /* Set inline self mode */
+    if (hg_test_info->self_inline)
+        hg_init_info.self_inline = HG_TRUE;
+
+    /* Lookup cache (set by tests before init) */
+    hg_init_info.addr_cache_size = hg_test_info->addr_cache_size;
+
+    /* Local copy engine */
+    hg_init_info.copy_threads = hg_test_info->copy_threads;
+    hg_init_info.copy_nt_size = hg_test_info->copy_nt_size;
+
+    /* Rails used to stripe bulk transfers */
+    hg_init_info.rail_count = hg_test_info->rail_count;
+    hg_init_info.rail_chunk_size = hg_test_info->rail_chunk_size;
+
     /* Assign NA class */
     hg_init_info.na_class = hg_test_info->na_test_info.na_class;
 
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    if (hg_test_info->na_test_info.listen
+        || hg_test_info->na_test_info.self_send) {
+        /* Make sure that thread count is at least max_contexts and that one
+         * thread is left to the per-RPC executor */
+        if (hg_test_info->thread_count <
+            (unsigned int) hg_test_info->na_test_info.max_contexts + 1)
+            hg_test_info->thread_count =
+                (unsigned int) hg_test_info->na_test_info.max_contexts + 1;
+
+        /* Create thread pool */
+        hg_thread_pool_init(hg_test_info->thread_count,
+            &hg_test_info->thread_pool);
+        printf("# Starting server with %d threads...\n",
+            hg_test_info->thread_count);
+
+        /* Executors running RPC callbacks from the thread pool */
+        hg_thread_key_create(&hg_test_info->executor_key);
+        hg_test_executor_init(&hg_test_info->class_executor, hg_test_info);
+        hg_test_executor_init(&hg_test_info->rpc_executor, hg_test_info);
+
+        /* RPC callbacks run from the progress thread of each context when
+         * there are secondary contexts, otherwise from the thread pool */
+        if (!(hg_test_info->na_test_info.listen
+            && hg_test_info->na_test_info.max_contexts > 1))
+            hg_init_info.executor = hg_test_info->class_executor.executor;
+    }
+#endif
+
     /* Init HG with init options */
     hg_test_info->hg_class = HG_Init_opt(NULL,
         hg_test_info->na_test_info.listen, &hg_init_info);
@@ -404,16 +636,6 @@ HG_Test_init(int argc, char *argv[], struct hg_test_info *hg_test_info)
         goto done;
     }
 
-#ifdef MERCURY_TESTING_HAS_THREAD_POOL
-    /* Attach handle created */
-    ret = HG_Class_set_handle_create_callback(hg_test_info->hg_class,
-        hg_test_handle_create_cb, hg_test_info->hg_class);
-    if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not set HG handle create callback");
-        goto done;
-    }
-#endif
-
     /* Set header */
     /*
     HG_Class_set_input_offset(hg_test_info->hg_class, sizeof(hg_uint64_t));
@@ -454,17 +676,13 @@ HG_Test_init(int argc, char *argv[], struct hg_test_info *hg_test_info)
         size_t i;
 
 #ifdef MERCURY_TESTING_HAS_THREAD_POOL
-        /* Make sure that thread count is at least max_contexts */
-        if (hg_test_info->thread_count <
-            hg_test_info->na_test_info.max_contexts)
-            hg_test_info->thread_count =
-                hg_test_info->na_test_info.max_contexts;
-
-        /* Create thread pool */
-        hg_thread_pool_init(hg_test_info->thread_count,
-            &hg_test_info->thread_pool);
-        printf("# Starting server with %d threads...\n",
-            hg_test_info->thread_count);
+        /* Per-RPC executor overrides the class executor */
+        ret = HG_Registered_set_executor(hg_test_info->hg_class,
+            hg_test_executor_rpc_id_g, &hg_test_info->rpc_executor.executor);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not set RPC executor");
+            goto done;
+        }
 
         /* Create bulk handle mutex */
         hg_thread_mutex_init(&hg_test_info->bulk_handle_mutex);
@@ -639,6 +857,9 @@ HG_Test_finalize(struct hg_test_info *hg_test_info)
         || hg_test_info->na_test_info.self_send) {
 #ifdef MERCURY_TESTING_HAS_THREAD_POOL
         hg_thread_pool_destroy(hg_test_info->thread_pool);
+        hg_test_executor_destroy(&hg_test_info->class_executor);
+        hg_test_executor_destroy(&hg_test_info->rpc_executor);
+        hg_thread_key_delete(hg_test_info->executor_key);
         hg_thread_mutex_destroy(&hg_test_info->bulk_handle_mutex);
 #endif
         /* Destroy bulk handle */
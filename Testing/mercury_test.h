@@ -17,6 +17,7 @@
 #ifdef MERCURY_TESTING_HAS_THREAD_POOL
 # include "mercury_thread_pool.h"
 # include "mercury_thread_mutex.h"
+# include "mercury_thread.h"
 #endif
 #include "mercury_atomic.h"
 
@@ -35,6 +36,18 @@
 /* Public Type and Struct Definition */
 /*************************************/
 
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+/* Executor posting RPC callbacks to the test thread pool */
+struct hg_test_executor_work;
+struct hg_test_executor {
+    struct hg_executor executor;
+    hg_thread_pool_t *thread_pool;
+    hg_thread_key_t key;        /* Set to executor while callback runs */
+    struct hg_test_executor_work *free_works;   /* Reusable work items */
+    hg_thread_mutex_t free_works_mutex;
+};
+#endif
+
 struct hg_test_info {
     hg_class_t *hg_class;
     hg_context_t *context;
@@ -49,11 +62,20 @@ struct hg_test_info {
     uint32_t cookie;
 #endif
     hg_bool_t auto_sm;
+    hg_bool_t self_inline;
     struct na_test_info na_test_info;
     unsigned int thread_count;
+    unsigned int addr_cache_size;
+    unsigned int copy_threads;
+    hg_size_t copy_nt_size;
+    unsigned int rail_count;
+    hg_size_t rail_chunk_size;
 #ifdef MERCURY_TESTING_HAS_THREAD_POOL
     hg_thread_pool_t *thread_pool;
     hg_thread_mutex_t bulk_handle_mutex;
+    hg_thread_key_t executor_key;
+    struct hg_test_executor class_executor;
+    struct hg_test_executor rpc_executor;
 #endif
     hg_bulk_t bulk_handle;
 };
@@ -96,6 +118,11 @@ struct hg_test_context_info {
 
 #define MERCURY_TESTING_NUM_THREADS_DEFAULT 8
 
+/* Executor that ran the callback of hg_test_executor RPCs */
+#define HG_TEST_EXECUTOR_TRIGGER    0   /* From HG_Trigger() */
+#define HG_TEST_EXECUTOR_CLASS      1   /* Class executor */
+#define HG_TEST_EXECUTOR_RPC        2   /* Per-RPC executor */
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -17,7 +17,7 @@
 
 int na_test_opt_ind_g = 1; /* token pointer */
 const char *na_test_opt_arg_g = NULL; /* flag argument (or value) */
-const char *na_test_short_opt_g = "hc:d:p:H:LsSak:l:t:bmC:V";
+const char *na_test_short_opt_g = "hc:d:p:H:LsSak:l:t:bmiC:Vx:X:R:Z:";
 const struct na_test_opt na_test_opt_g[] = {
     { "help", no_arg, 'h'},
     { "comm", require_arg, 'c' },
@@ -33,8 +33,13 @@ const struct na_test_opt na_test_opt_g[] = {
     { "threads", require_arg, 't'},
     { "busy", no_arg, 'b'},
     { "memory", no_arg, 'm'},
+    { "inline", no_arg, 'i'},
     { "contexts", require_arg, 'C'},
     { "verbose", no_arg, 'V' },
+    { "copy_threads", require_arg, 'x' },
+    { "copy_nt_size", require_arg, 'X' },
+    { "rails", require_arg, 'R' },
+    { "rail_chunk_size", require_arg, 'Z' },
     { NULL, 0, '\0' } /* Must add this at the end */
 };
 
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "mercury_addr_book.h"
+
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Restart test: a client HG class is initialized, sends its first RPC and is
+ * finalized, once by looking up the target and recording it in an address
+ * book, then again (restart) by restoring the target from the address book.
+ * Time-to-first-RPC includes HG init, --loop sets number of restarts */
+
+#define HG_TEST_ADDR_BOOK_PATH  "hg_test_addr_book.map"
+#define HG_TEST_ADDR_BOOK_MAX   16
+#define NDIGITS 9
+#define NWIDTH 13
+
+struct hg_test_addr_book_arg {
+    hg_bool_t completed;
+    hg_addr_t addr;
+    hg_return_t ret;
+};
+
+static hg_return_t
+hg_test_addr_book_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_test_addr_book_arg *arg =
+        (struct hg_test_addr_book_arg *) callback_info->arg;
+
+    arg->ret = callback_info->ret;
+    if (callback_info->type == HG_CB_LOOKUP)
+        arg->addr = callback_info->info.lookup.addr;
+    arg->completed = HG_TRUE;
+
+    return HG_SUCCESS;
+}
+
+/**
+ *
+ */
+static hg_return_t
+hg_test_addr_book_wait(hg_context_t *context,
+    struct hg_test_addr_book_arg *arg)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    do {
+        unsigned int actual_count = 0;
+
+        do {
+            ret = HG_Trigger(context, 0, 1, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count && !arg->completed);
+
+        if (arg->completed)
+            break;
+
+        ret = HG_Progress(context, HG_MAX_IDLE_TIME);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+
+    return arg->completed ? arg->ret : ret;
+}
+
+/**
+ * Initialize new class, resolve target (from address book if restore is set,
+ * otherwise through lookup, in which case it is recorded) and send one RPC.
+ */
+static hg_return_t
+hg_test_addr_book_run(const char *info_string, const char *target_name,
+    hg_bool_t restore, double *time)
+{
+    hg_class_t *hg_class = NULL;
+    hg_context_t *context = NULL;
+    hg_addr_book_t *addr_book = NULL;
+    hg_addr_t target_addr = HG_ADDR_NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    struct hg_test_addr_book_arg arg = { HG_FALSE, HG_ADDR_NULL, HG_SUCCESS };
+    hg_id_t rpc_id;
+    hg_time_t t1, t2;
+    hg_return_t ret;
+
+    hg_time_get_current(&t1);
+
+    hg_class = HG_Init(info_string, HG_FALSE);
+    if (!hg_class) {
+        fprintf(stderr, "Could not initialize HG\n");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    context = HG_Context_create(hg_class);
+    if (!context) {
+        fprintf(stderr, "Could not create HG context\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    rpc_id = MERCURY_REGISTER(hg_class, "hg_test_perf_rpc", void, void, NULL);
+
+    ret = HG_Addr_book_open(hg_class, HG_TEST_ADDR_BOOK_PATH,
+        HG_TEST_ADDR_BOOK_MAX, &addr_book);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not open address book\n");
+        goto done;
+    }
+
+    if (restore) {
+        if (HG_Addr_book_get_count(addr_book) != 1) {
+            fprintf(stderr, "Unexpected address book count\n");
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+        ret = HG_Addr_book_restore(addr_book, context, &target_addr);
+        if (ret != HG_SUCCESS || target_addr == HG_ADDR_NULL) {
+            fprintf(stderr, "Could not restore target address\n");
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+    } else {
+        ret = HG_Addr_lookup(context, hg_test_addr_book_cb, &arg, target_name,
+            HG_OP_ID_IGNORE);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not start lookup\n");
+            goto done;
+        }
+        ret = hg_test_addr_book_wait(context, &arg);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not lookup target\n");
+            goto done;
+        }
+        target_addr = arg.addr;
+    }
+
+    ret = HG_Create(context, target_addr, rpc_id, &handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not create handle\n");
+        goto done;
+    }
+    arg.completed = HG_FALSE;
+    ret = HG_Forward(handle, hg_test_addr_book_cb, &arg, NULL);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not forward call\n");
+        goto done;
+    }
+    ret = hg_test_addr_book_wait(context, &arg);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not complete call\n");
+        goto done;
+    }
+
+    hg_time_get_current(&t2);
+    *time = hg_time_to_double(hg_time_subtract(t2, t1));
+
+    /* Record target for next restart */
+    if (!restore) {
+        ret = HG_Addr_book_record(addr_book, target_name, target_addr);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not record target address\n");
+            goto done;
+        }
+    }
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    if (target_addr != HG_ADDR_NULL)
+        HG_Addr_free(hg_class, target_addr);
+    if (HG_Addr_book_close(addr_book) != HG_SUCCESS)
+        ret = HG_OTHER_ERROR;
+    if (context && HG_Context_destroy(context) != HG_SUCCESS)
+        ret = HG_OTHER_ERROR;
+    if (hg_class && HG_Finalize(hg_class) != HG_SUCCESS)
+        ret = HG_OTHER_ERROR;
+
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    char info_string[NA_TEST_MAX_ADDR_NAME];
+    double lookup_time = 0, restore_time = 0, td;
+    int i, ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    sprintf(info_string, "%s+%s", HG_Class_get_name(hg_test_info.hg_class),
+        HG_Class_get_protocol(hg_test_info.hg_class));
+    remove(HG_TEST_ADDR_BOOK_PATH);
+
+    printf("###############################################################################\n");
+    printf("# Address book restart test -- %d restart(s)\n",
+        hg_test_info.na_test_info.loop);
+    printf("###############################################################################\n");
+
+    /* Cold start (lookup and record) */
+    if (hg_test_addr_book_run(info_string,
+        hg_test_info.na_test_info.target_name, HG_FALSE, &lookup_time)
+        != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* Restarts (restore) */
+    for (i = 0; i < hg_test_info.na_test_info.loop; i++) {
+        if (hg_test_addr_book_run(info_string,
+            hg_test_info.na_test_info.target_name, HG_TRUE, &td)
+            != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+        restore_time += td;
+    }
+    restore_time /= hg_test_info.na_test_info.loop;
+
+    printf("%*s%*s\n", NWIDTH, "# Lookup (s)", NWIDTH, "Restore (s)");
+    printf("%*.*f%*.*f\n", NWIDTH, NDIGITS, lookup_time, NWIDTH, NDIGITS,
+        restore_time);
+
+done:
+    remove(HG_TEST_ADDR_BOOK_PATH);
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
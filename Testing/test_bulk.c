@@ -9,12 +9,21 @@
  */
 
 #include "mercury_test.h"
+#include "mercury_channel.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
 extern hg_id_t hg_test_bulk_write_id_g;
 extern hg_id_t hg_test_bulk_bind_write_id_g;
+extern hg_id_t hg_test_bulk_push_id_g;
+extern hg_id_t hg_test_pipeline_write_id_g;
+extern hg_id_t hg_test_gather_write_id_g;
+extern hg_id_t hg_test_atomic_handle_id_g;
+extern hg_id_t hg_test_atomic_incr_id_g;
+extern hg_id_t hg_test_channel_open_id_g;
+extern hg_id_t hg_test_channel_drain_id_g;
+extern hg_id_t hg_test_channel_close_id_g;
 
 #define BUFSIZE (MERCURY_TESTING_BUFFER_SIZE * 1024 * 1024)
 
@@ -24,6 +33,12 @@ struct forward_cb_args {
     hg_return_t ret;
 };
 
+struct atomic_cb_args {
+    hg_request_t *request;
+    hg_atomic_int32_t remaining;
+    hg_return_t ret;
+};
+
 //#define HG_TEST_DEBUG
 #ifdef HG_TEST_DEBUG
 #define HG_TEST_LOG_DEBUG(...)                                \
@@ -47,6 +62,7 @@ hg_test_bulk_forward_cb(const struct hg_cb_info *callback_info)
 
     if (callback_info->ret != HG_SUCCESS) {
         HG_TEST_LOG_ERROR("Return from callback info is not HG_SUCCESS");
+        args->ret = callback_info->ret;
         goto done;
     }
 
@@ -89,6 +105,7 @@ hg_test_bulk_bind_forward_cb(const struct hg_cb_info *callback_info)
 
     if (callback_info->ret != HG_SUCCESS) {
         HG_TEST_LOG_ERROR("Return from callback info is not HG_SUCCESS");
+        args->ret = callback_info->ret;
         goto done;
     }
 
@@ -119,6 +136,126 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+/**
+ * Callback returning status of operation
+ */
+static hg_return_t
+hg_test_bulk_ret_cb(const struct hg_cb_info *callback_info)
+{
+    struct forward_cb_args *args = (struct forward_cb_args *) callback_info->arg;
+
+    args->ret = callback_info->ret;
+    hg_request_complete(args->request);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+/**
+ * Forward RPC and wait for its response, output can then be retrieved from
+ * handle, which must be destroyed by caller.
+ */
+static hg_return_t
+hg_test_bulk_call(hg_context_t *context, hg_request_class_t *request_class,
+    hg_addr_t target_addr, hg_id_t rpc_id, void *in_struct,
+    hg_handle_t *handle_ptr)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    struct forward_cb_args forward_cb_args;
+    hg_return_t ret = HG_SUCCESS;
+
+    request = hg_request_create(request_class);
+    if (!request) {
+        HG_TEST_LOG_ERROR("Could not create request");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    ret = HG_Create(context, target_addr, rpc_id, &handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create handle");
+        goto done;
+    }
+
+    /* Forward call to remote addr and wait for response */
+    HG_TEST_LOG_DEBUG("Forwarding call with op id: %u...", rpc_id);
+    forward_cb_args.request = request;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(handle, hg_test_bulk_ret_cb, &forward_cb_args, in_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not forward call");
+        goto done;
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    /* Assign ret from CB */
+    ret = forward_cb_args.ret;
+    if (ret != HG_SUCCESS)
+        HG_TEST_LOG_ERROR("Return from callback info is not HG_SUCCESS");
+
+done:
+    if (ret != HG_SUCCESS && handle != HG_HANDLE_NULL) {
+        HG_Destroy(handle);
+        handle = HG_HANDLE_NULL;
+    }
+    *handle_ptr = handle;
+    if (request)
+        hg_request_destroy(request);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+/**
+ * Forward bulk write RPC with bulk handle and check the number of bytes that
+ * target reports having transferred.
+ */
+static hg_return_t
+hg_test_bulk_forward(hg_context_t *context, hg_request_class_t *request_class,
+    hg_addr_t target_addr, hg_id_t rpc_id, hg_bulk_t bulk_handle,
+    hg_int32_t fildes, hg_size_t transfer_size, hg_size_t origin_offset,
+    hg_size_t target_offset, hg_size_t expected_bytes)
+{
+    hg_handle_t handle = HG_HANDLE_NULL;
+    bulk_write_in_t bulk_write_in_struct;
+    bulk_write_out_t bulk_write_out_struct;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Fill input structure */
+    bulk_write_in_struct.fildes = fildes;
+    bulk_write_in_struct.transfer_size = transfer_size;
+    bulk_write_in_struct.origin_offset = origin_offset;
+    bulk_write_in_struct.target_offset = target_offset;
+    bulk_write_in_struct.bulk_handle = bulk_handle;
+    HG_TEST_LOG_DEBUG("Requesting transfer_size=%zu, origin_offset=%zu, "
+        "target_offset=%zu", bulk_write_in_struct.transfer_size,
+        bulk_write_in_struct.origin_offset, bulk_write_in_struct.target_offset);
+
+    ret = hg_test_bulk_call(context, request_class, target_addr, rpc_id,
+        &bulk_write_in_struct, &handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    /* Get output, data pushed to handle is copied back at this point */
+    ret = HG_Get_output(handle, &bulk_write_out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+    if (bulk_write_out_struct.ret != expected_bytes) {
+        HG_TEST_LOG_ERROR("Returned: %zu bytes, was expecting %zu",
+            (size_t) bulk_write_out_struct.ret, (size_t) expected_bytes);
+        ret = HG_SIZE_ERROR;
+    }
+    HG_Free_output(handle, &bulk_write_out_struct);
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_bulk_contig(hg_class_t *hg_class, hg_context_t *context,
@@ -240,16 +377,14 @@ static hg_return_t
 hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
     hg_request_class_t *request_class, hg_addr_t target_addr,
     hg_size_t transfer_size, hg_size_t origin_offset, hg_size_t target_offset,
-    hg_uint32_t origin_segment_count)
+    hg_uint32_t origin_segment_count, hg_size_t checksum_block_size,
+    hg_bool_t contiguous)
 {
-    hg_request_t *request = NULL;
-    hg_handle_t handle;
     hg_bulk_t bulk_handle = HG_BULK_NULL;
     hg_return_t ret = HG_SUCCESS;
-    struct forward_cb_args forward_cb_args;
-    bulk_write_in_t bulk_write_in_struct;
-    void **buf_ptrs;
-    hg_size_t *buf_sizes;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    char *bulk_buf = NULL;
     hg_size_t bulk_size = BUFSIZE;
     size_t i;
 
@@ -259,27 +394,23 @@ hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
         goto done;
     }
 
-    /* Prepare bulk_buf */
+    /* Prepare bulk_buf, contiguous segments are carved from a single buffer
+     * and registered as one region */
     buf_ptrs = (void **) malloc(origin_segment_count * sizeof(void *));
     buf_sizes = (hg_size_t *) malloc(origin_segment_count * sizeof(hg_size_t));
+    if (contiguous)
+        bulk_buf = (char *) malloc(bulk_size);
     for (i = 0; i < origin_segment_count; i++) {
         hg_size_t j;
 
         buf_sizes[i] = bulk_size / origin_segment_count;
-        buf_ptrs[i] = malloc(buf_sizes[i]);
+        buf_ptrs[i] = (contiguous) ? bulk_buf + i * buf_sizes[i] :
+            malloc(buf_sizes[i]);
         for (j = 0; j < buf_sizes[i]; j++) {
             ((char **) buf_ptrs)[i][j] = (char) (i * buf_sizes[i] + j);
         }
     }
 
-    request = hg_request_create(request_class);
-
-    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
-    if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not create handle");
-        goto done;
-    }
-
     /* Register memory */
     ret = HG_Bulk_create(hg_class, origin_segment_count, buf_ptrs,
         buf_sizes, HG_BULK_READ_ONLY, &bulk_handle);
@@ -288,57 +419,165 @@ hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
         goto done;
     }
 
-    /* Fill input structure */
-    bulk_write_in_struct.fildes = 0;
-    bulk_write_in_struct.transfer_size = transfer_size;
-    bulk_write_in_struct.origin_offset = origin_offset;
-    bulk_write_in_struct.target_offset = target_offset;
-    bulk_write_in_struct.bulk_handle = bulk_handle;
-    HG_TEST_LOG_DEBUG("Requesting transfer_size=%zu, origin_offset=%zu, "
-        "target_offset=%zu", bulk_write_in_struct.transfer_size,
-        bulk_write_in_struct.origin_offset, bulk_write_in_struct.target_offset);
+    /* Target verifies data against checksums sent along with handle */
+    if (checksum_block_size) {
+        ret = HG_Bulk_set_checksum(bulk_handle, checksum_block_size);
+        if (ret != HG_SUCCESS) {
+            HG_TEST_LOG_ERROR("Could not set bulk checksum");
+            goto done;
+        }
+    }
 
-    /* Forward call to remote addr and get a new request */
-    HG_TEST_LOG_DEBUG("Forwarding call with op id: %u...",
-        hg_test_bulk_write_id_g);
-    forward_cb_args.request = request;
-    forward_cb_args.expected_bytes = transfer_size;
-    forward_cb_args.ret = HG_SUCCESS;
-    ret = HG_Forward(handle, hg_test_bulk_forward_cb, &forward_cb_args,
-            &bulk_write_in_struct);
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_bulk_write_id_g, bulk_handle, 0, transfer_size, origin_offset,
+        target_offset, transfer_size);
+
+done:
+    HG_Bulk_free(bulk_handle);
+    for (i = 0; buf_ptrs && i < origin_segment_count && !contiguous; i++)
+        free(buf_ptrs[i]);
+    free(bulk_buf);
+    free(buf_ptrs);
+    free(buf_sizes);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_strided(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t block_size, hg_size_t stride, hg_uint32_t block_count,
+    hg_size_t transfer_size, hg_size_t origin_offset)
+{
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS;
+    char *bulk_buf = NULL;
+    hg_size_t i;
+
+    if (origin_offset + transfer_size > block_size * block_count) {
+        HG_LOG_ERROR("Exceeding bulk size");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    /* Prepare bulk_buf, gaps between blocks are not transferred and blocks
+     * contain consecutive values */
+    bulk_buf = malloc(stride * block_count);
+    memset(bulk_buf, 0, stride * block_count);
+    for (i = 0; i < block_size * block_count; i++)
+        bulk_buf[(i / block_size) * stride + i % block_size] = (char) i;
+
+    /* Register memory */
+    ret = HG_Bulk_create_strided(hg_class, bulk_buf, block_size, stride,
+        block_count, HG_BULK_READ_ONLY, &bulk_handle);
     if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not forward call");
+        HG_TEST_LOG_ERROR("Could not create strided bulk handle");
+        goto done;
+    }
+    if (HG_Bulk_get_size(bulk_handle) != block_size * block_count
+        || HG_Bulk_get_segment_count(bulk_handle) != block_count) {
+        HG_TEST_LOG_ERROR("Unexpected strided bulk handle size");
+        ret = HG_OTHER_ERROR;
         goto done;
     }
 
-    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_bulk_write_id_g, bulk_handle, 0, transfer_size, origin_offset,
+        0, transfer_size);
 
-    /* Free memory handle */
-    ret = HG_Bulk_free(bulk_handle);
+done:
+    HG_Bulk_free(bulk_handle);
+    free(bulk_buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_view(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t transfer_size, hg_size_t origin_offset, hg_size_t view_offset,
+    hg_size_t view_size, hg_uint32_t segment_count, hg_size_t stride)
+{
+    hg_bulk_t bulk_handle = HG_BULK_NULL, view_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    char *bulk_buf = NULL;
+    hg_size_t segment_size = BUFSIZE / segment_count;
+    size_t i;
+
+    if (view_offset + view_size > BUFSIZE
+        || origin_offset + transfer_size > view_size) {
+        HG_LOG_ERROR("Exceeding bulk size");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    /* Prepare bulk_buf, segments are either separate buffers (stride of 0)
+     * or carved from a single buffer, views start with value 0 */
+    buf_ptrs = (void **) malloc(segment_count * sizeof(void *));
+    buf_sizes = (hg_size_t *) malloc(segment_count * sizeof(hg_size_t));
+    if (stride)
+        bulk_buf = (char *) malloc(segment_count * stride);
+    for (i = 0; i < segment_count; i++) {
+        hg_size_t j;
+
+        buf_sizes[i] = segment_size;
+        buf_ptrs[i] = (stride) ? bulk_buf + i * stride :
+            malloc(segment_size);
+        for (j = 0; j < segment_size; j++) {
+            ((char **) buf_ptrs)[i][j] =
+                (char) (i * segment_size + j - view_offset);
+        }
+    }
+
+    /* Register memory once */
+    if (stride > segment_size)
+        ret = HG_Bulk_create_strided(hg_class, bulk_buf, segment_size, stride,
+            segment_count, HG_BULK_READWRITE, &bulk_handle);
+    else
+        ret = HG_Bulk_create(hg_class, segment_count, buf_ptrs, buf_sizes,
+            HG_BULK_READWRITE, &bulk_handle);
     if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not destroy bulk handle");
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
         goto done;
     }
 
-    /* Complete */
-    ret = HG_Destroy(handle);
+    /* Expose read-only slice */
+    ret = HG_Bulk_view(bulk_handle, view_offset, view_size, HG_BULK_READ_ONLY,
+        &view_handle);
     if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not destroy handle");
+        HG_TEST_LOG_ERROR("Could not create view of bulk handle");
+        goto done;
+    }
+    if (HG_Bulk_get_size(view_handle) != view_size
+        || HG_Bulk_get_serialize_size(view_handle, HG_FALSE)
+            > HG_Bulk_get_serialize_size(bulk_handle, HG_FALSE)) {
+        HG_TEST_LOG_ERROR("Unexpected view size");
+        ret = HG_OTHER_ERROR;
         goto done;
     }
 
-    hg_request_destroy(request);
+    /* View keeps a reference to the handle */
+    ret = HG_Bulk_free(bulk_handle);
+    bulk_handle = HG_BULK_NULL;
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not destroy bulk handle");
+        goto done;
+    }
 
-    /* Free bulk data */
-    for (i = 0; i < origin_segment_count; i++)
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_bulk_write_id_g, view_handle, 0, transfer_size, origin_offset,
+        0, transfer_size);
+
+done:
+    HG_Bulk_free(view_handle);
+    HG_Bulk_free(bulk_handle);
+    for (i = 0; buf_ptrs && i < segment_count && !stride; i++)
         free(buf_ptrs[i]);
+    free(bulk_buf);
     free(buf_ptrs);
     free(buf_sizes);
-
-    /* Assign ret from CB */
-    ret = forward_cb_args.ret;
-
-done:
     return ret;
 }
 
@@ -348,12 +587,8 @@ hg_test_bulk_small(hg_class_t *hg_class, hg_context_t *context,
     hg_request_class_t *request_class, hg_addr_t target_addr,
     hg_size_t transfer_size, hg_size_t origin_offset, hg_size_t target_offset)
 {
-    hg_request_t *request = NULL;
-    hg_handle_t handle;
     hg_bulk_t bulk_handle = HG_BULK_NULL;
     hg_return_t ret = HG_SUCCESS;
-    struct forward_cb_args forward_cb_args;
-    bulk_write_in_t bulk_write_in_struct;
     char data[12];
     void *buf_ptrs[2] = { data, data+8 };
     hg_size_t buf_sizes[2] = { 8, 4 };
@@ -370,14 +605,6 @@ hg_test_bulk_small(hg_class_t *hg_class, hg_context_t *context,
     for (i = 0; i < bulk_size; i++)
         data[i] = (char) i;
 
-    request = hg_request_create(request_class);
-
-    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
-    if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not create handle");
-        goto done;
-    }
-
     /* Register memory */
     ret = HG_Bulk_create(hg_class, 2, buf_ptrs, buf_sizes, HG_BULK_READ_ONLY,
         &bulk_handle);
@@ -386,60 +613,906 @@ hg_test_bulk_small(hg_class_t *hg_class, hg_context_t *context,
         goto done;
     }
 
-    /* Fill input structure */
-    bulk_write_in_struct.fildes = 1;
-    bulk_write_in_struct.transfer_size = transfer_size;
-    bulk_write_in_struct.origin_offset = origin_offset;
-    bulk_write_in_struct.target_offset = target_offset;
-    bulk_write_in_struct.bulk_handle = bulk_handle;
-    HG_TEST_LOG_DEBUG("Requesting transfer_size=%zu, origin_offset=%zu, "
-        "target_offset=%zu", bulk_write_in_struct.transfer_size,
-        bulk_write_in_struct.origin_offset, bulk_write_in_struct.target_offset);
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_bulk_write_id_g, bulk_handle, 1, transfer_size, origin_offset,
+        target_offset, transfer_size);
 
-    /* Forward call to remote addr and get a new request */
-    HG_TEST_LOG_DEBUG("Forwarding call with op id: %u...",
-        hg_test_bulk_write_id_g);
-    forward_cb_args.request = request;
-    forward_cb_args.expected_bytes = transfer_size;
-    forward_cb_args.ret = HG_SUCCESS;
-    ret = HG_Forward(handle, hg_test_bulk_forward_cb, &forward_cb_args,
-            &bulk_write_in_struct);
-    if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not forward call");
+done:
+    HG_Bulk_free(bulk_handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_eager_push(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_uint8_t flags, hg_size_t transfer_size, hg_size_t origin_offset,
+    hg_size_t target_offset)
+{
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS;
+    char data[48];
+    void *buf_ptrs[2] = { data, data+32 };
+    hg_size_t buf_sizes[2] = { 32, 16 };
+    hg_size_t bulk_size = 48;
+    size_t i;
+
+    if (origin_offset + transfer_size > bulk_size) {
+        HG_LOG_ERROR("Exceeding bulk size");
+        ret = HG_SIZE_ERROR;
         goto done;
     }
 
-    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+    /* Prepare bulk buf */
+    memset(data, 0, bulk_size);
 
-    /* Free memory handle */
-    ret = HG_Bulk_free(bulk_handle);
+    /* Return pushed data along with the response */
+    HG_Class_set_eager_bulk_size(hg_class, (hg_size_t) -1, bulk_size);
+
+    /* Register memory */
+    ret = HG_Bulk_create(hg_class, 2, buf_ptrs, buf_sizes, flags,
+        &bulk_handle);
     if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not destroy bulk handle");
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
         goto done;
     }
 
-    /* Complete */
-    ret = HG_Destroy(handle);
-    if (ret != HG_SUCCESS) {
-        HG_TEST_LOG_ERROR("Could not destroy handle");
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_bulk_push_id_g, bulk_handle, 1, transfer_size, origin_offset,
+        target_offset, transfer_size);
+    if (ret != HG_SUCCESS)
         goto done;
-    }
 
-    hg_request_destroy(request);
+    /* Check bulk buf, pushed data was copied by HG_Get_output() */
+    for (i = 0; i < bulk_size; i++) {
+        char expected = (i >= origin_offset && i < origin_offset + transfer_size)
+            ? (char) (i - origin_offset + target_offset) : 0;
 
-    /* Assign ret from CB */
-    ret = forward_cb_args.ret;
+        if (data[i] != expected) {
+            HG_TEST_LOG_ERROR("Error detected in bulk push, buf[%zu] = %d, "
+                "was expecting %d!", i, data[i], expected);
+            ret = HG_PROTOCOL_ERROR;
+            break;
+        }
+    }
 
 done:
+    HG_Bulk_free(bulk_handle);
+    HG_Class_set_eager_bulk_size(hg_class, (hg_size_t) -1, 0);
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-int main(int argc, char *argv[])
+static hg_return_t
+hg_test_bulk_cache(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    unsigned int cache_size, unsigned int handle_count)
 {
-    struct hg_test_info hg_test_info = { 0 };
-    hg_return_t hg_ret;
-    int ret = EXIT_SUCCESS;
+    hg_bulk_t bulk_handles[4] = { HG_BULK_NULL, HG_BULK_NULL, HG_BULK_NULL,
+        HG_BULK_NULL };
+    hg_return_t ret = HG_SUCCESS;
+    char *bulk_buf = NULL;
+    void *buf_ptr;
+    hg_size_t bulk_size = BUFSIZE / 4;
+    size_t i;
+
+    if (handle_count > 4) {
+        HG_LOG_ERROR("Exceeding handle count");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = HG_Bulk_cache_set_size(hg_class, cache_size);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not set registration cache size");
+        goto done;
+    }
+
+    /* Prepare bulk_buf */
+    bulk_buf = malloc(bulk_size);
+    for (i = 0; i < bulk_size; i++)
+        bulk_buf[i] = (char) i;
+    buf_ptr = bulk_buf;
+
+    /* Register same memory multiple times, handles share cached
+     * registration */
+    for (i = 0; i < handle_count; i++) {
+        ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &bulk_size,
+            HG_BULK_READ_ONLY, &bulk_handles[i]);
+        if (ret != HG_SUCCESS) {
+            HG_TEST_LOG_ERROR("Could not create bulk handle");
+            goto done;
+        }
+    }
+
+    /* Release first handle, registration must remain valid for others */
+    ret = HG_Bulk_free(bulk_handles[0]);
+    bulk_handles[0] = HG_BULK_NULL;
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not destroy bulk handle");
+        goto done;
+    }
+
+    for (i = 1; i < handle_count; i++) {
+        ret = hg_test_bulk_forward(context, request_class, target_addr,
+            hg_test_bulk_write_id_g, bulk_handles[i], 0, bulk_size, 0, 0,
+            bulk_size);
+        if (ret != HG_SUCCESS)
+            goto done;
+    }
+
+done:
+    for (i = 0; i < 4; i++)
+        HG_Bulk_free(bulk_handles[i]);
+    if (bulk_buf) {
+        /* Cached registration must not outlive memory */
+        HG_Bulk_cache_invalidate(hg_class, bulk_buf, bulk_size);
+        free(bulk_buf);
+    }
+    HG_Bulk_cache_set_size(hg_class, 0);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_pipeline(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t bulk_size, hg_size_t chunk_size, unsigned int window)
+{
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS;
+    char *bulk_buf = NULL;
+    void *buf_ptr;
+    size_t i;
+
+    /* Prepare bulk_buf */
+    bulk_buf = malloc(bulk_size);
+    for (i = 0; i < bulk_size; i++)
+        bulk_buf[i] = (char) i;
+    buf_ptr = bulk_buf;
+
+    /* Register memory */
+    ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &bulk_size,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+
+    /* Target pulls data in chunks, keeping window chunks in flight */
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_pipeline_write_id_g, bulk_handle, (hg_int32_t) window,
+        chunk_size, 0, 0, bulk_size);
+
+done:
+    HG_Bulk_free(bulk_handle);
+    free(bulk_buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_gather(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t entry_size, hg_uint32_t count, hg_bool_t multi)
+{
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS;
+    hg_size_t bulk_size = entry_size * count;
+    char *bulk_buf = NULL;
+    void *buf_ptr;
+    size_t i;
+
+    /* Prepare bulk_buf */
+    bulk_buf = malloc(bulk_size);
+    for (i = 0; i < bulk_size; i++)
+        bulk_buf[i] = (char) i;
+    buf_ptr = bulk_buf;
+
+    /* Register memory */
+    ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &bulk_size,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+
+    /* Target gathers count entries of entry_size */
+    ret = hg_test_bulk_forward(context, request_class, target_addr,
+        hg_test_gather_write_id_g, bulk_handle, (hg_int32_t) count,
+        entry_size, 0, multi, bulk_size);
+
+done:
+    HG_Bulk_free(bulk_handle);
+    free(bulk_buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_alloc(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t bulk_size)
+{
+    hg_bulk_t bulk_handles[3] = { HG_BULK_NULL, HG_BULK_NULL, HG_BULK_NULL };
+    void *buf_ptrs[3] = { NULL, NULL, NULL };
+    hg_return_t ret = HG_SUCCESS;
+    void *prev_buf_ptr;
+    size_t i, j;
+
+    /* Allocate consecutive blocks, second block may not start at beginning
+     * of registered arena */
+    for (i = 0; i < 2; i++) {
+        char *bulk_buf;
+
+        ret = HG_Bulk_alloc(hg_class, bulk_size, HG_BULK_READ_ONLY,
+            &buf_ptrs[i], &bulk_handles[i]);
+        if (ret != HG_SUCCESS) {
+            HG_TEST_LOG_ERROR("Could not allocate bulk memory");
+            goto done;
+        }
+        bulk_buf = (char *) buf_ptrs[i];
+        for (j = 0; j < bulk_size; j++)
+            bulk_buf[j] = (char) j;
+    }
+
+    for (i = 0; i < 2; i++) {
+        ret = hg_test_bulk_forward(context, request_class, target_addr,
+            hg_test_bulk_write_id_g, bulk_handles[i], 0, bulk_size, 0, 0,
+            bulk_size);
+        if (ret != HG_SUCCESS)
+            goto done;
+    }
+
+    /* Memory is returned to arena and reused */
+    prev_buf_ptr = buf_ptrs[1];
+    ret = HG_Bulk_free_mem(bulk_handles[1]);
+    bulk_handles[1] = HG_BULK_NULL;
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not free bulk memory");
+        goto done;
+    }
+
+    /* Freed block remains registered, peers writing to it must not affect
+     * the pool */
+    if (bulk_size <= HG_BULK_ARENA_MAX_CLASS_SIZE)
+        memset(prev_buf_ptr, 0xff, bulk_size);
+    ret = HG_Bulk_alloc(hg_class, bulk_size, HG_BULK_READ_ONLY, &buf_ptrs[1],
+        &bulk_handles[1]);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not allocate bulk memory");
+        goto done;
+    }
+    if (bulk_size <= HG_BULK_ARENA_MAX_CLASS_SIZE
+        && buf_ptrs[1] != prev_buf_ptr) {
+        HG_TEST_LOG_ERROR("Memory was not reused");
+        ret = HG_OTHER_ERROR;
+        goto done;
+    }
+
+    /* Pool still hands out other blocks */
+    ret = HG_Bulk_alloc(hg_class, bulk_size, HG_BULK_READ_ONLY, &buf_ptrs[2],
+        &bulk_handles[2]);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not allocate bulk memory");
+        goto done;
+    }
+    if (buf_ptrs[2] == buf_ptrs[0] || buf_ptrs[2] == buf_ptrs[1]) {
+        HG_TEST_LOG_ERROR("Block was allocated twice");
+        ret = HG_OTHER_ERROR;
+        goto done;
+    }
+
+done:
+    for (i = 0; i < 3; i++)
+        HG_Bulk_free_mem(bulk_handles[i]);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_checksum_corrupt(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_size_t checksum_block_size)
+{
+    hg_request_t *request = NULL;
+    hg_addr_t self_addr = HG_ADDR_NULL;
+    hg_bulk_t origin_handle = HG_BULK_NULL, remote_handle = HG_BULK_NULL,
+        local_handle = HG_BULK_NULL;
+    struct forward_cb_args transfer_cb_args;
+    hg_size_t bulk_size = BUFSIZE / 16, serialize_size;
+    char *origin_buf = NULL, *local_buf = NULL, *serialize_buf = NULL;
+    void *buf_ptr;
+    hg_return_t ret = HG_SUCCESS;
+    size_t i;
+
+    origin_buf = malloc(bulk_size);
+    local_buf = malloc(bulk_size);
+    for (i = 0; i < bulk_size; i++)
+        origin_buf[i] = (char) i;
+
+    ret = HG_Addr_self(hg_class, &self_addr);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get self addr");
+        goto done;
+    }
+
+    buf_ptr = origin_buf;
+    ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &bulk_size, HG_BULK_READ_ONLY,
+        &origin_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+    ret = HG_Bulk_set_checksum(origin_handle, checksum_block_size);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not set bulk checksum");
+        goto done;
+    }
+
+    /* Serialize handle (checksums computed) then corrupt origin data */
+    serialize_size = HG_Bulk_get_serialize_size(origin_handle, HG_FALSE);
+    serialize_buf = malloc(serialize_size);
+    ret = HG_Bulk_serialize(serialize_buf, serialize_size, HG_FALSE,
+        origin_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not serialize bulk handle");
+        goto done;
+    }
+    origin_buf[bulk_size / 2] ^= 1;
+
+    ret = HG_Bulk_deserialize(hg_class, &remote_handle, serialize_buf,
+        serialize_size);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not deserialize bulk handle");
+        goto done;
+    }
+
+    buf_ptr = local_buf;
+    ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &bulk_size, HG_BULK_WRITE_ONLY,
+        &local_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+
+    /* Pull data, corruption must be reported */
+    request = hg_request_create(request_class);
+    transfer_cb_args.request = request;
+    transfer_cb_args.expected_bytes = bulk_size;
+    transfer_cb_args.ret = HG_SUCCESS;
+    ret = HG_Bulk_transfer(context, hg_test_bulk_ret_cb,
+        &transfer_cb_args, HG_BULK_PULL, self_addr, remote_handle, 0,
+        local_handle, 0, bulk_size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not transfer bulk data");
+        goto done;
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    if (transfer_cb_args.ret != HG_CHECKSUM_ERROR) {
+        HG_TEST_LOG_ERROR("Corruption was not detected");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+done:
+    if (request)
+        hg_request_destroy(request);
+    HG_Bulk_free(local_handle);
+    HG_Bulk_free(remote_handle);
+    HG_Bulk_free(origin_handle);
+    if (self_addr != HG_ADDR_NULL)
+        HG_Addr_free(hg_class, self_addr);
+    free(serialize_buf);
+    free(local_buf);
+    free(origin_buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_progress(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_uint32_t segment_count,
+    hg_size_t segment_size)
+{
+    hg_request_t *request = NULL;
+    hg_addr_t self_addr = HG_ADDR_NULL;
+    hg_bulk_t origin_handle = HG_BULK_NULL, local_handle = HG_BULK_NULL;
+    hg_op_id_t op_id = HG_OP_ID_NULL;
+    struct forward_cb_args transfer_cb_args;
+    hg_size_t bulk_size = segment_count * segment_size, completed_size = 0;
+    hg_uint32_t outstanding_count = 0;
+    char *origin_buf = NULL, *local_buf = NULL;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    void *buf_ptr;
+    hg_return_t ret = HG_SUCCESS;
+    size_t i;
+
+    /* Origin segments are scattered so that each is a separate piece */
+    origin_buf = malloc(2 * bulk_size);
+    local_buf = malloc(bulk_size);
+    buf_ptrs = malloc(segment_count * sizeof(void *));
+    buf_sizes = malloc(segment_count * sizeof(hg_size_t));
+    for (i = 0; i < 2 * bulk_size; i++)
+        origin_buf[i] = (char) i;
+    for (i = 0; i < segment_count; i++) {
+        buf_ptrs[i] = origin_buf + 2 * i * segment_size;
+        buf_sizes[i] = segment_size;
+    }
+
+    ret = HG_Addr_self(hg_class, &self_addr);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get self addr");
+        goto done;
+    }
+
+    ret = HG_Bulk_create(hg_class, segment_count, buf_ptrs, buf_sizes,
+        HG_BULK_READ_ONLY, &origin_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+    buf_ptr = local_buf;
+    ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &bulk_size, HG_BULK_WRITE_ONLY,
+        &local_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+
+    /* Pull data with a deadline that does not expire, self transfers
+     * complete before the callback is triggered */
+    request = hg_request_create(request_class);
+    transfer_cb_args.request = request;
+    transfer_cb_args.expected_bytes = bulk_size;
+    transfer_cb_args.ret = HG_SUCCESS;
+    ret = HG_Bulk_transfer_timeout(context, hg_test_bulk_ret_cb,
+        &transfer_cb_args, HG_BULK_PULL, self_addr, 0, origin_handle, 0,
+        local_handle, 0, bulk_size, HG_MAX_IDLE_TIME, &op_id);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not transfer bulk data");
+        goto done;
+    }
+    ret = HG_Bulk_get_progress(op_id, &completed_size, &outstanding_count);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get transfer progress");
+        goto done;
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    if (completed_size != bulk_size || outstanding_count) {
+        HG_TEST_LOG_ERROR("Progress reported %zu bytes, %u pieces outstanding",
+            (size_t) completed_size, outstanding_count);
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+    if (transfer_cb_args.ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Transfer did not complete");
+        ret = transfer_cb_args.ret;
+        goto done;
+    }
+    for (i = 0; i < bulk_size; i++) {
+        if (local_buf[i] != (char) (i / segment_size * 2 * segment_size
+            + i % segment_size)) {
+            HG_TEST_LOG_ERROR("Error detected in bulk transfer, buf[%zu]", i);
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+    }
+
+done:
+    if (request)
+        hg_request_destroy(request);
+    HG_Bulk_free(local_handle);
+    HG_Bulk_free(origin_handle);
+    if (self_addr != HG_ADDR_NULL)
+        HG_Addr_free(hg_class, self_addr);
+    free(buf_sizes);
+    free(buf_ptrs);
+    free(local_buf);
+    free(origin_buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_atomic_cb(const struct hg_cb_info *callback_info)
+{
+    struct atomic_cb_args *args = (struct atomic_cb_args *) callback_info->arg;
+
+    if (callback_info->ret != HG_SUCCESS)
+        args->ret = callback_info->ret;
+    if (hg_atomic_decr32(&args->remaining) == 0)
+        hg_request_complete(args->request);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_atomic_op(hg_context_t *context, hg_request_class_t *request_class,
+    hg_bulk_atomic_op_t op, hg_addr_t target_addr, hg_bulk_t target_handle,
+    hg_size_t offset, hg_size_t size, hg_uint64_t operand,
+    hg_uint64_t compare, hg_uint64_t *result)
+{
+    struct atomic_cb_args atomic_cb_args;
+    hg_return_t ret = HG_SUCCESS;
+
+    atomic_cb_args.request = hg_request_create(request_class);
+    if (!atomic_cb_args.request) {
+        HG_TEST_LOG_ERROR("Could not create request");
+        return HG_NOMEM_ERROR;
+    }
+    hg_atomic_init32(&atomic_cb_args.remaining, 1);
+    atomic_cb_args.ret = HG_SUCCESS;
+
+    ret = HG_Bulk_atomic(context, hg_test_bulk_atomic_cb, &atomic_cb_args, op,
+        target_addr, 0, target_handle, offset, size, operand, compare, result,
+        HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not post atomic operation");
+        goto done;
+    }
+    hg_request_wait(atomic_cb_args.request, HG_MAX_IDLE_TIME, NULL);
+    ret = atomic_cb_args.ret;
+
+done:
+    hg_request_destroy(atomic_cb_args.request);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_atomic_handle(hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_bool_t read_only, hg_bulk_t *target_handle)
+{
+    hg_handle_t handle = HG_HANDLE_NULL;
+    bulk_atomic_incr_t in_struct;
+    bulk_bind_write_out_t out_struct;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Get handle of words exposed by target, target only keeps a read-only
+     * handle on words if requested */
+    in_struct.value = read_only;
+    ret = hg_test_bulk_call(context, request_class, target_addr,
+        hg_test_atomic_handle_id_g, &in_struct, &handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = HG_Get_output(handle, &out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+    *target_handle = out_struct.bulk_handle;
+    HG_Bulk_ref_incr(*target_handle);
+    HG_Free_output(handle, &out_struct);
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_atomic(hg_context_t *context, hg_request_class_t *request_class,
+    hg_addr_t target_addr, unsigned int count)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t target_handle = HG_BULK_NULL;
+    struct atomic_cb_args atomic_cb_args;
+    bulk_atomic_incr_t incr_struct;
+    hg_uint64_t *results = NULL, base, sum = 0, result;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    request = hg_request_create(request_class);
+    if (!request) {
+        HG_TEST_LOG_ERROR("Could not create request");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    ret = hg_test_bulk_atomic_handle(context, request_class, target_addr,
+        HG_FALSE, &target_handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    /* Concurrent fetch-and-add on 64-bit counter, fetched values must be
+     * distinct and consecutive */
+    results = malloc(count * sizeof(hg_uint64_t));
+    atomic_cb_args.request = request;
+    hg_atomic_init32(&atomic_cb_args.remaining, (hg_util_int32_t) count);
+    atomic_cb_args.ret = HG_SUCCESS;
+    for (i = 0; i < count; i++) {
+        ret = HG_Bulk_atomic(context, hg_test_bulk_atomic_cb, &atomic_cb_args,
+            HG_BULK_ATOMIC_FADD, target_addr, 0, target_handle, 0,
+            sizeof(hg_uint64_t), 1, 0, &results[i], HG_OP_ID_IGNORE);
+        if (ret != HG_SUCCESS) {
+            HG_TEST_LOG_ERROR("Could not post atomic operation");
+            goto done;
+        }
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+    if (atomic_cb_args.ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Atomic operation failed");
+        ret = atomic_cb_args.ret;
+        goto done;
+    }
+    base = results[0];
+    for (i = 0; i < count; i++) {
+        if (results[i] < base)
+            base = results[i];
+        sum += results[i];
+    }
+    if (sum != count * base + (hg_uint64_t) count * (count - 1) / 2) {
+        HG_TEST_LOG_ERROR("Fetched values are not consecutive");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    /* RPC increments the same counter */
+    incr_struct.value = 1;
+    ret = hg_test_bulk_call(context, request_class, target_addr,
+        hg_test_atomic_incr_id_g, &incr_struct, &handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = HG_Get_output(handle, &incr_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+    result = incr_struct.value;
+    HG_Free_output(handle, &incr_struct);
+    if (result != base + count) {
+        HG_TEST_LOG_ERROR("RPC fetched %lu, expected %lu",
+            (unsigned long) result, (unsigned long) (base + count));
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    /* Compare-and-swap that succeeds, then one that fails */
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_CSWAP,
+        target_addr, target_handle, 0, sizeof(hg_uint64_t), 7, base + count + 1,
+        &result);
+    if (ret != HG_SUCCESS || result != base + count + 1) {
+        HG_TEST_LOG_ERROR("Compare-and-swap did not fetch counter");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_CSWAP,
+        target_addr, target_handle, 0, sizeof(hg_uint64_t), 9, 8, &result);
+    if (ret != HG_SUCCESS || result != 7) {
+        HG_TEST_LOG_ERROR("Compare-and-swap did not swap value");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_FADD,
+        target_addr, target_handle, 0, sizeof(hg_uint64_t), 0, 0, &result);
+    if (ret != HG_SUCCESS || result != 7) {
+        HG_TEST_LOG_ERROR("Failed compare-and-swap modified value");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    /* 32-bit word wraps around */
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_SWAP,
+        target_addr, target_handle, sizeof(hg_uint64_t), sizeof(hg_uint32_t),
+        0xffffffff, 0, &result);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not swap 32-bit word");
+        goto done;
+    }
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_FADD,
+        target_addr, target_handle, sizeof(hg_uint64_t), sizeof(hg_uint32_t),
+        2, 0, &result);
+    if (ret != HG_SUCCESS || result != 0xffffffff) {
+        HG_TEST_LOG_ERROR("32-bit swap did not store value");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_SWAP,
+        target_addr, target_handle, sizeof(hg_uint64_t), sizeof(hg_uint32_t),
+        0, 0, &result);
+    if (ret != HG_SUCCESS || result != 1) {
+        HG_TEST_LOG_ERROR("32-bit fetch-and-add did not wrap around");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    /* Unaligned words are rejected */
+    if (HG_Bulk_atomic(context, hg_test_bulk_atomic_cb, &atomic_cb_args,
+        HG_BULK_ATOMIC_FADD, target_addr, 0, target_handle, 4,
+        sizeof(hg_uint64_t), 1, 0, NULL, HG_OP_ID_IGNORE) == HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Unaligned atomic operation was posted");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    /* Target rejects words that are no longer exposed by a live read-write
+     * handle, handle held by client claims read-write access */
+    HG_Bulk_free(target_handle);
+    target_handle = HG_BULK_NULL;
+    ret = hg_test_bulk_atomic_handle(context, request_class, target_addr,
+        HG_TRUE, &target_handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+    if (hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_SWAP,
+        target_addr, target_handle, 0, sizeof(hg_uint64_t), 0, 0,
+        &result) == HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Atomic operation updated read-only word");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    /* Counter must be left unchanged */
+    HG_Bulk_free(target_handle);
+    target_handle = HG_BULK_NULL;
+    ret = hg_test_bulk_atomic_handle(context, request_class, target_addr,
+        HG_FALSE, &target_handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_test_bulk_atomic_op(context, request_class, HG_BULK_ATOMIC_FADD,
+        target_addr, target_handle, 0, sizeof(hg_uint64_t), 0, 0, &result);
+    if (ret != HG_SUCCESS || result != 7) {
+        HG_TEST_LOG_ERROR("Rejected atomic operation modified value");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    HG_Bulk_free(target_handle);
+    if (request)
+        hg_request_destroy(request);
+    free(results);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_channel(hg_context_t *context, hg_request_class_t *request_class,
+    hg_addr_t target_addr, hg_bool_t shared, unsigned int count)
+{
+    hg_request_t *drain_request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL, drain_handle = HG_HANDLE_NULL;
+    hg_channel_t *channel = NULL;
+    struct forward_cb_args drain_cb_args;
+    channel_open_in_t open_in_struct;
+    bulk_bind_write_out_t open_out_struct;
+    bulk_atomic_incr_t drain_in_struct;
+    channel_drain_out_t drain_out_struct;
+    hg_size_t max_size, sizes[8], total_bytes = 0;
+    const void *bufs[8];
+    char *buf = NULL;
+    unsigned int enqueued = 0, completed = 0, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Open channel on target, ring is smaller than data streamed through it */
+    open_in_struct.size = 64 * 1024;
+    open_in_struct.shared = (hg_uint8_t) shared;
+    ret = hg_test_bulk_call(context, request_class, target_addr,
+        hg_test_channel_open_id_g, &open_in_struct, &handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = HG_Get_output(handle, &open_out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+    /* Small items so that ring wraps around a few times */
+    max_size = (open_out_struct.ret < 2048) ? open_out_struct.ret : 2048;
+    ret = HG_Channel_connect(context, target_addr, 0,
+        open_out_struct.bulk_handle, &channel);
+    HG_Free_output(handle, &open_out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not connect channel");
+        goto done;
+    }
+    if (HG_Channel_is_shared(channel) != (shared && strcmp(
+        HG_Class_get_protocol(HG_Context_get_class(context)), "sm") == 0)) {
+        HG_TEST_LOG_ERROR("Ring is not mapped as expected");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    buf = malloc(8 * max_size);
+    for (i = 0; i < 8; i++)
+        bufs[i] = buf + i * max_size;
+
+    /* Target drains items while they are enqueued */
+    drain_request = hg_request_create(request_class);
+    if (!drain_request) {
+        HG_TEST_LOG_ERROR("Could not create request");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    drain_cb_args.request = drain_request;
+    drain_cb_args.ret = HG_SUCCESS;
+    ret = HG_Create(context, target_addr, hg_test_channel_drain_id_g,
+        &drain_handle);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create handle");
+        goto done;
+    }
+    drain_in_struct.value = count;
+    ret = HG_Forward(drain_handle, hg_test_bulk_ret_cb,
+        &drain_cb_args, &drain_in_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not forward call");
+        goto done;
+    }
+
+    while (enqueued < count || HG_Channel_get_pending(channel)) {
+        unsigned int batch = (count - enqueued < 8) ? count - enqueued : 8;
+        unsigned int actual_count = 0;
+
+        /* Items of size s hold bytes (char) (s + j) */
+        for (i = 0; i < batch; i++) {
+            char *item = buf + i * max_size;
+            hg_size_t j;
+
+            sizes[i] = ((hg_size_t) (enqueued + i) * 997) % (max_size + 1);
+            for (j = 0; j < sizes[i]; j++)
+                item[j] = (char) (sizes[i] + j);
+        }
+        ret = HG_Channel_enqueue(channel, batch, bufs, sizes, &actual_count);
+        if (ret != HG_SUCCESS) {
+            HG_TEST_LOG_ERROR("Could not enqueue items");
+            goto done;
+        }
+        for (i = 0; i < actual_count; i++)
+            total_bytes += sizes[i];
+        enqueued += actual_count;
+        if (hg_request_wait(drain_request, 0, &completed) < 0 || completed)
+            break;
+    }
+    hg_request_wait(drain_request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = HG_Get_output(drain_handle, &drain_out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+    if (drain_out_struct.count != count
+        || drain_out_struct.bytes != total_bytes) {
+        HG_TEST_LOG_ERROR("Target received %lu items (%lu bytes), expected "
+            "%u items (%lu bytes)", (unsigned long) drain_out_struct.count,
+            (unsigned long) drain_out_struct.bytes, count,
+            (unsigned long) total_bytes);
+        ret = HG_PROTOCOL_ERROR;
+    }
+    HG_Free_output(drain_handle, &drain_out_struct);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    /* Close channel on target */
+    HG_Destroy(handle);
+    ret = hg_test_bulk_call(context, request_class, target_addr,
+        hg_test_channel_close_id_g, NULL, &handle);
+
+done:
+    HG_Channel_destroy(channel);
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    if (drain_handle != HG_HANDLE_NULL)
+        HG_Destroy(drain_handle);
+    if (drain_request)
+        hg_request_destroy(drain_request);
+    free(buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    hg_return_t hg_ret;
+    int ret = EXIT_SUCCESS;
 
     /* Initialize the interface */
     HG_Test_init(argc, argv, &hg_test_info);
@@ -504,7 +1577,8 @@ int main(int argc, char *argv[])
 
     HG_TEST("segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
     hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE, 0, 0, 16);
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE, 0, 0, 16, 0,
+        HG_FALSE);
     if (hg_ret != HG_SUCCESS) {
         ret = EXIT_FAILURE;
         goto done;
@@ -514,7 +1588,7 @@ int main(int argc, char *argv[])
     HG_TEST("segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
     hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
         hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4,
-        BUFSIZE/2 + 1, 0, 16);
+        BUFSIZE/2 + 1, 0, 16, 0, HG_FALSE);
     if (hg_ret != HG_SUCCESS) {
         ret = EXIT_FAILURE;
         goto done;
@@ -524,7 +1598,7 @@ int main(int argc, char *argv[])
     HG_TEST("segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, BUFSIZE/4)");
     hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
         hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/8,
-        BUFSIZE/2 + 1, BUFSIZE/4, 16);
+        BUFSIZE/2 + 1, BUFSIZE/4, 16, 0, HG_FALSE);
     if (hg_ret != HG_SUCCESS) {
         ret = EXIT_FAILURE;
         goto done;
@@ -534,7 +1608,7 @@ int main(int argc, char *argv[])
     HG_TEST("over-segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
     hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
         hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE, 0, 0,
-        1024);
+        1024, 0, HG_FALSE);
     if (hg_ret != HG_SUCCESS) {
         ret = EXIT_FAILURE;
         goto done;
@@ -544,7 +1618,7 @@ int main(int argc, char *argv[])
     HG_TEST("over-segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
     hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
         hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4,
-        BUFSIZE/2 + 1, 0, 1024);
+        BUFSIZE/2 + 1, 0, 1024, 0, HG_FALSE);
     if (hg_ret != HG_SUCCESS) {
         ret = EXIT_FAILURE;
         goto done;
@@ -554,7 +1628,249 @@ int main(int argc, char *argv[])
     HG_TEST("over-segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, BUFSIZE/4)");
     hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
         hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/8,
-        BUFSIZE/2 + 1, BUFSIZE/4, 1024);
+        BUFSIZE/2 + 1, BUFSIZE/4, 1024, 0, HG_FALSE);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("one-region segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4,
+        BUFSIZE/2 + 1, 0, 16384, 0, HG_TRUE);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("strided RPC bulk (block 1KB, stride 4KB, size BUFSIZE/8, offsets 100, 0)");
+    hg_ret = hg_test_bulk_strided(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 1024, 4096,
+        BUFSIZE/4/1024, BUFSIZE/8, 100);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("strided RPC bulk (block 24, stride 40, size 400, offsets 30, 0)");
+    hg_ret = hg_test_bulk_strided(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 24, 40, 20, 400,
+        30);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* More blocks than a single strided NA operation may access */
+    HG_TEST("strided RPC bulk (block 8, stride 24, size 23000, offsets 4, 0)");
+    hg_ret = hg_test_bulk_strided(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 8, 24, 3000,
+        23000, 4);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("view RPC bulk (view BUFSIZE/2 at 3, size BUFSIZE/4, offsets 5, 0)");
+    hg_ret = hg_test_bulk_view(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4, 5, 3,
+        BUFSIZE/2, 1, 0);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("segmented view RPC bulk (view BUFSIZE/2 at BUFSIZE/4 + 1, size BUFSIZE/4, offsets 100, 0)");
+    hg_ret = hg_test_bulk_view(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4, 100,
+        BUFSIZE/4 + 1, BUFSIZE/2, 1024, 0);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("one-region view RPC bulk (view BUFSIZE/2 at BUFSIZE/4 + 1, size BUFSIZE/4, offsets 100, 0)");
+    hg_ret = hg_test_bulk_view(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4, 100,
+        BUFSIZE/4 + 1, BUFSIZE/2, 16384, BUFSIZE/16384);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("strided view RPC bulk (view BUFSIZE/4 at BUFSIZE/4, size BUFSIZE/8, offsets 100, 0)");
+    hg_ret = hg_test_bulk_view(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/8, 100,
+        BUFSIZE/4, BUFSIZE/4, 1024, 2 * (BUFSIZE/1024));
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* Checksum test */
+    HG_TEST("checksummed segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE, 0, 0, 16,
+        HG_BULK_CHECKSUM_BLOCK_SIZE, HG_FALSE);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("checksummed over-segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE/4,
+        BUFSIZE/2 + 1, 0, 1024, HG_BULK_CHECKSUM_BLOCK_SIZE, HG_FALSE);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* eager push test */
+    HG_TEST("eager push RPC bulk (write-only, size 40, offsets 4, 0)");
+    hg_ret = hg_test_bulk_eager_push(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, HG_BULK_WRITE_ONLY, 40, 4, 0);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("eager push RPC bulk (read-write, size 20, offsets 24, 8)");
+    hg_ret = hg_test_bulk_eager_push(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, HG_BULK_READWRITE, 20, 24, 8);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* registration cache test */
+    HG_TEST("cached registration RPC bulk (size BUFSIZE/4, 4 handles)");
+    hg_ret = hg_test_bulk_cache(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 2, 4);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* pipelined transfer tests */
+    HG_TEST("pipelined RPC bulk (size BUFSIZE, chunk 1MB, window 4)");
+    hg_ret = hg_test_bulk_pipeline(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE,
+        1024 * 1024, 4);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("pipelined RPC bulk (size BUFSIZE/4 + 3, chunk 64KB, window 2)");
+    hg_ret = hg_test_bulk_pipeline(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE / 4 + 3,
+        64 * 1024, 2);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* vectored transfer tests */
+    HG_TEST("vectored RPC bulk (64 entries of 4KB)");
+    hg_ret = hg_test_bulk_gather(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 4096, 64,
+        HG_TRUE);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("vectored RPC bulk (3 entries of BUFSIZE/4 + 3)");
+    hg_ret = hg_test_bulk_gather(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE / 4 + 3,
+        3, HG_TRUE);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* pre-registered arena tests */
+    HG_TEST("arena allocated RPC bulk (size 12288)");
+    hg_ret = hg_test_bulk_alloc(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 12288);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("arena allocated RPC bulk (size BUFSIZE/4)");
+    hg_ret = hg_test_bulk_alloc(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, BUFSIZE / 4);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("checksummed bulk corruption detection");
+    hg_ret = hg_test_bulk_checksum_corrupt(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class, 4096);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* progress and deadline test */
+    HG_TEST("bulk progress with deadline (16 segments of 4KB)");
+    hg_ret = hg_test_bulk_progress(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class, 16, 4096);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* atomic test */
+    HG_TEST("bulk atomic operations (16 concurrent fetch-and-add)");
+    hg_ret = hg_test_bulk_atomic(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 16);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* channel tests */
+    HG_TEST("channel streaming through bulk transfers (1000 items)");
+    hg_ret = hg_test_bulk_channel(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, HG_FALSE, 1000);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    HG_TEST("channel streaming through shared ring (1000 items)");
+    hg_ret = hg_test_bulk_channel(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, HG_TRUE, 1000);
     if (hg_ret != HG_SUCCESS) {
         ret = EXIT_FAILURE;
         goto done;
@@ -27,6 +27,11 @@ MERCURY_GEN_PROC(bulk_write_in_t,
 MERCURY_GEN_PROC(bulk_write_out_t, ((hg_size_t)(ret)))
 MERCURY_GEN_PROC(bulk_bind_write_out_t,
     ((hg_size_t)(ret)) ((hg_bulk_t)(bulk_handle)))
+MERCURY_GEN_PROC(bulk_atomic_incr_t, ((hg_uint64_t)(value)))
+MERCURY_GEN_PROC(channel_open_in_t,
+    ((hg_uint64_t)(size)) ((hg_uint8_t)(shared)))
+MERCURY_GEN_PROC(channel_drain_out_t,
+    ((hg_uint64_t)(count)) ((hg_uint64_t)(bytes)))
 #else
 /* Define bulk_write_in_t */
 typedef struct {
@@ -125,6 +130,83 @@ hg_proc_bulk_bind_write_out_t(hg_proc_t proc, void *data)
 
     return ret;
 }
+
+/* Define bulk_atomic_incr_t */
+typedef struct {
+    hg_uint64_t value;
+} bulk_atomic_incr_t;
+
+/* Define hg_proc_bulk_atomic_incr_t */
+static HG_INLINE hg_return_t
+hg_proc_bulk_atomic_incr_t(hg_proc_t proc, void *data)
+{
+    hg_return_t ret = HG_SUCCESS;
+    bulk_atomic_incr_t *struct_data = (bulk_atomic_incr_t *) data;
+
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->value);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Proc error");
+        return ret;
+    }
+
+    return ret;
+}
+
+/* Define channel_open_in_t */
+typedef struct {
+    hg_uint64_t size;
+    hg_uint8_t shared;
+} channel_open_in_t;
+
+/* Define hg_proc_channel_open_in_t */
+static HG_INLINE hg_return_t
+hg_proc_channel_open_in_t(hg_proc_t proc, void *data)
+{
+    hg_return_t ret = HG_SUCCESS;
+    channel_open_in_t *struct_data = (channel_open_in_t *) data;
+
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->size);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Proc error");
+        return ret;
+    }
+
+    ret = hg_proc_hg_uint8_t(proc, &struct_data->shared);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Proc error");
+        return ret;
+    }
+
+    return ret;
+}
+
+/* Define channel_drain_out_t */
+typedef struct {
+    hg_uint64_t count;
+    hg_uint64_t bytes;
+} channel_drain_out_t;
+
+/* Define hg_proc_channel_drain_out_t */
+static HG_INLINE hg_return_t
+hg_proc_channel_drain_out_t(hg_proc_t proc, void *data)
+{
+    hg_return_t ret = HG_SUCCESS;
+    channel_drain_out_t *struct_data = (channel_drain_out_t *) data;
+
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->count);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Proc error");
+        return ret;
+    }
+
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->bytes);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Proc error");
+        return ret;
+    }
+
+    return ret;
+}
 #endif
 
 #endif /* TEST_BULK_H */
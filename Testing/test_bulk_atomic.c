@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Atomic benchmark: client increments a counter exposed by the server, either
+ * with HG_Bulk_atomic() or with an RPC that increments it, the atomic path
+ * falls back to an internal RPC when the plugin has no native atomics */
+
+#define BENCHMARK_NAME "Remote fetch-and-add rate"
+#define STRING(s) #s
+#define XSTRING(s) STRING(s)
+#define VERSION_NAME \
+    XSTRING(HG_VERSION_MAJOR) \
+    "." \
+    XSTRING(HG_VERSION_MINOR) \
+    "." \
+    XSTRING(HG_VERSION_PATCH)
+
+#define SKIP 10
+#define NDIGITS 2
+#define NWIDTH 20
+
+extern hg_id_t hg_test_atomic_handle_id_g;
+extern hg_id_t hg_test_atomic_incr_id_g;
+
+static hg_return_t
+hg_test_perf_forward_cb(const struct hg_cb_info *callback_info)
+{
+    hg_request_complete((hg_request_t *) callback_info->arg);
+
+    return HG_SUCCESS;
+}
+
+/**
+ * Get handle of counters exposed by server.
+ */
+static hg_return_t
+get_target_handle(struct hg_test_info *hg_test_info, hg_bulk_t *bulk_handle)
+{
+    bulk_bind_write_out_t out_struct;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_request_t *request;
+    hg_return_t ret = HG_SUCCESS;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+        hg_test_atomic_handle_id_g, &handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start call\n");
+        goto done;
+    }
+
+    ret = HG_Forward(handle, hg_test_perf_forward_cb, request, NULL);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not forward call\n");
+        goto done;
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = HG_Get_output(handle, &out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get output\n");
+        goto done;
+    }
+    *bulk_handle = out_struct.bulk_handle;
+    HG_Bulk_ref_incr(*bulk_handle);
+    HG_Free_output(handle, &out_struct);
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    hg_request_destroy(request);
+    return ret;
+}
+
+/**
+ * Return rate (ops/s) of HG_Bulk_atomic() fetch-and-add on word of size.
+ */
+static hg_return_t
+measure_atomic(struct hg_test_info *hg_test_info, hg_bulk_t bulk_handle,
+    hg_size_t size, double *rate)
+{
+    hg_request_t *request;
+    size_t loop = (size_t) hg_test_info->na_test_info.loop;
+    double time_read = 0;
+    hg_return_t ret = HG_SUCCESS;
+    size_t i;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    for (i = 0; i < SKIP + loop; i++) {
+        hg_uint64_t result;
+        hg_time_t t1, t2;
+
+        if (i == SKIP)
+            NA_Test_barrier(&hg_test_info->na_test_info);
+
+        hg_time_get_current(&t1);
+        ret = HG_Bulk_atomic(hg_test_info->context, hg_test_perf_forward_cb,
+            request, HG_BULK_ATOMIC_FADD, hg_test_info->target_addr, 0,
+            bulk_handle, 0, size, 1, 0, &result, HG_OP_ID_IGNORE);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not post atomic operation\n");
+            goto done;
+        }
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_time_get_current(&t2);
+        hg_request_reset(request);
+
+        if (i >= SKIP)
+            time_read += hg_time_to_double(hg_time_subtract(t2, t1));
+    }
+    NA_Test_barrier(&hg_test_info->na_test_info);
+
+    *rate = (double) loop / time_read;
+
+done:
+    hg_request_destroy(request);
+    return ret;
+}
+
+/**
+ * Return rate (ops/s) of increment RPC.
+ */
+static hg_return_t
+measure_rpc(struct hg_test_info *hg_test_info, double *rate)
+{
+    bulk_atomic_incr_t in_struct;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_request_t *request;
+    size_t loop = (size_t) hg_test_info->na_test_info.loop;
+    double time_read = 0;
+    hg_return_t ret = HG_SUCCESS;
+    size_t i;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+        hg_test_atomic_incr_id_g, &handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start call\n");
+        goto done;
+    }
+    in_struct.value = 1;
+
+    for (i = 0; i < SKIP + loop; i++) {
+        hg_time_t t1, t2;
+
+        if (i == SKIP)
+            NA_Test_barrier(&hg_test_info->na_test_info);
+
+        hg_time_get_current(&t1);
+        ret = HG_Forward(handle, hg_test_perf_forward_cb, request, &in_struct);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not forward call\n");
+            goto done;
+        }
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_time_get_current(&t2);
+        hg_request_reset(request);
+
+        if (i >= SKIP)
+            time_read += hg_time_to_double(hg_time_subtract(t2, t1));
+    }
+    NA_Test_barrier(&hg_test_info->na_test_info);
+
+    *rate = (double) loop / time_read;
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    hg_request_destroy(request);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_size_t sizes[2] = { sizeof(hg_uint32_t), sizeof(hg_uint64_t) };
+    double rpc_rate = 0;
+    size_t i;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    if (get_target_handle(&hg_test_info, &bulk_handle) != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+        fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+        fprintf(stdout, "# Loop %d times\n", hg_test_info.na_test_info.loop);
+        fprintf(stdout, "%-*s%*s%*s\n", 10, "# Size", NWIDTH,
+            "Atomic (ops/s)", NWIDTH, "RPC (ops/s)");
+        fflush(stdout);
+    }
+
+    if (measure_rpc(&hg_test_info, &rpc_rate) != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    for (i = 0; i < 2; i++) {
+        double atomic_rate = 0;
+
+        if (measure_atomic(&hg_test_info, bulk_handle, sizes[i], &atomic_rate)
+            != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+
+        if (hg_test_info.na_test_info.mpi_comm_rank == 0)
+            fprintf(stdout, "%-*lu%*.*f%*.*f\n", 10, (unsigned long) sizes[i],
+                NWIDTH, NDIGITS, atomic_rate, NWIDTH, NDIGITS, rpc_rate);
+    }
+
+done:
+    HG_Bulk_free(bulk_handle);
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Bulk descriptor microbenchmark: serialized size of handles and time to set
+ * up a small transfer in the middle of handles of increasing segment count,
+ * segments are either adjacent (registered as one region) or scattered, no
+ * RPC is sent (transfers are local) */
+
+#define NDIGITS 3
+#define NWIDTH 15
+#define SEGMENT_SIZE 64
+#define MAX_SEGMENT_COUNT 65536
+#define TRANSFER_SIZE 8
+#define SMALL_LOOP 1000
+
+static hg_return_t
+hg_test_bulk_desc_transfer_cb(const struct hg_cb_info *callback_info)
+{
+    hg_request_complete((hg_request_t *) callback_info->arg);
+
+    return HG_SUCCESS;
+}
+
+/**
+ * Return serialized size of handle and average time (us) to serialize it.
+ */
+static hg_return_t
+measure_serialize(hg_bulk_t bulk_handle, void *buf, size_t loop,
+    hg_size_t *size, double *time)
+{
+    hg_time_t t1, t2;
+    size_t i;
+    hg_return_t ret = HG_SUCCESS;
+
+    *size = HG_Bulk_get_serialize_size(bulk_handle, HG_FALSE);
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < loop; i++) {
+        ret = HG_Bulk_serialize(buf, *size, HG_FALSE, bulk_handle);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not serialize bulk handle\n");
+            goto done;
+        }
+    }
+    hg_time_get_current(&t2);
+    *time = hg_time_to_double(hg_time_subtract(t2, t1)) * 1e6 / (double) loop;
+
+done:
+    return ret;
+}
+
+/**
+ * Return average time (us) to complete a small transfer from the middle of
+ * handle.
+ */
+static hg_return_t
+measure_setup(struct hg_test_info *hg_test_info, hg_addr_t self_addr,
+    hg_bulk_t bulk_handle, hg_bulk_t local_handle, size_t loop, double *time)
+{
+    hg_request_t *request = hg_request_create(hg_test_info->request_class);
+    hg_size_t offset = HG_Bulk_get_size(bulk_handle) / 2;
+    hg_time_t t1, t2;
+    size_t i;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < loop; i++) {
+        ret = HG_Bulk_transfer(hg_test_info->context,
+            hg_test_bulk_desc_transfer_cb, request, HG_BULK_PULL, self_addr,
+            bulk_handle, offset, local_handle, 0, TRANSFER_SIZE,
+            HG_OP_ID_IGNORE);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not transfer bulk data\n");
+            goto done;
+        }
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_request_reset(request);
+    }
+    hg_time_get_current(&t2);
+    *time = hg_time_to_double(hg_time_subtract(t2, t1)) * 1e6 / (double) loop;
+
+done:
+    hg_request_destroy(request);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    hg_addr_t self_addr = HG_ADDR_NULL;
+    hg_bulk_t local_handle = HG_BULK_NULL;
+    char *seg_buf = NULL, *ser_buf = NULL;
+    char local_buf[TRANSFER_SIZE];
+    void *local_ptr = local_buf;
+    hg_size_t local_size = TRANSFER_SIZE;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    hg_size_t ser_buf_size = 64 * MAX_SEGMENT_COUNT;
+    hg_uint32_t count;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    /* Scattered segments leave a gap of SEGMENT_SIZE between segments */
+    seg_buf = malloc(2 * SEGMENT_SIZE * MAX_SEGMENT_COUNT);
+    ser_buf = malloc(ser_buf_size);
+    buf_ptrs = malloc(MAX_SEGMENT_COUNT * sizeof(void *));
+    buf_sizes = malloc(MAX_SEGMENT_COUNT * sizeof(hg_size_t));
+    if (!seg_buf || !ser_buf || !buf_ptrs || !buf_sizes) {
+        fprintf(stderr, "Could not allocate buffers\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    memset(seg_buf, 'a', 2 * SEGMENT_SIZE * MAX_SEGMENT_COUNT);
+
+    if (HG_Addr_self(hg_test_info.hg_class, &self_addr) != HG_SUCCESS
+        || HG_Bulk_create(hg_test_info.hg_class, 1, &local_ptr, &local_size,
+            HG_BULK_READWRITE, &local_handle) != HG_SUCCESS) {
+        fprintf(stderr, "Could not create local handle\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    printf("###############################################################################\n");
+    printf("# Bulk descriptor test -- %d byte segments, %d byte transfer\n",
+        SEGMENT_SIZE, TRANSFER_SIZE);
+    printf("###############################################################################\n");
+    printf("%-*s%*s%*s%*s%*s%*s%*s\n", 10, "# Segments", NWIDTH,
+        "Region (B)", NWIDTH, "Scattered (B)", NWIDTH, "Ser reg (us)", NWIDTH,
+        "Ser sc (us)", NWIDTH, "Setup reg (us)", NWIDTH, "Setup sc (us)");
+
+    for (count = 1; count <= MAX_SEGMENT_COUNT; count *= 4) {
+        size_t loop = (size_t) hg_test_info.na_test_info.loop * SMALL_LOOP;
+        hg_bulk_t region_handle = HG_BULK_NULL, scattered_handle = HG_BULK_NULL;
+        hg_size_t region_size = 0, scattered_size = 0;
+        double t_ser = 0, t_ser_sc = 0, t_region = 0, t_scattered = 0;
+        hg_uint32_t i;
+
+        /* Keep total work roughly constant on large counts, with enough
+         * iterations to time setup */
+        if (count > 64)
+            loop = loop * 64 / count + SMALL_LOOP / 10;
+
+        for (i = 0; i < count; i++) {
+            buf_ptrs[i] = seg_buf + i * SEGMENT_SIZE;
+            buf_sizes[i] = SEGMENT_SIZE;
+        }
+        if (HG_Bulk_create(hg_test_info.hg_class, count, buf_ptrs, buf_sizes,
+            HG_BULK_READ_ONLY, &region_handle) != HG_SUCCESS) {
+            fprintf(stderr, "Could not create bulk handle\n");
+            ret = EXIT_FAILURE;
+            break;
+        }
+        for (i = 0; i < count; i++)
+            buf_ptrs[i] = seg_buf + 2 * i * SEGMENT_SIZE;
+        if (HG_Bulk_create(hg_test_info.hg_class, count, buf_ptrs, buf_sizes,
+            HG_BULK_READ_ONLY, &scattered_handle) != HG_SUCCESS) {
+            fprintf(stderr, "Could not create bulk handle\n");
+            HG_Bulk_free(region_handle);
+            ret = EXIT_FAILURE;
+            break;
+        }
+
+        if (measure_serialize(region_handle, ser_buf, loop, &region_size,
+            &t_ser) != HG_SUCCESS
+            || measure_serialize(scattered_handle, ser_buf, loop,
+                &scattered_size, &t_ser_sc) != HG_SUCCESS
+            || measure_setup(&hg_test_info, self_addr, region_handle,
+                local_handle, loop, &t_region) != HG_SUCCESS
+            || measure_setup(&hg_test_info, self_addr, scattered_handle,
+                local_handle, loop, &t_scattered) != HG_SUCCESS)
+            ret = EXIT_FAILURE;
+        HG_Bulk_free(region_handle);
+        HG_Bulk_free(scattered_handle);
+        if (ret != EXIT_SUCCESS)
+            break;
+
+        printf("%-*lu%*lu%*lu%*.*f%*.*f%*.*f%*.*f\n", 10,
+            (unsigned long) count, NWIDTH, (unsigned long) region_size, NWIDTH,
+            (unsigned long) scattered_size, NWIDTH, NDIGITS, t_ser, NWIDTH,
+            NDIGITS, t_ser_sc, NWIDTH, NDIGITS, t_region, NWIDTH, NDIGITS,
+            t_scattered);
+    }
+
+done:
+    HG_Bulk_free(local_handle);
+    HG_Addr_free(hg_test_info.hg_class, self_addr);
+    free(buf_sizes);
+    free(buf_ptrs);
+    free(ser_buf);
+    free(seg_buf);
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
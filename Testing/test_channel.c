@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "mercury_channel.h"
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Channel benchmark: client streams items of one size to a channel opened by
+ * the server, which drains it concurrently, either through bulk transfers or
+ * through a ring mapped in shared memory (sm plugin only) */
+
+#define BENCHMARK_NAME "Channel streaming rate"
+#define STRING(s) #s
+#define XSTRING(s) STRING(s)
+#define VERSION_NAME \
+    XSTRING(HG_VERSION_MAJOR) \
+    "." \
+    XSTRING(HG_VERSION_MINOR) \
+    "." \
+    XSTRING(HG_VERSION_PATCH)
+
+#define NDIGITS 2
+#define NWIDTH 20
+#define RING_SIZE (4 * 1024 * 1024)
+#define MIN_ITEM_SIZE 64
+#define MAX_ITEM_SIZE (64 * 1024)
+#define MAX_ITEM_COUNT 100000
+#define MAX_BYTES (64 * 1024 * 1024)
+#define BATCH 64
+
+extern hg_id_t hg_test_channel_open_id_g;
+extern hg_id_t hg_test_channel_drain_id_g;
+extern hg_id_t hg_test_channel_close_id_g;
+
+static hg_return_t
+hg_test_perf_forward_cb(const struct hg_cb_info *callback_info)
+{
+    hg_request_complete((hg_request_t *) callback_info->arg);
+
+    return HG_SUCCESS;
+}
+
+/**
+ * Forward RPC with no output and wait for completion.
+ */
+static hg_return_t
+forward_wait(struct hg_test_info *hg_test_info, hg_id_t id, void *in_struct,
+    hg_handle_t *handle_ptr)
+{
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_request_t *request;
+    hg_return_t ret = HG_SUCCESS;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    ret = HG_Create(hg_test_info->context, hg_test_info->target_addr, id,
+        &handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start call\n");
+        goto done;
+    }
+
+    ret = HG_Forward(handle, hg_test_perf_forward_cb, request, in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not forward call\n");
+        goto done;
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+done:
+    if (ret == HG_SUCCESS && handle_ptr)
+        *handle_ptr = handle;
+    else if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    hg_request_destroy(request);
+    return ret;
+}
+
+/**
+ * Return rate (items/s) of streaming count items of item_size.
+ */
+static hg_return_t
+measure_channel(struct hg_test_info *hg_test_info, char *buf,
+    hg_size_t item_size, unsigned int count, hg_bool_t shared, double *rate)
+{
+    channel_open_in_t open_in_struct;
+    bulk_bind_write_out_t open_out_struct;
+    bulk_atomic_incr_t drain_in_struct;
+    channel_drain_out_t drain_out_struct;
+    hg_handle_t handle = HG_HANDLE_NULL, drain_handle = HG_HANDLE_NULL;
+    hg_request_t *request;
+    hg_channel_t *channel = NULL;
+    const void *bufs[BATCH];
+    hg_size_t sizes[BATCH];
+    unsigned int enqueued = 0, i;
+    hg_time_t t1, t2;
+    hg_return_t ret = HG_SUCCESS;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    /* Open channel on server and connect to it */
+    open_in_struct.size = RING_SIZE;
+    open_in_struct.shared = (hg_uint8_t) shared;
+    ret = forward_wait(hg_test_info, hg_test_channel_open_id_g,
+        &open_in_struct, &handle);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = HG_Get_output(handle, &open_out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get output\n");
+        goto done;
+    }
+    ret = HG_Channel_connect(hg_test_info->context, hg_test_info->target_addr,
+        0, open_out_struct.bulk_handle, &channel);
+    HG_Free_output(handle, &open_out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not connect channel\n");
+        goto done;
+    }
+    if (shared && !HG_Channel_is_shared(channel)) {
+        *rate = 0;
+        goto close;
+    }
+
+    for (i = 0; i < BATCH; i++) {
+        bufs[i] = buf;
+        sizes[i] = item_size;
+    }
+
+    NA_Test_barrier(&hg_test_info->na_test_info);
+
+    /* Server drains items while they are enqueued */
+    ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+        hg_test_channel_drain_id_g, &drain_handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start call\n");
+        goto done;
+    }
+    drain_in_struct.value = count;
+
+    hg_time_get_current(&t1);
+    ret = HG_Forward(drain_handle, hg_test_perf_forward_cb, request,
+        &drain_in_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not forward call\n");
+        goto done;
+    }
+    while (enqueued < count) {
+        unsigned int actual_count = 0;
+        unsigned int completed = 0;
+
+        ret = HG_Channel_enqueue(channel,
+            (count - enqueued < BATCH) ? count - enqueued : BATCH, bufs,
+            sizes, &actual_count);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not enqueue items\n");
+            goto done;
+        }
+        enqueued += actual_count;
+
+        /* Complete transfers and read consumer index */
+        hg_request_wait(request, 0, &completed);
+        if (completed)
+            break;
+    }
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+    hg_time_get_current(&t2);
+
+    ret = HG_Get_output(drain_handle, &drain_out_struct);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not get output\n");
+        goto done;
+    }
+    if (drain_out_struct.count != count) {
+        fprintf(stderr, "Server received %lu items, expected %u\n",
+            (unsigned long) drain_out_struct.count, count);
+        ret = HG_PROTOCOL_ERROR;
+    }
+    HG_Free_output(drain_handle, &drain_out_struct);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    NA_Test_barrier(&hg_test_info->na_test_info);
+
+    *rate = (double) count / hg_time_to_double(hg_time_subtract(t2, t1));
+
+close:
+    ret = forward_wait(hg_test_info, hg_test_channel_close_id_g, NULL, NULL);
+
+done:
+    HG_Channel_destroy(channel);
+    if (drain_handle != HG_HANDLE_NULL)
+        HG_Destroy(drain_handle);
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    hg_request_destroy(request);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    char *buf = NULL;
+    hg_size_t size;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    /* Items of size s hold bytes (char) (s + j), verified by server */
+    buf = malloc(MAX_ITEM_SIZE);
+    if (!buf) {
+        fprintf(stderr, "Could not allocate buffer\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+        fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+        fprintf(stdout, "# Loop %d times from %d to %d bytes, ring of %d "
+            "bytes, batches of %d items\n", hg_test_info.na_test_info.loop,
+            MIN_ITEM_SIZE, MAX_ITEM_SIZE, RING_SIZE, BATCH);
+        fprintf(stdout, "%-*s%*s%*s\n", 10, "# Size", NWIDTH,
+            "Bulk (msg/s)", NWIDTH, "Shared (msg/s)");
+        fflush(stdout);
+    }
+
+    for (size = MIN_ITEM_SIZE; size <= MAX_ITEM_SIZE; size *= 4) {
+        unsigned int count = (unsigned int) ((MAX_BYTES / size
+            > MAX_ITEM_COUNT) ? MAX_ITEM_COUNT : MAX_BYTES / size)
+            * (unsigned int) hg_test_info.na_test_info.loop;
+        double bulk_rate = 0, shared_rate = 0;
+        hg_size_t j;
+
+        for (j = 0; j < size; j++)
+            buf[j] = (char) (size + j);
+
+        if (measure_channel(&hg_test_info, buf, size, count, HG_FALSE,
+            &bulk_rate) != HG_SUCCESS
+            || measure_channel(&hg_test_info, buf, size, count, HG_TRUE,
+                &shared_rate) != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+
+        if (hg_test_info.na_test_info.mpi_comm_rank == 0)
+            fprintf(stdout, "%-*lu%*.*f%*.*f\n", 10, (unsigned long) size,
+                NWIDTH, NDIGITS, bulk_rate, NWIDTH, NDIGITS, shared_rate);
+    }
+
+done:
+    free(buf);
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Gather benchmark: server pulls count entries of one size, each entry
+ * standing for a separate client, either with one transfer per entry or with
+ * a single HG_Bulk_transfer_multi(), total size is bounded by the server
+ * buffer (MERCURY_TESTING_BUFFER_SIZE) */
+
+#define BENCHMARK_NAME "Gather latency (server bulk pull)"
+#define STRING(s) #s
+#define XSTRING(s) STRING(s)
+#define VERSION_NAME \
+    XSTRING(HG_VERSION_MAJOR) \
+    "." \
+    XSTRING(HG_VERSION_MINOR) \
+    "." \
+    XSTRING(HG_VERSION_PATCH)
+
+#define SKIP 10
+#define NDIGITS 2
+#define NWIDTH 20
+#define SMALL_ENTRY_SIZE (4 * 1024)
+#define LARGE_ENTRY_SIZE (64 * 1024)
+#define MAX_ENTRY_COUNT 1024
+#define MAX_MSG_SIZE (MERCURY_TESTING_BUFFER_SIZE * 1024 * 1024)
+
+extern hg_id_t hg_test_gather_write_id_g;
+
+static hg_return_t
+hg_test_perf_forward_cb(const struct hg_cb_info *callback_info)
+{
+    hg_request_complete((hg_request_t *) callback_info->arg);
+
+    return HG_SUCCESS;
+}
+
+/**
+ * Return average time (us) for server to gather count entries of entry_size.
+ */
+static hg_return_t
+measure_gather(struct hg_test_info *hg_test_info, hg_bulk_t bulk_handle,
+    hg_size_t entry_size, hg_uint32_t count, hg_bool_t multi, double *time)
+{
+    bulk_write_in_t in_struct;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_request_t *request;
+    size_t loop = (size_t) hg_test_info->na_test_info.loop;
+    double time_read = 0;
+    hg_return_t ret = HG_SUCCESS;
+    size_t i;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+        hg_test_gather_write_id_g, &handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start call\n");
+        goto done;
+    }
+
+    /* Fill input structure */
+    in_struct.fildes = (hg_int32_t) count;
+    in_struct.transfer_size = entry_size;
+    in_struct.origin_offset = 0;
+    in_struct.target_offset = multi;
+    in_struct.bulk_handle = bulk_handle;
+
+    for (i = 0; i < SKIP + loop; i++) {
+        hg_time_t t1, t2;
+
+        /* Warm up for bulk data */
+        if (i == SKIP)
+            NA_Test_barrier(&hg_test_info->na_test_info);
+
+        hg_time_get_current(&t1);
+        ret = HG_Forward(handle, hg_test_perf_forward_cb, request, &in_struct);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not forward call\n");
+            goto done;
+        }
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_time_get_current(&t2);
+        hg_request_reset(request);
+
+        if (i >= SKIP)
+            time_read += hg_time_to_double(hg_time_subtract(t2, t1));
+    }
+    NA_Test_barrier(&hg_test_info->na_test_info);
+
+    *time = time_read * 1e6 / (double) loop;
+
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    hg_request_destroy(request);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    char *bulk_buf = NULL;
+    void *buf_ptr;
+    hg_size_t buf_size = MAX_MSG_SIZE;
+    hg_size_t entry_sizes[2] = { SMALL_ENTRY_SIZE, LARGE_ENTRY_SIZE };
+    hg_uint32_t count;
+    size_t i;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    /* Prepare bulk_buf */
+    bulk_buf = malloc(MAX_MSG_SIZE);
+    if (!bulk_buf) {
+        fprintf(stderr, "Could not allocate buffer\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    for (i = 0; i < MAX_MSG_SIZE; i++)
+        bulk_buf[i] = (char) i;
+    buf_ptr = bulk_buf;
+
+    if (HG_Bulk_create(hg_test_info.hg_class, 1, &buf_ptr, &buf_size,
+        HG_BULK_READ_ONLY, &bulk_handle) != HG_SUCCESS) {
+        fprintf(stderr, "Could not create bulk data handle\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+        fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+        fprintf(stdout, "# Loop %d times from 1 to %d entries\n",
+            hg_test_info.na_test_info.loop, MAX_ENTRY_COUNT);
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+        fprintf(stdout, "# WARNING verifying data, output will be slower\n");
+#endif
+        fprintf(stdout, "%-*s%*s%*s%*s\n", 10, "# Entries", NWIDTH,
+            "Entry size (B)", NWIDTH, "Separate (us)", NWIDTH, "Multi (us)");
+        fflush(stdout);
+    }
+
+    for (i = 0; i < 2; i++) {
+        for (count = 1; count <= MAX_ENTRY_COUNT
+            && entry_sizes[i] * count <= MAX_MSG_SIZE; count *= 4) {
+            double t_separate = 0, t_multi = 0;
+
+            if (measure_gather(&hg_test_info, bulk_handle, entry_sizes[i],
+                count, HG_FALSE, &t_separate) != HG_SUCCESS
+                || measure_gather(&hg_test_info, bulk_handle, entry_sizes[i],
+                    count, HG_TRUE, &t_multi) != HG_SUCCESS) {
+                ret = EXIT_FAILURE;
+                goto done;
+            }
+
+            if (hg_test_info.na_test_info.mpi_comm_rank == 0)
+                fprintf(stdout, "%-*u%*lu%*.*f%*.*f\n", 10, count, NWIDTH,
+                    (unsigned long) entry_sizes[i], NWIDTH, NDIGITS,
+                    t_separate, NWIDTH, NDIGITS, t_multi);
+        }
+    }
+
+done:
+    HG_Bulk_free(bulk_handle);
+    free(bulk_buf);
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "na_test.h"
+
+#include "mercury_time.h"
+#include "mercury_thread.h"
+#include "mercury_atomic.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Startup benchmark: look up N distinct peers either one at a time or with
+ * a single HG_Addr_lookup_multi() call, N doubles up to --loop (na_sm accepts
+ * at most 64 pending connections). Peers are listening classes created in
+ * this process and progressed by a separate thread, the address cache is
+ * disabled so that every lookup reaches the NA plugin. Note that na_sm only
+ * accepts connections every NA_SM_ACCEPT_INTERVAL on a given listener, peers
+ * looked up again within that interval include the wait. */
+
+#define NDIGITS 9
+#define NWIDTH 13
+
+struct hg_test_lookup_perf_args {
+    hg_request_t *request;
+    hg_addr_t *addrs;
+    unsigned int index;
+    hg_return_t ret;
+};
+
+struct hg_test_lookup_perf_peers {
+    hg_class_t **classes;
+    hg_context_t **contexts;
+    char **names;
+    unsigned int count;
+    hg_thread_t thread;
+    hg_bool_t thread_started;
+    hg_atomic_int32_t done;
+};
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_test_lookup_perf_peers_progress(void *arg)
+{
+    struct hg_test_lookup_perf_peers *peers =
+        (struct hg_test_lookup_perf_peers *) arg;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+
+    /* Peers must progress to accept incoming connections */
+    while (!hg_atomic_get32(&peers->done)) {
+        unsigned int i;
+
+        for (i = 0; i < peers->count; i++) {
+            unsigned int actual_count;
+
+            HG_Progress(peers->contexts[i], 0);
+            while (HG_Trigger(peers->contexts[i], 0, 1, &actual_count)
+                == HG_SUCCESS && actual_count)
+                continue;
+        }
+        hg_thread_yield();
+    }
+
+    return thread_ret;
+}
+
+/**
+ *
+ */
+static void
+hg_test_lookup_perf_peers_destroy(struct hg_test_lookup_perf_peers *peers)
+{
+    unsigned int i;
+
+    if (peers->thread_started) {
+        hg_atomic_set32(&peers->done, 1);
+        hg_thread_join(peers->thread);
+    }
+    for (i = 0; i < peers->count; i++) {
+        free(peers->names[i]);
+        HG_Context_destroy(peers->contexts[i]);
+        HG_Finalize(peers->classes[i]);
+    }
+    free(peers->names);
+    free(peers->contexts);
+    free(peers->classes);
+}
+
+/**
+ *
+ */
+static hg_return_t
+hg_test_lookup_perf_peers_create(const char *info_string, unsigned int count,
+    struct hg_test_lookup_perf_peers *peers)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_atomic_init32(&peers->done, 0);
+    peers->count = 0;
+    peers->thread_started = HG_FALSE;
+    peers->classes = (hg_class_t **) malloc(count * sizeof(hg_class_t *));
+    peers->contexts = (hg_context_t **) malloc(count * sizeof(hg_context_t *));
+    peers->names = (char **) malloc(count * sizeof(char *));
+    if (!peers->classes || !peers->contexts || !peers->names) {
+        fprintf(stderr, "Could not allocate peers\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    while (peers->count < count) {
+        hg_class_t *hg_class;
+        hg_context_t *context;
+        hg_addr_t self_addr = HG_ADDR_NULL;
+        hg_size_t name_size = NA_TEST_MAX_ADDR_NAME;
+        char *name;
+
+        hg_class = HG_Init(info_string, HG_TRUE);
+        if (!hg_class) {
+            fprintf(stderr, "Could not initialize peer class\n");
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+        context = HG_Context_create(hg_class);
+        if (!context) {
+            fprintf(stderr, "Could not create peer context\n");
+            HG_Finalize(hg_class);
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        name = (char *) malloc(name_size);
+        if (!name || HG_Addr_self(hg_class, &self_addr) != HG_SUCCESS
+            || HG_Addr_to_string(hg_class, name, &name_size, self_addr)
+                != HG_SUCCESS) {
+            fprintf(stderr, "Could not get peer address\n");
+            HG_Addr_free(hg_class, self_addr);
+            free(name);
+            HG_Context_destroy(context);
+            HG_Finalize(hg_class);
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+        HG_Addr_free(hg_class, self_addr);
+
+        peers->classes[peers->count] = hg_class;
+        peers->contexts[peers->count] = context;
+        peers->names[peers->count] = name;
+        peers->count++;
+    }
+
+    if (hg_thread_create(&peers->thread, hg_test_lookup_perf_peers_progress,
+        peers) != HG_UTIL_SUCCESS) {
+        fprintf(stderr, "Could not create peer progress thread\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    peers->thread_started = HG_TRUE;
+
+done:
+    if (ret != HG_SUCCESS)
+        hg_test_lookup_perf_peers_destroy(peers);
+    return ret;
+}
+
+static hg_return_t
+hg_test_lookup_perf_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_test_lookup_perf_args *args =
+        (struct hg_test_lookup_perf_args *) callback_info->arg;
+
+    args->ret = callback_info->ret;
+    if (args->addrs)
+        args->addrs[args->index] = callback_info->info.lookup.addr;
+    hg_request_complete(args->request);
+
+    return HG_SUCCESS;
+}
+
+/**
+ * Lookups cannot be canceled (NA_Cancel() is a no-op for lookups in the NA
+ * plugins), keep waiting until the callback has run so that neither args nor
+ * addrs are released while still referenced.
+ */
+static hg_return_t
+hg_test_lookup_perf_wait(struct hg_test_lookup_perf_args *args)
+{
+    unsigned int completed = 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_request_wait(args->request, HG_MAX_IDLE_TIME, &completed);
+    if (!completed) {
+        fprintf(stderr, "Lookup did not complete, waiting for callback\n");
+        ret = HG_TIMEOUT;
+        do {
+            hg_request_wait(args->request, HG_MAX_IDLE_TIME, &completed);
+        } while (!completed);
+    }
+    hg_request_reset(args->request);
+    if (ret == HG_SUCCESS)
+        ret = args->ret;
+
+    return ret;
+}
+
+/**
+ *
+ */
+static hg_return_t
+hg_test_lookup_perf_serial(struct hg_test_info *hg_test_info,
+    struct hg_test_lookup_perf_args *args, const char **names,
+    hg_addr_t *addrs, unsigned int count)
+{
+    unsigned int i;
+    hg_return_t ret = HG_SUCCESS;
+
+    args->addrs = addrs;
+    for (i = 0; i < count; i++) {
+        args->index = i;
+        ret = HG_Addr_lookup(hg_test_info->context, hg_test_lookup_perf_cb,
+            args, names[i], HG_OP_ID_IGNORE);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not start lookup\n");
+            goto done;
+        }
+        ret = hg_test_lookup_perf_wait(args);
+        if (ret != HG_SUCCESS)
+            goto done;
+    }
+
+done:
+    return ret;
+}
+
+/**
+ *
+ */
+static hg_return_t
+hg_test_lookup_perf_multi(struct hg_test_info *hg_test_info,
+    struct hg_test_lookup_perf_args *args, const char **names,
+    hg_addr_t *addrs, unsigned int count)
+{
+    hg_return_t ret;
+
+    args->addrs = NULL;
+    ret = HG_Addr_lookup_multi(hg_test_info->context, hg_test_lookup_perf_cb,
+        args, names, addrs, count, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start lookup\n");
+        goto done;
+    }
+    ret = hg_test_lookup_perf_wait(args);
+
+done:
+    return ret;
+}
+
+/**
+ *
+ */
+static hg_return_t
+measure_lookup(struct hg_test_info *hg_test_info,
+    struct hg_test_lookup_perf_peers *peers, unsigned int count)
+{
+    struct hg_test_lookup_perf_args args;
+    const char **names = NULL;
+    hg_addr_t *addrs = NULL;
+    double td[2];
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i, j;
+
+    names = (const char **) malloc(count * sizeof(const char *));
+    addrs = (hg_addr_t *) malloc(count * sizeof(hg_addr_t));
+    if (!names || !addrs) {
+        fprintf(stderr, "Could not allocate addresses\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    for (i = 0; i < count; i++)
+        names[i] = peers->names[i];
+
+    args.request = hg_request_create(hg_test_info->request_class);
+    if (!args.request) {
+        fprintf(stderr, "Could not create request\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    for (j = 0; j < 2; j++) {
+        hg_time_t t1, t2;
+
+        for (i = 0; i < count; i++)
+            addrs[i] = HG_ADDR_NULL;
+
+        hg_time_get_current(&t1);
+        ret = (j == 0) ?
+            hg_test_lookup_perf_serial(hg_test_info, &args, names, addrs,
+                count) :
+            hg_test_lookup_perf_multi(hg_test_info, &args, names, addrs, count);
+        hg_time_get_current(&t2);
+        td[j] = hg_time_to_double(hg_time_subtract(t2, t1));
+
+        for (i = 0; i < count; i++)
+            HG_Addr_free(hg_test_info->hg_class, addrs[i]);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not lookup addresses\n");
+            break;
+        }
+    }
+
+    hg_request_destroy(args.request);
+
+    if (ret == HG_SUCCESS)
+        printf("%*u%*.*f%*.*f%*.*g%*.*g\n", NWIDTH, count, NWIDTH, NDIGITS,
+            td[0], NWIDTH, NDIGITS, td[1], NWIDTH, NDIGITS,
+            (double) count / td[0], NWIDTH, NDIGITS, (double) count / td[1]);
+
+done:
+    free(addrs);
+    free(names);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    struct hg_test_lookup_perf_peers peers;
+    char info_string[NA_TEST_MAX_ADDR_NAME];
+    unsigned int count;
+    int ret = EXIT_SUCCESS;
+
+    /* Cached lookups would not reach the NA plugin */
+    hg_test_info.addr_cache_size = 0;
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    sprintf(info_string, "%s+%s", HG_Class_get_name(hg_test_info.hg_class),
+        HG_Class_get_protocol(hg_test_info.hg_class));
+    if (hg_test_lookup_perf_peers_create(info_string,
+        (unsigned int) hg_test_info.na_test_info.loop, &peers) != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    printf("###############################################################################\n");
+    printf("# Address lookup test -- up to %d peer(s)\n",
+        hg_test_info.na_test_info.loop);
+    printf("###############################################################################\n");
+    printf("%*s%*s%*s%*s%*s\n", NWIDTH, "#     Peers", NWIDTH, "Serial (s)",
+        NWIDTH, "Multi (s)", NWIDTH, "Serial (l/s)", NWIDTH, "Multi (l/s)");
+
+    for (count = 1; count <= (unsigned int) hg_test_info.na_test_info.loop;
+        count *= 2) {
+        if (measure_lookup(&hg_test_info, &peers, count) != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            break;
+        }
+    }
+
+    hg_test_lookup_perf_peers_destroy(&peers);
+
+done:
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
@@ -12,8 +12,20 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 extern hg_id_t hg_test_overflow_id_g;
+extern hg_id_t hg_test_overflow_codec_id_g;
+extern hg_id_t hg_test_overflow_input_id_g;
+extern hg_id_t hg_test_overflow_fail_id_g;
+extern hg_id_t hg_test_overflow_input_fail_id_g;
+extern hg_atomic_int32_t hg_test_codec_decode_count_g;
+
+struct forward_cb_args {
+    hg_request_t *request;
+    hg_return_t ret;
+    int decode_count;
+};
 
 //#define HG_TEST_DEBUG
 #ifdef HG_TEST_DEBUG
@@ -28,14 +40,16 @@ static hg_return_t
 hg_test_rpc_forward_cb(const struct hg_cb_info *callback_info)
 {
     hg_handle_t handle = callback_info->info.forward.handle;
-    hg_request_t *request = (hg_request_t *) callback_info->arg;
+    struct forward_cb_args *args =
+        (struct forward_cb_args *) callback_info->arg;
     overflow_out_t out_struct;
     hg_string_t string;
-    size_t string_len;
+    size_t string_len, i;
     hg_return_t ret = HG_SUCCESS;
 
     if (callback_info->ret != HG_SUCCESS) {
         HG_TEST_LOG_WARNING("Return from callback info is not HG_SUCCESS");
+        ret = callback_info->ret;
         goto done;
     }
 
@@ -50,29 +64,149 @@ hg_test_rpc_forward_cb(const struct hg_cb_info *callback_info)
     string = out_struct.string;
     string_len = out_struct.string_len;
     HG_TEST_LOG_DEBUG("Returned string (length %zu): %s", string_len, string);
-    (void) string;
-    (void) string_len;
+    if (!string || strlen(string) != string_len) {
+        HG_TEST_LOG_ERROR("Returned string length does not match");
+        ret = HG_PROTOCOL_ERROR;
+    } else {
+        for (i = 0; i < string_len; i++)
+            if (string[i] != 'h') {
+                HG_TEST_LOG_ERROR("Returned string is corrupted");
+                ret = HG_PROTOCOL_ERROR;
+                break;
+            }
+    }
 
     /* Free request */
-    ret = HG_Free_output(handle, &out_struct);
+    if (HG_Free_output(handle, &out_struct) != HG_SUCCESS) {
+        ret = HG_PROTOCOL_ERROR;
+        HG_TEST_LOG_ERROR("Could not free output");
+        goto done;
+    }
+
+done:
+    args->ret = ret;
+    hg_request_complete(args->request);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_forward_input_cb(const struct hg_cb_info *callback_info)
+{
+    hg_handle_t handle = callback_info->info.forward.handle;
+    struct forward_cb_args *args =
+        (struct forward_cb_args *) callback_info->arg;
+    rpc_open_out_t out_struct;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (callback_info->ret != HG_SUCCESS) {
+        HG_TEST_LOG_WARNING("Return from callback info is not HG_SUCCESS");
+        ret = callback_info->ret;
+        goto done;
+    }
+
+    /* Get output */
+    ret = HG_Get_output(handle, &out_struct);
     if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+
+    /* Target checked the string it received */
+    ret = (hg_return_t) out_struct.ret;
+    if (ret != HG_SUCCESS)
+        HG_TEST_LOG_ERROR("Input string is corrupted");
+    args->decode_count = out_struct.event_id;
+
+    /* Free request */
+    if (HG_Free_output(handle, &out_struct) != HG_SUCCESS) {
+        ret = HG_PROTOCOL_ERROR;
         HG_TEST_LOG_ERROR("Could not free output");
         goto done;
     }
 
 done:
-    hg_request_complete(request);
+    args->ret = ret;
+    hg_request_complete(args->request);
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_overflow_input(hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t addr, hg_id_t rpc_id,
+    int *decode_count)
+{
+    hg_request_t *request = NULL;
+    struct forward_cb_args forward_cb_args;
+    hg_handle_t handle;
+    overflow_out_t in_struct;
+    size_t string_len =
+        HG_Class_get_input_eager_size(HG_Context_get_class(context)) * 2;
+    hg_string_t string = NULL;
+    hg_return_t hg_ret = HG_SUCCESS;
+    unsigned int flag;
+
+    request = hg_request_create(request_class);
+
+    /* Input does not fit into eager message */
+    string = (hg_string_t) malloc(string_len + 1);
+    if (!string) {
+        HG_TEST_LOG_ERROR("Could not allocate string");
+        hg_ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(string, 'h', string_len);
+    string[string_len] = '\0';
+    in_struct.string = string;
+    in_struct.string_len = string_len;
+
+    /* Create RPC request */
+    hg_ret = HG_Create(context, addr, rpc_id, &handle);
+    if (hg_ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create handle");
+        goto done;
+    }
+
+    /* Forward call to remote addr and get a new request */
+    HG_TEST_LOG_DEBUG("Forwarding RPC, op id: %u...", rpc_id);
+    forward_cb_args.request = request;
+    forward_cb_args.ret = HG_SUCCESS;
+    forward_cb_args.decode_count = 0;
+    hg_ret = HG_Forward(handle, hg_test_rpc_forward_input_cb, &forward_cb_args,
+        &in_struct);
+    if (hg_ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not forward call");
+        goto done;
+    }
+
+    /* Errors must complete the RPC, not time out */
+    hg_request_wait(request, HG_MAX_IDLE_TIME, &flag);
+    if (!flag) {
+        HG_TEST_LOG_ERROR("RPC did not complete");
+        hg_ret = HG_TIMEOUT;
+        goto done;
+    }
+    HG_Destroy(handle);
+    hg_ret = forward_cb_args.ret;
+    *decode_count = forward_cb_args.decode_count;
+
+done:
+    free(string);
+    hg_request_destroy(request);
+    return hg_ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_overflow(hg_context_t *context, hg_request_class_t *request_class,
     hg_addr_t addr, hg_id_t rpc_id, hg_cb_t callback)
 {
     hg_request_t *request = NULL;
+    struct forward_cb_args forward_cb_args;
     hg_handle_t handle;
     hg_return_t hg_ret = HG_SUCCESS;
+    unsigned int flag;
 
     request = hg_request_create(request_class);
 
@@ -85,13 +219,26 @@ hg_test_overflow(hg_context_t *context, hg_request_class_t *request_class,
 
     /* Forward call to remote addr and get a new request */
     HG_TEST_LOG_DEBUG("Forwarding RPC, op id: %u...", rpc_id);
-    hg_ret = HG_Forward(handle, callback, request, NULL);
+    forward_cb_args.request = request;
+    forward_cb_args.ret = HG_SUCCESS;
+    hg_ret = HG_Forward(handle, callback, &forward_cb_args, NULL);
     if (hg_ret != HG_SUCCESS) {
         HG_TEST_LOG_ERROR("Could not forward call");
         goto done;
     }
 
-    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+    hg_request_wait(request, HG_MAX_IDLE_TIME, &flag);
+    if (!flag) {
+        HG_TEST_LOG_ERROR("RPC did not complete");
+        hg_ret = HG_TIMEOUT;
+        goto done;
+    }
+    if (forward_cb_args.ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Error in forward callback");
+        hg_ret = forward_cb_args.ret;
+        HG_Destroy(handle);
+        goto done;
+    }
 
     /* Complete */
     hg_ret = HG_Destroy(handle);
@@ -111,11 +258,15 @@ main(int argc, char *argv[])
 {
     struct hg_test_info hg_test_info = { 0 };
     hg_return_t hg_ret;
+    int decode_count[2], decoded;
     int ret = EXIT_SUCCESS;
 
     /* Initialize the interface */
     HG_Test_init(argc, argv, &hg_test_info);
 
+    /* Payloads sent to ourself are never encoded */
+    decoded = hg_test_info.na_test_info.self_send ? 0 : 1;
+
     /* Overflow RPC test */
     HG_TEST("overflow RPC");
     hg_ret = hg_test_overflow(hg_test_info.context, hg_test_info.request_class,
@@ -127,6 +278,65 @@ main(int argc, char *argv[])
     }
     HG_PASSED();
 
+    /* Overflow RPC test with compressed output, output must be decoded */
+    HG_TEST("compressed overflow RPC");
+    decode_count[0] = hg_atomic_get32(&hg_test_codec_decode_count_g);
+    hg_ret = hg_test_overflow(hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, hg_test_overflow_codec_id_g,
+        hg_test_rpc_forward_cb);
+    if (hg_ret != HG_SUCCESS
+        || hg_atomic_get32(&hg_test_codec_decode_count_g)
+            != decode_count[0] + decoded) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    /* Overflow RPC test with compressed input, target reports how many
+     * payloads it has decoded */
+    HG_TEST("compressed overflow input RPC");
+    hg_ret = hg_test_overflow_input(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_overflow_input_id_g, &decode_count[0]);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    hg_ret = hg_test_overflow_input(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_overflow_input_id_g, &decode_count[1]);
+    if (hg_ret != HG_SUCCESS
+        || decode_count[1] != decode_count[0] + decoded) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
+    if (!hg_test_info.na_test_info.self_send) {
+        /* Output that cannot be decoded completes the RPC with an error */
+        HG_TEST("overflow RPC decode error");
+        hg_ret = hg_test_overflow(hg_test_info.context,
+            hg_test_info.request_class, hg_test_info.target_addr,
+            hg_test_overflow_fail_id_g, hg_test_rpc_forward_cb);
+        if (hg_ret == HG_SUCCESS || hg_ret == HG_TIMEOUT) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+        HG_PASSED();
+
+        /* Input that cannot be decoded makes the target respond with an
+         * error */
+        HG_TEST("overflow input RPC decode error");
+        hg_ret = hg_test_overflow_input(hg_test_info.context,
+            hg_test_info.request_class, hg_test_info.target_addr,
+            hg_test_overflow_input_fail_id_g, &decode_count[0]);
+        if (hg_ret == HG_SUCCESS || hg_ret == HG_TIMEOUT) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+        HG_PASSED();
+    }
+
 done:
     if (ret != EXIT_SUCCESS)
         HG_FAILED();
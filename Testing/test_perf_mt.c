@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "na_test.h"
+
+#include "mercury_time.h"
+#include "mercury_atomic.h"
+#include "mercury_thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Multi-threaded client: each thread creates, forwards and destroys its own
+ * handles on the shared context (use --threads to set thread count). If
+ * --contexts is set, thread i targets context i % contexts (see server_mt) */
+
+#define NDIGITS 9
+#define NWIDTH 13
+
+extern hg_id_t hg_test_perf_rpc_id_g;
+
+struct hg_test_perf_mt_args {
+    struct hg_test_info *hg_test_info;
+    unsigned int thread_id;
+    unsigned int op_count;
+    hg_return_t ret;
+};
+
+static hg_return_t
+hg_test_perf_mt_forward_cb(const struct hg_cb_info *callback_info)
+{
+    hg_request_complete((hg_request_t *) callback_info->arg);
+
+    return HG_SUCCESS;
+}
+
+static HG_THREAD_RETURN_TYPE
+hg_test_perf_mt_thread(void *arg)
+{
+    struct hg_test_perf_mt_args *args = (struct hg_test_perf_mt_args *) arg;
+    struct hg_test_info *hg_test_info = args->hg_test_info;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+    hg_request_t *request;
+    unsigned int i;
+
+    request = hg_request_create(hg_test_info->request_class);
+
+    for (i = 0; i < args->op_count; i++) {
+        hg_handle_t handle;
+
+        args->ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+            hg_test_perf_rpc_id_g, &handle);
+        if (args->ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not start call\n");
+            break;
+        }
+
+        /* Spread threads over target contexts */
+        if (hg_test_info->na_test_info.max_contexts > 1)
+            HG_Set_target_id(handle, (hg_uint8_t) (args->thread_id
+                % (unsigned int) hg_test_info->na_test_info.max_contexts));
+
+        args->ret = HG_Forward(handle, hg_test_perf_mt_forward_cb, request,
+            NULL);
+        if (args->ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not forward call\n");
+            HG_Destroy(handle);
+            break;
+        }
+
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_request_reset(request);
+
+        args->ret = HG_Destroy(handle);
+        if (args->ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not complete\n");
+            break;
+        }
+    }
+
+    hg_request_destroy(request);
+
+    return thread_ret;
+}
+
+/**
+ *
+ */
+static hg_return_t
+measure_rpc_mt(struct hg_test_info *hg_test_info, unsigned int thread_count)
+{
+    struct hg_test_perf_mt_args *args = NULL;
+    hg_thread_t *threads = NULL;
+    unsigned int op_count =
+        (unsigned int) hg_test_info->na_test_info.loop / thread_count;
+    hg_time_t t1, t2;
+    double td;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    if (!op_count)
+        op_count = 1;
+
+    if (hg_test_info->na_test_info.mpi_comm_rank == 0)
+        printf("# Executing RPC with %d client(s) -- %u thread(s) x %u call(s)\n",
+            hg_test_info->na_test_info.mpi_comm_size, thread_count, op_count);
+
+    args = (struct hg_test_perf_mt_args *) malloc(
+        thread_count * sizeof(struct hg_test_perf_mt_args));
+    threads = (hg_thread_t *) malloc(thread_count * sizeof(hg_thread_t));
+    if (!args || !threads) {
+        fprintf(stderr, "Could not allocate threads\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    NA_Test_barrier(&hg_test_info->na_test_info);
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < thread_count; i++) {
+        args[i].hg_test_info = hg_test_info;
+        args[i].thread_id = i;
+        args[i].op_count = op_count;
+        args[i].ret = HG_SUCCESS;
+        hg_thread_create(&threads[i], hg_test_perf_mt_thread, &args[i]);
+    }
+    for (i = 0; i < thread_count; i++)
+        hg_thread_join(threads[i]);
+
+    NA_Test_barrier(&hg_test_info->na_test_info);
+    hg_time_get_current(&t2);
+    td = hg_time_to_double(hg_time_subtract(t2, t1));
+
+    for (i = 0; i < thread_count; i++) {
+        if (args[i].ret != HG_SUCCESS) {
+            ret = args[i].ret;
+            goto done;
+        }
+    }
+
+    if (hg_test_info->na_test_info.mpi_comm_rank == 0) {
+        printf("%*s%*s\n", NWIDTH, "#    Time (s)", NWIDTH, "Calls (c/s)");
+        printf("%*.*f%*.*g\n", NWIDTH, NDIGITS, td, NWIDTH, NDIGITS,
+            (double) (op_count * thread_count)
+            * hg_test_info->na_test_info.mpi_comm_size / td);
+    }
+
+done:
+    free(threads);
+    free(args);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    unsigned int thread_count;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+        printf("###############################################################################\n");
+        printf("# Multi-threaded RPC test\n");
+        printf("###############################################################################\n");
+    }
+
+    /* Scale number of client threads up to thread count */
+    for (thread_count = 1; thread_count <= hg_test_info.thread_count;
+        thread_count *= 2) {
+        if (measure_rpc_mt(&hg_test_info, thread_count) != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            break;
+        }
+    }
+
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
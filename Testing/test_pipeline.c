@@ -9,106 +9,175 @@
  */
 
 #include "mercury_test.h"
+#include "mercury_time.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
+/* Pipelined write benchmark: server pulls data either with a single transfer
+ * or with HG_Bulk_transfer_pipelined(), sizes are bounded by the server
+ * buffer (MERCURY_TESTING_BUFFER_SIZE) */
+
+#define BENCHMARK_NAME "Pipelined write BW (server bulk pull)"
+#define STRING(s) #s
+#define XSTRING(s) STRING(s)
+#define VERSION_NAME \
+    XSTRING(HG_VERSION_MAJOR) \
+    "." \
+    XSTRING(HG_VERSION_MINOR) \
+    "." \
+    XSTRING(HG_VERSION_PATCH)
+
+#define SKIP 10
+#define NDIGITS 2
+#define NWIDTH 20
+#define MIN_MSG_SIZE (1024 * 1024)
+#define MAX_MSG_SIZE (MERCURY_TESTING_BUFFER_SIZE * 1024 * 1024)
+#define SMALL_CHUNK_SIZE (256 * 1024)
+
 extern hg_id_t hg_test_pipeline_write_id_g;
 
-/*****************************************************************************/
-int main(int argc, char *argv[])
+static hg_return_t
+hg_test_perf_forward_cb(const struct hg_cb_info *callback_info)
+{
+    hg_request_complete((hg_request_t *) callback_info->arg);
+
+    return HG_SUCCESS;
+}
+
+/**
+ * Return bandwidth (MB/s) of data pulled by server, chunk_size of 0 pulls
+ * data with a single transfer.
+ */
+static hg_return_t
+measure_pipeline(struct hg_test_info *hg_test_info, hg_bulk_t bulk_handle,
+    hg_size_t chunk_size, unsigned int window, double *bandwidth)
 {
-    hg_addr_t addr;
-
-    bulk_write_in_t bulk_write_in_struct;
-    bulk_write_out_t bulk_write_out_struct;
-    hg_request_t bulk_write_request;
-
-    int fildes = 12345;
-    int *bulk_buf;
-    void *buf_ptr[1];
-    size_t count = (1024 * 1024 * MERCURY_TESTING_BUFFER_SIZE) / sizeof(int);
-    size_t bulk_size = count * sizeof(int);
-    hg_bulk_t bulk_handle = HG_BULK_NULL;
-    size_t bulk_write_ret = 0;
-
-    hg_status_t bla_open_status;
-    hg_return_t hg_ret;
+    bulk_write_in_t in_struct;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_request_t *request;
+    hg_size_t nbytes = HG_Bulk_get_size(bulk_handle);
+    size_t loop = (size_t) hg_test_info->na_test_info.loop;
+    double time_read = 0;
+    hg_return_t ret = HG_SUCCESS;
     size_t i;
 
-    /* Initialize the interface (for convenience, shipper_test_client_init
-     * initializes the network interface with the selected plugin)
-     */
-    HG_Test_client_init(argc, argv, &addr, NULL);
+    request = hg_request_create(hg_test_info->request_class);
 
-    /* Prepare bulk_buf */
-    bulk_buf = (int*) malloc(bulk_size);
-    for (i = 0; i < count; i++) {
-        bulk_buf[i] = (int) i;
-    }
-    *buf_ptr = bulk_buf;
-
-    /* Register memory */
-    hg_ret = HG_Bulk_handle_create(1, buf_ptr, &bulk_size,
-            HG_BULK_READ_ONLY, &bulk_handle);
-    if (hg_ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not create bulk data handle\n");
-        return EXIT_FAILURE;
+    ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+        hg_test_pipeline_write_id_g, &handle);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not start call\n");
+        goto done;
     }
 
     /* Fill input structure */
-    bulk_write_in_struct.fildes = fildes;
-    bulk_write_in_struct.bulk_handle = bulk_handle;
-
-    /* Forward call to remote addr and get a new request */
-    /* printf("Forwarding bulk_write, op id: %u...\n", hg_test_bulk_write_id_g); */
-    hg_ret = HG_Forward(addr, hg_test_pipeline_write_id_g,
-            &bulk_write_in_struct, &bulk_write_out_struct, &bulk_write_request);
-    if (hg_ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not forward call\n");
-        return EXIT_FAILURE;
+    in_struct.fildes = (hg_int32_t) window;
+    in_struct.transfer_size = chunk_size;
+    in_struct.origin_offset = 0;
+    in_struct.target_offset = 0;
+    in_struct.bulk_handle = bulk_handle;
+
+    for (i = 0; i < SKIP + loop; i++) {
+        hg_time_t t1, t2;
+
+        /* Warm up for bulk data */
+        if (i == SKIP)
+            NA_Test_barrier(&hg_test_info->na_test_info);
+
+        hg_time_get_current(&t1);
+        ret = HG_Forward(handle, hg_test_perf_forward_cb, request, &in_struct);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not forward call\n");
+            goto done;
+        }
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_time_get_current(&t2);
+        hg_request_reset(request);
+
+        if (i >= SKIP)
+            time_read += hg_time_to_double(hg_time_subtract(t2, t1));
     }
+    NA_Test_barrier(&hg_test_info->na_test_info);
 
-    /* Wait for call to be executed and return value to be sent back
-     * (Request is freed when the call completes)
-     */
-    hg_ret = HG_Wait(bulk_write_request, HG_MAX_IDLE_TIME, &bla_open_status);
-    if (hg_ret != HG_SUCCESS) {
-        fprintf(stderr, "Error during wait\n");
-        return EXIT_FAILURE;
-    }
-    if (!bla_open_status) {
-        fprintf(stderr, "Operation did not complete\n");
-        return EXIT_FAILURE;
-    } else {
-        /* printf("Call completed\n"); */
-    }
+    *bandwidth = (double) nbytes * (double) loop / (1024 * 1024) / time_read;
 
-    /* Get output parameters */
-    bulk_write_ret = bulk_write_out_struct.ret;
-    if (bulk_write_ret != bulk_size) {
-        fprintf(stderr, "Data not correctly processed\n");
-    }
+done:
+    if (handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    hg_request_destroy(request);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    char *bulk_buf = NULL;
+    size_t size;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
 
-    /* Free request */
-    hg_ret = HG_Request_free(bulk_write_request);
-    if (hg_ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not free request\n");
-        return EXIT_FAILURE;
+    /* Prepare bulk_buf */
+    bulk_buf = malloc(MAX_MSG_SIZE);
+    if (!bulk_buf) {
+        fprintf(stderr, "Could not allocate buffer\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    for (size = 0; size < MAX_MSG_SIZE; size++)
+        bulk_buf[size] = (char) size;
+
+    if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+        fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+        fprintf(stdout, "# Loop %d times from size %d to %d byte(s), "
+            "window of %d chunks\n", hg_test_info.na_test_info.loop,
+            MIN_MSG_SIZE, MAX_MSG_SIZE, HG_BULK_PIPELINE_WINDOW);
+#ifdef MERCURY_TESTING_HAS_VERIFY_DATA
+        fprintf(stdout, "# WARNING verifying data, output will be slower\n");
+#endif
+        fprintf(stdout, "%-*s%*s%*s%*s\n", 10, "# Size", NWIDTH,
+            "Single (MB/s)", NWIDTH, "256KB chunks (MB/s)", NWIDTH,
+            "1MB chunks (MB/s)");
+        fflush(stdout);
     }
 
-    /* Free memory handle */
-    hg_ret = HG_Bulk_handle_free(bulk_handle);
-    if (hg_ret != HG_SUCCESS) {
-        fprintf(stderr, "Could not free bulk data handle\n");
-        return EXIT_FAILURE;
+    for (size = MIN_MSG_SIZE; size <= MAX_MSG_SIZE; size *= 2) {
+        hg_bulk_t bulk_handle = HG_BULK_NULL;
+        void *buf_ptr = bulk_buf;
+        hg_size_t buf_size = size;
+        double bw_single = 0, bw_small = 0, bw_large = 0;
+
+        if (HG_Bulk_create(hg_test_info.hg_class, 1, &buf_ptr, &buf_size,
+            HG_BULK_READ_ONLY, &bulk_handle) != HG_SUCCESS) {
+            fprintf(stderr, "Could not create bulk data handle\n");
+            ret = EXIT_FAILURE;
+            break;
+        }
+
+        if (measure_pipeline(&hg_test_info, bulk_handle, 0, 0, &bw_single)
+            != HG_SUCCESS
+            || measure_pipeline(&hg_test_info, bulk_handle, SMALL_CHUNK_SIZE,
+                HG_BULK_PIPELINE_WINDOW, &bw_small) != HG_SUCCESS
+            || measure_pipeline(&hg_test_info, bulk_handle,
+                HG_BULK_PIPELINE_CHUNK_SIZE, HG_BULK_PIPELINE_WINDOW,
+                &bw_large) != HG_SUCCESS)
+            ret = EXIT_FAILURE;
+        HG_Bulk_free(bulk_handle);
+        if (ret != EXIT_SUCCESS)
+            break;
+
+        if (hg_test_info.na_test_info.mpi_comm_rank == 0)
+            fprintf(stdout, "%-*d%*.*f%*.*f%*.*f\n", 10, (int) size, NWIDTH,
+                NDIGITS, bw_single, NWIDTH, NDIGITS, bw_small, NWIDTH,
+                NDIGITS, bw_large);
     }
 
-    /* Free bulk_buf */
+done:
     free(bulk_buf);
-    bulk_buf = NULL;
-
-    HG_Test_finalize();
+    HG_Test_finalize(&hg_test_info);
 
-    return EXIT_SUCCESS;
+    return ret;
 }
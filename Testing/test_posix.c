@@ -394,11 +394,25 @@ main(int argc, char *argv[])
 
     printf("(%d) Reading data...\n", rank);
 
-    nbyte = read(fd, read_buf, sizeof(int) * n_ints);
-    if (nbyte < 0) {
+    /* Server exposes file ranges with file-backed bulk handles, first read
+     * ends in the middle of a page so that next range starts unaligned */
+    nbyte = read(fd, read_buf, sizeof(int) * 1000);
+    if (nbyte != sizeof(int) * 1000) {
         fprintf(stderr, "Error detected in client_posix_read\n");
         return EXIT_FAILURE;
     }
+    nbyte = read(fd, read_buf + 1000, sizeof(int) * (n_ints - 1000));
+    if (nbyte != (ssize_t) (sizeof(int) * (n_ints - 1000))) {
+        fprintf(stderr, "Error detected in client_posix_read\n");
+        return EXIT_FAILURE;
+    }
+    nbyte += (ssize_t) (sizeof(int) * 1000);
+
+    /* Nothing left to read */
+    if (read(fd, read_buf, sizeof(int)) != 0) {
+        fprintf(stderr, "Error detected in client_posix_read at end of file\n");
+        return EXIT_FAILURE;
+    }
 
     printf("(%d) Closing file...\n", rank);
 
@@ -431,5 +445,5 @@ main(int argc, char *argv[])
     HG_Test_finalize(&hg_test_info);
 #endif
 
-    return EXIT_SUCCESS;
+    return (error) ? EXIT_FAILURE : EXIT_SUCCESS;
 }
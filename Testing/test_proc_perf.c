@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "mercury_checksum.h"
+
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Encode microbenchmark: cost of encoding a small header plus a raw payload
+ * of increasing size, without checksum and with CRC32C checksum (requires
+ * MERCURY_USE_CHECKSUMS), no RPC is sent (run with --self_send) */
+
+#define NDIGITS 3
+#define NWIDTH 15
+#define MAX_MSG_SIZE (MERCURY_TESTING_BUFFER_SIZE * 1024 * 1024)
+#define SMALL_LOOP 1000
+
+struct hg_test_proc_perf_in {
+    hg_uint64_t id;
+    hg_uint32_t count;
+    hg_uint8_t flags;
+    hg_size_t buf_size;
+    void *buf;
+};
+
+/**
+ *
+ */
+static hg_return_t
+hg_test_proc_perf_in(hg_proc_t proc, struct hg_test_proc_perf_in *in)
+{
+    hg_return_t ret;
+
+    ret = hg_proc_hg_uint64_t(proc, &in->id);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint32_t(proc, &in->count);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint8_t(proc, &in->flags);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_size_t(proc, &in->buf_size);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_raw(proc, in->buf, in->buf_size);
+
+done:
+    return ret;
+}
+
+/**
+ * Return average time (us) to encode and flush in struct.
+ */
+static hg_return_t
+measure_encode(hg_class_t *hg_class, hg_proc_hash_t hash, void *enc_buf,
+    hg_size_t enc_buf_size, struct hg_test_proc_perf_in *in, size_t loop,
+    double *time)
+{
+    hg_proc_t proc = HG_PROC_NULL;
+    hg_time_t t1, t2;
+    size_t i;
+    hg_return_t ret;
+
+    ret = hg_proc_create(hg_class, hash, &proc);
+    if (ret != HG_SUCCESS) {
+        fprintf(stderr, "Could not create proc\n");
+        goto done;
+    }
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < loop; i++) {
+        ret = hg_proc_reset(proc, enc_buf, enc_buf_size, HG_ENCODE);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not reset proc\n");
+            goto done;
+        }
+        ret = hg_test_proc_perf_in(proc, in);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not encode\n");
+            goto done;
+        }
+        ret = hg_proc_flush(proc);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not flush proc\n");
+            goto done;
+        }
+    }
+    hg_time_get_current(&t2);
+    *time = hg_time_to_double(hg_time_subtract(t2, t1)) * 1e6 / (double) loop;
+
+done:
+    hg_proc_free(proc);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    struct hg_test_proc_perf_in in;
+    void *enc_buf = NULL;
+    hg_size_t enc_buf_size = MAX_MSG_SIZE + 64;
+    hg_size_t size;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    in.id = 42;
+    in.count = 1;
+    in.flags = 0;
+    in.buf = malloc(MAX_MSG_SIZE);
+    enc_buf = malloc(enc_buf_size);
+    if (!in.buf || !enc_buf) {
+        fprintf(stderr, "Could not allocate buffers\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    memset(in.buf, 'a', MAX_MSG_SIZE);
+
+    printf("###############################################################################\n");
+    printf("# Proc encode test -- CRC32C %s\n",
+        hg_checksum_crc32c_is_accelerated() ? "(SSE4.2)" : "(table)");
+#ifndef HG_HAS_CHECKSUMS
+    printf("# Checksums disabled (MERCURY_USE_CHECKSUMS), CRC32 is not applied\n");
+#endif
+    printf("###############################################################################\n");
+    printf("%-*s%*s%*s%*s%*s\n", 10, "# Size", NWIDTH, "No hash (us)",
+        NWIDTH, "CRC32 (us)", NWIDTH, "Overhead (%)", NWIDTH, "CRC32C (MB/s)");
+
+    for (size = 1; size <= MAX_MSG_SIZE; size *= 2) {
+        size_t loop = (size_t) hg_test_info.na_test_info.loop * SMALL_LOOP;
+        double t_nohash, t_crc, t_raw, overhead;
+        hg_time_t t1, t2;
+        hg_uint32_t crc = 0;
+        size_t i;
+
+        /* Keep total work roughly constant on large sizes */
+        if (size > 8192)
+            loop = loop * 8192 / size + 1;
+        in.buf_size = size;
+
+        if (measure_encode(hg_test_info.hg_class, HG_NOHASH, enc_buf,
+            enc_buf_size, &in, loop, &t_nohash) != HG_SUCCESS
+            || measure_encode(hg_test_info.hg_class, HG_CRC32, enc_buf,
+            enc_buf_size, &in, loop, &t_crc) != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            break;
+        }
+
+        /* Raw checksum throughput */
+        hg_time_get_current(&t1);
+        for (i = 0; i < loop; i++)
+            crc = hg_checksum_crc32c(crc, in.buf, size);
+        hg_time_get_current(&t2);
+        t_raw = hg_time_to_double(hg_time_subtract(t2, t1));
+
+        overhead = (t_nohash > 0) ? (t_crc - t_nohash) * 100 / t_nohash : 0;
+        printf("%-*lu%*.*f%*.*f%*.*f%*.*f\n", 10, (unsigned long) size, NWIDTH,
+            NDIGITS, t_nohash, NWIDTH, NDIGITS, t_crc, NWIDTH, NDIGITS,
+            overhead, NWIDTH, NDIGITS,
+            (double) (size * loop) / (t_raw * 1024 * 1024));
+    }
+
+done:
+    free(enc_buf);
+    free(in.buf);
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
@@ -11,6 +11,7 @@
 #include "mercury_test.h"
 #include "mercury_time.h"
 #include "mercury_atomic.h"
+#include "mercury_mem_copy.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -229,6 +230,20 @@ main(int argc, char *argv[])
             fprintf(stdout, "# Loop %d times from size %d to %d byte(s) with "
                 "%u handle(s)\n",
                 hg_test_info.na_test_info.loop, 1, MAX_MSG_SIZE, nhandles);
+            /* The copy engine is process-wide and configured once when the
+             * class is initialized, and over na+sm data is copied by the
+             * process that posts the transfer (the server), so thread counts
+             * cannot be swept within a run: compare them by running client
+             * and server with the same -x/--copy_threads value */
+            fprintf(stdout, "# Local copy threads: %u, non-temporal size: "
+                "%lu byte(s)\n", hg_mem_copy_get_threads(),
+                (unsigned long) hg_test_info.copy_nt_size);
+            /* Run with -R/--rails to compare rail counts (server side) */
+            fprintf(stdout, "# Rails: %u, chunk size: %lu byte(s)\n",
+                HG_Core_context_get_na_rail_count(
+                    hg_test_info.context->core_context),
+                (unsigned long) HG_Core_context_get_na_rail_chunk_size(
+                    hg_test_info.context->core_context));
 #ifdef MERCURY_TESTING_HAS_VERIFY_DATA
             fprintf(stdout, "# WARNING verifying data, output will be slower\n");
 #endif
@@ -16,6 +16,8 @@
 
 extern hg_id_t hg_test_rpc_open_id_g;
 extern hg_id_t hg_test_rpc_open_id_no_resp_g;
+extern hg_id_t hg_test_executor_id_g;
+extern hg_id_t hg_test_executor_rpc_id_g;
 
 #define NINFLIGHT 32
 
@@ -24,6 +26,11 @@ struct forward_cb_args {
     rpc_handle_t *rpc_handle;
 };
 
+struct executor_cb_args {
+    hg_request_t *request;
+    int executor;
+};
+
 //#define HG_TEST_DEBUG
 #ifdef HG_TEST_DEBUG
 #define HG_TEST_LOG_DEBUG(...)                                \
@@ -124,6 +131,44 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+/**
+ * HG_Forward callback (executor)
+ */
+static hg_return_t
+hg_test_rpc_forward_executor_cb(const struct hg_cb_info *callback_info)
+{
+    hg_handle_t handle = callback_info->info.forward.handle;
+    struct executor_cb_args *args =
+        (struct executor_cb_args *) callback_info->arg;
+    rpc_open_out_t rpc_open_out_struct;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (callback_info->ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Return from callback info is not HG_SUCCESS");
+        goto done;
+    }
+
+    /* Get output */
+    ret = HG_Get_output(handle, &rpc_open_out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not get output");
+        goto done;
+    }
+    args->executor = rpc_open_out_struct.event_id;
+
+    /* Free request */
+    ret = HG_Free_output(handle, &rpc_open_out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not free output");
+        goto done;
+    }
+
+done:
+    hg_request_complete(args->request);
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_rpc(hg_context_t *context, hg_request_class_t *request_class,
@@ -246,6 +291,166 @@ done:
     return hg_ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_executor(hg_context_t *context, hg_request_class_t *request_class,
+    hg_addr_t addr, hg_id_t rpc_id, int expected_executor)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle;
+    hg_return_t hg_ret = HG_SUCCESS;
+    struct executor_cb_args executor_cb_args;
+
+    request = hg_request_create(request_class);
+
+    /* Create RPC request */
+    hg_ret = HG_Create(context, addr, rpc_id, &handle);
+    if (hg_ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not create handle");
+        goto done;
+    }
+
+    /* Forward call to remote addr and get a new request */
+    executor_cb_args.request = request;
+    executor_cb_args.executor = -1;
+    hg_ret = HG_Forward(handle, hg_test_rpc_forward_executor_cb,
+        &executor_cb_args, NULL);
+    if (hg_ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not forward call");
+        goto done;
+    }
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    /* Complete */
+    hg_ret = HG_Destroy(handle);
+    if (hg_ret != HG_SUCCESS) {
+        HG_TEST_LOG_ERROR("Could not destroy handle");
+        goto done;
+    }
+
+    /* Callback must have run from the expected executor */
+    if (executor_cb_args.executor != expected_executor) {
+        HG_TEST_LOG_ERROR("RPC callback ran from executor %d, expected %d",
+            executor_cb_args.executor, expected_executor);
+        hg_ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+done:
+    hg_request_destroy(request);
+    return hg_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_addr_cache(hg_context_t *context, hg_request_class_t *request_class,
+    const char *target_name)
+{
+    hg_class_t *hg_class = HG_Context_get_class(context);
+    const char *short_name = strchr(target_name, '+');
+    hg_addr_t addr1 = HG_ADDR_NULL, addr2 = HG_ADDR_NULL, addr3 = HG_ADDR_NULL;
+    hg_return_t hg_ret = HG_SUCCESS;
+
+    /* Second lookup of the same name returns the cached address */
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, target_name,
+        &addr1, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, target_name,
+        &addr2, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    if (addr1 != addr2) {
+        HG_TEST_LOG_ERROR("Second lookup did not return cached address");
+        hg_ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    HG_Addr_free(hg_class, addr2);
+    addr2 = HG_ADDR_NULL;
+
+    /* Removed address is no longer returned by lookups */
+    HG_Addr_set_remove(hg_class, addr1);
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, target_name,
+        &addr2, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    if (addr1 == addr2) {
+        HG_TEST_LOG_ERROR("Lookup returned removed address");
+        hg_ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    HG_Addr_free(hg_class, addr1);
+    addr1 = HG_ADDR_NULL;
+
+    /* Same target without class name (e.g., sm://...) is another entry */
+    if (!short_name)
+        goto done;
+    short_name++;
+
+    /* Cache holds a single entry that is still in use (addr2), new names
+     * cannot be cached */
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, short_name,
+        &addr1, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, short_name,
+        &addr3, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    if (addr1 == addr3) {
+        HG_TEST_LOG_ERROR("Address in use was evicted from cache");
+        hg_ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    HG_Addr_free(hg_class, addr1);
+    HG_Addr_free(hg_class, addr3);
+    addr1 = addr3 = HG_ADDR_NULL;
+
+    /* Once no longer used, least recently used entry is evicted */
+    HG_Addr_free(hg_class, addr2);
+    addr2 = HG_ADDR_NULL;
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, short_name,
+        &addr1, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, short_name,
+        &addr3, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    if (addr1 != addr3) {
+        HG_TEST_LOG_ERROR("Lookup did not return cached address");
+        hg_ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    HG_Addr_free(hg_class, addr3);
+    addr3 = HG_ADDR_NULL;
+
+    /* Evicted name is looked up again and not cached while addr1 is used */
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, target_name,
+        &addr2, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    hg_ret = HG_Hl_addr_lookup_wait(context, request_class, target_name,
+        &addr3, HG_MAX_IDLE_TIME);
+    if (hg_ret != HG_SUCCESS)
+        goto done;
+    if (addr2 == addr3) {
+        HG_TEST_LOG_ERROR("Evicted address was returned from cache");
+        hg_ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+done:
+    if (addr1 != HG_ADDR_NULL)
+        HG_Addr_free(hg_class, addr1);
+    if (addr2 != HG_ADDR_NULL)
+        HG_Addr_free(hg_class, addr2);
+    if (addr3 != HG_ADDR_NULL)
+        HG_Addr_free(hg_class, addr3);
+    return hg_ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_rpc_reset(hg_context_t *context, hg_request_class_t *request_class,
@@ -514,7 +719,9 @@ main(int argc, char *argv[])
     hg_id_t inv_id;
     int ret = EXIT_SUCCESS;
 
-    /* Initialize the interface */
+    /* Initialize the interface, cache a single looked up address so that
+     * eviction can be tested */
+    hg_test_info.addr_cache_size = 1;
     HG_Test_init(argc, argv, &hg_test_info);
 
     /* Simple RPC test */
@@ -528,6 +735,34 @@ main(int argc, char *argv[])
     }
     HG_PASSED();
 
+    /* RPC callbacks run from the thread pool, the per-RPC executor takes
+     * precedence over the class executor, which is not used by servers that
+     * progress multiple contexts */
+    HG_TEST("RPC executor");
+#ifdef MERCURY_TESTING_HAS_THREAD_POOL
+    hg_ret = hg_test_rpc_executor(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_executor_id_g, (!hg_test_info.na_test_info.self_send
+            && hg_test_info.na_test_info.max_contexts > 1) ?
+            HG_TEST_EXECUTOR_TRIGGER : HG_TEST_EXECUTOR_CLASS);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    hg_ret = hg_test_rpc_executor(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_executor_rpc_id_g, HG_TEST_EXECUTOR_RPC);
+#else
+    hg_ret = hg_test_rpc_executor(hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_executor_rpc_id_g, HG_TEST_EXECUTOR_TRIGGER);
+#endif
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    HG_PASSED();
+
     /* RPC test with lookup/free */
     if (!hg_test_info.na_test_info.self_send &&
         strcmp(HG_Class_get_name(hg_test_info.hg_class), "mpi")) {
@@ -550,6 +785,24 @@ main(int argc, char *argv[])
             goto done;
         }
         HG_PASSED();
+
+        HG_TEST("lookup cache");
+        HG_Addr_free(hg_test_info.hg_class, hg_test_info.target_addr);
+        hg_test_info.target_addr = HG_ADDR_NULL;
+        hg_ret = hg_test_rpc_addr_cache(hg_test_info.context,
+            hg_test_info.request_class, hg_test_info.na_test_info.target_name);
+        if (hg_ret != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+        hg_ret = HG_Hl_addr_lookup_wait(hg_test_info.context,
+            hg_test_info.request_class, hg_test_info.na_test_info.target_name,
+            &hg_test_info.target_addr, HG_MAX_IDLE_TIME);
+        if (hg_ret != HG_SUCCESS) {
+            ret = EXIT_FAILURE;
+            goto done;
+        }
+        HG_PASSED();
     }
 
     /* RPC reset test */
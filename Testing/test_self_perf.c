@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "na_test.h"
+
+#include "mercury_time.h"
+#include "mercury_atomic.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Run with --self_send, add --inline to execute self RPCs inline */
+
+#define RPC_SKIP 20
+#define NDIGITS 9
+#define NWIDTH 13
+
+extern hg_id_t hg_test_perf_rpc_id_g;
+
+struct hg_test_self_perf_args {
+    hg_request_t *request;
+    unsigned int op_count;
+    hg_atomic_int32_t op_completed_count;
+};
+
+static hg_return_t
+hg_test_self_perf_forward_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_test_self_perf_args *args =
+        (struct hg_test_self_perf_args *) callback_info->arg;
+
+    if ((unsigned int) hg_atomic_incr32(&args->op_completed_count)
+        == args->op_count) {
+        hg_request_complete(args->request);
+    }
+
+    return HG_SUCCESS;
+}
+
+/**
+ *
+ */
+static hg_return_t
+hg_test_self_perf_run(hg_handle_t *handles,
+    struct hg_test_self_perf_args *args, unsigned int count)
+{
+    unsigned int completed = 0;
+    unsigned int i;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_atomic_set32(&args->op_completed_count, 0);
+    args->op_count = count;
+
+    for (i = 0; i < count; i++) {
+        ret = HG_Forward(handles[i], hg_test_self_perf_forward_cb,
+            args, NULL);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not forward call\n");
+            break;
+        }
+    }
+
+    /* Callbacks only run from trigger, wait for the calls that were
+     * forwarded before args can be reused or released */
+    if (i < count) {
+        args->op_count = i;
+        if ((unsigned int) hg_atomic_get32(&args->op_completed_count) == i)
+            hg_request_complete(args->request);
+    }
+    hg_request_wait(args->request, HG_MAX_IDLE_TIME, &completed);
+    if (!completed) {
+        unsigned int j;
+
+        fprintf(stderr, "Calls did not complete, canceling\n");
+        for (j = 0; j < i; j++)
+            HG_Cancel(handles[j]);
+        do {
+            hg_request_wait(args->request, HG_MAX_IDLE_TIME, &completed);
+        } while (!completed);
+        if (ret == HG_SUCCESS)
+            ret = HG_TIMEOUT;
+    }
+    hg_request_reset(args->request);
+
+    return ret;
+}
+
+/**
+ *
+ */
+static hg_return_t
+measure_self_rpc(struct hg_test_info *hg_test_info, unsigned int nhandles)
+{
+    hg_handle_t *handles = NULL;
+    struct hg_test_self_perf_args args = { 0 };
+    double time_read = 0, min_time_read = -1, max_time_read = 0;
+    unsigned int op_count = 0;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    unsigned int i;
+
+    printf("# Executing self RPC (%s) -- loop %d time(s) (%u handles)\n",
+        hg_test_info->self_inline ? "inline" : "queued",
+        hg_test_info->na_test_info.loop, nhandles);
+
+    handles = calloc(nhandles, sizeof(hg_handle_t));
+    if (!handles) {
+        fprintf(stderr, "Could not allocate handles\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    for (i = 0; i < nhandles; i++) {
+        ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
+            hg_test_perf_rpc_id_g, &handles[i]);
+        if (ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not start call\n");
+            goto done;
+        }
+    }
+
+    args.request = hg_request_create(hg_test_info->request_class);
+    if (!args.request) {
+        fprintf(stderr, "Could not create request\n");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    /* Warm up */
+    printf("# Warming up...\n");
+    for (i = 0; i < RPC_SKIP; i++) {
+        ret = hg_test_self_perf_run(handles, &args, nhandles);
+        if (ret != HG_SUCCESS)
+            goto done;
+    }
+
+    printf("%*s%*s%*s%*s%*s%*s\n", NWIDTH, "#    Time (s)", NWIDTH, "Min (s)",
+        NWIDTH, "Max (s)", NWIDTH, "Calls (c/s)", NWIDTH, "Min (c/s)",
+        NWIDTH, "Max (c/s)");
+
+    /* RPC benchmark */
+    while (op_count < (unsigned int) hg_test_info->na_test_info.loop) {
+        unsigned int count = (unsigned int) hg_test_info->na_test_info.loop
+            - op_count;
+        hg_time_t t1, t2;
+        double td, tb, part_time_read;
+
+        if (count > nhandles)
+            count = nhandles;
+
+        hg_time_get_current(&t1);
+        ret = hg_test_self_perf_run(handles, &args, count);
+        if (ret != HG_SUCCESS)
+            goto done;
+        hg_time_get_current(&t2);
+        op_count += count;
+
+        td = hg_time_to_double(hg_time_subtract(t2, t1));
+        time_read += td;
+        tb = td / (double) count;
+        if (min_time_read < 0) min_time_read = tb;
+        min_time_read = (tb < min_time_read) ? tb : min_time_read;
+        max_time_read = (tb > max_time_read) ? tb : max_time_read;
+        part_time_read = time_read / (double) op_count;
+
+        printf("%*.*f%*.*f%*.*f%*.*g%*.*g%*.*g\r", NWIDTH, NDIGITS,
+            part_time_read, NWIDTH, NDIGITS, min_time_read, NWIDTH, NDIGITS,
+            max_time_read, NWIDTH, NDIGITS, 1.0 / part_time_read, NWIDTH,
+            NDIGITS, 1.0 / max_time_read, NWIDTH, NDIGITS,
+            1.0 / min_time_read);
+    }
+    printf("\n");
+
+done:
+    if (args.request)
+        hg_request_destroy(args.request);
+
+    /* Complete */
+    for (i = 0; handles && i < nhandles; i++) {
+        if (handles[i] == HG_HANDLE_NULL)
+            continue;
+        cleanup_ret = HG_Destroy(handles[i]);
+        if (cleanup_ret != HG_SUCCESS) {
+            fprintf(stderr, "Could not complete\n");
+            if (ret == HG_SUCCESS)
+                ret = cleanup_ret;
+        }
+    }
+    free(handles);
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    hg_return_t hg_ret;
+    int ret = EXIT_SUCCESS;
+
+    HG_Test_init(argc, argv, &hg_test_info);
+
+    if (!hg_test_info.na_test_info.self_send) {
+        fprintf(stderr, "Self RPC benchmark requires --self_send\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    printf("###############################################################################\n");
+    printf("# Self RPC test\n");
+    printf("###############################################################################\n");
+
+    /* Single handle in flight */
+    hg_ret = measure_self_rpc(&hg_test_info, 1);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* Multiple handles in flight */
+    hg_ret = measure_self_rpc(&hg_test_info,
+        MERCURY_TESTING_NUM_THREADS_DEFAULT * 2);
+    if (hg_ret != HG_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+done:
+    HG_Test_finalize(&hg_test_info);
+
+    return ret;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+#include "mercury_server.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Context-per-core server: one context and one pinned thread per --threads,
+ * RPCs are received by the main context and steered to the context matching
+ * their target ID. Run clients with --contexts set to the same number of
+ * threads (e.g., perf_mt) */
+
+#define HG_TEST_PROGRESS_TIMEOUT    100
+#define HG_TEST_SHARE_THRESHOLD     64
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = { 0 };
+    struct hg_server_info hg_server_info;
+    struct hg_test_context_info *hg_test_context_info;
+    hg_server_t *hg_server = NULL;
+    unsigned int i;
+    hg_return_t ret = HG_SUCCESS;
+    int rc = EXIT_SUCCESS;
+
+    /* Force to listen */
+    hg_test_info.na_test_info.listen = NA_TRUE;
+    ret = HG_Test_init(argc, argv, &hg_test_info);
+    if (ret != HG_SUCCESS) {
+        rc = EXIT_FAILURE;
+        goto done;
+    }
+    if (hg_test_info.secondary_contexts)
+        HG_LOG_WARNING("Secondary contexts are not progressed by server_mt");
+
+    hg_server_info.context_count = hg_test_info.thread_count;
+    hg_server_info.share_threshold = HG_TEST_SHARE_THRESHOLD;
+    hg_server_info.pin_threads = HG_TRUE;
+    hg_server_info.trigger_only = HG_TRUE; /* Endpoint is shared */
+    hg_server_info.progress_timeout = HG_TEST_PROGRESS_TIMEOUT;
+    ret = HG_Server_start(hg_test_info.hg_class, &hg_server_info, &hg_server);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not start server");
+        rc = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* RPC callbacks see the context that received the RPC, which may be any
+     * of the server contexts or the main context, share context info so that
+     * finalize requests are all counted in one place */
+    hg_test_context_info = (struct hg_test_context_info *)
+        HG_Context_get_data(hg_test_info.context);
+    for (i = 0; i < hg_server_info.context_count; i++) {
+        ret = HG_Context_set_data(HG_Server_get_context(hg_server, i),
+            hg_test_context_info, NULL);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not set HG context data");
+            rc = EXIT_FAILURE;
+            goto done;
+        }
+    }
+    printf("# Server started with %u context(s)\n",
+        hg_server_info.context_count);
+
+    /* Main context only receives RPCs, which are then steered to server
+     * contexts, wait for one finalize request per server context */
+    do {
+        unsigned int actual_count = 0;
+
+        do {
+            ret = HG_Trigger(hg_test_info.context, 0, 1, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count);
+
+        if ((unsigned int) hg_atomic_get32(&hg_test_context_info->finalizing)
+            >= hg_server_info.context_count)
+            break;
+
+        ret = HG_Progress(hg_test_info.context, HG_TEST_PROGRESS_TIMEOUT);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+
+    printf("%*s%*s%*s%*s\n", 10, "# Context", 16, "RPCs", 16, "Steered", 16,
+        "Shared");
+    for (i = 0; i < hg_server_info.context_count; i++) {
+        struct hg_context_stats stats;
+
+        HG_Context_get_stats(HG_Server_get_context(hg_server, i), &stats);
+        printf("%*u%*lu%*lu%*lu\n", 10, i, 16, (unsigned long) stats.rpc_count,
+            16, (unsigned long) stats.rpc_steered, 16,
+            (unsigned long) stats.rpc_shared);
+    }
+
+done:
+    if (HG_Server_stop(hg_server) != HG_SUCCESS)
+        rc = EXIT_FAILURE;
+    HG_Test_finalize(&hg_test_info);
+
+    return rc;
+}
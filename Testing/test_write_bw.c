@@ -11,6 +11,7 @@
 #include "mercury_test.h"
 #include "mercury_time.h"
 #include "mercury_atomic.h"
+#include "mercury_mem_copy.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,6 +34,7 @@
 #define NWIDTH 20
 #define MAX_MSG_SIZE (MERCURY_TESTING_BUFFER_SIZE * 1024 * 1024)
 #define MAX_HANDLES 16
+#define BULK_CACHE_SIZE 64
 
 extern hg_id_t hg_test_perf_bulk_write_id_g;
 
@@ -58,7 +60,7 @@ hg_test_perf_forward_cb(const struct hg_cb_info *callback_info)
 
 static hg_return_t
 measure_bulk_transfer(struct hg_test_info *hg_test_info, size_t total_size,
-    unsigned int nhandles)
+    unsigned int nhandles, hg_bool_t reregister)
 {
     bulk_write_in_t in_struct;
     char *bulk_buf;
@@ -139,6 +141,23 @@ measure_bulk_transfer(struct hg_test_info *hg_test_info, size_t total_size,
 
         hg_time_get_current(&t1);
 
+        /* Register memory again as applications passing the same buffer
+         * would do */
+        if (reregister) {
+            ret = HG_Bulk_free(bulk_handle);
+            if (ret != HG_SUCCESS) {
+                fprintf(stderr, "Could not free bulk data handle\n");
+                goto done;
+            }
+            ret = HG_Bulk_create(hg_test_info->hg_class, 1, buf_ptrs,
+                (hg_size_t *) buf_sizes, HG_BULK_READ_ONLY, &bulk_handle);
+            if (ret != HG_SUCCESS) {
+                fprintf(stderr, "Could not create bulk data handle\n");
+                goto done;
+            }
+            in_struct.bulk_handle = bulk_handle;
+        }
+
         for (j = 0; j < nhandles; j++) {
             ret = HG_Forward(handles[j], hg_test_perf_forward_cb, &args, &in_struct);
             if (ret != HG_SUCCESS) {
@@ -198,6 +217,8 @@ measure_bulk_transfer(struct hg_test_info *hg_test_info, size_t total_size,
     }
 
 done:
+    /* Cached registration must not outlive buffer */
+    HG_Bulk_cache_invalidate(hg_test_info->hg_class, bulk_buf, nbytes);
     free(bulk_buf);
     free(handles);
     return ret;
@@ -208,7 +229,7 @@ int
 main(int argc, char *argv[])
 {
     struct hg_test_info hg_test_info = { 0 };
-    unsigned int nhandles;
+    unsigned int nhandles, cache_size;
     size_t size;
 
     HG_Test_init(argc, argv, &hg_test_info);
@@ -219,6 +240,20 @@ main(int argc, char *argv[])
             fprintf(stdout, "# Loop %d times from size %d to %d byte(s) with "
                 "%u handle(s)\n",
                 hg_test_info.na_test_info.loop, 1, MAX_MSG_SIZE, nhandles);
+            /* The copy engine is process-wide and configured once when the
+             * class is initialized, and over na+sm data is copied by the
+             * process that posts the transfer (the server), so thread counts
+             * cannot be swept within a run: compare them by running client
+             * and server with the same -x/--copy_threads value */
+            fprintf(stdout, "# Local copy threads: %u, non-temporal size: "
+                "%lu byte(s)\n", hg_mem_copy_get_threads(),
+                (unsigned long) hg_test_info.copy_nt_size);
+            /* Run with -R/--rails to compare rail counts (server side) */
+            fprintf(stdout, "# Rails: %u, chunk size: %lu byte(s)\n",
+                HG_Core_context_get_na_rail_count(
+                    hg_test_info.context->core_context),
+                (unsigned long) HG_Core_context_get_na_rail_chunk_size(
+                    hg_test_info.context->core_context));
 #ifdef MERCURY_TESTING_HAS_VERIFY_DATA
             fprintf(stdout, "# WARNING verifying data, output will be slower\n");
 #endif
@@ -228,10 +263,32 @@ main(int argc, char *argv[])
         }
 
         for (size = 1; size <= MAX_MSG_SIZE; size *= 2)
-            measure_bulk_transfer(&hg_test_info, size, nhandles);
+            measure_bulk_transfer(&hg_test_info, size, nhandles, HG_FALSE);
+
+        fprintf(stdout, "\n");
+    }
+
+    /* Registration in the inner loop, without and with registration cache */
+    for (cache_size = 0; cache_size <= BULK_CACHE_SIZE;
+        cache_size += BULK_CACHE_SIZE) {
+        HG_Bulk_cache_set_size(hg_test_info.hg_class, cache_size);
+        if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+            fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+            fprintf(stdout, "# Loop %d times from size %d to %d byte(s) with "
+                "1 handle(s), registering memory every iteration "
+                "(registration cache size %u)\n",
+                hg_test_info.na_test_info.loop, 1, MAX_MSG_SIZE, cache_size);
+            fprintf(stdout, "%-*s%*s\n", 10, "# Size", NWIDTH,
+                "Bandwidth (MB/s)");
+            fflush(stdout);
+        }
+
+        for (size = 1; size <= MAX_MSG_SIZE; size *= 2)
+            measure_bulk_transfer(&hg_test_info, size, 1, HG_TRUE);
 
         fprintf(stdout, "\n");
     }
+    HG_Bulk_cache_set_size(hg_test_info.hg_class, 0);
 
     HG_Test_finalize(&hg_test_info);
 
@@ -0,0 +1,92 @@
+#include "mercury_mem_copy.h"
+
+#include "mercury_test_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COPY_THREADS 4
+#define COPY_SIZE (4 * 1024 * 1024 + 13)
+
+static int
+check_copy(char *dest, const char *src, size_t offset, size_t n)
+{
+    memset(dest, 0, COPY_SIZE + 1);
+    hg_mem_copy(dest + offset, src + offset, n);
+
+    if (memcmp(dest + offset, src + offset, n) != 0) {
+        fprintf(stderr, "Copy of %lu bytes at offset %lu differs\n",
+            (unsigned long) n, (unsigned long) offset);
+        return EXIT_FAILURE;
+    }
+    if (dest[offset + n] != 0) {
+        fprintf(stderr, "Copy of %lu bytes at offset %lu overflows\n",
+            (unsigned long) n, (unsigned long) offset);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char *argv[])
+{
+    char *src, *dest;
+    size_t i;
+    int ret = EXIT_SUCCESS;
+
+    (void) argc;
+    (void) argv;
+
+    src = malloc(COPY_SIZE + 1);
+    dest = malloc(COPY_SIZE + 1);
+    if (!src || !dest) {
+        fprintf(stderr, "Could not allocate buffers\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    for (i = 0; i < COPY_SIZE + 1; i++)
+        src[i] = (char) (i * 7 + 1);
+
+    /* Plain memcpy, then split with non-temporal stores from 64 KB */
+    if (check_copy(dest, src, 3, COPY_SIZE - 3) != EXIT_SUCCESS) {
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    if (hg_mem_copy_init(COPY_THREADS, 64 * 1024) != HG_UTIL_SUCCESS) {
+        fprintf(stderr, "Could not initialize copy engine\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    if (hg_mem_copy_get_threads() != COPY_THREADS) {
+        fprintf(stderr, "Copy engine uses %u threads, expected %d\n",
+            hg_mem_copy_get_threads(), COPY_THREADS);
+        ret = EXIT_FAILURE;
+    }
+    if (check_copy(dest, src, 0, COPY_SIZE) != EXIT_SUCCESS
+        || check_copy(dest, src, 5, COPY_SIZE - 5) != EXIT_SUCCESS
+        || check_copy(dest, src, 1, 128 * 1024 + 3) != EXIT_SUCCESS
+        || check_copy(dest, src, 0, 100) != EXIT_SUCCESS)
+        ret = EXIT_FAILURE;
+
+    /* Later initializations keep the configuration of the first one */
+    if (hg_mem_copy_init(1, 0) != HG_UTIL_SUCCESS
+        || hg_mem_copy_get_threads() != COPY_THREADS
+        || hg_mem_copy_finalize() != HG_UTIL_SUCCESS) {
+        fprintf(stderr, "Copy engine configuration was not kept\n");
+        ret = EXIT_FAILURE;
+    }
+
+    if (hg_mem_copy_finalize() != HG_UTIL_SUCCESS
+        || hg_mem_copy_get_threads() != 1) {
+        fprintf(stderr, "Could not finalize copy engine\n");
+        ret = EXIT_FAILURE;
+    }
+
+done:
+    free(src);
+    free(dest);
+    return ret;
+}
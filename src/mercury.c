@@ -12,11 +12,17 @@
 #include "mercury_bulk.h"
 #include "mercury_proc.h"
 #include "mercury_proc_bulk.h"
+#include "mercury_codec.h"
 
 #include "mercury_hash_string.h"
 #include "mercury_mem.h"
 #include "mercury_thread_spin.h"
+#include "mercury_time.h"
+#ifdef HG_HAS_COLLECT_STATS
+#include "mercury_atomic.h"
+#endif
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -26,6 +32,25 @@
 
 #define HG_POST_LIMIT_DEFAULT 256
 
+/* Name of RPC emulating bulk atomic operations */
+#define HG_BULK_ATOMIC_RPC_NAME "__hg_bulk_atomic"
+
+/* Map stat type to either 32-bit atomic or 64-bit */
+#ifdef HG_HAS_COLLECT_STATS
+#ifndef HG_UTIL_HAS_OPA_PRIMITIVES_H
+typedef hg_atomic_int64_t hg_stat_t;
+typedef hg_util_int64_t hg_stat_value_t;
+#define hg_stat_get hg_atomic_get64
+#define hg_stat_cas hg_atomic_cas64
+#else
+typedef hg_atomic_int32_t hg_stat_t;
+typedef hg_util_int32_t hg_stat_value_t;
+#define hg_stat_get hg_atomic_get32
+#define hg_stat_cas hg_atomic_cas32
+#endif
+#define HG_STAT_INIT HG_ATOMIC_VAR_INIT
+#endif
+
 /* Convert value to string */
 #define HG_ERROR_STRING_MACRO(def, value, string) \
   if (value == def) string = #def
@@ -41,6 +66,8 @@
 struct hg_private_class {
     struct hg_class hg_class;       /* Must remain as first field */
     hg_thread_spin_t register_lock; /* Register lock */
+    const struct hg_codec *codecs[HG_CODEC_MAX]; /* Codecs by codec ID */
+    hg_id_t bulk_atomic_id;         /* RPC emulating bulk atomic operations */
 
     /* Callbacks */
     hg_return_t (*handle_create)(hg_handle_t, void *);  /* handle_create */
@@ -53,6 +80,8 @@ struct hg_proc_info {
     hg_proc_cb_t in_proc_cb;        /* Input proc callback */
     hg_proc_cb_t out_proc_cb;       /* Output proc callback */
     hg_bool_t no_response;          /* RPC response not expected */
+    hg_uint8_t codec_id;            /* Codec used for extra payloads */
+    hg_size_t codec_threshold;      /* Min extra payload size encoded */
     void *data;                     /* User data */
     void (*free_callback)(void *);  /* User data free callback */
 };
@@ -73,7 +102,17 @@ struct hg_private_handle {
     void *out_extra_buf;            /* Extra output buffer */
     hg_size_t out_extra_buf_size;   /* Extra output buffer size */
     hg_bulk_t out_extra_bulk;       /* Extra output bulk handle */
+    hg_uint8_t in_extra_codec;      /* Codec of extra input buffer */
+    hg_size_t in_extra_raw_size;    /* Decoded extra input buffer size */
+    hg_uint8_t out_extra_codec;     /* Codec of extra output buffer */
+    hg_size_t out_extra_raw_size;   /* Decoded extra output buffer size */
     hg_return_t (*extra_bulk_transfer_cb)(hg_core_handle_t); /* Bulk transfer callback */
+    hg_op_t extra_bulk_transfer_op; /* Bulk transfer op (input/output) */
+    hg_return_t extra_ret;          /* Error while getting extra payload */
+    hg_bulk_t *origin_eager_bulks;  /* Eager bulk handles sent (origin) */
+    hg_uint32_t origin_eager_bulk_count; /* Number of eager handles sent */
+    hg_bulk_t *target_eager_bulks;  /* Eager bulk handles received (target) */
+    hg_uint32_t target_eager_bulk_count; /* Number of eager handles received */
 };
 
 /* HG op id */
@@ -92,6 +131,21 @@ struct hg_op_id {
     } info;
 };
 
+/* Input of RPC emulating bulk atomic operations */
+typedef struct {
+    hg_uint64_t address;            /* Address of word at origin */
+    hg_uint64_t operand;            /* Operand */
+    hg_uint64_t compare;            /* Compared value */
+    hg_uint8_t op;                  /* Atomic operation */
+    hg_uint8_t size;                /* Size of word */
+} hg_bulk_atomic_in_t;
+
+/* Output of RPC emulating bulk atomic operations */
+typedef struct {
+    hg_int32_t ret;                 /* Return code of operation */
+    hg_uint64_t value;              /* Previous value of word */
+} hg_bulk_atomic_out_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -224,6 +278,260 @@ hg_free_extra_payload(
         struct hg_private_handle *hg_handle
         );
 
+/**
+ * Encode extra payload with codec, payload is left unchanged if encoding
+ * does not reduce its size.
+ */
+static hg_return_t
+hg_encode_extra_payload(
+        struct hg_private_handle *hg_handle,
+        hg_uint8_t codec_id,
+        void **extra_buf,
+        hg_size_t *extra_buf_size,
+        hg_uint8_t *extra_codec
+        );
+
+/**
+ * Decode extra payload that was received.
+ */
+static hg_return_t
+hg_decode_extra_payload(
+        struct hg_private_handle *hg_handle,
+        hg_op_t op
+        );
+
+/**
+ * Keep references to bulk handles recorded by proc as eager push handles.
+ * Origin and target keep separate lists as a handle sent to self is used
+ * on both sides.
+ */
+static hg_return_t
+hg_set_eager_bulks(
+        hg_proc_t proc,
+        hg_bulk_t **eager_bulks_ptr,
+        hg_uint32_t *eager_bulk_count_ptr
+        );
+
+/**
+ * Release eager push bulk handles.
+ */
+static void
+hg_free_eager_bulks(
+        hg_bulk_t **eager_bulks_ptr,
+        hg_uint32_t *eager_bulk_count_ptr
+        );
+
+/**
+ * Encode / decode data pushed eagerly to bulk handle.
+ */
+extern hg_return_t
+hg_bulk_proc_eager_data(
+        hg_proc_t proc,
+        hg_bulk_t handle
+        );
+
+/**
+ * Create bulk registration cache of class.
+ */
+extern hg_return_t
+hg_bulk_cache_create(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Destroy bulk registration cache of class.
+ */
+extern void
+hg_bulk_cache_destroy(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Create pool of bulk memory arenas of class.
+ */
+extern hg_return_t
+hg_bulk_pool_create(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Destroy pool of bulk memory arenas of class.
+ */
+extern void
+hg_bulk_pool_destroy(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Create list of bulk transfers with deadline of context.
+ */
+extern hg_return_t
+hg_bulk_deadlines_create(
+        hg_context_t *context
+        );
+
+/**
+ * Destroy list of bulk transfers with deadline of context.
+ */
+extern void
+hg_bulk_deadlines_destroy(
+        hg_context_t *context
+        );
+
+/**
+ * Bound progress timeout by first bulk transfer deadline of context.
+ */
+extern unsigned int
+hg_bulk_deadlines_timeout(
+        hg_context_t *context,
+        unsigned int timeout
+        );
+
+/**
+ * Cancel bulk transfers of context whose deadline has expired.
+ */
+extern void
+hg_bulk_deadlines_check(
+        hg_context_t *context
+        );
+
+#ifdef HG_HAS_COLLECT_STATS
+/**
+ * Number of bulk transfers canceled on deadline.
+ */
+extern hg_uint64_t
+hg_bulk_stat_timeout_count(
+        void
+        );
+#endif
+
+/**
+ * Create list of bulk handles updated by emulated atomic operations.
+ */
+extern hg_return_t
+hg_bulk_atomic_targets_create(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Destroy list of bulk handles updated by emulated atomic operations.
+ */
+extern void
+hg_bulk_atomic_targets_destroy(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Execute bulk atomic operation on local word passed by peer, word must lie
+ * within a live read-write handle of class.
+ */
+extern hg_return_t
+hg_bulk_atomic_target_exec(
+        hg_class_t *hg_class,
+        hg_uint64_t address,
+        hg_bulk_atomic_op_t op,
+        hg_size_t size,
+        hg_uint64_t operand,
+        hg_uint64_t compare,
+        hg_uint64_t *value
+        );
+
+/**
+ * Complete bulk atomic operation emulated with RPC.
+ */
+extern void
+hg_bulk_atomic_complete(
+        void *arg,
+        hg_return_t ret,
+        hg_uint64_t value
+        );
+
+/**
+ * Proc of bulk atomic RPC input.
+ */
+static hg_return_t
+hg_proc_hg_bulk_atomic_in_t(
+        hg_proc_t proc,
+        void *data
+        );
+
+/**
+ * Proc of bulk atomic RPC output.
+ */
+static hg_return_t
+hg_proc_hg_bulk_atomic_out_t(
+        hg_proc_t proc,
+        void *data
+        );
+
+/**
+ * Bulk atomic RPC callback, executes operation on local word.
+ */
+static hg_return_t
+hg_bulk_atomic_rpc_cb(
+        hg_handle_t handle
+        );
+
+/**
+ * Bulk atomic RPC forward callback.
+ */
+static hg_return_t
+hg_bulk_atomic_forward_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/**
+ * Forward bulk atomic RPC to origin of handle.
+ */
+hg_return_t
+hg_bulk_atomic_forward(
+        hg_context_t *context,
+        hg_addr_t origin_addr,
+        hg_uint8_t origin_id,
+        hg_uint64_t address,
+        hg_bulk_atomic_op_t op,
+        hg_size_t size,
+        hg_uint64_t operand,
+        hg_uint64_t compare,
+        void *arg,
+        hg_handle_t *handle
+        );
+
+/**
+ * Cancel bulk atomic RPC.
+ */
+hg_return_t
+hg_bulk_atomic_cancel(
+        hg_handle_t handle
+        );
+
+/**
+ * Release handle of bulk atomic RPC.
+ */
+void
+hg_bulk_atomic_release(
+        hg_handle_t handle
+        );
+
+#ifdef HG_HAS_COLLECT_STATS
+/**
+ * Add value to stat.
+ */
+static HG_INLINE void
+hg_stat_add(
+        hg_stat_t *stat,
+        hg_stat_value_t value
+        );
+
+/**
+ * Print stats.
+ */
+static void
+hg_print_stats(
+        void
+        );
+#endif
+
 /**
  * Forward callback.
  */
@@ -244,6 +552,47 @@ hg_core_respond_cb(
 /* Local Variables */
 /*******************/
 
+#ifdef HG_HAS_COLLECT_STATS
+static hg_bool_t hg_print_stats_registered_g = HG_FALSE;
+static hg_stat_t hg_codec_raw_bytes_g = HG_STAT_INIT(0);
+static hg_stat_t hg_codec_encoded_bytes_g = HG_STAT_INIT(0);
+static hg_stat_t hg_codec_encode_time_g = HG_STAT_INIT(0);  /* us */
+static hg_stat_t hg_codec_decode_time_g = HG_STAT_INIT(0);  /* us */
+#endif
+
+/*---------------------------------------------------------------------------*/
+#ifdef HG_HAS_COLLECT_STATS
+static HG_INLINE void
+hg_stat_add(hg_stat_t *stat, hg_stat_value_t value)
+{
+    hg_stat_value_t old_value;
+
+    do {
+        old_value = hg_stat_get(stat);
+    } while (!hg_stat_cas(stat, old_value, old_value + value));
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_print_stats(void)
+{
+    hg_stat_value_t raw_bytes = hg_stat_get(&hg_codec_raw_bytes_g);
+    hg_stat_value_t encoded_bytes = hg_stat_get(&hg_codec_encoded_bytes_g);
+
+    /* Printed after core stat report */
+    printf("Codec bytes (raw):    %lu\n", (unsigned long) raw_bytes);
+    printf("Codec bytes (coded):  %lu\n", (unsigned long) encoded_bytes);
+    printf("Codec ratio:          %.2f\n", (encoded_bytes) ?
+        (double) raw_bytes / (double) encoded_bytes : 1.0);
+    printf("Codec encode (us):    %lu\n",
+        (unsigned long) hg_stat_get(&hg_codec_encode_time_g));
+    printf("Codec decode (us):    %lu\n",
+        (unsigned long) hg_stat_get(&hg_codec_decode_time_g));
+    printf("Bulk timeouts:        %lu\n",
+        (unsigned long) hg_bulk_stat_timeout_count());
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 /**
  * Free function for value in function map.
@@ -373,7 +722,11 @@ hg_more_data_cb(hg_core_handle_t core_handle, hg_op_t op,
     }
 
     if (extra_buf) {
-        /* We were forwarding to ourself and the extra buf is already set */
+        /* We were forwarding to ourself and the extra buf is already set,
+         * errors are reported when the handle completes */
+        hg_handle->extra_ret = hg_decode_extra_payload(hg_handle, op);
+        if (hg_handle->extra_ret != HG_SUCCESS)
+            HG_LOG_ERROR("Could not decode extra payload");
         ret = done_cb(core_handle);
         if (ret != HG_SUCCESS) {
             HG_LOG_ERROR("Could not execute more data done callback");
@@ -405,6 +758,10 @@ hg_more_data_free_cb(hg_core_handle_t core_handle)
     }
 
     hg_free_extra_payload(hg_handle);
+    hg_free_eager_bulks(&hg_handle->origin_eager_bulks,
+        &hg_handle->origin_eager_bulk_count);
+    hg_free_eager_bulks(&hg_handle->target_eager_bulks,
+        &hg_handle->target_eager_bulk_count);
 
 done:
     return;
@@ -432,6 +789,14 @@ hg_core_rpc_cb(hg_core_handle_t core_handle)
         ret = HG_INVALID_PARAM;
         goto done;
     }
+
+    /* Respond with error if extra input could not be retrieved */
+    if (hg_handle->extra_ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not get extra input payload");
+        HG_Core_destroy(core_handle);
+        ret = hg_handle->extra_ret;
+        goto done;
+    }
     ret = hg_proc_info->rpc_cb((hg_handle_t) hg_handle);
 
 done:
@@ -521,6 +886,13 @@ hg_get_struct(struct hg_private_handle *hg_handle,
             ret = HG_INVALID_PARAM;
             goto done;
     }
+
+    /* Extra payload is missing or still encoded */
+    if (hg_handle->extra_ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not get extra payload");
+        ret = hg_handle->extra_ret;
+        goto done;
+    }
     if (!proc_cb) {
         HG_LOG_ERROR("No proc set, proc must be set in HG_Register()");
         ret = HG_PROTOCOL_ERROR;
@@ -562,6 +934,39 @@ hg_get_struct(struct hg_private_handle *hg_handle,
         goto done;
     }
 
+    if (op == HG_INPUT) {
+        /* Data pushed to eager bulk handles is returned with output */
+        ret = hg_set_eager_bulks(proc, &hg_handle->target_eager_bulks,
+            &hg_handle->target_eager_bulk_count);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not set eager bulk handles");
+            goto done;
+        }
+    } else if (hg_header->msg.output.flags & HG_HEADER_EAGER_DATA) {
+        hg_uint32_t eager_bulk_count, i;
+
+        /* Copy data pushed eagerly by target */
+        ret = hg_proc_hg_uint32_t(proc, &eager_bulk_count);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not decode eager bulk count");
+            goto done;
+        }
+        if (eager_bulk_count != hg_handle->origin_eager_bulk_count) {
+            HG_LOG_ERROR("Eager bulk count does not match (%u != %u)",
+                eager_bulk_count, hg_handle->origin_eager_bulk_count);
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+        for (i = 0; i < eager_bulk_count; i++) {
+            ret = hg_bulk_proc_eager_data(proc,
+                hg_handle->origin_eager_bulks[i]);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not decode eager bulk data");
+                goto done;
+            }
+        }
+    }
+
     /* Flush proc */
     ret = hg_proc_flush(proc);
     if (ret != HG_SUCCESS) {
@@ -598,6 +1003,8 @@ hg_set_struct(struct hg_private_handle *hg_handle,
     void *buf, **extra_buf;
     hg_size_t buf_size, *extra_buf_size;
     hg_bulk_t *extra_bulk;
+    hg_uint8_t *extra_codec;
+    hg_size_t *extra_raw_size;
     struct hg_header *hg_header = &hg_handle->hg_header;
 #ifdef HG_HAS_CHECKSUMS
     struct hg_header_hash *hg_header_hash = NULL;
@@ -624,6 +1031,8 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf = &hg_handle->in_extra_buf;
             extra_buf_size = &hg_handle->in_extra_buf_size;
             extra_bulk = &hg_handle->in_extra_bulk;
+            extra_codec = &hg_handle->in_extra_codec;
+            extra_raw_size = &hg_handle->in_extra_raw_size;
             break;
         case HG_OUTPUT:
             /* Cannot respond if no_response flag set */
@@ -649,6 +1058,8 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf = &hg_handle->out_extra_buf;
             extra_buf_size = &hg_handle->out_extra_buf_size;
             extra_bulk = &hg_handle->out_extra_bulk;
+            extra_codec = &hg_handle->out_extra_codec;
+            extra_raw_size = &hg_handle->out_extra_raw_size;
             break;
         default:
             HG_LOG_ERROR("Invalid HG op");
@@ -656,6 +1067,8 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             goto done;
     }
     if (!proc_cb || !struct_ptr) {
+        if (op == HG_OUTPUT && hg_handle->target_eager_bulk_count)
+            HG_LOG_WARNING("No output, data pushed eagerly is not returned");
         /* Silently skip */
         *payload_size = header_offset;
         goto done;
@@ -675,6 +1088,10 @@ hg_set_struct(struct hg_private_handle *hg_handle,
         goto done;
     }
 
+    /* Bulk handles may only be pushed eagerly if a response is returned */
+    hg_proc_set_eager_push(proc, (hg_bool_t) (op == HG_INPUT
+        && hg_proc_info->out_proc_cb && !hg_proc_info->no_response));
+
     /* Encode parameters */
     ret = proc_cb(proc, struct_ptr);
     if (ret != HG_SUCCESS) {
@@ -682,6 +1099,34 @@ hg_set_struct(struct hg_private_handle *hg_handle,
         goto done;
     }
 
+    if (op == HG_INPUT) {
+        /* Keep eager bulk handles to copy data returned with output */
+        ret = hg_set_eager_bulks(proc, &hg_handle->origin_eager_bulks,
+            &hg_handle->origin_eager_bulk_count);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not set eager bulk handles");
+            goto done;
+        }
+    } else if (hg_handle->target_eager_bulk_count) {
+        hg_uint32_t i;
+
+        /* Append data pushed eagerly */
+        ret = hg_proc_hg_uint32_t(proc, &hg_handle->target_eager_bulk_count);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not encode eager bulk count");
+            goto done;
+        }
+        for (i = 0; i < hg_handle->target_eager_bulk_count; i++) {
+            ret = hg_bulk_proc_eager_data(proc,
+                hg_handle->target_eager_bulks[i]);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not encode eager bulk data");
+                goto done;
+            }
+        }
+        hg_header->msg.output.flags |= HG_HEADER_EAGER_DATA;
+    }
+
     /* Flush proc */
     ret = hg_proc_flush(proc);
     if (ret != HG_SUCCESS) {
@@ -720,6 +1165,24 @@ hg_set_struct(struct hg_private_handle *hg_handle,
         /* Prevent buffer from being freed when proc_reset is called */
         hg_proc_set_extra_buf_is_mine(proc, HG_TRUE);
 
+        /* Encode payload if a codec is set for that RPC, there is nothing to
+         * save when sending to ourself */
+        *extra_codec = HG_CODEC_NONE;
+        *extra_raw_size = *extra_buf_size;
+        if (hg_proc_info->codec_id != HG_CODEC_NONE
+            && *extra_buf_size >= hg_proc_info->codec_threshold
+            && !NA_Addr_is_self(HG_Core_addr_get_na_class(
+                (hg_core_addr_t) hg_handle->handle.info.addr),
+                HG_Core_addr_get_na(
+                    (hg_core_addr_t) hg_handle->handle.info.addr))) {
+            ret = hg_encode_extra_payload(hg_handle, hg_proc_info->codec_id,
+                extra_buf, extra_buf_size, extra_codec);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not encode extra payload");
+                goto done;
+            }
+        }
+
         /* Create bulk descriptor */
         ret = HG_Bulk_create(hg_handle->handle.info.hg_class, 1, extra_buf,
             extra_buf_size, HG_BULK_READ_ONLY, extra_bulk);
@@ -744,6 +1207,18 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             goto done;
         }
 
+        /* Encode codec ID and decoded size of payload */
+        ret = hg_proc_hg_uint8_t(proc, extra_codec);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not process extra codec ID");
+            goto done;
+        }
+        ret = hg_proc_hg_size_t(proc, extra_raw_size);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not process extra raw size");
+            goto done;
+        }
+
         ret = hg_proc_flush(proc);
         if (ret != HG_SUCCESS) {
             HG_LOG_ERROR("Error in proc flush");
@@ -842,6 +1317,8 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
     void *buf, **extra_buf;
     hg_size_t buf_size, *extra_buf_size;
     hg_bulk_t *extra_bulk = NULL;
+    hg_uint8_t *extra_codec;
+    hg_size_t *extra_raw_size;
     hg_size_t header_offset = hg_header_get_size(op);
     hg_size_t page_size = (hg_size_t) hg_mem_get_page_size();
     hg_bulk_t local_handle = HG_BULK_NULL;
@@ -862,6 +1339,8 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
             extra_buf = &hg_handle->in_extra_buf;
             extra_buf_size = &hg_handle->in_extra_buf_size;
             extra_bulk = &hg_handle->in_extra_bulk;
+            extra_codec = &hg_handle->in_extra_codec;
+            extra_raw_size = &hg_handle->in_extra_raw_size;
             break;
         case HG_OUTPUT:
             /* Use custom header offset */
@@ -877,6 +1356,8 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
             extra_buf = &hg_handle->out_extra_buf;
             extra_buf_size = &hg_handle->out_extra_buf_size;
             extra_bulk = &hg_handle->out_extra_bulk;
+            extra_codec = &hg_handle->out_extra_codec;
+            extra_raw_size = &hg_handle->out_extra_raw_size;
             break;
         default:
             HG_LOG_ERROR("Invalid HG op");
@@ -901,6 +1382,18 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
         goto done;
     }
 
+    /* Decode codec ID and decoded size of payload */
+    ret = hg_proc_hg_uint8_t(proc, extra_codec);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not process extra codec ID");
+        goto done;
+    }
+    ret = hg_proc_hg_size_t(proc, extra_raw_size);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not process extra raw size");
+        goto done;
+    }
+
     ret = hg_proc_flush(proc);
     if (ret != HG_SUCCESS) {
         HG_LOG_ERROR("Error in proc flush");
@@ -925,6 +1418,7 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
 
     /* Read bulk data here and wait for the data to be here  */
     hg_handle->extra_bulk_transfer_cb = done_cb;
+    hg_handle->extra_bulk_transfer_op = op;
     ret = HG_Bulk_transfer_id(hg_handle->handle.info.context,
         hg_get_extra_payload_cb, hg_handle, HG_BULK_PULL,
         (hg_addr_t) hg_core_info->addr, hg_core_info->context_id,
@@ -952,6 +1446,18 @@ hg_get_extra_payload_cb(const struct hg_cb_info *callback_info)
         (struct hg_private_handle *) callback_info->arg;
     hg_return_t ret = HG_SUCCESS;
 
+    /* Decode payload before it gets decoded by proc, the handle must complete
+     * in all cases so that errors reach the RPC or forward callback */
+    if (callback_info->ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not transfer extra payload");
+        hg_handle->extra_ret = callback_info->ret;
+    } else {
+        hg_handle->extra_ret = hg_decode_extra_payload(hg_handle,
+            hg_handle->extra_bulk_transfer_op);
+        if (hg_handle->extra_ret != HG_SUCCESS)
+            HG_LOG_ERROR("Could not decode extra payload");
+    }
+
     ret = hg_handle->extra_bulk_transfer_cb(hg_handle->handle.core_handle);
     if (ret != HG_SUCCESS) {
         HG_LOG_ERROR("Could not execute bulk transfer callback");
@@ -966,6 +1472,8 @@ done:
 static void
 hg_free_extra_payload(struct hg_private_handle *hg_handle)
 {
+    hg_handle->extra_ret = HG_SUCCESS;
+
     /* Free extra bulk buf if there was any */
     if (hg_handle->in_extra_buf) {
         HG_Bulk_free(hg_handle->in_extra_bulk);
@@ -985,49 +1493,419 @@ hg_free_extra_payload(struct hg_private_handle *hg_handle)
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE hg_return_t
-hg_core_forward_cb(const struct hg_core_cb_info *callback_info)
+static hg_return_t
+hg_encode_extra_payload(struct hg_private_handle *hg_handle,
+    hg_uint8_t codec_id, void **extra_buf, hg_size_t *extra_buf_size,
+    hg_uint8_t *extra_codec)
 {
-    struct hg_private_handle *hg_handle =
-            (struct hg_private_handle *) callback_info->arg;
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_handle->handle.info.hg_class;
+    const struct hg_codec *codec = private_class->codecs[codec_id];
+    hg_size_t page_size = (hg_size_t) hg_mem_get_page_size();
+    void *encoded_buf = NULL;
+    hg_size_t encoded_buf_size;
+#ifdef HG_HAS_COLLECT_STATS
+    hg_time_t t1, t2;
+#endif
     hg_return_t ret = HG_SUCCESS;
 
-    /* Execute callback */
-    if (hg_handle->forward_cb) {
-        struct hg_cb_info hg_cb_info;
+    if (!codec) {
+        HG_LOG_ERROR("No codec registered with ID %u", codec_id);
+        ret = HG_NO_MATCH;
+        goto done;
+    }
 
-        hg_cb_info.arg = hg_handle->forward_arg;
-        hg_cb_info.ret = callback_info->ret;
-        hg_cb_info.type = callback_info->type;
-        hg_cb_info.info.forward.handle = (hg_handle_t) hg_handle;
+    encoded_buf_size = codec->bound(*extra_buf_size);
+    encoded_buf = hg_mem_aligned_alloc(page_size, encoded_buf_size);
+    if (!encoded_buf) {
+        HG_LOG_ERROR("Could not allocate encoded payload buffer");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
 
-        hg_handle->forward_cb(&hg_cb_info);
+#ifdef HG_HAS_COLLECT_STATS
+    hg_time_get_current(&t1);
+#endif
+    ret = codec->encode(*extra_buf, *extra_buf_size, encoded_buf,
+        &encoded_buf_size);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not encode payload using %s", codec->name);
+        goto done;
     }
+#ifdef HG_HAS_COLLECT_STATS
+    hg_time_get_current(&t2);
+    hg_stat_add(&hg_codec_encode_time_g, (hg_stat_value_t)
+        (hg_time_to_double(hg_time_subtract(t2, t1)) * 1e6));
+    hg_stat_add(&hg_codec_raw_bytes_g, (hg_stat_value_t) *extra_buf_size);
+    hg_stat_add(&hg_codec_encoded_bytes_g, (hg_stat_value_t)
+        ((encoded_buf_size < *extra_buf_size) ? encoded_buf_size :
+            *extra_buf_size));
+#endif
+
+    /* Send payload as is if it did not shrink or if the target would reject
+     * its decoded size */
+    if (encoded_buf_size >= *extra_buf_size
+        || *extra_buf_size / HG_CODEC_RATIO_MAX > encoded_buf_size)
+        goto done;
+
+    hg_mem_aligned_free(*extra_buf);
+    *extra_buf = encoded_buf;
+    *extra_buf_size = encoded_buf_size;
+    *extra_codec = codec_id;
+    encoded_buf = NULL;
 
+done:
+    hg_mem_aligned_free(encoded_buf);
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE hg_return_t
-hg_core_respond_cb(const struct hg_core_cb_info *callback_info)
+static hg_return_t
+hg_decode_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op)
 {
-    struct hg_private_handle *hg_handle =
-            (struct hg_private_handle *) callback_info->arg;
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_handle->handle.info.hg_class;
+    const struct hg_codec *codec;
+    hg_size_t page_size = (hg_size_t) hg_mem_get_page_size();
+    void **extra_buf, *decoded_buf = NULL;
+    hg_size_t *extra_buf_size, decoded_buf_size;
+    hg_uint8_t *extra_codec;
+    hg_size_t extra_raw_size;
+#ifdef HG_HAS_COLLECT_STATS
+    hg_time_t t1, t2;
+#endif
     hg_return_t ret = HG_SUCCESS;
 
-    /* Execute callback */
-    if (hg_handle->respond_cb) {
-        struct hg_cb_info hg_cb_info;
-
-        hg_cb_info.arg = hg_handle->respond_arg;
-        hg_cb_info.ret = callback_info->ret;
-        hg_cb_info.type = callback_info->type;
-        hg_cb_info.info.respond.handle = (hg_handle_t) hg_handle;
-
-        hg_handle->respond_cb(&hg_cb_info);
-    }
-
-    return ret;
+    switch (op) {
+        case HG_INPUT:
+            extra_buf = &hg_handle->in_extra_buf;
+            extra_buf_size = &hg_handle->in_extra_buf_size;
+            extra_codec = &hg_handle->in_extra_codec;
+            extra_raw_size = hg_handle->in_extra_raw_size;
+            break;
+        case HG_OUTPUT:
+            extra_buf = &hg_handle->out_extra_buf;
+            extra_buf_size = &hg_handle->out_extra_buf_size;
+            extra_codec = &hg_handle->out_extra_codec;
+            extra_raw_size = hg_handle->out_extra_raw_size;
+            break;
+        default:
+            HG_LOG_ERROR("Invalid HG op");
+            ret = HG_INVALID_PARAM;
+            goto done;
+    }
+
+    /* Nothing to do if payload was sent as is */
+    if (*extra_codec == HG_CODEC_NONE)
+        goto done;
+
+    codec = (*extra_codec < HG_CODEC_MAX) ?
+        private_class->codecs[*extra_codec] : NULL;
+    if (!codec) {
+        HG_LOG_ERROR("No codec registered with ID %u", *extra_codec);
+        ret = HG_NO_MATCH;
+        goto done;
+    }
+
+    /* Decoded size comes from the wire, bound it before allocating */
+    if (extra_raw_size / HG_CODEC_RATIO_MAX > *extra_buf_size) {
+        HG_LOG_ERROR("Decoded payload size (%lu) exceeds max ratio of encoded"
+            " size (%lu)", (unsigned long) extra_raw_size,
+            (unsigned long) *extra_buf_size);
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    decoded_buf_size = extra_raw_size;
+    decoded_buf = hg_mem_aligned_alloc(page_size, decoded_buf_size);
+    if (!decoded_buf) {
+        HG_LOG_ERROR("Could not allocate decoded payload buffer");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+#ifdef HG_HAS_COLLECT_STATS
+    hg_time_get_current(&t1);
+#endif
+    ret = codec->decode(*extra_buf, *extra_buf_size, decoded_buf,
+        &decoded_buf_size);
+    if (ret != HG_SUCCESS || decoded_buf_size != extra_raw_size) {
+        HG_LOG_ERROR("Could not decode payload using %s", codec->name);
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+#ifdef HG_HAS_COLLECT_STATS
+    hg_time_get_current(&t2);
+    hg_stat_add(&hg_codec_decode_time_g, (hg_stat_value_t)
+        (hg_time_to_double(hg_time_subtract(t2, t1)) * 1e6));
+#endif
+
+    hg_mem_aligned_free(*extra_buf);
+    *extra_buf = decoded_buf;
+    *extra_buf_size = decoded_buf_size;
+    *extra_codec = HG_CODEC_NONE;
+    decoded_buf = NULL;
+
+done:
+    hg_mem_aligned_free(decoded_buf);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_set_eager_bulks(hg_proc_t proc, hg_bulk_t **eager_bulks_ptr,
+    hg_uint32_t *eager_bulk_count_ptr)
+{
+    hg_bulk_t *eager_bulks;
+    hg_uint32_t eager_bulk_count, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Release handles of previous encode / decode */
+    hg_free_eager_bulks(eager_bulks_ptr, eager_bulk_count_ptr);
+
+    eager_bulks = hg_proc_get_eager_bulks(proc, &eager_bulk_count);
+    if (!eager_bulk_count)
+        goto done;
+
+    *eager_bulks_ptr = (hg_bulk_t *) malloc(
+        eager_bulk_count * sizeof(hg_bulk_t));
+    if (!*eager_bulks_ptr) {
+        HG_LOG_ERROR("Could not allocate eager bulk array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    for (i = 0; i < eager_bulk_count; i++) {
+        HG_Bulk_ref_incr(eager_bulks[i]);
+        (*eager_bulks_ptr)[i] = eager_bulks[i];
+    }
+    *eager_bulk_count_ptr = eager_bulk_count;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_free_eager_bulks(hg_bulk_t **eager_bulks_ptr,
+    hg_uint32_t *eager_bulk_count_ptr)
+{
+    hg_uint32_t i;
+
+    for (i = 0; i < *eager_bulk_count_ptr; i++)
+        HG_Bulk_free((*eager_bulks_ptr)[i]);
+    free(*eager_bulks_ptr);
+    *eager_bulks_ptr = NULL;
+    *eager_bulk_count_ptr = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_core_forward_cb(const struct hg_core_cb_info *callback_info)
+{
+    struct hg_private_handle *hg_handle =
+            (struct hg_private_handle *) callback_info->arg;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Execute callback */
+    if (hg_handle->forward_cb) {
+        struct hg_cb_info hg_cb_info;
+
+        hg_cb_info.arg = hg_handle->forward_arg;
+        hg_cb_info.ret = (callback_info->ret == HG_SUCCESS) ?
+            hg_handle->extra_ret : callback_info->ret;
+        hg_cb_info.type = callback_info->type;
+        hg_cb_info.info.forward.handle = (hg_handle_t) hg_handle;
+
+        hg_handle->forward_cb(&hg_cb_info);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_core_respond_cb(const struct hg_core_cb_info *callback_info)
+{
+    struct hg_private_handle *hg_handle =
+            (struct hg_private_handle *) callback_info->arg;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Execute callback */
+    if (hg_handle->respond_cb) {
+        struct hg_cb_info hg_cb_info;
+
+        hg_cb_info.arg = hg_handle->respond_arg;
+        hg_cb_info.ret = callback_info->ret;
+        hg_cb_info.type = callback_info->type;
+        hg_cb_info.info.respond.handle = (hg_handle_t) hg_handle;
+
+        hg_handle->respond_cb(&hg_cb_info);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_proc_hg_bulk_atomic_in_t(hg_proc_t proc, void *data)
+{
+    hg_bulk_atomic_in_t *struct_data = (hg_bulk_atomic_in_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->address);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->operand);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->compare);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint8_t(proc, &struct_data->op);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint8_t(proc, &struct_data->size);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_proc_hg_bulk_atomic_out_t(hg_proc_t proc, void *data)
+{
+    hg_bulk_atomic_out_t *struct_data = (hg_bulk_atomic_out_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = hg_proc_hg_int32_t(proc, &struct_data->ret);
+    if (ret != HG_SUCCESS)
+        goto done;
+    ret = hg_proc_hg_uint64_t(proc, &struct_data->value);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_atomic_rpc_cb(hg_handle_t handle)
+{
+    hg_bulk_atomic_in_t in_struct;
+    hg_bulk_atomic_out_t out_struct;
+    hg_uint64_t value = 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = HG_Get_input(handle, &in_struct);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not get input");
+        goto done;
+    }
+
+    /* Address of word was resolved by caller from handle exposed by this
+     * process, it is rejected unless it lies within one of our live
+     * read-write handles */
+    out_struct.ret = (hg_int32_t) hg_bulk_atomic_target_exec(
+        HG_Get_info(handle)->hg_class, in_struct.address,
+        (hg_bulk_atomic_op_t) in_struct.op, in_struct.size, in_struct.operand,
+        in_struct.compare, &value);
+    out_struct.value = value;
+
+    HG_Free_input(handle, &in_struct);
+
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not respond");
+        goto done;
+    }
+
+done:
+    HG_Destroy(handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_atomic_forward_cb(const struct hg_cb_info *callback_info)
+{
+    hg_handle_t handle = callback_info->info.forward.handle;
+    hg_bulk_atomic_out_t out_struct;
+    hg_uint64_t value = 0;
+    hg_return_t ret = callback_info->ret;
+
+    if (ret == HG_SUCCESS) {
+        ret = HG_Get_output(handle, &out_struct);
+        if (ret != HG_SUCCESS)
+            HG_LOG_ERROR("Could not get output");
+        else {
+            ret = (hg_return_t) out_struct.ret;
+            value = out_struct.value;
+            HG_Free_output(handle, &out_struct);
+        }
+    }
+
+    /* Handle is released with bulk operation ID */
+    hg_bulk_atomic_complete(callback_info->arg, ret, value);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_atomic_forward(hg_context_t *context, hg_addr_t origin_addr,
+    hg_uint8_t origin_id, hg_uint64_t address, hg_bulk_atomic_op_t op,
+    hg_size_t size, hg_uint64_t operand, hg_uint64_t compare, void *arg,
+    hg_handle_t *handle_ptr)
+{
+    hg_bulk_atomic_in_t in_struct;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = HG_Create(context, origin_addr,
+        HG_CONTEXT_CLASS(context)->bulk_atomic_id, &handle);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create handle");
+        goto done;
+    }
+
+    ret = HG_Set_target_id(handle, origin_id);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not set target ID");
+        goto done;
+    }
+
+    in_struct.address = address;
+    in_struct.operand = operand;
+    in_struct.compare = compare;
+    in_struct.op = (hg_uint8_t) op;
+    in_struct.size = (hg_uint8_t) size;
+
+    /* Handle must be set before callback can be triggered */
+    *handle_ptr = handle;
+    ret = HG_Forward(handle, hg_bulk_atomic_forward_cb, arg, &in_struct);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not forward call");
+        *handle_ptr = HG_HANDLE_NULL;
+        goto done;
+    }
+
+done:
+    if (ret != HG_SUCCESS && handle != HG_HANDLE_NULL)
+        HG_Destroy(handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_atomic_cancel(hg_handle_t handle)
+{
+    return HG_Cancel(handle);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_atomic_release(hg_handle_t handle)
+{
+    HG_Destroy(handle);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1077,6 +1955,7 @@ HG_Init_opt(const char *na_info_string, hg_bool_t na_listen,
     const struct hg_init_info *hg_init_info)
 {
     struct hg_private_class *hg_class = NULL;
+    unsigned int i;
     hg_return_t ret = HG_SUCCESS;
 
     hg_class = malloc(sizeof(struct hg_private_class));
@@ -1086,6 +1965,22 @@ HG_Init_opt(const char *na_info_string, hg_bool_t na_listen,
     }
     memset(hg_class, 0, sizeof(struct hg_private_class));
     hg_thread_spin_init(&hg_class->register_lock);
+    for (i = 0; i < HG_CODEC_MAX; i++)
+        hg_class->codecs[i] = hg_codec_get_builtin((hg_uint8_t) i);
+    hg_class->hg_class.eager_pull_size = (hg_size_t) -1; /* No limit */
+    hg_class->hg_class.eager_push_size = 0; /* Disabled */
+
+#ifdef HG_HAS_COLLECT_STATS
+    /* Register before core so that codec stats follow core stat report */
+    if (hg_init_info && hg_init_info->stats && !hg_print_stats_registered_g) {
+        if (atexit(hg_print_stats) != 0) {
+            HG_LOG_ERROR("Could not register hg_print_stats");
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+        hg_print_stats_registered_g = HG_TRUE;
+    }
+#endif
 
     hg_class->hg_class.core_class = HG_Core_init_opt(na_info_string, na_listen,
         hg_init_info);
@@ -1099,6 +1994,48 @@ HG_Init_opt(const char *na_info_string, hg_bool_t na_listen,
     HG_Core_set_more_data_callback(hg_class->hg_class.core_class,
         hg_more_data_cb, hg_more_data_free_cb);
 
+    /* Create bulk registration cache (disabled by default) */
+    ret = hg_bulk_cache_create((hg_class_t *) hg_class);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create bulk registration cache");
+        HG_Core_finalize(hg_class->hg_class.core_class);
+        goto done;
+    }
+
+    /* Create pool of bulk memory arenas (allocated on demand) */
+    ret = hg_bulk_pool_create((hg_class_t *) hg_class);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create bulk memory pool");
+        hg_bulk_cache_destroy((hg_class_t *) hg_class);
+        HG_Core_finalize(hg_class->hg_class.core_class);
+        goto done;
+    }
+
+    /* Create list of handles that emulated atomic operations may update */
+    ret = hg_bulk_atomic_targets_create((hg_class_t *) hg_class);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create bulk atomic target list");
+        hg_bulk_pool_destroy((hg_class_t *) hg_class);
+        hg_bulk_cache_destroy((hg_class_t *) hg_class);
+        HG_Core_finalize(hg_class->hg_class.core_class);
+        goto done;
+    }
+
+    /* Register RPC emulating bulk atomic operations on plugins that do not
+     * support them */
+    hg_class->bulk_atomic_id = hg_hash_string(HG_BULK_ATOMIC_RPC_NAME);
+    ret = HG_Register((hg_class_t *) hg_class, hg_class->bulk_atomic_id,
+        hg_proc_hg_bulk_atomic_in_t, hg_proc_hg_bulk_atomic_out_t,
+        hg_bulk_atomic_rpc_cb);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register bulk atomic RPC");
+        hg_bulk_atomic_targets_destroy((hg_class_t *) hg_class);
+        hg_bulk_pool_destroy((hg_class_t *) hg_class);
+        hg_bulk_cache_destroy((hg_class_t *) hg_class);
+        HG_Core_finalize(hg_class->hg_class.core_class);
+        goto done;
+    }
+
 done:
     if (ret != HG_SUCCESS) {
         free(hg_class);
@@ -1115,6 +2052,11 @@ HG_Finalize(hg_class_t *hg_class)
         (struct hg_private_class *) hg_class;
     hg_return_t ret = HG_SUCCESS;
 
+    /* Release cached registrations and arenas before NA class is finalized */
+    hg_bulk_cache_destroy(hg_class);
+    hg_bulk_pool_destroy(hg_class);
+    hg_bulk_atomic_targets_destroy(hg_class);
+
     ret = HG_Core_finalize(private_class->hg_class.core_class);
     if (ret != HG_SUCCESS) {
         HG_LOG_ERROR("Could not finalize HG core class");
@@ -1195,6 +2137,13 @@ HG_Context_create_id(hg_class_t *hg_class, hg_uint8_t id)
         goto done;
     }
 
+    /* Create list of bulk transfers with deadline */
+    ret = hg_bulk_deadlines_create(hg_context);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create bulk deadline list");
+        goto done;
+    }
+
     /* Set handle create callback */
     HG_Core_context_set_handle_create_callback(hg_context->core_context,
         hg_handle_create_cb, hg_context);
@@ -1230,12 +2179,59 @@ HG_Context_destroy(hg_context_t *context)
         HG_LOG_ERROR("Could not destroy HG core context");
         goto done;
     }
+    hg_bulk_deadlines_destroy(context);
     free(context);
 
 done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Context_set_steering(hg_context_t *context, hg_bool_t enable,
+    unsigned int share_threshold)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = HG_Core_context_set_steering(context->core_context, enable,
+        share_threshold);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not set context steering");
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Context_get_stats(hg_context_t *context, struct hg_context_stats *stats)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = HG_Core_context_get_stats(context->core_context, stats);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not get context stats");
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_id_t
 HG_Register_name(hg_class_t *hg_class, const char *func_name,
@@ -1612,6 +2608,104 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_set_executor(hg_class_t *hg_class, hg_id_t id,
+    const struct hg_executor *executor)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = HG_Core_registered_set_executor(hg_class->core_class, id, executor);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not set executor");
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Register_codec(hg_class_t *hg_class, hg_uint8_t codec_id,
+    const struct hg_codec *codec)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (codec_id == HG_CODEC_NONE || codec_id >= HG_CODEC_MAX) {
+        HG_LOG_ERROR("Invalid codec ID %u", codec_id);
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (codec && (!codec->bound || !codec->encode || !codec->decode)) {
+        HG_LOG_ERROR("Incomplete codec");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_thread_spin_lock(&private_class->register_lock);
+    private_class->codecs[codec_id] = codec;
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_set_codec(hg_class_t *hg_class, hg_id_t id, hg_uint8_t codec_id,
+    hg_size_t threshold)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (codec_id >= HG_CODEC_MAX || !private_class->codecs[codec_id]) {
+        HG_LOG_ERROR("No codec registered with ID %u", codec_id);
+        ret = HG_NO_MATCH;
+        goto done;
+    }
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    if (!hg_proc_info) {
+        HG_LOG_ERROR("Could not get registered data");
+        ret = HG_NO_MATCH;
+        hg_thread_spin_unlock(&private_class->register_lock);
+        goto done;
+    }
+
+    hg_proc_info->codec_id = codec_id;
+    hg_proc_info->codec_threshold = threshold;
+
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Addr_lookup(hg_context_t *context, hg_cb_t callback, void *arg,
@@ -1650,6 +2744,51 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Addr_lookup_multi(hg_context_t *context, hg_cb_t callback, void *arg,
+    const char **names, hg_addr_t *addrs, unsigned int count,
+    hg_op_id_t *op_id)
+{
+    struct hg_op_id *hg_op_id = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    /* Allocate op_id */
+    hg_op_id = (struct hg_op_id *) malloc(sizeof(struct hg_op_id));
+    if (!hg_op_id) {
+        HG_LOG_ERROR("Could not allocate HG operation ID");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_op_id->context = context;
+    hg_op_id->type = HG_CB_LOOKUP;
+    hg_op_id->callback = callback;
+    hg_op_id->arg = arg;
+    hg_op_id->info.lookup.hg_addr = HG_ADDR_NULL;
+
+    /* HG addresses are HG core addresses */
+    ret = HG_Core_addr_lookup_multi(context->core_context,
+        hg_core_addr_lookup_cb, hg_op_id, names, (hg_core_addr_t *) addrs,
+        count, &hg_op_id->info.lookup.core_op_id);
+    if (ret != HG_SUCCESS) {
+        free(hg_op_id);
+        goto done;
+    }
+
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_op_id;
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Addr_free(hg_class_t *hg_class, hg_addr_t addr)
@@ -2135,6 +3274,7 @@ HG_Forward(hg_handle_t handle, hg_cb_t callback, void *arg, void *in_struct)
     /* Set callback data */
     private_handle->forward_cb = callback;
     private_handle->forward_arg = arg;
+    private_handle->extra_ret = HG_SUCCESS;
 
     /* Retrieve RPC data */
     hg_proc_info = (const struct hg_proc_info *) HG_Core_get_rpc_data(
@@ -2240,7 +3380,10 @@ HG_Progress(hg_context_t *context, unsigned int timeout)
         goto done;
     }
 
-    ret = HG_Core_progress(context->core_context, timeout);
+    /* Wake up in time to cancel bulk transfers whose deadline expires */
+    ret = HG_Core_progress(context->core_context,
+        hg_bulk_deadlines_timeout(context, timeout));
+    hg_bulk_deadlines_check(context);
 
 done:
     return ret;
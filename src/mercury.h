@@ -14,6 +14,7 @@
 #include "mercury_types.h"
 #include "mercury_header.h"
 #include "mercury_error.h"
+#include "mercury_codec.h"
 
 #include "mercury_core.h"
 
@@ -223,6 +224,32 @@ HG_Class_set_output_offset(
         hg_size_t offset
         );
 
+/**
+ * Set max size of bulk data that can be transferred eagerly, i.e., without
+ * going through RDMA, when bulk handles are sent along with RPC arguments
+ * (requires MERCURY_USE_EAGER_BULK):
+ *   - data of HG_BULK_READ_ONLY handles up to pull_size bytes is encoded
+ *     along with the handle and pulled by the target from the RPC message
+ *     (default is no limit other than the RPC eager size)
+ *   - data of HG_BULK_WRITE_ONLY / HG_BULK_READWRITE handles up to push_size
+ *     bytes is not exposed, data pushed by the target is instead sent back
+ *     along with the RPC response and copied into the origin's buffer when
+ *     HG_Get_output() is called (default is 0, i.e., disabled). This only
+ *     applies to RPCs that have an output proc and expect a response.
+ *
+ * \param hg_class [IN/OUT]     pointer to HG class
+ * \param pull_size [IN]        max size of data pulled eagerly
+ * \param push_size [IN]        max size of data pushed eagerly
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+static HG_INLINE hg_return_t
+HG_Class_set_eager_bulk_size(
+        hg_class_t *hg_class,
+        hg_size_t pull_size,
+        hg_size_t push_size
+        );
+
 /**
  * Associate user data to class. When HG_Finalize() is called,
  * free_callback (if defined) is called to free the associated data.
@@ -375,6 +402,43 @@ HG_Context_get_data(
         const hg_context_t *context
         );
 
+/**
+ * Register context for RPC steering, RPCs whose target ID matches the context
+ * ID are then queued to that context regardless of the context that received
+ * them. If share_threshold is non-zero, RPCs are queued to the least loaded
+ * registered context once the completion queue of the target context holds
+ * more than share_threshold entries. Refer to HG_Core_context_set_steering()
+ * for additional details.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param enable [IN]           enable / disable steering to that context
+ * \param share_threshold [IN]  queue depth above which RPCs are shared
+ *                              (0 disables sharing)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Context_set_steering(
+        hg_context_t *context,
+        hg_bool_t enable,
+        unsigned int share_threshold
+        );
+
+/**
+ * Retrieve RPC counters of a given context (number of RPCs queued and,
+ * among those, number of RPCs steered or shared from other contexts).
+ *
+ * \param context [IN]          pointer to HG context
+ * \param stats [OUT]           pointer to stats struct
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Context_get_stats(
+        hg_context_t *context,
+        struct hg_context_stats *stats
+        );
+
 /**
  * Dynamically register a function func_name as an RPC as well as the
  * RPC callback executed when the RPC request ID associated to func_name is
@@ -566,10 +630,73 @@ HG_Registered_disabled_response(
         hg_bool_t *disabled
         );
 
+/**
+ * Set executor used for running the RPC callback associated to id instead of
+ * running it from HG_Trigger(). This takes precedence over the executor passed
+ * through hg_init_info. Mercury owns the work item that is posted to the
+ * executor, no allocation is therefore required when dispatching the callback.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param executor [IN]         pointer to executor (NULL to reset default)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Registered_set_executor(
+        hg_class_t *hg_class,
+        hg_id_t id,
+        const struct hg_executor *executor
+        );
+
+/**
+ * Register codec with ID codec_id. Built-in codecs (HG_CODEC_NONE and
+ * HG_CODEC_LZ) are always registered, HG_CODEC_LZ may be replaced. Codec IDs
+ * must refer to the same codec on origin and target. Payloads that shrink by
+ * more than HG_CODEC_RATIO_MAX are sent as is.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param codec_id [IN]         codec ID (less than HG_CODEC_MAX)
+ * \param codec [IN]            pointer to codec (NULL to deregister)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Register_codec(
+        hg_class_t *hg_class,
+        hg_uint8_t codec_id,
+        const struct hg_codec *codec
+        );
+
+/**
+ * Set codec used to compress payloads of a given RPC ID that do not fit into
+ * eager messages (i.e., payloads transferred through bulk). Payloads of at
+ * least threshold bytes are encoded after being serialized and decoded
+ * before being deserialized, payloads that do not shrink are sent as is.
+ * Setting is local: origin applies it to input, target to output.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param codec_id [IN]         codec ID (HG_CODEC_NONE to disable)
+ * \param threshold [IN]        min payload size to encode
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Registered_set_codec(
+        hg_class_t *hg_class,
+        hg_id_t id,
+        hg_uint8_t codec_id,
+        hg_size_t threshold
+        );
+
 /**
  * Lookup an addr from a peer address/name. Addresses need to be
  * freed by calling HG_Addr_free(). After completion, user callback is
  * placed into a completion queue and can be triggered using HG_Trigger().
+ * If the class was initialized with a non-zero addr_cache_size, addresses
+ * are cached by name and subsequent lookups of the same name complete
+ * immediately.
  *
  * \param context [IN]          pointer to context of execution
  * \param callback [IN]         pointer to function callback
@@ -588,6 +715,37 @@ HG_Addr_lookup(
         hg_op_id_t   *op_id
         );
 
+/**
+ * Lookup multiple addrs concurrently. All lookups are started before
+ * progress is made so that plugins can overlap connection setup. Once all
+ * lookups have completed, addrs is filled and a single user callback is
+ * placed into a completion queue and can be triggered using HG_Trigger().
+ * Addresses that could not be looked up are set to HG_ADDR_NULL and the
+ * callback return value is set to the error of the last failed lookup.
+ * Addresses need to be freed by calling HG_Addr_free().
+ *
+ * \param context [IN]          pointer to context of execution
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param names [IN]            array of lookup names
+ * \param addrs [OUT]           array of count addresses, must remain valid
+ *                              until callback is triggered
+ * \param count [IN]            number of names to lookup
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Addr_lookup_multi(
+        hg_context_t *context,
+        hg_cb_t callback,
+        void *arg,
+        const char **names,
+        hg_addr_t *addrs,
+        unsigned int count,
+        hg_op_id_t *op_id
+        );
+
 /**
  * Free the addr.
  *
@@ -606,7 +764,7 @@ HG_Addr_free(
  * Hint that the address is no longer valid. This may happen if the peer is
  * no longer responding. This can be used to force removal of the
  * peer address from the list of the peers, before freeing it and reclaim
- * resources.
+ * resources. The address is also removed from the lookup cache.
  *
  * \param hg_class [IN]         pointer to HG class
  * \param addr [IN]             abstract address
@@ -1087,12 +1245,19 @@ struct hg_class {
     hg_core_class_t *core_class;        /* Core class */
     hg_size_t in_offset;                /* Input offset */
     hg_size_t out_offset;               /* Output offset */
+    hg_size_t eager_pull_size;          /* Max size of bulk data pulled eagerly */
+    hg_size_t eager_push_size;          /* Max size of bulk data pushed eagerly */
+    struct hg_bulk_cache *bulk_cache;   /* Bulk registration cache */
+    struct hg_bulk_pool *bulk_pool;     /* Bulk memory arenas */
+    struct hg_bulk_atomic_targets *bulk_atomic_targets; /* Bulk handles
+                                           updated by emulated atomics */
 };
 
 /* HG context */
 struct hg_context {
     hg_core_context_t *core_context;    /* Core context */
     hg_class_t *hg_class;               /* HG class */
+    struct hg_bulk_deadlines *bulk_deadlines; /* Bulk transfers with deadline */
 };
 
 /* HG handle */
@@ -1214,6 +1379,23 @@ HG_Class_set_output_offset(hg_class_t *hg_class, hg_size_t offset)
     return HG_SUCCESS;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+HG_Class_set_eager_bulk_size(hg_class_t *hg_class, hg_size_t pull_size,
+    hg_size_t push_size)
+{
+#ifdef HG_HAS_VERBOSE_ERROR
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        return HG_INVALID_PARAM;
+    }
+#endif
+    hg_class->eager_pull_size = pull_size;
+    hg_class->eager_push_size = push_size;
+
+    return HG_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_return_t
 HG_Class_set_data(hg_class_t *hg_class, void *data,
@@ -0,0 +1,440 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_addr_book.h"
+
+#include "mercury_mem.h"
+#include "mercury_thread_mutex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+#define HG_ADDR_BOOK_MAGIC      0x48474142  /* "HGAB" */
+#define HG_ADDR_BOOK_VERSION    1
+#define HG_ADDR_BOOK_NA_MAX     64          /* Max length of NA info string */
+
+/* Size of mapped region */
+#define HG_ADDR_BOOK_SIZE(max_entries)                                      \
+    (sizeof(struct hg_addr_book_header)                                     \
+        + (size_t) (max_entries) * sizeof(struct hg_addr_book_entry))
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/* Address book file header */
+struct hg_addr_book_header {
+    hg_uint32_t magic;                      /* Magic number */
+    hg_uint32_t version;                    /* File format version */
+    hg_uint32_t max_entries;                /* Max number of entries */
+    hg_uint32_t count;                      /* Number of entries */
+    char na_info[HG_ADDR_BOOK_NA_MAX];      /* Plugin/protocol of data */
+};
+
+/* Address book file entry */
+struct hg_addr_book_entry {
+    char name[HG_ADDR_BOOK_NAME_MAX];       /* Address name */
+    hg_uint32_t data_size;                  /* Serialized size (0 if none) */
+    char data[HG_ADDR_BOOK_DATA_MAX];       /* Serialized address */
+};
+
+/* HG address book */
+struct hg_addr_book {
+    hg_class_t *hg_class;                   /* HG class */
+    struct hg_addr_book_header *header;     /* Mapped header */
+    struct hg_addr_book_entry *entries;     /* Mapped entries */
+    size_t size;                            /* Size of mapped region */
+    hg_thread_mutex_t mutex;                /* Mutex for recording */
+};
+
+/* Lookup completion */
+struct hg_addr_book_lookup_arg {
+    hg_bool_t completed;                    /* Lookups have completed */
+    hg_return_t ret;                        /* Return value of lookups */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Map address book file.
+ */
+static hg_return_t
+hg_addr_book_map(
+        struct hg_addr_book *hg_addr_book,
+        const char *path,
+        unsigned int max_entries
+        );
+
+/**
+ * Lookup callback.
+ */
+static hg_return_t
+hg_addr_book_lookup_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_addr_book_map(struct hg_addr_book *hg_addr_book, const char *path,
+    unsigned int max_entries)
+{
+    struct hg_addr_book_header *header;
+    char na_info[HG_ADDR_BOOK_NA_MAX];
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    hg_addr_book->size = HG_ADDR_BOOK_SIZE(max_entries);
+    header = (struct hg_addr_book_header *) hg_mem_file_map(path,
+        hg_addr_book->size, HG_UTIL_TRUE);
+    if (!header) {
+        HG_LOG_ERROR("Could not map address book file %s", path);
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    if (header->magic == HG_ADDR_BOOK_MAGIC
+        && header->version == HG_ADDR_BOOK_VERSION) {
+        /* Keep existing entries, remap if book was created larger */
+        if (header->max_entries > max_entries) {
+            max_entries = header->max_entries;
+            hg_mem_file_unmap(header, hg_addr_book->size);
+            hg_addr_book->size = HG_ADDR_BOOK_SIZE(max_entries);
+            header = (struct hg_addr_book_header *) hg_mem_file_map(path,
+                hg_addr_book->size, HG_UTIL_FALSE);
+            if (!header) {
+                HG_LOG_ERROR("Could not map address book file %s", path);
+                ret = HG_NOMEM_ERROR;
+                goto done;
+            }
+        }
+        header->max_entries = max_entries;
+        if (header->count > max_entries)
+            header->count = max_entries;
+    } else {
+        /* New file (or unrecognized content) */
+        memset(header, 0, hg_addr_book->size);
+        header->magic = HG_ADDR_BOOK_MAGIC;
+        header->version = HG_ADDR_BOOK_VERSION;
+        header->max_entries = max_entries;
+        header->count = 0;
+    }
+    hg_addr_book->header = header;
+    hg_addr_book->entries = (struct hg_addr_book_entry *) (header + 1);
+
+    /* Serialized addresses can only be restored by the same plugin */
+    snprintf(na_info, HG_ADDR_BOOK_NA_MAX, "%s+%s",
+        HG_Class_get_name(hg_addr_book->hg_class),
+        HG_Class_get_protocol(hg_addr_book->hg_class));
+    if (strncmp(header->na_info, na_info, HG_ADDR_BOOK_NA_MAX) != 0) {
+        for (i = 0; i < header->count; i++)
+            hg_addr_book->entries[i].data_size = 0;
+        strncpy(header->na_info, na_info, HG_ADDR_BOOK_NA_MAX);
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_addr_book_lookup_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_addr_book_lookup_arg *lookup_arg =
+        (struct hg_addr_book_lookup_arg *) callback_info->arg;
+
+    lookup_arg->ret = callback_info->ret;
+    lookup_arg->completed = HG_TRUE;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Addr_book_open(hg_class_t *hg_class, const char *path,
+    unsigned int max_entries, hg_addr_book_t **addr_book)
+{
+    struct hg_addr_book *hg_addr_book = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!path || !max_entries) {
+        HG_LOG_ERROR("NULL path or max entries");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!addr_book) {
+        HG_LOG_ERROR("NULL pointer to address book");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_addr_book = (struct hg_addr_book *) malloc(sizeof(struct hg_addr_book));
+    if (!hg_addr_book) {
+        HG_LOG_ERROR("Could not allocate address book");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_addr_book, 0, sizeof(struct hg_addr_book));
+    hg_addr_book->hg_class = hg_class;
+    hg_thread_mutex_init(&hg_addr_book->mutex);
+
+    ret = hg_addr_book_map(hg_addr_book, path, max_entries);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not map address book");
+        goto done;
+    }
+
+    *addr_book = hg_addr_book;
+
+done:
+    if (ret != HG_SUCCESS && hg_addr_book) {
+        hg_thread_mutex_destroy(&hg_addr_book->mutex);
+        free(hg_addr_book);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Addr_book_close(hg_addr_book_t *addr_book)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!addr_book) goto done;
+
+    if (hg_mem_file_unmap(addr_book->header, addr_book->size)
+        != HG_UTIL_SUCCESS) {
+        HG_LOG_ERROR("Could not unmap address book");
+        ret = HG_OTHER_ERROR;
+    }
+    hg_thread_mutex_destroy(&addr_book->mutex);
+    free(addr_book);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Addr_book_record(hg_addr_book_t *addr_book, const char *name,
+    hg_addr_t addr)
+{
+    struct hg_addr_book_header *header;
+    struct hg_addr_book_entry *entry = NULL;
+    na_class_t *na_class;
+    na_addr_t na_addr;
+    na_size_t data_size;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    if (!addr_book) {
+        HG_LOG_ERROR("NULL address book");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!name || strlen(name) >= HG_ADDR_BOOK_NAME_MAX) {
+        HG_LOG_ERROR("NULL or too long address name");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (addr == HG_ADDR_NULL) {
+        HG_LOG_ERROR("NULL address");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    header = addr_book->header;
+
+    hg_thread_mutex_lock(&addr_book->mutex);
+
+    /* Replace existing entry if any */
+    for (i = 0; i < header->count; i++) {
+        if (strcmp(addr_book->entries[i].name, name) == 0) {
+            entry = &addr_book->entries[i];
+            break;
+        }
+    }
+    if (!entry) {
+        if (header->count == header->max_entries) {
+            HG_LOG_ERROR("Address book is full (%u entries)",
+                header->max_entries);
+            ret = HG_SIZE_ERROR;
+            goto unlock;
+        }
+        entry = &addr_book->entries[header->count];
+        memset(entry, 0, sizeof(struct hg_addr_book_entry));
+        strcpy(entry->name, name);
+    }
+
+    /* HG addresses are HG core addresses */
+    na_class = HG_Core_addr_get_na_class((hg_core_addr_t) addr);
+    na_addr = HG_Core_addr_get_na((hg_core_addr_t) addr);
+    data_size = NA_Addr_get_serialize_size(na_class, na_addr);
+    if (data_size > 0 && data_size <= HG_ADDR_BOOK_DATA_MAX
+        && NA_Addr_serialize(na_class, entry->data, data_size, na_addr)
+            == NA_SUCCESS)
+        entry->data_size = (hg_uint32_t) data_size;
+    else
+        entry->data_size = 0; /* Name will be looked up */
+
+    /* Entry is only visible once it is complete */
+    if (entry == &addr_book->entries[header->count])
+        header->count++;
+
+unlock:
+    hg_thread_mutex_unlock(&addr_book->mutex);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+unsigned int
+HG_Addr_book_get_count(const hg_addr_book_t *addr_book)
+{
+    return addr_book ? addr_book->header->count : 0;
+}
+
+/*---------------------------------------------------------------------------*/
+const char *
+HG_Addr_book_get_name(const hg_addr_book_t *addr_book, unsigned int index)
+{
+    const char *name = NULL;
+
+    if (!addr_book) {
+        HG_LOG_ERROR("NULL address book");
+        goto done;
+    }
+    if (index >= addr_book->header->count) {
+        HG_LOG_ERROR("Invalid address book index (%u)", index);
+        goto done;
+    }
+
+    name = addr_book->entries[index].name;
+
+done:
+    return name;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Addr_book_restore(hg_addr_book_t *addr_book, hg_context_t *context,
+    hg_addr_t *addrs)
+{
+    struct hg_addr_book_lookup_arg lookup_arg = { HG_FALSE, HG_SUCCESS };
+    const char **lookup_names = NULL;
+    hg_addr_t *lookup_addrs = NULL;
+    unsigned int *lookup_indices = NULL;
+    unsigned int count, lookup_count = 0, i;
+    na_class_t *na_class;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!addr_book) {
+        HG_LOG_ERROR("NULL address book");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!context) {
+        HG_LOG_ERROR("NULL HG context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!addrs) {
+        HG_LOG_ERROR("NULL addresses");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    count = addr_book->header->count;
+    if (!count)
+        goto done;
+    na_class = HG_Core_class_get_na(addr_book->hg_class->core_class);
+
+    lookup_names = (const char **) malloc(count * sizeof(const char *));
+    lookup_addrs = (hg_addr_t *) malloc(count * sizeof(hg_addr_t));
+    lookup_indices = (unsigned int *) malloc(count * sizeof(unsigned int));
+    if (!lookup_names || !lookup_addrs || !lookup_indices) {
+        HG_LOG_ERROR("Could not allocate lookup arrays");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    /* Deserialize what can be, without any lookup */
+    for (i = 0; i < count; i++) {
+        struct hg_addr_book_entry *entry = &addr_book->entries[i];
+        hg_core_addr_t core_addr = HG_CORE_ADDR_NULL;
+        na_addr_t na_addr = NA_ADDR_NULL;
+
+        addrs[i] = HG_ADDR_NULL;
+        if (entry->data_size
+            && NA_Addr_deserialize(na_class, &na_addr, entry->data,
+                entry->data_size) == NA_SUCCESS) {
+            if (HG_Core_addr_create(addr_book->hg_class->core_class,
+                &core_addr) == HG_SUCCESS) {
+                HG_Core_addr_set_na(core_addr, na_addr);
+                addrs[i] = (hg_addr_t) core_addr;
+                continue;
+            }
+            NA_Addr_free(na_class, na_addr);
+        }
+        lookup_names[lookup_count] = entry->name;
+        lookup_indices[lookup_count] = i;
+        lookup_count++;
+    }
+    if (!lookup_count)
+        goto done;
+
+    /* Look up remaining names concurrently */
+    ret = HG_Addr_lookup_multi(context, hg_addr_book_lookup_cb, &lookup_arg,
+        lookup_names, lookup_addrs, lookup_count, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not start lookups");
+        goto done;
+    }
+
+    do {
+        unsigned int actual_count = 0;
+
+        do {
+            ret = HG_Trigger(context, 0, 1, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count && !lookup_arg.completed);
+
+        if (lookup_arg.completed)
+            break;
+
+        ret = HG_Progress(context, HG_MAX_IDLE_TIME);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+    if (!lookup_arg.completed) {
+        HG_LOG_ERROR("Could not complete lookups");
+        goto done;
+    }
+    if (lookup_arg.ret != HG_SUCCESS)
+        HG_LOG_WARNING("Some addresses could not be restored");
+    ret = HG_SUCCESS;
+
+    for (i = 0; i < lookup_count; i++)
+        addrs[lookup_indices[i]] = lookup_addrs[i];
+
+done:
+    free(lookup_indices);
+    free(lookup_addrs);
+    free(lookup_names);
+    return ret;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_ADDR_BOOK_H
+#define MERCURY_ADDR_BOOK_H
+
+#include "mercury.h"
+
+/*************************************/
+/* Public Type and Struct Definition */
+/*************************************/
+
+typedef struct hg_addr_book hg_addr_book_t; /* Opaque HG address book */
+
+/*****************/
+/* Public Macros */
+/*****************/
+
+/* Max length of names recorded in address book (including '\0') */
+#define HG_ADDR_BOOK_NAME_MAX   256
+
+/* Max size of serialized addresses recorded in address book */
+#define HG_ADDR_BOOK_DATA_MAX   256
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Open address book backed by file path, the file is created if it does not
+ * exist and mapped into memory so that recorded addresses persist across
+ * restarts. Addresses are recorded in serialized form when the NA plugin
+ * supports it (see NA_Addr_serialize()), otherwise only their name is
+ * recorded. Serialized addresses recorded by a different plugin/protocol
+ * than the one used by hg_class are discarded.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param path [IN]             path of address book file
+ * \param max_entries [IN]      max number of addresses (if the existing book
+ *                              holds more, its size is kept)
+ * \param addr_book [OUT]       pointer to HG address book
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Addr_book_open(
+        hg_class_t *hg_class,
+        const char *path,
+        unsigned int max_entries,
+        hg_addr_book_t **addr_book
+        );
+
+/**
+ * Flush address book to its file and close it.
+ *
+ * \param addr_book [IN]        pointer to HG address book
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Addr_book_close(
+        hg_addr_book_t *addr_book
+        );
+
+/**
+ * Record address resolved from name (e.g., once HG_Addr_lookup() has
+ * completed or from the address of a received RPC). An existing entry with
+ * the same name is replaced.
+ *
+ * \param addr_book [IN]        pointer to HG address book
+ * \param name [IN]             address name
+ * \param addr [IN]             abstract address
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Addr_book_record(
+        hg_addr_book_t *addr_book,
+        const char *name,
+        hg_addr_t addr
+        );
+
+/**
+ * Get number of addresses recorded in address book.
+ *
+ * \param addr_book [IN]        pointer to HG address book
+ *
+ * \return Number of addresses
+ */
+HG_EXPORT unsigned int
+HG_Addr_book_get_count(
+        const hg_addr_book_t *addr_book
+        );
+
+/**
+ * Get name of recorded address.
+ *
+ * \param addr_book [IN]        pointer to HG address book
+ * \param index [IN]            index of address
+ *
+ * \return Name or NULL if index is out of range
+ */
+HG_EXPORT const char *
+HG_Addr_book_get_name(
+        const hg_addr_book_t *addr_book,
+        unsigned int index
+        );
+
+/**
+ * Rehydrate all recorded addresses: serialized addresses are deserialized
+ * directly without any lookup, remaining ones are looked up by name with
+ * HG_Addr_lookup_multi(). This call progresses and triggers context until
+ * all lookups have completed. The i-th address corresponds to the i-th name
+ * returned by HG_Addr_book_get_name(), addresses that could not be restored
+ * are set to HG_ADDR_NULL. Addresses need to be freed by calling
+ * HG_Addr_free().
+ *
+ * \param addr_book [IN]        pointer to HG address book
+ * \param context [IN]          pointer to context used for lookups
+ * \param addrs [OUT]           array of HG_Addr_book_get_count() addresses
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Addr_book_restore(
+        hg_addr_book_t *addr_book,
+        hg_context_t *context,
+        hg_addr_t *addrs
+        );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_ADDR_BOOK_H */
@@ -12,10 +12,19 @@
 #include "mercury_core.h"
 #include "mercury_private.h"
 #include "mercury_error.h"
+#include "mercury_checksum.h"
+#include "mercury_proc.h"
 
 #include "na.h"
 
 #include "mercury_atomic.h"
+#include "mercury_thread_spin.h"
+#include "mercury_thread_mutex.h"
+#include "mercury_list.h"
+#include "mercury_time.h"
+#include "mercury_hash_table.h"
+#include "mercury_mem.h"
+#include "mercury_mem_copy.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -26,6 +35,15 @@
 #define HG_BULK_MIN(a, b) \
     (a < b) ? a : b
 
+/* Largest checksum block size (remaining bytes are tracked in 32-bit) */
+#define HG_BULK_CHECKSUM_BLOCK_SIZE_MAX (1 << 30)
+
+/* Min number of segments for which segment offsets are indexed */
+#define HG_BULK_INDEX_MIN_COUNT 16
+
+/* Max size of encoded varint */
+#define HG_BULK_VARINT_SIZE_MAX 10
+
 /* Remove warnings when plugin does not use callback arguments */
 #if defined(__cplusplus)
     #define HG_BULK_UNUSED
@@ -39,14 +57,24 @@
 /* Local Type and Struct Definition */
 /************************************/
 
-/* HG class */
+/* HG class (must match struct hg_class in mercury.h) */
 struct hg_class {
     hg_core_class_t *core_class;          /* Core class */
+    hg_size_t in_offset;                  /* Input offset */
+    hg_size_t out_offset;                 /* Output offset */
+    hg_size_t eager_pull_size;            /* Max size of data pulled eagerly */
+    hg_size_t eager_push_size;            /* Max size of data pushed eagerly */
+    struct hg_bulk_cache *bulk_cache;     /* Registration cache */
+    struct hg_bulk_pool *bulk_pool;       /* Arenas used by HG_Bulk_alloc */
+    struct hg_bulk_atomic_targets *bulk_atomic_targets; /* Handles updated
+                                             by emulated atomics */
 };
 
-/* HG context */
+/* HG context (must match struct hg_context in mercury.h) */
 struct hg_context {
     hg_core_context_t *core_context;      /* Core context */
+    hg_class_t *hg_class;                 /* HG class */
+    struct hg_bulk_deadlines *bulk_deadlines; /* Transfers with deadline */
 };
 
 /* HG Bulk op id */
@@ -65,9 +93,154 @@ struct hg_bulk_op_id {
     struct hg_bulk *hg_bulk_local;        /* Local handle */
     na_op_id_t *na_op_ids ;               /* NA operations IDs */
     hg_bool_t is_self;                    /* Is self operation */
+    hg_size_t origin_offset;              /* Origin offset of transfer */
+    hg_size_t local_offset;               /* Local offset of transfer */
+    hg_size_t size;                       /* Size of transfer */
+    struct hg_bulk_piece *pieces;         /* Pieces (multiple NA operations) */
+    hg_bool_t striped;                    /* Pieces striped across rails */
+    hg_atomic_int32_t *block_remaining;   /* Bytes left per verified block */
+    hg_uint32_t block_first;              /* First verified block */
+    hg_uint32_t block_count;              /* Number of verified blocks */
+    hg_atomic_int32_t corrupted;          /* Checksum mismatch detected */
+    struct hg_bulk_pipeline *pipeline;    /* Pipeline (pipelined transfers) */
+    struct hg_bulk_multi *multi;          /* Entries (vectored transfers) */
+    struct hg_bulk_op_id *parent;         /* Vectored transfer of entry */
+    hg_atomic_int32_t failed;             /* NA operation failed (entries) */
+    hg_time_t deadline;                   /* Deadline of transfer */
+    hg_bool_t has_deadline;               /* Transfer is in deadline list */
+    hg_atomic_int32_t posted;             /* NA operations posted */
+    hg_atomic_int32_t timed_out;          /* Canceled on deadline */
+    struct hg_bulk_atomic *atomic;        /* Atomic operation */
+    HG_LIST_ENTRY(hg_bulk_op_id) deadline_entry; /* Entry in deadline list */
     struct hg_completion_entry hg_completion_entry; /* Entry in completion queue */
 };
 
+/* Piece of transfer, used to report progress and verify checksums as pieces
+ * complete */
+struct hg_bulk_piece {
+    struct hg_bulk_op_id *hg_bulk_op_id;  /* Operation ID */
+    hg_size_t offset;                     /* Offset from start of transfer */
+    hg_size_t size;                       /* Size of piece */
+    na_context_t *na_context;             /* NA context (rail) of piece */
+    hg_atomic_int32_t completed;          /* Piece completed */
+};
+
+/* Chunk of pipelined transfer */
+struct hg_bulk_chunk {
+    struct hg_bulk_op_id *hg_bulk_op_id;  /* Operation ID of pipeline */
+    hg_op_id_t op_id;                     /* Operation ID of chunk */
+    hg_size_t offset;                     /* Offset from start of transfer */
+    hg_size_t size;                       /* Size of chunk */
+    hg_bool_t in_flight;                  /* Chunk issued */
+    struct hg_bulk_chunk *next;           /* Next chunk not in flight */
+};
+
+/* Pipelined transfer, chunks are issued as separate transfers by a single
+ * thread at a time and at most window chunks are in flight */
+struct hg_bulk_pipeline {
+    hg_bulk_chunk_cb_t chunk_callback;    /* Chunk callback */
+    struct hg_addr *origin_addr;          /* Origin address */
+    hg_uint8_t origin_id;                 /* Origin context ID */
+    hg_size_t size;                       /* Size of transfer */
+    hg_size_t chunk_size;                 /* Size of chunks */
+    hg_size_t next_offset;                /* Offset of next chunk */
+    hg_size_t completed_size;             /* Size of chunks completed */
+    struct hg_bulk_chunk *chunks;         /* Array of window chunks */
+    struct hg_bulk_chunk *free_chunks;    /* Chunks not in flight */
+    unsigned int window;                  /* Max number of chunks in flight */
+    unsigned int pending;                 /* Chunks not completed yet */
+    hg_bool_t issuing;                    /* Chunks being issued */
+    hg_bool_t completed;                  /* Pipeline completed */
+    hg_return_t ret;                      /* Return code of transfer */
+    hg_thread_spin_t lock;                /* Pipeline lock */
+};
+
+/* Vectored transfer, operation IDs of entries are allocated at once and
+ * entries complete the transfer without going through the completion queue */
+struct hg_bulk_multi {
+    struct hg_bulk_transfer_entry *entries; /* Entries passed by user */
+    struct hg_bulk_op_id *entry_op_ids;   /* Operation IDs of entries */
+    hg_uint32_t count;                    /* Number of entries */
+    hg_atomic_int32_t remaining;          /* Entries not completed yet */
+};
+
+/* Word of atomic operation */
+union hg_bulk_atomic_word {
+    hg_uint32_t u32;
+    hg_uint64_t u64;
+};
+
+/* Atomic operation, words passed to NA must remain valid until completion */
+struct hg_bulk_atomic {
+    hg_bulk_atomic_op_t op;               /* Atomic operation */
+    hg_size_t size;                       /* Size of word */
+    union hg_bulk_atomic_word operand;    /* Operand */
+    union hg_bulk_atomic_word compare;    /* Compared value */
+    union hg_bulk_atomic_word fetched;    /* Previous value fetched by NA */
+    hg_uint64_t *result;                  /* Result passed by user */
+    hg_uint64_t value;                    /* Previous value */
+    hg_return_t ret;                      /* Return code of operation */
+    hg_handle_t handle;                   /* Handle of emulated operation */
+};
+
+/* Read-write handles created by this process, words passed by peers to the
+ * RPC emulating atomic operations must lie within one of these handles */
+struct hg_bulk_atomic_targets {
+    HG_LIST_HEAD(hg_bulk) handles;        /* Live read-write handles */
+    hg_thread_mutex_t lock;               /* List lock (held while a word
+                                             is updated) */
+};
+
+/* Transfers of context that have a deadline, transfers are canceled from
+ * HG_Progress() once their deadline has expired */
+struct hg_bulk_deadlines {
+    HG_LIST_HEAD(hg_bulk_op_id) ops;      /* Transfers with deadline */
+    hg_thread_mutex_t lock;               /* List lock */
+    hg_atomic_int32_t count;              /* Number of transfers in list */
+};
+
+/* Range of data pushed eagerly */
+struct hg_bulk_range {
+    hg_size_t offset; /* Offset from start of handle */
+    hg_size_t size;   /* Size of range */
+};
+
+/* Registration cache, cached handles are keyed by NA class, flags and
+ * segments and hold the NA memory handles shared by handles created on the
+ * same segments */
+struct hg_bulk_cache {
+    hg_hash_table_t *table;               /* Cached handles */
+    hg_thread_spin_t lock;                /* Cache lock */
+    unsigned int size;                    /* Max number of cached handles */
+    unsigned long clock;                  /* Cache use counter */
+};
+
+/* Arena of pre-registered memory divided into blocks of one size class
+ * (class_index is the pool class count for allocations that do not fit
+ * in the largest class and that use a dedicated arena). Free blocks are
+ * tracked by index outside of the arena since its memory is exposed to
+ * remote peers */
+struct hg_bulk_arena {
+    struct hg_bulk *hg_bulk;              /* Handle registering arena */
+    void *base;                           /* Arena memory */
+    hg_size_t size;                       /* Arena size */
+    unsigned int class_index;             /* Size class of blocks */
+    hg_bool_t huge_pages;                 /* Arena backed by huge pages */
+    unsigned int *free_blocks;            /* Stack of free block indices */
+    unsigned int free_count;              /* Number of free blocks */
+    struct hg_bulk_arena *next;           /* Next arena of pool */
+    struct hg_bulk_arena *next_free;      /* Next arena with free blocks */
+};
+
+/* Pool of arenas used by HG_Bulk_alloc() */
+struct hg_bulk_pool {
+    struct hg_bulk_arena_info info;       /* Arena configuration */
+    struct hg_bulk_arena *arenas;         /* List of arenas */
+    struct hg_bulk_arena **free_arenas;   /* Arenas with free blocks by class */
+    unsigned int class_count;             /* Number of size classes */
+    hg_thread_spin_t lock;                /* Pool lock */
+};
+
 /* Segment used to transfer data and map to NA layer */
 struct hg_bulk_segment {
     hg_ptr_t address; /* address of the segment */
@@ -104,17 +277,38 @@ struct hg_bulk {
     hg_size_t total_size;                /* Total size of data abstracted */
     hg_uint32_t segment_count;           /* Number of segments */
     struct hg_bulk_segment *segments;    /* Array of segments */
+    hg_size_t *segment_offsets;          /* Start offset of segments (index) */
     na_mem_handle_t *na_mem_handles;     /* Array of NA memory handles */
 #ifdef HG_HAS_SM_ROUTING
     na_mem_handle_t *na_sm_mem_handles;  /* Array of NA SM memory handles */
 #endif
     hg_uint32_t na_mem_handle_count;     /* Number of handles */
+    hg_bool_t contiguous;                /* Segments form one NA region */
+    hg_size_t stride;                    /* Stride of blocks (0 if segments
+                                            are not strided) */
     hg_bool_t segment_published;         /* NA memory handles published */
     hg_bool_t segment_alloc;             /* Allocated memory to mirror data */
     hg_uint8_t flags;                    /* Permission flags */
     hg_bool_t eager_mode;                /* Eager transfer */
+    hg_bool_t eager_push;                /* Pushed data returned w/ response */
+    hg_bool_t remote;                    /* Deserialized from origin */
+    struct hg_bulk_range *eager_ranges;  /* Ranges pushed eagerly */
+    hg_uint32_t eager_range_count;       /* Number of ranges pushed eagerly */
+    hg_thread_spin_t eager_lock;         /* Lock on eager ranges */
     void *serialize_ptr;                 /* Cached serialization buffer */
     hg_size_t serialize_size;            /* Cached serialization size */
+    hg_uint32_t checksum_block_size;     /* Checksum block size (0 if none) */
+    hg_uint32_t *checksums;              /* CRC32C of each block */
+    hg_bool_t checksum_remote;           /* Checksums decoded from origin */
+    hg_size_t na_mem_offset;             /* Offset of first segment in NA
+                                            handle */
+    struct hg_bulk *reg_bulk;            /* Handle owning NA memory handles
+                                            (parent of views) */
+    unsigned long cache_stamp;           /* Last use of cached handle */
+    struct hg_bulk_arena *arena;         /* Arena of memory (HG_Bulk_alloc) */
+    hg_bool_t file_mapped;               /* Segment maps a file range */
+    hg_bool_t atomic_target;             /* Handle in atomic target list */
+    HG_LIST_ENTRY(hg_bulk) atomic_entry; /* Entry in atomic target list */
     hg_atomic_int32_t ref_count;         /* Reference count */
 };
 
@@ -135,6 +329,45 @@ hg_bulk_create(
         struct hg_bulk **hg_bulk_ptr
         );
 
+/**
+ * Create handle from strided blocks, only the first block is stored.
+ */
+static hg_return_t
+hg_bulk_create_strided(
+        struct hg_class *hg_class,
+        void *buf_ptr,
+        hg_size_t block_size,
+        hg_size_t stride,
+        hg_uint32_t block_count,
+        hg_uint8_t flags,
+        struct hg_bulk **hg_bulk_ptr
+        );
+
+/**
+ * Create handle from mapping of file range, mapping is not cached.
+ */
+static hg_return_t
+hg_bulk_create_file(
+        struct hg_class *hg_class,
+        int fd,
+        hg_size_t offset,
+        hg_size_t size,
+        hg_uint8_t flags,
+        struct hg_bulk **hg_bulk_ptr
+        );
+
+/**
+ * Create view of sub-range of handle that shares its NA memory handles.
+ */
+static hg_return_t
+hg_bulk_view(
+        struct hg_bulk *hg_bulk,
+        hg_size_t offset,
+        hg_size_t size,
+        hg_uint8_t flags,
+        struct hg_bulk **hg_bulk_ptr
+        );
+
 /**
  * Free handle.
  */
@@ -144,7 +377,154 @@ hg_bulk_free(
         );
 
 /**
- * Get info for bulk transfer.
+ * Check whether each segment starts where the previous one ends.
+ */
+static hg_bool_t
+hg_bulk_segments_adjacent(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Create index of segment offsets, segments are not indexed if there are
+ * fewer than HG_BULK_INDEX_MIN_COUNT segments.
+ */
+static hg_return_t
+hg_bulk_index_create(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Create and register NA memory handles of handle.
+ */
+static hg_return_t
+hg_bulk_register(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Get size of encoded segments.
+ */
+static hg_size_t
+hg_bulk_segments_get_serialize_size(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Publish NA memory handles of handle.
+ */
+static hg_return_t
+hg_bulk_publish(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Hash handle segments.
+ */
+static unsigned int
+hg_bulk_cache_hash(
+        hg_hash_table_key_t key
+        );
+
+/**
+ * Compare handle segments.
+ */
+static int
+hg_bulk_cache_equal(
+        hg_hash_table_key_t key1,
+        hg_hash_table_key_t key2
+        );
+
+/**
+ * Get cached handle registered on the same segments and take a reference
+ * to it.
+ */
+static struct hg_bulk *
+hg_bulk_cache_get(
+        struct hg_bulk_cache *hg_bulk_cache,
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Register a copy of handle and add it to cache, evicting the least
+ * recently used handle that is no longer referenced if the cache is full.
+ */
+static struct hg_bulk *
+hg_bulk_cache_add(
+        struct hg_bulk_cache *hg_bulk_cache,
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Remove cached handles overlapping memory range (all if buf is NULL).
+ */
+static void
+hg_bulk_cache_flush(
+        struct hg_bulk_cache *hg_bulk_cache,
+        const void *buf,
+        hg_size_t size
+        );
+
+/**
+ * Get size class of requested size (class count if size is too large).
+ */
+static HG_INLINE unsigned int
+hg_bulk_pool_class(
+        struct hg_bulk_pool *hg_bulk_pool,
+        hg_size_t size
+        );
+
+/**
+ * Set arena configuration of pool (only if no arena was allocated).
+ */
+static hg_return_t
+hg_bulk_pool_set_info(
+        struct hg_bulk_pool *hg_bulk_pool,
+        const struct hg_bulk_arena_info *arena_info
+        );
+
+/**
+ * Allocate and register arena.
+ */
+static hg_return_t
+hg_bulk_arena_create(
+        hg_class_t *hg_class,
+        hg_size_t size,
+        unsigned int class_index,
+        struct hg_bulk_arena **arena_ptr
+        );
+
+/**
+ * Deregister and free arena.
+ */
+static void
+hg_bulk_arena_destroy(
+        struct hg_bulk_arena *arena
+        );
+
+/**
+ * Get memory of requested size from pool, arenas are created on demand.
+ */
+static hg_return_t
+hg_bulk_pool_get(
+        hg_class_t *hg_class,
+        hg_size_t size,
+        struct hg_bulk_arena **arena_ptr,
+        void **block_ptr
+        );
+
+/**
+ * Return memory to its arena (dedicated arenas are destroyed).
+ */
+static void
+hg_bulk_pool_release(
+        struct hg_bulk_pool *hg_bulk_pool,
+        struct hg_bulk_arena *arena,
+        void *block
+        );
+
+/**
+ * Get info for bulk transfer, segment index is looked up in O(log n) if
+ * segment offsets are indexed.
  */
 static HG_INLINE void
 hg_bulk_offset_translate(
@@ -154,6 +534,79 @@ hg_bulk_offset_translate(
         hg_size_t *segment_start_offset
         );
 
+/**
+ * Get segment of handle, segments of strided handles are computed from the
+ * first block.
+ */
+static HG_INLINE struct hg_bulk_segment
+hg_bulk_segment_get(
+        struct hg_bulk *hg_bulk,
+        hg_size_t segment_index
+        );
+
+/**
+ * Get address of NA memory handle that segment belongs to, a single NA
+ * memory handle may be shared by all segments. Only the first segment may
+ * start at an offset within its NA memory handle.
+ */
+static HG_INLINE hg_ptr_t
+hg_bulk_na_base(
+        struct hg_bulk *hg_bulk,
+        hg_size_t segment_index
+        );
+
+/**
+ * Get size of segment used for transfers, contiguous handles are transferred
+ * as a single segment.
+ */
+static HG_INLINE hg_size_t
+hg_bulk_segment_size(
+        struct hg_bulk *hg_bulk,
+        hg_size_t segment_index
+        );
+
+/**
+ * Check whether handle uses a single NA memory handle created from multiple
+ * segments.
+ */
+static HG_INLINE hg_bool_t
+hg_bulk_na_segmented(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Check whether handle is made of strided blocks that are not adjacent.
+ */
+static HG_INLINE hg_bool_t
+hg_bulk_strided(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Get size of data that can be transferred from segment offset, strided
+ * handles may be accessed with up to strided_max blocks at once.
+ */
+static HG_INLINE hg_size_t
+hg_bulk_piece_size(
+        struct hg_bulk *hg_bulk,
+        hg_size_t segment_index,
+        hg_size_t segment_offset,
+        hg_size_t strided_max
+        );
+
+/**
+ * Get NA strided layout of handle and offset of data within that layout,
+ * return NULL if handle is not strided.
+ */
+static HG_INLINE const struct na_stride *
+hg_bulk_na_stride(
+        struct hg_bulk *hg_bulk,
+        hg_size_t segment_index,
+        hg_size_t segment_offset,
+        struct na_stride *na_stride,
+        hg_size_t *na_offset
+        );
+
 /**
  * Access bulk handle and get segment addresses/sizes.
  */
@@ -169,6 +622,82 @@ hg_bulk_access(
         hg_uint32_t *actual_count
         );
 
+/**
+ * Get eager flags that apply to local handle.
+ */
+static HG_INLINE hg_uint8_t
+hg_bulk_eager_flags(
+        struct hg_bulk *hg_bulk,
+        hg_uint8_t request_eager
+        );
+
+/**
+ * Copy data between buffer and handle.
+ */
+static void
+hg_bulk_copy(
+        struct hg_bulk *hg_bulk,
+        hg_size_t offset,
+        void *buf,
+        hg_size_t size,
+        hg_bool_t to_bulk
+        );
+
+/**
+ * Record range pushed eagerly.
+ */
+static hg_return_t
+hg_bulk_eager_range_add(
+        struct hg_bulk *hg_bulk,
+        hg_size_t offset,
+        hg_size_t size
+        );
+
+/**
+ * Get number of checksum blocks.
+ */
+static HG_INLINE hg_uint32_t
+hg_bulk_checksum_count(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Compute checksum of data range.
+ */
+static hg_uint32_t
+hg_bulk_checksum(
+        struct hg_bulk *hg_bulk,
+        hg_size_t offset,
+        hg_size_t size
+        );
+
+/**
+ * Compute checksums of all blocks.
+ */
+static hg_return_t
+hg_bulk_checksum_update(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Set up verification of blocks fully covered by transfer.
+ */
+static hg_return_t
+hg_bulk_checksum_init(
+        struct hg_bulk_op_id *hg_bulk_op_id,
+        hg_size_t size
+        );
+
+/**
+ * Account for completed piece and verify blocks that are complete.
+ */
+static void
+hg_bulk_checksum_verify(
+        struct hg_bulk_op_id *hg_bulk_op_id,
+        hg_size_t offset,
+        hg_size_t size
+        );
+
 /**
  * Transfer callback.
  */
@@ -177,6 +706,14 @@ hg_bulk_transfer_cb(
         const struct na_cb_info *callback_info
         );
 
+/**
+ * Transfer callback of pieces (progress tracked, checksums verified).
+ */
+static int
+hg_bulk_transfer_piece_cb(
+        const struct na_cb_info *callback_info
+        );
+
 /**
  * Transfer data pieces (private).
  */
@@ -194,10 +731,23 @@ hg_bulk_transfer_pieces(
         hg_size_t local_segment_start_offset,
         hg_size_t size,
         hg_bool_t scatter_gather,
+        hg_size_t origin_offset,
+        hg_size_t block_size,
+        hg_size_t rail_chunk_size,
+        hg_size_t strided_max,
         struct hg_bulk_op_id *hg_bulk_op_id,
         unsigned int *na_op_count
         );
 
+/**
+ * Get NA context that NA operation of transfer was posted to.
+ */
+static HG_INLINE na_context_t *
+hg_bulk_op_na_context(
+        struct hg_bulk_op_id *hg_bulk_op_id,
+        unsigned int i
+        );
+
 /**
  * Transfer data.
  */
@@ -214,33 +764,340 @@ hg_bulk_transfer(
         struct hg_bulk *hg_bulk_local,
         hg_size_t local_offset,
         hg_size_t size,
+        unsigned int timeout,
+        struct hg_bulk_op_id *hg_bulk_op_id_entry,
         hg_op_id_t *op_id
         );
 
 /**
- * Complete operation ID.
+ * Check parameters of transfer.
  */
 static hg_return_t
-hg_bulk_complete(
-        struct hg_bulk_op_id *hg_bulk_op_id
+hg_bulk_transfer_check(
+        hg_context_t *context,
+        hg_bulk_op_t op,
+        struct hg_addr *origin_addr,
+        hg_uint8_t origin_id,
+        struct hg_bulk *hg_bulk_origin,
+        struct hg_bulk *hg_bulk_local,
+        hg_size_t size
         );
 
 /**
- * Add entry to completion queue.
+ * Issue chunks of pipelined transfer until window is full.
  */
-extern hg_return_t
-hg_core_completion_add(
-        struct hg_core_context *core_context,
-        struct hg_completion_entry *hg_completion_entry,
-        hg_bool_t self_notify
+static void
+hg_bulk_pipeline_issue(
+        struct hg_bulk_op_id *hg_bulk_op_id
         );
 
 /**
- * Trigger callback from bulk op ID.
+ * Pipelined transfer can complete (must be called with lock held).
  */
-hg_return_t
-hg_bulk_trigger_entry(
-        struct hg_bulk_op_id *hg_bulk_op_id
+static HG_INLINE hg_bool_t
+hg_bulk_pipeline_done(
+        struct hg_bulk_pipeline *pipeline
+        );
+
+/**
+ * Transfer callback of pipeline chunks.
+ */
+static hg_return_t
+hg_bulk_pipeline_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/**
+ * Cancel chunks of pipelined transfer.
+ */
+static hg_return_t
+hg_bulk_pipeline_cancel(
+        struct hg_bulk_op_id *hg_bulk_op_id
+        );
+
+/**
+ * Complete entry of vectored transfer, transfer completes with last entry.
+ */
+static void
+hg_bulk_multi_complete(
+        struct hg_bulk_op_id *hg_bulk_op_id
+        );
+
+/**
+ * Cancel entries of vectored transfer.
+ */
+static hg_return_t
+hg_bulk_multi_cancel(
+        struct hg_bulk_op_id *hg_bulk_op_id
+        );
+
+/**
+ * Release entries of vectored transfer.
+ */
+static hg_return_t
+hg_bulk_multi_free(
+        struct hg_bulk_multi *multi
+        );
+
+/**
+ * Add transfer to deadline list of context.
+ */
+static void
+hg_bulk_deadline_add(
+        struct hg_bulk_op_id *hg_bulk_op_id,
+        unsigned int timeout
+        );
+
+/**
+ * Remove transfer from deadline list of context.
+ */
+static void
+hg_bulk_deadline_remove(
+        struct hg_bulk_op_id *hg_bulk_op_id
+        );
+
+/**
+ * Get segment and offset of word updated by atomic operation.
+ */
+static hg_return_t
+hg_bulk_atomic_address(
+        struct hg_bulk *hg_bulk,
+        hg_size_t offset,
+        hg_size_t size,
+        hg_uint32_t *segment_index,
+        hg_size_t *segment_offset
+        );
+
+/**
+ * Add read-write handle created by this process to atomic target list.
+ */
+static void
+hg_bulk_atomic_target_add(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Remove handle from atomic target list.
+ */
+static void
+hg_bulk_atomic_target_remove(
+        struct hg_bulk *hg_bulk
+        );
+
+/**
+ * Check whether word lies within a segment of handle.
+ */
+static hg_bool_t
+hg_bulk_atomic_target_contains(
+        struct hg_bulk *hg_bulk,
+        hg_ptr_t address,
+        hg_size_t size
+        );
+
+/**
+ * Execute atomic operation on local word.
+ */
+static hg_return_t
+hg_bulk_atomic_exec(
+        void *address,
+        hg_bulk_atomic_op_t op,
+        hg_size_t size,
+        hg_uint64_t operand,
+        hg_uint64_t compare,
+        hg_uint64_t *value
+        );
+
+/**
+ * Atomic NA callback.
+ */
+static int
+hg_bulk_atomic_na_cb(
+        const struct na_cb_info *callback_info
+        );
+
+/**
+ * Forward RPC emulating atomic operation, origin executes operation on
+ * address.
+ */
+extern hg_return_t
+hg_bulk_atomic_forward(
+        hg_context_t *context,
+        hg_addr_t origin_addr,
+        hg_uint8_t origin_id,
+        hg_uint64_t address,
+        hg_bulk_atomic_op_t op,
+        hg_size_t size,
+        hg_uint64_t operand,
+        hg_uint64_t compare,
+        void *arg,
+        hg_handle_t *handle
+        );
+
+/**
+ * Cancel RPC emulating atomic operation.
+ */
+extern hg_return_t
+hg_bulk_atomic_cancel(
+        hg_handle_t handle
+        );
+
+/**
+ * Release handle of RPC emulating atomic operation.
+ */
+extern void
+hg_bulk_atomic_release(
+        hg_handle_t handle
+        );
+
+/**
+ * Complete operation ID.
+ */
+static hg_return_t
+hg_bulk_complete(
+        struct hg_bulk_op_id *hg_bulk_op_id
+        );
+
+/**
+ * Add entry to completion queue.
+ */
+extern hg_return_t
+hg_core_completion_add(
+        struct hg_core_context *core_context,
+        struct hg_completion_entry *hg_completion_entry,
+        hg_bool_t self_notify
+        );
+
+/**
+ * Trigger callback from bulk op ID.
+ */
+hg_return_t
+hg_bulk_trigger_entry(
+        struct hg_bulk_op_id *hg_bulk_op_id
+        );
+
+/**
+ * Encode data pushed eagerly to handle / decode it into origin handle.
+ */
+hg_return_t
+hg_bulk_proc_eager_data(
+        hg_proc_t proc,
+        hg_bulk_t handle
+        );
+
+/**
+ * Create registration cache of class (disabled until size is set).
+ */
+hg_return_t
+hg_bulk_cache_create(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Release cached handles and destroy registration cache of class.
+ */
+void
+hg_bulk_cache_destroy(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Create pool of arenas used by HG_Bulk_alloc() (arenas allocated on demand).
+ */
+hg_return_t
+hg_bulk_pool_create(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Free arenas and destroy pool of class.
+ */
+void
+hg_bulk_pool_destroy(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Create deadline list of context.
+ */
+hg_return_t
+hg_bulk_deadlines_create(
+        hg_context_t *context
+        );
+
+/**
+ * Destroy deadline list of context (transfers must have completed).
+ */
+void
+hg_bulk_deadlines_destroy(
+        hg_context_t *context
+        );
+
+/**
+ * Return timeout bounded by time left until first deadline of context.
+ */
+unsigned int
+hg_bulk_deadlines_timeout(
+        hg_context_t *context,
+        unsigned int timeout
+        );
+
+/**
+ * Cancel transfers of context whose deadline has expired.
+ */
+void
+hg_bulk_deadlines_check(
+        hg_context_t *context
+        );
+
+#ifdef HG_HAS_COLLECT_STATS
+/**
+ * Return number of transfers canceled on deadline.
+ */
+hg_uint64_t
+hg_bulk_stat_timeout_count(
+        void
+        );
+#endif
+
+/**
+ * Create atomic target list of class.
+ */
+hg_return_t
+hg_bulk_atomic_targets_create(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Destroy atomic target list of class.
+ */
+void
+hg_bulk_atomic_targets_destroy(
+        hg_class_t *hg_class
+        );
+
+/**
+ * Execute atomic operation on local word passed by a peer, the word must be
+ * aligned and lie within a live read-write handle created by this process.
+ */
+hg_return_t
+hg_bulk_atomic_target_exec(
+        hg_class_t *hg_class,
+        hg_uint64_t address,
+        hg_bulk_atomic_op_t op,
+        hg_size_t size,
+        hg_uint64_t operand,
+        hg_uint64_t compare,
+        hg_uint64_t *value
+        );
+
+/**
+ * Complete atomic operation emulated with RPC.
+ */
+void
+hg_bulk_atomic_complete(
+        void *arg,
+        hg_return_t ret,
+        hg_uint64_t value
         );
 
 /**
@@ -291,7 +1148,7 @@ hg_bulk_memcpy_put(na_class_t HG_BULK_UNUSED *na_class,
 
     na_cb_info.arg = arg;
     na_cb_info.ret = NA_SUCCESS;
-    memcpy((void *) (remote_address + remote_offset),
+    hg_mem_copy((void *) (remote_address + remote_offset),
             (const void *) (local_address + local_offset), data_size);
     callback(&na_cb_info);
     return NA_SUCCESS;
@@ -313,7 +1170,7 @@ hg_bulk_memcpy_get(na_class_t HG_BULK_UNUSED *na_class,
 
     na_cb_info.arg = arg;
     na_cb_info.ret = NA_SUCCESS;
-    memcpy((void *) (local_address + local_offset),
+    hg_mem_copy((void *) (local_address + local_offset),
             (const void *) (remote_address + remote_offset), data_size);
     callback(&na_cb_info);
     return NA_SUCCESS;
@@ -361,10 +1218,91 @@ done:
     return ret;
 }
 
+/**
+ * Size of encoded varint.
+ */
+static HG_INLINE hg_size_t
+hg_bulk_varint_size(hg_uint64_t value)
+{
+    hg_size_t size = 1;
+
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+
+    return size;
+}
+
+/**
+ * Serialize varint (7 bits per byte, high bit set if more bytes follow).
+ */
+static HG_INLINE hg_return_t
+hg_bulk_serialize_varint(char **dest, ssize_t *dest_left, hg_uint64_t value)
+{
+    unsigned char bytes[HG_BULK_VARINT_SIZE_MAX];
+    size_t n = 0;
+
+    while (value >= 0x80) {
+        bytes[n++] = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    bytes[n++] = (unsigned char) value;
+
+    return hg_bulk_serialize_memcpy(dest, dest_left, bytes, n);
+}
+
+/**
+ * Deserialize varint.
+ */
+static HG_INLINE hg_return_t
+hg_bulk_deserialize_varint(const char **src, ssize_t *src_left,
+    hg_uint64_t *value)
+{
+    hg_uint64_t result = 0;
+    unsigned int shift;
+
+    for (shift = 0; shift < 7 * HG_BULK_VARINT_SIZE_MAX; shift += 7) {
+        unsigned char byte;
+
+        if (*src_left < 1) {
+            HG_LOG_ERROR("Buffer size too small");
+            return HG_SIZE_ERROR;
+        }
+        byte = (unsigned char) **src;
+        (*src)++;
+        (*src_left)--;
+        result |= (hg_uint64_t) (byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return HG_SUCCESS;
+        }
+    }
+    HG_LOG_ERROR("Malformed varint");
+
+    return HG_PROTOCOL_ERROR;
+}
+
+/**
+ * Encode segment address as signed distance to end of previous segment.
+ */
+static HG_INLINE hg_uint64_t
+hg_bulk_segment_delta(hg_ptr_t address, hg_ptr_t prev_end)
+{
+    hg_uint64_t delta = (hg_uint64_t) (address - prev_end);
+
+    /* Zigzag encoding, small negative distances remain small */
+    return (delta << 1) ^ ((delta >> 63) ? ~(hg_uint64_t) 0 : 0);
+}
+
 /*******************/
 /* Local Variables */
 /*******************/
 
+#ifdef HG_HAS_COLLECT_STATS
+static hg_atomic_int32_t hg_bulk_timeout_count_g = HG_ATOMIC_VAR_INIT(0);
+#endif
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
@@ -373,13 +1311,7 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
 {
     struct hg_bulk *hg_bulk = NULL;
     hg_return_t ret = HG_SUCCESS;
-    na_return_t na_ret;
     na_class_t *na_class = HG_Core_class_get_na(hg_class->core_class);
-#ifdef HG_HAS_SM_ROUTING
-    na_class_t *na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
-#endif
-    hg_bool_t use_register_segments = (hg_bool_t)
-        (na_class->ops->mem_handle_create_segments && count > 1);
     unsigned int i;
 
     hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
@@ -392,10 +1324,11 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
     hg_bulk->hg_class = hg_class;
     hg_bulk->na_class = na_class;
 #ifdef HG_HAS_SM_ROUTING
-    hg_bulk->na_sm_class = na_sm_class;
+    hg_bulk->na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
 #endif
     hg_bulk->segment_count = count;
-    hg_bulk->na_mem_handle_count = (use_register_segments) ? 1 : count;
+    hg_bulk->na_mem_handle_count = (na_class->ops->mem_handle_create_segments
+        && count > 1) ? 1 : count;
     hg_bulk->segment_alloc = (!buf_ptrs);
     hg_bulk->flags = flags;
     hg_atomic_set32(&hg_bulk->ref_count, 1);
@@ -430,35 +1363,388 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
         }
     }
 
-    /* Allocate NA memory handles */
-    hg_bulk->na_mem_handles = (na_mem_handle_t *) malloc(
-        hg_bulk->na_mem_handle_count * sizeof(na_mem_handle_t));
-    if (!hg_bulk->na_mem_handles) {
-        HG_LOG_ERROR("Could not allocate mem handle array");
-        ret = HG_NOMEM_ERROR;
-        goto done;
+    /* Register segments that follow each other in memory as one region */
+    if (buf_ptrs && count > 1 && hg_bulk_segments_adjacent(hg_bulk)) {
+        hg_bulk->contiguous = HG_TRUE;
+        hg_bulk->na_mem_handle_count = 1;
     }
-#ifdef HG_HAS_SM_ROUTING
-    if (na_sm_class) {
-        hg_bulk->na_sm_mem_handles = (na_mem_handle_t *) malloc(
-            hg_bulk->na_mem_handle_count * sizeof(na_mem_handle_t));
-        if (!hg_bulk->na_sm_mem_handles) {
-            HG_LOG_ERROR("Could not allocate SM mem handle array");
-            ret = HG_NOMEM_ERROR;
-            goto done;
-        }
+
+    ret = hg_bulk_index_create(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create segment index");
+        goto done;
     }
-#endif
-    for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
-        hg_bulk->na_mem_handles[i] = NA_MEM_HANDLE_NULL;
+
+    /* Share NA memory handles of cached handle if user memory was already
+     * registered */
+    if (buf_ptrs && hg_class->bulk_cache && hg_class->bulk_cache->size) {
+        struct hg_bulk *cache_bulk =
+            hg_bulk_cache_get(hg_class->bulk_cache, hg_bulk);
+
+        if (!cache_bulk)
+            cache_bulk = hg_bulk_cache_add(hg_class->bulk_cache, hg_bulk);
+        if (cache_bulk) {
+            hg_bulk->reg_bulk = cache_bulk;
+            hg_bulk->na_mem_handle_count = cache_bulk->na_mem_handle_count;
+            hg_bulk->na_mem_handles = cache_bulk->na_mem_handles;
 #ifdef HG_HAS_SM_ROUTING
-        if (hg_bulk->na_sm_mem_handles)
-            hg_bulk->na_sm_mem_handles[i] = NA_MEM_HANDLE_NULL;
+            hg_bulk->na_sm_mem_handles = cache_bulk->na_sm_mem_handles;
 #endif
+            /* Cached handles are published when registered */
+            hg_bulk->segment_published = HG_TRUE;
+        }
     }
 
     /* Create and register NA memory handles */
-    for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
+    if (!hg_bulk->reg_bulk) {
+        ret = hg_bulk_register(hg_bulk);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not register handle");
+            goto done;
+        }
+    }
+
+    *hg_bulk_ptr = hg_bulk;
+
+done:
+    if (ret != HG_SUCCESS) {
+        hg_bulk_free(hg_bulk);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_bulk_segments_adjacent(struct hg_bulk *hg_bulk)
+{
+    hg_uint32_t i;
+
+    if (hg_bulk->stride)
+        return (hg_bool_t) (hg_bulk->stride == hg_bulk->segments[0].size);
+
+    for (i = 1; i < hg_bulk->segment_count; i++) {
+        if (hg_bulk->segments[i].address != hg_bulk->segments[i - 1].address
+            + (hg_ptr_t) hg_bulk->segments[i - 1].size)
+            return HG_FALSE;
+    }
+
+    return HG_TRUE;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_create_strided(struct hg_class *hg_class, void *buf_ptr,
+    hg_size_t block_size, hg_size_t stride, hg_uint32_t block_count,
+    hg_uint8_t flags, struct hg_bulk **hg_bulk_ptr)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    if (!hg_bulk) {
+        HG_LOG_ERROR("Could not allocate handle");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->hg_class = hg_class;
+    hg_bulk->na_class = HG_Core_class_get_na(hg_class->core_class);
+#ifdef HG_HAS_SM_ROUTING
+    hg_bulk->na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
+#endif
+    hg_bulk->total_size = block_size * block_count;
+    hg_bulk->segment_count = block_count;
+    hg_bulk->stride = stride;
+    hg_bulk->na_mem_handle_count = 1;
+    hg_bulk->flags = flags;
+    hg_atomic_set32(&hg_bulk->ref_count, 1);
+
+    /* Only first block is stored */
+    hg_bulk->segments = (struct hg_bulk_segment *) malloc(
+        sizeof(struct hg_bulk_segment));
+    if (!hg_bulk->segments) {
+        HG_LOG_ERROR("Could not allocate segment array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_bulk->segments[0].address = (hg_ptr_t) buf_ptr;
+    hg_bulk->segments[0].size = block_size;
+    hg_bulk->contiguous = (hg_bool_t) (block_count > 1
+        && hg_bulk_segments_adjacent(hg_bulk));
+
+    /* Register whole span of blocks */
+    ret = hg_bulk_register(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register handle");
+        goto done;
+    }
+
+    *hg_bulk_ptr = hg_bulk;
+
+done:
+    if (ret != HG_SUCCESS) {
+        hg_bulk_free(hg_bulk);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_create_file(struct hg_class *hg_class, int fd, hg_size_t offset,
+    hg_size_t size, hg_uint8_t flags, struct hg_bulk **hg_bulk_ptr)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    void *buf_ptr;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Pages of file cache are exposed directly, read-only handles only need
+     * fd to be open for reading */
+    buf_ptr = hg_mem_fd_map(fd, offset, (size_t) size,
+        (hg_util_bool_t) (flags != HG_BULK_READ_ONLY));
+    if (!buf_ptr) {
+        HG_LOG_ERROR("Could not map file range");
+        ret = HG_OTHER_ERROR;
+        goto done;
+    }
+
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    if (!hg_bulk) {
+        HG_LOG_ERROR("Could not allocate handle");
+        hg_mem_fd_unmap(buf_ptr, (size_t) size);
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->hg_class = hg_class;
+    hg_bulk->na_class = HG_Core_class_get_na(hg_class->core_class);
+#ifdef HG_HAS_SM_ROUTING
+    hg_bulk->na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
+#endif
+    hg_bulk->total_size = size;
+    hg_bulk->segment_count = 1;
+    hg_bulk->na_mem_handle_count = 1;
+    hg_bulk->flags = flags;
+    hg_atomic_set32(&hg_bulk->ref_count, 1);
+
+    hg_bulk->segments = (struct hg_bulk_segment *) malloc(
+        sizeof(struct hg_bulk_segment));
+    if (!hg_bulk->segments) {
+        HG_LOG_ERROR("Could not allocate segment array");
+        hg_mem_fd_unmap(buf_ptr, (size_t) size);
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_bulk->segments[0].address = (hg_ptr_t) buf_ptr;
+    hg_bulk->segments[0].size = size;
+    hg_bulk->file_mapped = HG_TRUE;
+
+    /* Registration cache is bypassed as the address of the mapping may be
+     * reused once unmapped */
+    ret = hg_bulk_register(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register handle");
+        goto done;
+    }
+
+    *hg_bulk_ptr = hg_bulk;
+
+done:
+    if (ret != HG_SUCCESS) {
+        hg_bulk_free(hg_bulk);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_view(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
+    hg_uint8_t flags, struct hg_bulk **hg_bulk_ptr)
+{
+    struct hg_bulk *hg_bulk_new = NULL;
+    struct hg_bulk_segment first_segment;
+    hg_uint32_t first_index, last_index, count, i;
+    hg_size_t first_offset, last_offset;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_offset_translate(hg_bulk, offset, &first_index, &first_offset);
+    hg_bulk_offset_translate(hg_bulk, offset + size - 1, &last_index,
+        &last_offset);
+    first_segment = hg_bulk_segment_get(hg_bulk, first_index);
+
+    /* Partial blocks cannot be described with a stride */
+    if (hg_bulk->stride && !hg_bulk->contiguous && first_index != last_index
+        && (first_offset || last_offset + 1 != hg_bulk->segments[0].size)) {
+        HG_LOG_ERROR("View of strided handle must be within a block or cover "
+            "whole blocks");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    /* NA memory handles must be published to be shared */
+    ret = hg_bulk_publish(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not publish handle");
+        goto done;
+    }
+
+    hg_bulk_new = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    if (!hg_bulk_new) {
+        HG_LOG_ERROR("Could not allocate handle");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk_new, 0, sizeof(struct hg_bulk));
+    hg_bulk_new->hg_class = hg_bulk->hg_class;
+    hg_bulk_new->na_class = hg_bulk->na_class;
+#ifdef HG_HAS_SM_ROUTING
+    hg_bulk_new->na_sm_class = hg_bulk->na_sm_class;
+#endif
+    hg_bulk_new->total_size = size;
+    hg_bulk_new->flags = flags;
+    hg_atomic_set32(&hg_bulk_new->ref_count, 1);
+
+    /* Contiguous handles and views within a segment use a single segment */
+    if (hg_bulk->contiguous || first_index == last_index)
+        count = 1;
+    else
+        count = last_index - first_index + 1;
+    hg_bulk_new->segment_count = count;
+    if (hg_bulk->stride && count > 1)
+        hg_bulk_new->stride = hg_bulk->stride;
+
+    hg_bulk_new->segments = (struct hg_bulk_segment *) malloc(
+        (hg_bulk_new->stride ? 1 : count) * sizeof(struct hg_bulk_segment));
+    if (!hg_bulk_new->segments) {
+        HG_LOG_ERROR("Could not allocate segment array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    for (i = 0; i < (hg_bulk_new->stride ? 1 : count); i++)
+        hg_bulk_new->segments[i] = hg_bulk_segment_get(hg_bulk,
+            first_index + i);
+    hg_bulk_new->segments[0].address += (hg_ptr_t) first_offset;
+    if (count == 1)
+        hg_bulk_new->segments[0].size = size;
+    else if (!hg_bulk_new->stride) {
+        hg_bulk_new->segments[0].size -= first_offset;
+        hg_bulk_new->segments[count - 1].size = last_offset + 1;
+    }
+
+    ret = hg_bulk_index_create(hg_bulk_new);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create segment index");
+        goto done;
+    }
+
+    /* Share NA memory handles of parent, offsets are relative to the NA
+     * memory handle that contains the first segment of the view */
+    hg_atomic_incr32(&hg_bulk->ref_count);
+    hg_bulk_new->reg_bulk = hg_bulk;
+    if (hg_bulk->na_mem_handle_count > 1) {
+        hg_bulk_new->na_mem_handle_count = count;
+        hg_bulk_new->na_mem_handles = hg_bulk->na_mem_handles + first_index;
+#ifdef HG_HAS_SM_ROUTING
+        if (hg_bulk->na_sm_mem_handles)
+            hg_bulk_new->na_sm_mem_handles =
+                hg_bulk->na_sm_mem_handles + first_index;
+#endif
+        hg_bulk_new->na_mem_offset = first_offset
+            + (first_index ? 0 : hg_bulk->na_mem_offset);
+    } else {
+        hg_bulk_new->na_mem_handle_count = 1;
+        hg_bulk_new->na_mem_handles = hg_bulk->na_mem_handles;
+#ifdef HG_HAS_SM_ROUTING
+        hg_bulk_new->na_sm_mem_handles = hg_bulk->na_sm_mem_handles;
+#endif
+        /* Segmented NA memory handles are addressed with logical offsets,
+         * strided handles are registered from their first block */
+        hg_bulk_new->na_mem_offset = hg_bulk->na_mem_offset + (hg_bulk->stride
+            ? (hg_size_t) (first_segment.address + (hg_ptr_t) first_offset
+                - hg_bulk->segments[0].address) : offset);
+    }
+    hg_bulk_new->segment_published = HG_TRUE;
+
+    *hg_bulk_ptr = hg_bulk_new;
+
+done:
+    if (ret != HG_SUCCESS) {
+        hg_bulk_free(hg_bulk_new);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_index_create(struct hg_bulk *hg_bulk)
+{
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    /* Strided segments are located without index */
+    if (hg_bulk->segment_count < HG_BULK_INDEX_MIN_COUNT || hg_bulk->stride)
+        goto done;
+
+    /* Offset of end of segment i is segment_offsets[i + 1] */
+    hg_bulk->segment_offsets = (hg_size_t *) malloc(
+        (hg_bulk->segment_count + 1) * sizeof(hg_size_t));
+    if (!hg_bulk->segment_offsets) {
+        HG_LOG_ERROR("Could not allocate segment offsets");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_bulk->segment_offsets[0] = 0;
+    for (i = 0; i < hg_bulk->segment_count; i++)
+        hg_bulk->segment_offsets[i + 1] = hg_bulk->segment_offsets[i]
+            + hg_bulk->segments[i].size;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_register(struct hg_bulk *hg_bulk)
+{
+    hg_return_t ret = HG_SUCCESS;
+    na_return_t na_ret;
+    na_class_t *na_class = hg_bulk->na_class;
+#ifdef HG_HAS_SM_ROUTING
+    na_class_t *na_sm_class = hg_bulk->na_sm_class;
+#endif
+    hg_bool_t use_register_segments = (hg_bool_t)
+        (hg_bulk->na_mem_handle_count < hg_bulk->segment_count
+            && !hg_bulk->contiguous && !hg_bulk->stride);
+    unsigned int i;
+
+    /* Allocate NA memory handles */
+    hg_bulk->na_mem_handles = (na_mem_handle_t *) malloc(
+        hg_bulk->na_mem_handle_count * sizeof(na_mem_handle_t));
+    if (!hg_bulk->na_mem_handles) {
+        HG_LOG_ERROR("Could not allocate mem handle array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+#ifdef HG_HAS_SM_ROUTING
+    if (na_sm_class) {
+        hg_bulk->na_sm_mem_handles = (na_mem_handle_t *) malloc(
+            hg_bulk->na_mem_handle_count * sizeof(na_mem_handle_t));
+        if (!hg_bulk->na_sm_mem_handles) {
+            HG_LOG_ERROR("Could not allocate SM mem handle array");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+    }
+#endif
+    for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
+        hg_bulk->na_mem_handles[i] = NA_MEM_HANDLE_NULL;
+#ifdef HG_HAS_SM_ROUTING
+        if (hg_bulk->na_sm_mem_handles)
+            hg_bulk->na_sm_mem_handles[i] = NA_MEM_HANDLE_NULL;
+#endif
+    }
+
+    /* Create and register NA memory handles */
+    for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
         /* na_mem_handle_count always <= segment_count */
         if (!hg_bulk->segments[i].address)
             continue;
@@ -468,16 +1754,28 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
                 (struct na_segment *) hg_bulk->segments;
             na_size_t na_segment_count = (na_size_t) hg_bulk->segment_count;
             na_ret = NA_Mem_handle_create_segments(na_class, na_segments,
-                na_segment_count, flags, &hg_bulk->na_mem_handles[i]);
+                na_segment_count, hg_bulk->flags, &hg_bulk->na_mem_handles[i]);
             if (na_ret != NA_SUCCESS) {
-                HG_LOG_ERROR("NA_Mem_handle_create_segments failed");
-                ret = HG_NA_ERROR;
+                /* Segments may exceed plugin limits (e.g., IOV_MAX), fall
+                 * back to one NA memory handle per segment */
+                HG_LOG_WARNING("NA_Mem_handle_create_segments failed, "
+                    "registering %u segments separately",
+                    hg_bulk->segment_count);
+                free(hg_bulk->na_mem_handles);
+                hg_bulk->na_mem_handles = NULL;
+#ifdef HG_HAS_SM_ROUTING
+                free(hg_bulk->na_sm_mem_handles);
+                hg_bulk->na_sm_mem_handles = NULL;
+#endif
+                hg_bulk->na_mem_handle_count = hg_bulk->segment_count;
+                ret = hg_bulk_register(hg_bulk);
                 goto done;
             }
 #ifdef HG_HAS_SM_ROUTING
             if (hg_bulk->na_sm_mem_handles) {
                 na_ret = NA_Mem_handle_create_segments(na_sm_class, na_segments,
-                    na_segment_count, flags, &hg_bulk->na_sm_mem_handles[i]);
+                    na_segment_count, hg_bulk->flags,
+                    &hg_bulk->na_sm_mem_handles[i]);
                 if (na_ret != NA_SUCCESS) {
                     HG_LOG_ERROR("NA_Mem_handle_create_segments for SM failed");
                     ret = HG_NA_ERROR;
@@ -486,9 +1784,18 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
             }
 #endif
         } else {
+            /* Contiguous and strided segments are registered as a single
+             * region that spans all segments */
+            hg_size_t size = hg_bulk->contiguous ? hg_bulk->total_size :
+                hg_bulk->segments[i].size;
+
+            if (hg_bulk->stride)
+                size = (hg_bulk->segment_count - 1) * hg_bulk->stride
+                    + hg_bulk->segments[0].size;
+
             na_ret = NA_Mem_handle_create(na_class,
-                (void *) hg_bulk->segments[i].address,
-                hg_bulk->segments[i].size, flags, &hg_bulk->na_mem_handles[i]);
+                (void *) hg_bulk->segments[i].address, size, hg_bulk->flags,
+                &hg_bulk->na_mem_handles[i]);
             if (na_ret != NA_SUCCESS) {
                 HG_LOG_ERROR("NA_Mem_handle_create failed");
                 ret = HG_NA_ERROR;
@@ -497,8 +1804,8 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
 #ifdef HG_HAS_SM_ROUTING
             if (hg_bulk->na_sm_mem_handles) {
                 na_ret = NA_Mem_handle_create(na_sm_class,
-                    (void *) hg_bulk->segments[i].address,
-                    hg_bulk->segments[i].size, flags, &hg_bulk->na_sm_mem_handles[i]);
+                    (void *) hg_bulk->segments[i].address, size,
+                    hg_bulk->flags, &hg_bulk->na_sm_mem_handles[i]);
                 if (na_ret != NA_SUCCESS) {
                     HG_LOG_ERROR("NA_Mem_handle_create for SM failed");
                     ret = HG_NA_ERROR;
@@ -526,37 +1833,576 @@ hg_bulk_create(struct hg_class *hg_class, hg_uint32_t count,
 #endif
     }
 
-    *hg_bulk_ptr = hg_bulk;
-
 done:
-    if (ret != HG_SUCCESS) {
-        hg_bulk_free(hg_bulk);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_size_t
+hg_bulk_segments_get_serialize_size(struct hg_bulk *hg_bulk)
+{
+    hg_ptr_t prev_end = 0;
+    hg_size_t ret = hg_bulk_varint_size(hg_bulk->stride);
+    hg_uint32_t i;
+
+    /* Strided handles only encode first block */
+    for (i = 0; i < (hg_bulk->stride ? 1 : hg_bulk->segment_count); i++) {
+        ret += hg_bulk_varint_size(hg_bulk_segment_delta(
+            hg_bulk->segments[i].address, prev_end))
+            + hg_bulk_varint_size(hg_bulk->segments[i].size);
+        prev_end = hg_bulk->segments[i].address
+            + (hg_ptr_t) hg_bulk->segments[i].size;
     }
+
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_free(struct hg_bulk *hg_bulk)
+hg_bulk_publish(struct hg_bulk *hg_bulk)
 {
+    na_class_t *na_class = hg_bulk->na_class;
+#ifdef HG_HAS_SM_ROUTING
+    na_class_t *na_sm_class = hg_bulk->na_sm_class;
+#endif
     hg_return_t ret = HG_SUCCESS;
-    unsigned int i;
-
-    if (!hg_bulk) goto done;
+    na_return_t na_ret;
+    hg_uint32_t i;
 
-    if (hg_atomic_decr32(&hg_bulk->ref_count)) {
-        /* Cannot free yet */
+    if (hg_bulk->segment_published)
         goto done;
-    }
 
-    if (hg_bulk->na_mem_handles) {
-        na_class_t *na_class = hg_bulk->na_class;
+    for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
+        if (!hg_bulk->na_mem_handles[i])
+            continue;
+
+        na_ret = NA_Mem_publish(na_class, hg_bulk->na_mem_handles[i]);
+        if (na_ret != NA_SUCCESS) {
+            HG_LOG_ERROR("NA_Mem_publish failed");
+            ret = HG_NA_ERROR;
+            goto done;
+        }
 #ifdef HG_HAS_SM_ROUTING
-        na_class_t *na_sm_class = hg_bulk->na_sm_class;
+        if (hg_bulk->na_sm_mem_handles && hg_bulk->na_sm_mem_handles[i]) {
+            na_ret = NA_Mem_publish(na_sm_class, hg_bulk->na_sm_mem_handles[i]);
+            if (na_ret != NA_SUCCESS) {
+                HG_LOG_ERROR("NA_Mem_publish for SM failed");
+                ret = HG_NA_ERROR;
+                goto done;
+            }
+        }
 #endif
+    }
+    hg_bulk->segment_published = HG_TRUE;
 
-        /* Unregister/free NA memory handles */
-        if (hg_bulk->segment_published) {
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static unsigned int
+hg_bulk_cache_hash(hg_hash_table_key_t key)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) key;
+    hg_uint64_t hash = hg_bulk->flags;
+    hg_uint32_t i;
+
+    for (i = 0; i < hg_bulk->segment_count; i++)
+        hash = (hash ^ hg_bulk->segments[i].address ^ hg_bulk->segments[i].size)
+            * 0x100000001b3ULL;
+
+    return (unsigned int) (hash ^ (hash >> 32));
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_bulk_cache_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2)
+{
+    struct hg_bulk *hg_bulk1 = (struct hg_bulk *) key1;
+    struct hg_bulk *hg_bulk2 = (struct hg_bulk *) key2;
+    hg_uint32_t i;
+
+    if (hg_bulk1->na_class != hg_bulk2->na_class
+        || hg_bulk1->flags != hg_bulk2->flags
+        || hg_bulk1->segment_count != hg_bulk2->segment_count)
+        return 0;
+
+    for (i = 0; i < hg_bulk1->segment_count; i++)
+        if (hg_bulk1->segments[i].address != hg_bulk2->segments[i].address
+            || hg_bulk1->segments[i].size != hg_bulk2->segments[i].size)
+            return 0;
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk *
+hg_bulk_cache_get(struct hg_bulk_cache *hg_bulk_cache, struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk *cache_bulk;
+
+    hg_thread_spin_lock(&hg_bulk_cache->lock);
+    cache_bulk = (struct hg_bulk *) hg_hash_table_lookup(hg_bulk_cache->table,
+        (hg_hash_table_key_t) hg_bulk);
+    if (cache_bulk == HG_HASH_TABLE_NULL)
+        cache_bulk = NULL;
+    else {
+        hg_atomic_incr32(&cache_bulk->ref_count);
+        cache_bulk->cache_stamp = ++hg_bulk_cache->clock;
+    }
+    hg_thread_spin_unlock(&hg_bulk_cache->lock);
+
+    return cache_bulk;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk *
+hg_bulk_cache_add(struct hg_bulk_cache *hg_bulk_cache, struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk *cache_bulk = NULL, *cached_bulk, *evicted_bulk = NULL;
+    hg_return_t ret;
+
+    /* Register copy of handle outside of lock, the copy does not own the
+     * user memory */
+    cache_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    if (!cache_bulk) {
+        HG_LOG_ERROR("Could not allocate cached handle");
+        goto error;
+    }
+    memset(cache_bulk, 0, sizeof(struct hg_bulk));
+    cache_bulk->hg_class = hg_bulk->hg_class;
+    cache_bulk->na_class = hg_bulk->na_class;
+#ifdef HG_HAS_SM_ROUTING
+    cache_bulk->na_sm_class = hg_bulk->na_sm_class;
+#endif
+    cache_bulk->total_size = hg_bulk->total_size;
+    cache_bulk->segment_count = hg_bulk->segment_count;
+    cache_bulk->na_mem_handle_count = hg_bulk->na_mem_handle_count;
+    cache_bulk->contiguous = hg_bulk->contiguous;
+    cache_bulk->flags = hg_bulk->flags;
+    /* Reference of caller */
+    hg_atomic_set32(&cache_bulk->ref_count, 1);
+
+    cache_bulk->segments = (struct hg_bulk_segment *) malloc(
+        cache_bulk->segment_count * sizeof(struct hg_bulk_segment));
+    if (!cache_bulk->segments) {
+        HG_LOG_ERROR("Could not allocate segment array");
+        goto error;
+    }
+    memcpy(cache_bulk->segments, hg_bulk->segments,
+        cache_bulk->segment_count * sizeof(struct hg_bulk_segment));
+
+    ret = hg_bulk_register(cache_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register cached handle");
+        goto error;
+    }
+    ret = hg_bulk_publish(cache_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not publish cached handle");
+        goto error;
+    }
+
+    hg_thread_spin_lock(&hg_bulk_cache->lock);
+
+    /* Concurrent create on the same segments already cached it */
+    cached_bulk = (struct hg_bulk *) hg_hash_table_lookup(hg_bulk_cache->table,
+        (hg_hash_table_key_t) hg_bulk);
+    if (cached_bulk != HG_HASH_TABLE_NULL) {
+        hg_atomic_incr32(&cached_bulk->ref_count);
+        cached_bulk->cache_stamp = ++hg_bulk_cache->clock;
+        hg_thread_spin_unlock(&hg_bulk_cache->lock);
+        hg_bulk_free(cache_bulk);
+        return cached_bulk;
+    }
+
+    if (hg_hash_table_num_entries(hg_bulk_cache->table)
+        >= hg_bulk_cache->size) {
+        hg_hash_table_iter_t iter;
+
+        /* Only evict handles that are no longer used outside the cache */
+        hg_hash_table_iterate(hg_bulk_cache->table, &iter);
+        while (hg_hash_table_iter_has_more(&iter)) {
+            cached_bulk = (struct hg_bulk *) hg_hash_table_iter_next(&iter);
+            if (hg_atomic_get32(&cached_bulk->ref_count) > 1)
+                continue;
+            if (!evicted_bulk
+                || cached_bulk->cache_stamp < evicted_bulk->cache_stamp)
+                evicted_bulk = cached_bulk;
+        }
+        if (!evicted_bulk) {
+            hg_thread_spin_unlock(&hg_bulk_cache->lock);
+            goto error;
+        }
+        hg_hash_table_remove(hg_bulk_cache->table,
+            (hg_hash_table_key_t) evicted_bulk);
+    }
+
+    if (!hg_hash_table_insert(hg_bulk_cache->table,
+        (hg_hash_table_key_t) cache_bulk, (hg_hash_table_value_t) cache_bulk)) {
+        HG_LOG_ERROR("Could not insert handle into cache");
+        hg_thread_spin_unlock(&hg_bulk_cache->lock);
+        goto error;
+    }
+    /* Cache holds its own reference */
+    hg_atomic_incr32(&cache_bulk->ref_count);
+    cache_bulk->cache_stamp = ++hg_bulk_cache->clock;
+
+    hg_thread_spin_unlock(&hg_bulk_cache->lock);
+
+    /* Drop reference of evicted handle outside of lock */
+    hg_bulk_free(evicted_bulk);
+
+    return cache_bulk;
+
+error:
+    hg_bulk_free(evicted_bulk);
+    hg_bulk_free(cache_bulk);
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_cache_flush(struct hg_bulk_cache *hg_bulk_cache, const void *buf,
+    hg_size_t size)
+{
+    hg_ptr_t start = (hg_ptr_t) buf, end = start + size;
+
+    for (;;) {
+        struct hg_bulk *cache_bulk = NULL;
+        hg_hash_table_iter_t iter;
+
+        hg_thread_spin_lock(&hg_bulk_cache->lock);
+        hg_hash_table_iterate(hg_bulk_cache->table, &iter);
+        while (!cache_bulk && hg_hash_table_iter_has_more(&iter)) {
+            struct hg_bulk *cached_bulk =
+                (struct hg_bulk *) hg_hash_table_iter_next(&iter);
+            hg_uint32_t i;
+
+            for (i = 0; i < cached_bulk->segment_count; i++) {
+                if (!buf || (cached_bulk->segments[i].address < end
+                    && start < cached_bulk->segments[i].address
+                    + cached_bulk->segments[i].size)) {
+                    cache_bulk = cached_bulk;
+                    break;
+                }
+            }
+        }
+        if (cache_bulk)
+            hg_hash_table_remove(hg_bulk_cache->table,
+                (hg_hash_table_key_t) cache_bulk);
+        hg_thread_spin_unlock(&hg_bulk_cache->lock);
+
+        if (!cache_bulk)
+            break;
+        /* Deregistered once no handle uses it anymore */
+        hg_bulk_free(cache_bulk);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_bulk_pool_class(struct hg_bulk_pool *hg_bulk_pool, hg_size_t size)
+{
+    hg_size_t class_size = hg_bulk_pool->info.min_class_size;
+    unsigned int class_index = 0;
+
+    while (class_size < size && class_index < hg_bulk_pool->class_count) {
+        class_size <<= 1;
+        class_index++;
+    }
+
+    return class_index;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pool_set_info(struct hg_bulk_pool *hg_bulk_pool,
+    const struct hg_bulk_arena_info *arena_info)
+{
+    struct hg_bulk_arena **free_arenas = NULL, **prev_free_arenas;
+    unsigned int class_count = 1;
+    hg_size_t class_size;
+    hg_return_t ret = HG_SUCCESS;
+
+    for (class_size = arena_info->min_class_size;
+        class_size < arena_info->max_class_size; class_size <<= 1)
+        class_count++;
+
+    free_arenas = (struct hg_bulk_arena **) calloc(class_count,
+        sizeof(struct hg_bulk_arena *));
+    if (!free_arenas) {
+        HG_LOG_ERROR("Could not allocate free block lists");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    hg_thread_spin_lock(&hg_bulk_pool->lock);
+    if (hg_bulk_pool->arenas) {
+        hg_thread_spin_unlock(&hg_bulk_pool->lock);
+        HG_LOG_ERROR("Arenas were already allocated");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    hg_bulk_pool->info = *arena_info;
+    hg_bulk_pool->class_count = class_count;
+    /* Previous lists are empty and freed */
+    prev_free_arenas = hg_bulk_pool->free_arenas;
+    hg_bulk_pool->free_arenas = free_arenas;
+    free_arenas = prev_free_arenas;
+    hg_thread_spin_unlock(&hg_bulk_pool->lock);
+
+done:
+    free(free_arenas);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_arena_create(hg_class_t *hg_class, hg_size_t size,
+    unsigned int class_index, struct hg_bulk_arena **arena_ptr)
+{
+    struct hg_bulk_arena *arena = NULL;
+    struct hg_bulk *hg_bulk = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    arena = (struct hg_bulk_arena *) malloc(sizeof(struct hg_bulk_arena));
+    if (!arena) {
+        HG_LOG_ERROR("Could not allocate arena");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(arena, 0, sizeof(struct hg_bulk_arena));
+    arena->size = size;
+    arena->class_index = class_index;
+    arena->huge_pages = hg_class->bulk_pool->info.huge_pages;
+
+    /* Block 0 is handed out by the caller, others are free */
+    if (class_index < hg_class->bulk_pool->class_count) {
+        unsigned int block_count = (unsigned int) (size
+            / (hg_class->bulk_pool->info.min_class_size << class_index));
+        unsigned int i;
+
+        arena->free_blocks = (unsigned int *) malloc(
+            block_count * sizeof(unsigned int));
+        if (!arena->free_blocks) {
+            HG_LOG_ERROR("Could not allocate free block indices");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        /* Lowest indices are on top of the stack */
+        for (i = 0; i + 1 < block_count; i++)
+            arena->free_blocks[i] = block_count - 1 - i;
+        arena->free_count = block_count - 1;
+    }
+
+    if (arena->huge_pages)
+        arena->base = hg_mem_huge_alloc((size_t) size);
+    else
+        arena->base = hg_mem_aligned_alloc((size_t) hg_mem_get_page_size(),
+            (size_t) size);
+    if (!arena->base) {
+        HG_LOG_ERROR("Could not allocate arena memory");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    /* Handle registering arena, shared by handles of arena blocks */
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    if (!hg_bulk) {
+        HG_LOG_ERROR("Could not allocate handle");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->hg_class = hg_class;
+    hg_bulk->na_class = HG_Core_class_get_na(hg_class->core_class);
+#ifdef HG_HAS_SM_ROUTING
+    hg_bulk->na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
+#endif
+    hg_bulk->total_size = size;
+    hg_bulk->segment_count = 1;
+    hg_bulk->na_mem_handle_count = 1;
+    hg_bulk->flags = HG_BULK_READWRITE;
+    hg_atomic_set32(&hg_bulk->ref_count, 1);
+    arena->hg_bulk = hg_bulk;
+
+    hg_bulk->segments = (struct hg_bulk_segment *) malloc(
+        sizeof(struct hg_bulk_segment));
+    if (!hg_bulk->segments) {
+        HG_LOG_ERROR("Could not allocate segment array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_bulk->segments[0].address = (hg_ptr_t) arena->base;
+    hg_bulk->segments[0].size = size;
+
+    ret = hg_bulk_register(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register arena");
+        goto done;
+    }
+
+    ret = hg_bulk_publish(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not publish arena");
+        goto done;
+    }
+
+    *arena_ptr = arena;
+
+done:
+    if (ret != HG_SUCCESS)
+        hg_bulk_arena_destroy(arena);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_arena_destroy(struct hg_bulk_arena *arena)
+{
+    if (!arena)
+        return;
+
+    /* Deregister before memory is released */
+    hg_bulk_free(arena->hg_bulk);
+    if (arena->huge_pages)
+        hg_mem_huge_free(arena->base, (size_t) arena->size);
+    else
+        hg_mem_aligned_free(arena->base);
+    free(arena->free_blocks);
+    free(arena);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pool_get(hg_class_t *hg_class, hg_size_t size,
+    struct hg_bulk_arena **arena_ptr, void **block_ptr)
+{
+    struct hg_bulk_pool *hg_bulk_pool = hg_class->bulk_pool;
+    struct hg_bulk_arena *arena = NULL;
+    unsigned int class_index = hg_bulk_pool_class(hg_bulk_pool, size);
+    hg_return_t ret = HG_SUCCESS;
+
+    if (class_index < hg_bulk_pool->class_count) {
+        hg_size_t block_size = hg_bulk_pool->info.min_class_size << class_index;
+        unsigned int block_index = 0;
+
+        hg_thread_spin_lock(&hg_bulk_pool->lock);
+        arena = hg_bulk_pool->free_arenas[class_index];
+        if (arena) {
+            block_index = arena->free_blocks[--arena->free_count];
+            if (!arena->free_count)
+                hg_bulk_pool->free_arenas[class_index] = arena->next_free;
+        }
+        hg_thread_spin_unlock(&hg_bulk_pool->lock);
+
+        if (arena) {
+            *arena_ptr = arena;
+            *block_ptr = (char *) arena->base
+                + (hg_size_t) block_index * block_size;
+            goto done;
+        }
+
+        /* No free block, create arena outside of lock and keep first block */
+        ret = hg_bulk_arena_create(hg_class, hg_bulk_pool->info.arena_size,
+            class_index, &arena);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not create arena");
+            goto done;
+        }
+
+        hg_thread_spin_lock(&hg_bulk_pool->lock);
+        if (arena->free_count) {
+            arena->next_free = hg_bulk_pool->free_arenas[class_index];
+            hg_bulk_pool->free_arenas[class_index] = arena;
+        }
+        arena->next = hg_bulk_pool->arenas;
+        hg_bulk_pool->arenas = arena;
+        hg_thread_spin_unlock(&hg_bulk_pool->lock);
+    } else {
+        /* Dedicated arena */
+        ret = hg_bulk_arena_create(hg_class, size, class_index, &arena);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not create arena");
+            goto done;
+        }
+
+        hg_thread_spin_lock(&hg_bulk_pool->lock);
+        arena->next = hg_bulk_pool->arenas;
+        hg_bulk_pool->arenas = arena;
+        hg_thread_spin_unlock(&hg_bulk_pool->lock);
+    }
+
+    *arena_ptr = arena;
+    *block_ptr = arena->base;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_pool_release(struct hg_bulk_pool *hg_bulk_pool,
+    struct hg_bulk_arena *arena, void *block)
+{
+    if (arena->class_index < hg_bulk_pool->class_count) {
+        hg_size_t block_size =
+            hg_bulk_pool->info.min_class_size << arena->class_index;
+        unsigned int block_index = (unsigned int)
+            (((char *) block - (char *) arena->base) / block_size);
+
+        hg_thread_spin_lock(&hg_bulk_pool->lock);
+        /* Arena has free blocks again */
+        if (!arena->free_count) {
+            arena->next_free = hg_bulk_pool->free_arenas[arena->class_index];
+            hg_bulk_pool->free_arenas[arena->class_index] = arena;
+        }
+        arena->free_blocks[arena->free_count++] = block_index;
+        hg_thread_spin_unlock(&hg_bulk_pool->lock);
+    } else {
+        struct hg_bulk_arena **arena_ptr;
+
+        hg_thread_spin_lock(&hg_bulk_pool->lock);
+        for (arena_ptr = &hg_bulk_pool->arenas; *arena_ptr != arena;
+            arena_ptr = &(*arena_ptr)->next)
+            continue;
+        *arena_ptr = arena->next;
+        hg_thread_spin_unlock(&hg_bulk_pool->lock);
+
+        hg_bulk_arena_destroy(arena);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_free(struct hg_bulk *hg_bulk)
+{
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    if (!hg_bulk) goto done;
+
+    if (hg_atomic_decr32(&hg_bulk->ref_count)) {
+        /* Cannot free yet */
+        goto done;
+    }
+
+    /* Memory must no longer be updated by emulated atomic operations */
+    if (hg_bulk->atomic_target)
+        hg_bulk_atomic_target_remove(hg_bulk);
+
+    if (hg_bulk->reg_bulk) {
+        /* NA memory handles are owned by cached handle or arena */
+        hg_bulk_free(hg_bulk->reg_bulk);
+    } else if (hg_bulk->na_mem_handles) {
+        na_class_t *na_class = hg_bulk->na_class;
+#ifdef HG_HAS_SM_ROUTING
+        na_class_t *na_sm_class = hg_bulk->na_sm_class;
+#endif
+
+        /* Unregister/free NA memory handles */
+        if (hg_bulk->segment_published) {
             for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
                 na_return_t na_ret;
 
@@ -617,13 +2463,33 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
 #endif
     }
 
+    /* Return memory allocated by HG_Bulk_alloc() to its arena */
+    if (hg_bulk->arena)
+        hg_bulk_pool_release(hg_bulk->hg_class->bulk_pool, hg_bulk->arena,
+            (void *) hg_bulk->segments[0].address);
+
+    /* Unmap file range once deregistered */
+    if (hg_bulk->file_mapped
+        && hg_mem_fd_unmap((void *) hg_bulk->segments[0].address,
+            (size_t) hg_bulk->segments[0].size) != HG_UTIL_SUCCESS) {
+        HG_LOG_ERROR("Could not unmap file range");
+        ret = HG_OTHER_ERROR;
+    }
+
     /* Free segments */
     if (hg_bulk->segment_alloc) {
-        for (i = 0; i < hg_bulk->segment_count; i++) {
+        /* Strided handles only store first block */
+        for (i = 0; i < (hg_bulk->stride ? 1 : hg_bulk->segment_count); i++) {
             free((void *) hg_bulk->segments[i].address);
         }
     }
     free(hg_bulk->segments);
+    free(hg_bulk->segment_offsets);
+    free(hg_bulk->checksums);
+    if (hg_bulk->eager_push) {
+        free(hg_bulk->eager_ranges);
+        hg_thread_spin_destroy(&hg_bulk->eager_lock);
+    }
 
     /* Free addr if any was attached to handle */
     HG_Core_addr_free(hg_bulk->hg_class->core_class, hg_bulk->addr);
@@ -635,55 +2501,266 @@ done:
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_bulk_offset_translate(struct hg_bulk *hg_bulk, hg_size_t offset,
-    hg_uint32_t *segment_start_index, hg_size_t *segment_start_offset)
+static HG_INLINE hg_uint8_t
+hg_bulk_eager_flags(struct hg_bulk *hg_bulk, hg_uint8_t request_eager)
 {
-    hg_uint32_t i, new_segment_start_index = 0;
-    hg_size_t new_segment_offset = offset, next_offset = 0;
+    struct hg_class *hg_class = hg_bulk->hg_class;
+    hg_uint8_t flags = 0;
 
-    /* Get start index and handle offset */
-    for (i = 0; i < hg_bulk->segment_count; i++) {
-        next_offset += hg_bulk->segments[i].size;
-        if (offset < next_offset) {
-            new_segment_start_index = i;
+    switch (hg_bulk->flags) {
+        case HG_BULK_READ_ONLY:
+            if ((request_eager & HG_BULK_EAGER_PULL)
+                && hg_bulk->total_size <= hg_class->eager_pull_size)
+                flags = HG_BULK_EAGER_PULL;
+            break;
+        case HG_BULK_WRITE_ONLY:
+            if ((request_eager & HG_BULK_EAGER_PUSH)
+                && hg_bulk->total_size <= hg_class->eager_push_size)
+                flags = HG_BULK_EAGER_PUSH;
+            break;
+        case HG_BULK_READWRITE:
+            /* Target must see its own pushes when pulling, both or none */
+            if ((request_eager & HG_BULK_EAGER_PULL)
+                && (request_eager & HG_BULK_EAGER_PUSH)
+                && hg_bulk->total_size <= hg_class->eager_pull_size
+                && hg_bulk->total_size <= hg_class->eager_push_size)
+                flags = HG_BULK_EAGER_PULL | HG_BULK_EAGER_PUSH;
+            break;
+        default:
             break;
-        }
-        new_segment_offset -= hg_bulk->segments[i].size;
     }
 
-    *segment_start_index = new_segment_start_index;
-    *segment_start_offset = new_segment_offset;
+    return flags;
 }
 
 /*---------------------------------------------------------------------------*/
 static void
-hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
-    hg_uint8_t HG_BULK_UNUSED flags, hg_uint32_t max_count, void **buf_ptrs,
-    hg_size_t *buf_sizes, hg_uint32_t *actual_count)
+hg_bulk_copy(struct hg_bulk *hg_bulk, hg_size_t offset, void *buf,
+    hg_size_t size, hg_bool_t to_bulk)
 {
+    char *buf_ptr = (char *) buf;
     hg_uint32_t segment_index;
     hg_size_t segment_offset;
-    hg_size_t remaining_size = size;
-    hg_uint32_t count = 0;
-
-    /* TODO use flags */
 
     hg_bulk_offset_translate(hg_bulk, offset, &segment_index,
         &segment_offset);
 
-    while ((remaining_size > 0) && (count < max_count)) {
-        hg_ptr_t segment_address;
-        hg_size_t segment_size;
+    while (size > 0 && segment_index < hg_bulk->segment_count) {
+        struct hg_bulk_segment segment =
+            hg_bulk_segment_get(hg_bulk, segment_index);
+        char *segment_ptr = (char *) segment.address + segment_offset;
+        hg_size_t copy_size = HG_BULK_MIN(size, segment.size - segment_offset);
+
+        if (to_bulk)
+            hg_mem_copy(segment_ptr, buf_ptr, copy_size);
+        else
+            hg_mem_copy(buf_ptr, segment_ptr, copy_size);
+        buf_ptr += copy_size;
+        size -= copy_size;
+        segment_index++;
+        segment_offset = 0;
+    }
+}
 
-        /* Can only transfer smallest size */
-        segment_size = hg_bulk->segments[segment_index].size
-            - segment_offset;
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_eager_range_add(struct hg_bulk *hg_bulk, hg_size_t offset,
+    hg_size_t size)
+{
+    struct hg_bulk_range *last;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_spin_lock(&hg_bulk->eager_lock);
+
+    /* Extend last range if contiguous (common case of sequential pushes) */
+    last = (hg_bulk->eager_range_count) ?
+        &hg_bulk->eager_ranges[hg_bulk->eager_range_count - 1] : NULL;
+    if (last && offset >= last->offset
+        && offset <= last->offset + last->size) {
+        if (offset + size > last->offset + last->size)
+            last->size = offset + size - last->offset;
+    } else {
+        struct hg_bulk_range *new_ranges = (struct hg_bulk_range *) realloc(
+            hg_bulk->eager_ranges,
+            (hg_bulk->eager_range_count + 1) * sizeof(struct hg_bulk_range));
+
+        if (!new_ranges) {
+            HG_LOG_ERROR("Could not allocate eager ranges");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        hg_bulk->eager_ranges = new_ranges;
+        hg_bulk->eager_ranges[hg_bulk->eager_range_count].offset = offset;
+        hg_bulk->eager_ranges[hg_bulk->eager_range_count].size = size;
+        hg_bulk->eager_range_count++;
+    }
+
+done:
+    hg_thread_spin_unlock(&hg_bulk->eager_lock);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_offset_translate(struct hg_bulk *hg_bulk, hg_size_t offset,
+    hg_uint32_t *segment_start_index, hg_size_t *segment_start_offset)
+{
+    hg_uint32_t i, new_segment_start_index = 0;
+    hg_size_t new_segment_offset = offset, next_offset = 0;
+
+    if (hg_bulk->stride) {
+        *segment_start_index = (hg_uint32_t) (offset / hg_bulk->segments[0].size);
+        *segment_start_offset = offset % hg_bulk->segments[0].size;
+        return;
+    }
+
+    if (hg_bulk->segment_offsets) {
+        hg_uint32_t low = 0, high = hg_bulk->segment_count - 1;
+
+        /* First segment that ends after offset (skips empty segments) */
+        while (low < high) {
+            hg_uint32_t mid = low + (high - low) / 2;
+
+            if (offset < hg_bulk->segment_offsets[mid + 1])
+                high = mid;
+            else
+                low = mid + 1;
+        }
+        *segment_start_index = low;
+        *segment_start_offset = offset - hg_bulk->segment_offsets[low];
+        return;
+    }
+
+    /* Get start index and handle offset */
+    for (i = 0; i < hg_bulk->segment_count; i++) {
+        next_offset += hg_bulk->segments[i].size;
+        if (offset < next_offset) {
+            new_segment_start_index = i;
+            break;
+        }
+        new_segment_offset -= hg_bulk->segments[i].size;
+    }
+
+    *segment_start_index = new_segment_start_index;
+    *segment_start_offset = new_segment_offset;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE struct hg_bulk_segment
+hg_bulk_segment_get(struct hg_bulk *hg_bulk, hg_size_t segment_index)
+{
+    struct hg_bulk_segment segment;
+
+    if (!hg_bulk->stride)
+        return hg_bulk->segments[segment_index];
+
+    segment.address = hg_bulk->segments[0].address
+        + (hg_ptr_t) (segment_index * hg_bulk->stride);
+    segment.size = hg_bulk->segments[0].size;
+
+    return segment;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_ptr_t
+hg_bulk_na_base(struct hg_bulk *hg_bulk, hg_size_t segment_index)
+{
+    hg_size_t base_index = (hg_bulk->na_mem_handle_count > 1) ?
+        segment_index : 0;
+
+    return hg_bulk_segment_get(hg_bulk, base_index).address
+        - (hg_ptr_t) (base_index ? 0 : hg_bulk->na_mem_offset);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_bulk_segment_size(struct hg_bulk *hg_bulk, hg_size_t segment_index)
+{
+    return (hg_bulk->contiguous) ? hg_bulk->total_size :
+        hg_bulk_segment_get(hg_bulk, segment_index).size;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_bool_t
+hg_bulk_na_segmented(struct hg_bulk *hg_bulk)
+{
+    return (hg_bool_t) (hg_bulk->na_mem_handle_count == 1
+        && hg_bulk->segment_count > 1 && !hg_bulk->contiguous
+        && !hg_bulk->stride);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_bool_t
+hg_bulk_strided(struct hg_bulk *hg_bulk)
+{
+    return (hg_bool_t) (hg_bulk->stride && !hg_bulk->contiguous
+        && hg_bulk->na_mem_handle_count == 1);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_bulk_piece_size(struct hg_bulk *hg_bulk, hg_size_t segment_index,
+    hg_size_t segment_offset, hg_size_t strided_max)
+{
+    hg_size_t size = hg_bulk_segment_size(hg_bulk, segment_index)
+        - segment_offset;
+
+    if (strided_max && hg_bulk_strided(hg_bulk)) {
+        hg_size_t block_count = HG_BULK_MIN(strided_max,
+            hg_bulk->segment_count - segment_index);
+
+        size += (block_count - 1) * hg_bulk->segments[0].size;
+    }
+
+    return size;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE const struct na_stride *
+hg_bulk_na_stride(struct hg_bulk *hg_bulk, hg_size_t segment_index,
+    hg_size_t segment_offset, struct na_stride *na_stride,
+    hg_size_t *na_offset)
+{
+    if (!hg_bulk_strided(hg_bulk))
+        return NULL;
+
+    /* Strided handles are registered from their first block */
+    na_stride->offset = hg_bulk->na_mem_offset;
+    na_stride->block_size = hg_bulk->segments[0].size;
+    na_stride->stride = hg_bulk->stride;
+    *na_offset = segment_index * hg_bulk->segments[0].size + segment_offset;
+
+    return na_stride;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
+    hg_uint8_t HG_BULK_UNUSED flags, hg_uint32_t max_count, void **buf_ptrs,
+    hg_size_t *buf_sizes, hg_uint32_t *actual_count)
+{
+    hg_uint32_t segment_index;
+    hg_size_t segment_offset;
+    hg_size_t remaining_size = size;
+    hg_uint32_t count = 0;
+
+    /* TODO use flags */
+
+    hg_bulk_offset_translate(hg_bulk, offset, &segment_index,
+        &segment_offset);
+
+    while ((remaining_size > 0) && (count < max_count)) {
+        struct hg_bulk_segment segment =
+            hg_bulk_segment_get(hg_bulk, segment_index);
+        hg_ptr_t segment_address;
+        hg_size_t segment_size;
+
+        /* Can only transfer smallest size */
+        segment_size = segment.size - segment_offset;
 
         /* Remaining size may be smaller */
         segment_size = HG_BULK_MIN(remaining_size, segment_size);
-        segment_address = hg_bulk->segments[segment_index].address +
-            (hg_ptr_t) segment_offset;
+        segment_address = segment.address + (hg_ptr_t) segment_offset;
 
         /* Fill segments */
         if (buf_ptrs) buf_ptrs[count] = (void *) segment_address;
@@ -705,6 +2782,164 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
     if (actual_count) *actual_count = count;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_uint32_t
+hg_bulk_checksum_count(struct hg_bulk *hg_bulk)
+{
+    /* Checksums only make sense if data can be read from handle */
+    if (!hg_bulk->checksum_block_size || !(hg_bulk->flags & HG_BULK_READ_ONLY))
+        return 0;
+
+    return (hg_uint32_t) ((hg_bulk->total_size + hg_bulk->checksum_block_size
+        - 1) / hg_bulk->checksum_block_size);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_bulk_checksum(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size)
+{
+    hg_uint32_t segment_index;
+    hg_size_t segment_offset;
+    hg_size_t remaining_size = size;
+    hg_uint32_t crc = 0;
+
+    hg_bulk_offset_translate(hg_bulk, offset, &segment_index,
+        &segment_offset);
+
+    while (remaining_size > 0 && segment_index < hg_bulk->segment_count) {
+        struct hg_bulk_segment segment =
+            hg_bulk_segment_get(hg_bulk, segment_index);
+        hg_size_t segment_size = segment.size - segment_offset;
+
+        segment_size = HG_BULK_MIN(remaining_size, segment_size);
+        crc = hg_checksum_crc32c(crc,
+            (const void *) (segment.address + (hg_ptr_t) segment_offset),
+            segment_size);
+        remaining_size -= segment_size;
+
+        segment_index++;
+        segment_offset = 0;
+    }
+
+    return crc;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_checksum_update(struct hg_bulk *hg_bulk)
+{
+    hg_uint32_t checksum_count = hg_bulk_checksum_count(hg_bulk);
+    hg_size_t block_size = hg_bulk->checksum_block_size;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    if (!hg_bulk->checksums) {
+        hg_bulk->checksums = (hg_uint32_t *) malloc(
+            checksum_count * sizeof(hg_uint32_t));
+        if (!hg_bulk->checksums) {
+            HG_LOG_ERROR("Could not allocate checksum array");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+    }
+
+    for (i = 0; i < checksum_count; i++) {
+        hg_size_t block_offset = i * block_size;
+
+        hg_bulk->checksums[i] = hg_bulk_checksum(hg_bulk, block_offset,
+            HG_BULK_MIN(block_size, hg_bulk->total_size - block_offset));
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_checksum_init(struct hg_bulk_op_id *hg_bulk_op_id, hg_size_t size)
+{
+    struct hg_bulk *hg_bulk_origin = hg_bulk_op_id->hg_bulk_origin;
+    hg_size_t block_size = hg_bulk_origin->checksum_block_size;
+    hg_size_t start = hg_bulk_op_id->origin_offset, end = start + size;
+    hg_uint32_t block_first, block_end, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Only blocks fully covered by the transfer can be verified, the last
+     * block may be shorter than block_size */
+    block_first = (hg_uint32_t) ((start + block_size - 1) / block_size);
+    block_end = (end == hg_bulk_origin->total_size) ?
+        hg_bulk_checksum_count(hg_bulk_origin) :
+        (hg_uint32_t) (end / block_size);
+    if (block_end <= block_first)
+        goto done;
+
+    hg_bulk_op_id->block_remaining = (hg_atomic_int32_t *) malloc(
+        (block_end - block_first) * sizeof(hg_atomic_int32_t));
+    if (!hg_bulk_op_id->block_remaining) {
+        HG_LOG_ERROR("Could not allocate block array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    for (i = block_first; i < block_end; i++) {
+        hg_size_t block_offset = i * block_size;
+
+        hg_atomic_init32(&hg_bulk_op_id->block_remaining[i - block_first],
+            (hg_util_int32_t) (HG_BULK_MIN(block_size,
+                hg_bulk_origin->total_size - block_offset)));
+    }
+    hg_bulk_op_id->block_first = block_first;
+    hg_bulk_op_id->block_count = block_end - block_first;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_checksum_verify(struct hg_bulk_op_id *hg_bulk_op_id, hg_size_t offset,
+    hg_size_t size)
+{
+    struct hg_bulk *hg_bulk_origin = hg_bulk_op_id->hg_bulk_origin;
+    hg_size_t block_size = hg_bulk_origin->checksum_block_size;
+    hg_size_t start = hg_bulk_op_id->origin_offset + offset, end = start + size;
+    hg_uint32_t i;
+
+    for (i = (hg_uint32_t) (start / block_size); i * block_size < end; i++) {
+        hg_size_t block_start = i * block_size;
+        hg_size_t block_end = HG_BULK_MIN(block_start + block_size,
+            hg_bulk_origin->total_size);
+        hg_atomic_int32_t *block_remaining;
+        hg_util_int32_t remaining, len;
+        hg_uint32_t crc;
+
+        if (i < hg_bulk_op_id->block_first
+            || i >= hg_bulk_op_id->block_first + hg_bulk_op_id->block_count)
+            continue;
+
+        /* Pieces of the same block may complete concurrently */
+        block_remaining =
+            &hg_bulk_op_id->block_remaining[i - hg_bulk_op_id->block_first];
+        len = (hg_util_int32_t) ((HG_BULK_MIN(end, block_end))
+            - ((start > block_start) ? start : block_start));
+        do {
+            remaining = hg_atomic_get32(block_remaining);
+        } while (!hg_atomic_cas32(block_remaining, remaining,
+            remaining - len));
+        if (remaining != len)
+            continue;
+
+        /* Block is complete, verify local copy */
+        crc = hg_bulk_checksum(hg_bulk_op_id->hg_bulk_local,
+            hg_bulk_op_id->local_offset + block_start
+                - hg_bulk_op_id->origin_offset, block_end - block_start);
+        if (crc != hg_bulk_origin->checksums[i]) {
+            HG_LOG_ERROR("Checksum mismatch on block %u (0x%08x != 0x%08x)",
+                i, crc, hg_bulk_origin->checksums[i]);
+            hg_atomic_set32(&hg_bulk_op_id->corrupted, 1);
+        }
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static int
 hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
@@ -721,7 +2956,10 @@ hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
         HG_LOG_ERROR("Error in NA callback: %s",
             NA_Error_to_string(callback_info->ret));
         na_ret = NA_PROTOCOL_ERROR;
-        goto done;
+        /* Entries of vectored transfers report their status instead */
+        if (!hg_bulk_op_id->parent)
+            goto done;
+        hg_atomic_set32(&hg_bulk_op_id->failed, 1);
     }
 
     /* When all NA transfers that correspond to bulk operation complete
@@ -729,7 +2967,10 @@ hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
      */
     if ((unsigned int) hg_atomic_incr32(&hg_bulk_op_id->op_completed_count)
         == hg_bulk_op_id->op_count) {
-        hg_bulk_complete(hg_bulk_op_id);
+        if (hg_bulk_op_id->parent)
+            hg_bulk_multi_complete(hg_bulk_op_id);
+        else
+            hg_bulk_complete(hg_bulk_op_id);
         ret++;
     }
 
@@ -738,6 +2979,28 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static int
+hg_bulk_transfer_piece_cb(const struct na_cb_info *callback_info)
+{
+    struct hg_bulk_piece *hg_bulk_piece =
+        (struct hg_bulk_piece *) callback_info->arg;
+    struct na_cb_info piece_callback_info = *callback_info;
+
+    if (callback_info->ret == NA_SUCCESS) {
+        /* Verify data as soon as it lands so that it overlaps with remaining
+         * pieces of the transfer */
+        if (hg_bulk_piece->hg_bulk_op_id->block_count)
+            hg_bulk_checksum_verify(hg_bulk_piece->hg_bulk_op_id,
+                hg_bulk_piece->offset, hg_bulk_piece->size);
+        hg_atomic_set32(&hg_bulk_piece->completed, 1);
+    }
+
+    piece_callback_info.arg = hg_bulk_piece->hg_bulk_op_id;
+
+    return hg_bulk_transfer_cb(&piece_callback_info);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_transfer_pieces(na_bulk_op_t na_bulk_op, na_addr_t origin_addr, na_uint8_t origin_id,
@@ -745,8 +3008,9 @@ hg_bulk_transfer_pieces(na_bulk_op_t na_bulk_op, na_addr_t origin_addr, na_uint8
     hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
     struct hg_bulk *hg_bulk_local, hg_size_t local_segment_start_index,
     hg_size_t local_segment_start_offset, hg_size_t size,
-    hg_bool_t scatter_gather, struct hg_bulk_op_id *hg_bulk_op_id,
-    unsigned int *na_op_count)
+    hg_bool_t scatter_gather, hg_size_t origin_offset, hg_size_t block_size,
+    hg_size_t rail_chunk_size, hg_size_t strided_max,
+    struct hg_bulk_op_id *hg_bulk_op_id, unsigned int *na_op_count)
 {
     hg_size_t origin_segment_index = origin_segment_start_index;
     hg_size_t na_origin_segment_index =
@@ -777,29 +3041,122 @@ hg_bulk_transfer_pieces(na_bulk_op_t na_bulk_op, na_addr_t origin_addr, na_uint8
 
         if (!scatter_gather) {
             /* Can only transfer smallest size */
-            origin_transfer_size =
-                hg_bulk_origin->segments[origin_segment_index].size
-                    - origin_segment_offset;
-            local_transfer_size =
-                hg_bulk_local->segments[local_segment_index].size
-                    - local_segment_offset;
+            origin_transfer_size = hg_bulk_piece_size(hg_bulk_origin,
+                origin_segment_index, origin_segment_offset, strided_max);
+            local_transfer_size = hg_bulk_piece_size(hg_bulk_local,
+                local_segment_index, local_segment_offset, strided_max);
             transfer_size = HG_BULK_MIN(origin_transfer_size,
                 local_transfer_size);
 
             /* Remaining size may be smaller */
             transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
+
+            /* Do not cross chunks striped across rails */
+            if (rail_chunk_size) {
+                hg_size_t chunk_left = rail_chunk_size
+                    - (size - remaining_size) % rail_chunk_size;
+
+                transfer_size = HG_BULK_MIN(chunk_left, transfer_size);
+            }
+        }
+
+        /* Do not cross checksum block boundaries, scatter-gather transfers
+         * are split as well */
+        if (block_size) {
+            hg_size_t block_left = block_size
+                - (origin_offset + size - remaining_size) % block_size;
+
+            transfer_size = HG_BULK_MIN(block_left, transfer_size);
         }
 
         if (na_bulk_op) {
-            na_ret = na_bulk_op(hg_bulk_op_id->na_class,
-                hg_bulk_op_id->na_context, hg_bulk_transfer_cb, hg_bulk_op_id,
-                na_local_mem_handles[na_local_segment_index],
-                hg_bulk_local->segments[local_segment_index].address,
-                local_segment_offset,
-                na_origin_mem_handles[na_origin_segment_index],
-                hg_bulk_origin->segments[origin_segment_index].address,
-                origin_segment_offset, transfer_size, origin_addr, origin_id,
-                &hg_bulk_op_id->na_op_ids[count]);
+            na_cb_t na_cb = hg_bulk_transfer_cb;
+            void *na_cb_arg = hg_bulk_op_id;
+            na_context_t *na_context = hg_bulk_op_id->na_context;
+            hg_size_t transferred = size - remaining_size;
+            hg_ptr_t origin_base = hg_bulk_na_base(hg_bulk_origin,
+                origin_segment_index);
+            hg_ptr_t local_base = hg_bulk_na_base(hg_bulk_local,
+                local_segment_index);
+            hg_size_t origin_na_offset = origin_segment_offset
+                + (hg_bulk_segment_get(hg_bulk_origin,
+                    origin_segment_index).address - origin_base);
+            hg_size_t local_na_offset = local_segment_offset
+                + (hg_bulk_segment_get(hg_bulk_local,
+                    local_segment_index).address - local_base);
+
+            /* NA memory handles created from multiple segments are addressed
+             * with offsets from the start of the first segment, which
+             * memcpy operations cannot use */
+            if (na_bulk_op == hg_bulk_na_get || na_bulk_op == hg_bulk_na_put) {
+                if (hg_bulk_na_segmented(hg_bulk_origin))
+                    origin_na_offset = hg_bulk_op_id->origin_offset
+                        + transferred + hg_bulk_origin->na_mem_offset;
+                if (hg_bulk_na_segmented(hg_bulk_local))
+                    local_na_offset = hg_bulk_op_id->local_offset
+                        + transferred + hg_bulk_local->na_mem_offset;
+            }
+
+            /* Chunks are posted to rails in turn, each rail completes its
+             * pieces independently and the last piece completes transfer */
+            if (rail_chunk_size) {
+                hg_core_context_t *core_context =
+                    hg_bulk_op_id->context->core_context;
+
+                na_context = HG_Core_context_get_na_rail(core_context,
+                    (unsigned int) ((transferred / rail_chunk_size)
+                        % HG_Core_context_get_na_rail_count(core_context)));
+            }
+
+            if (hg_bulk_op_id->pieces) {
+                struct hg_bulk_piece *hg_bulk_piece =
+                    &hg_bulk_op_id->pieces[count];
+
+                hg_bulk_piece->hg_bulk_op_id = hg_bulk_op_id;
+                hg_bulk_piece->offset = transferred;
+                hg_bulk_piece->size = transfer_size;
+                hg_bulk_piece->na_context = na_context;
+                hg_atomic_init32(&hg_bulk_piece->completed, 0);
+                na_cb = hg_bulk_transfer_piece_cb;
+                na_cb_arg = hg_bulk_piece;
+            }
+
+            if (strided_max) {
+                /* Blocks of strided handles are accessed with a single NA
+                 * operation */
+                struct na_stride origin_na_stride, local_na_stride;
+                const struct na_stride *origin_stride = hg_bulk_na_stride(
+                    hg_bulk_origin, origin_segment_index,
+                    origin_segment_offset, &origin_na_stride,
+                    &origin_na_offset);
+                const struct na_stride *local_stride = hg_bulk_na_stride(
+                    hg_bulk_local, local_segment_index, local_segment_offset,
+                    &local_na_stride, &local_na_offset);
+
+                na_ret = (na_bulk_op == hg_bulk_na_put) ?
+                    NA_Put_strided(hg_bulk_op_id->na_class, na_context, na_cb,
+                        na_cb_arg, na_local_mem_handles[na_local_segment_index],
+                        local_stride, local_na_offset,
+                        na_origin_mem_handles[na_origin_segment_index],
+                        origin_stride, origin_na_offset, transfer_size,
+                        origin_addr, origin_id,
+                        &hg_bulk_op_id->na_op_ids[count]) :
+                    NA_Get_strided(hg_bulk_op_id->na_class, na_context, na_cb,
+                        na_cb_arg, na_local_mem_handles[na_local_segment_index],
+                        local_stride, local_na_offset,
+                        na_origin_mem_handles[na_origin_segment_index],
+                        origin_stride, origin_na_offset, transfer_size,
+                        origin_addr, origin_id,
+                        &hg_bulk_op_id->na_op_ids[count]);
+            } else
+                na_ret = na_bulk_op(hg_bulk_op_id->na_class,
+                    na_context, na_cb, na_cb_arg,
+                    na_local_mem_handles[na_local_segment_index], local_base,
+                    local_na_offset,
+                    na_origin_mem_handles[na_origin_segment_index],
+                    origin_base, origin_na_offset,
+                    transfer_size, origin_addr, origin_id,
+                    &hg_bulk_op_id->na_op_ids[count]);
             if (na_ret != NA_SUCCESS) {
                 HG_LOG_ERROR("Could not transfer data");
                 ret = HG_NA_ERROR;
@@ -818,20 +3175,43 @@ hg_bulk_transfer_pieces(na_bulk_op_t na_bulk_op, na_addr_t origin_addr, na_uint8
         origin_segment_offset += transfer_size;
         local_segment_offset += transfer_size;
 
-        /* Change segment if new offset exceeds segment size */
+        /* Scatter-gather offsets are relative to the first segment */
+        if (scatter_gather)
+            continue;
+
+        /* Change segment if new offset exceeds segment size, pieces of
+         * strided handles may span multiple blocks */
         if (origin_segment_offset >=
-            hg_bulk_origin->segments[origin_segment_index].size) {
-            origin_segment_index++;
+            hg_bulk_segment_size(hg_bulk_origin, origin_segment_index)) {
+            hg_size_t origin_segment_size =
+                hg_bulk_segment_size(hg_bulk_origin, origin_segment_index);
+
+            if (strided_max && hg_bulk_strided(hg_bulk_origin)) {
+                origin_segment_index +=
+                    origin_segment_offset / origin_segment_size;
+                origin_segment_offset %= origin_segment_size;
+            } else {
+                origin_segment_index++;
+                origin_segment_offset = 0;
+            }
             if (hg_bulk_origin->na_mem_handle_count > 1)
                 na_origin_segment_index = origin_segment_index;
-            origin_segment_offset = 0;
         }
         if (local_segment_offset >=
-            hg_bulk_local->segments[local_segment_index].size) {
-            local_segment_index++;
+            hg_bulk_segment_size(hg_bulk_local, local_segment_index)) {
+            hg_size_t local_segment_size =
+                hg_bulk_segment_size(hg_bulk_local, local_segment_index);
+
+            if (strided_max && hg_bulk_strided(hg_bulk_local)) {
+                local_segment_index +=
+                    local_segment_offset / local_segment_size;
+                local_segment_offset %= local_segment_size;
+            } else {
+                local_segment_index++;
+                local_segment_offset = 0;
+            }
             if (hg_bulk_local->na_mem_handle_count > 1)
                 na_local_segment_index = local_segment_index;
-            local_segment_offset = 0;
         }
     }
 
@@ -842,12 +3222,21 @@ hg_bulk_transfer_pieces(na_bulk_op_t na_bulk_op, na_addr_t origin_addr, na_uint8
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE na_context_t *
+hg_bulk_op_na_context(struct hg_bulk_op_id *hg_bulk_op_id, unsigned int i)
+{
+    return hg_bulk_op_id->striped ? hg_bulk_op_id->pieces[i].na_context :
+        hg_bulk_op_id->na_context;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
     hg_bulk_op_t op, struct hg_addr *origin_addr, hg_uint8_t origin_id,
     struct hg_bulk *hg_bulk_origin, hg_size_t origin_offset,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
+    unsigned int timeout, struct hg_bulk_op_id *hg_bulk_op_id_entry,
     hg_op_id_t *op_id)
 {
     hg_uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
@@ -867,226 +3256,1701 @@ hg_bulk_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
         (hg_core_addr_t) origin_addr);
     hg_bool_t is_self = NA_Addr_is_self(na_origin_addr_class, na_origin_addr);
     hg_bool_t scatter_gather =
-        (na_class->ops->mem_handle_create_segments && !is_self) ? HG_TRUE :
-            HG_FALSE;
+        (na_class->ops->mem_handle_create_segments && !is_self
+            && hg_bulk_origin->na_mem_handle_count == 1
+            && hg_bulk_local->na_mem_handle_count == 1
+            && (!hg_bulk_origin->stride || hg_bulk_origin->contiguous)
+            && (!hg_bulk_local->stride || hg_bulk_local->contiguous)) ?
+            HG_TRUE : HG_FALSE;
+    hg_size_t block_size = 0, rail_chunk_size = 0, strided_max = 0;
     hg_return_t ret = HG_SUCCESS;
     unsigned int i;
 
     /* Map op to NA op */
     switch (op) {
         case HG_BULK_PUSH:
-            na_bulk_op = (is_self) ? hg_bulk_memcpy_put : hg_bulk_na_put;
+            /* Eager push copies data that is returned with response */
+            na_bulk_op = (is_self || hg_bulk_origin->eager_push) ?
+                hg_bulk_memcpy_put : hg_bulk_na_put;
+            if (hg_bulk_origin->eager_push) /* Force scatter gather to false */
+                scatter_gather = HG_FALSE;
+            break;
+        case HG_BULK_PULL:
+            /* Eager mode can only be used when data is pulled from origin */
+            na_bulk_op = (is_self || hg_bulk_origin->eager_mode) ?
+                hg_bulk_memcpy_get : hg_bulk_na_get;
+            if (hg_bulk_origin->eager_mode) /* Force scatter gather to false */
+                scatter_gather = HG_FALSE;
+            break;
+        default:
+            HG_LOG_ERROR("Unknown bulk operation");
+            ret = HG_INVALID_PARAM;
+            goto done;
+    }
+
+    /* Allocate op_id, entries of vectored transfers are allocated by parent */
+    if (hg_bulk_op_id_entry)
+        hg_bulk_op_id = hg_bulk_op_id_entry;
+    else {
+        hg_bulk_op_id = (struct hg_bulk_op_id *) malloc(
+            sizeof(struct hg_bulk_op_id));
+        if (!hg_bulk_op_id) {
+            HG_LOG_ERROR("Could not allocate HG Bulk operation ID");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        hg_bulk_op_id->multi = NULL;
+        hg_bulk_op_id->parent = NULL;
+        hg_atomic_init32(&hg_bulk_op_id->failed, 0);
+    }
+    hg_bulk_op_id->context = context;
+#ifdef HG_HAS_SM_ROUTING
+    if (na_sm_class == na_origin_addr_class) {
+        hg_bulk_op_id->na_class = na_sm_class;
+        hg_bulk_op_id->na_context = na_sm_context;
+        use_sm = HG_TRUE;
+    } else {
+#endif
+        hg_bulk_op_id->na_class = na_class;
+        hg_bulk_op_id->na_context = na_context;
+#ifdef HG_HAS_SM_ROUTING
+    }
+#endif
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->arg = arg;
+    hg_atomic_set32(&hg_bulk_op_id->completed, 0);
+    hg_atomic_set32(&hg_bulk_op_id->canceled, 0);
+    hg_bulk_op_id->op_count = 1; /* Default */
+    hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
+    hg_bulk_op_id->op = op;
+    hg_bulk_op_id->hg_bulk_origin = hg_bulk_origin;
+    hg_atomic_incr32(&hg_bulk_origin->ref_count); /* Increment ref count */
+    hg_bulk_op_id->hg_bulk_local = hg_bulk_local;
+    hg_atomic_incr32(&hg_bulk_local->ref_count); /* Increment ref count */
+    hg_bulk_op_id->na_op_ids = NULL;
+    hg_bulk_op_id->is_self = is_self;
+    hg_bulk_op_id->origin_offset = origin_offset;
+    hg_bulk_op_id->local_offset = local_offset;
+    hg_bulk_op_id->size = size;
+    hg_bulk_op_id->pieces = NULL;
+    hg_bulk_op_id->striped = HG_FALSE;
+    hg_bulk_op_id->block_remaining = NULL;
+    hg_bulk_op_id->block_first = 0;
+    hg_bulk_op_id->block_count = 0;
+    hg_atomic_init32(&hg_bulk_op_id->corrupted, 0);
+    hg_bulk_op_id->pipeline = NULL;
+    hg_bulk_op_id->atomic = NULL;
+    hg_bulk_op_id->has_deadline = HG_FALSE;
+    hg_atomic_init32(&hg_bulk_op_id->posted, 0);
+    hg_atomic_init32(&hg_bulk_op_id->timed_out, 0);
+
+    /* Stripe NA transfers larger than a chunk across rails of context, rails
+     * share the NA class so that handles and addresses apply to all of them */
+    if ((na_bulk_op == hg_bulk_na_get || na_bulk_op == hg_bulk_na_put)
+        && !use_sm
+        && HG_Core_context_get_na_rail_count(context->core_context) > 1
+        && size > HG_Core_context_get_na_rail_chunk_size(
+            context->core_context)) {
+        rail_chunk_size =
+            HG_Core_context_get_na_rail_chunk_size(context->core_context);
+        hg_bulk_op_id->striped = HG_TRUE;
+        scatter_gather = HG_FALSE; /* Pieces are split on chunks */
+    }
+
+    /* Verify checksums sent by origin when data is pulled */
+    if (op == HG_BULK_PULL && hg_bulk_origin->checksum_remote
+        && hg_bulk_origin->checksums) {
+        ret = hg_bulk_checksum_init(hg_bulk_op_id, size);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not initialize checksum verification");
+            goto done;
+        }
+        /* Split pieces on block boundaries so that blocks can be verified
+         * as soon as they complete */
+        if (hg_bulk_op_id->block_count)
+            block_size = hg_bulk_origin->checksum_block_size;
+    }
+
+    /* Access blocks of strided handles in batches rather than posting one NA
+     * operation per block, when the plugin supports strided transfers */
+    if ((na_bulk_op == hg_bulk_na_get || na_bulk_op == hg_bulk_na_put)
+        && !scatter_gather && (hg_bulk_strided(hg_bulk_origin)
+            || hg_bulk_strided(hg_bulk_local))) {
+        strided_max = NA_Get_strided_max(hg_bulk_op_id->na_class);
+        if (strided_max < 2)
+            strided_max = 0;
+    }
+
+    /* Translate bulk_offset, contiguous handles are transferred as a single
+     * segment */
+    if (origin_offset && !scatter_gather && !hg_bulk_origin->contiguous)
+        hg_bulk_offset_translate(hg_bulk_origin, origin_offset,
+            &origin_segment_start_index, &origin_segment_start_offset);
+
+    /* Translate block offset */
+    if (local_offset && !scatter_gather && !hg_bulk_local->contiguous)
+        hg_bulk_offset_translate(hg_bulk_local, local_offset,
+            &local_segment_start_index, &local_segment_start_offset);
+
+    /* Figure out number of NA operations required */
+    if (!scatter_gather || block_size) {
+        hg_bulk_transfer_pieces(NULL, NA_ADDR_NULL, origin_id, use_sm, hg_bulk_origin,
+            origin_segment_start_index, origin_segment_start_offset,
+            hg_bulk_local, local_segment_start_index,
+            local_segment_start_offset, size, scatter_gather, origin_offset,
+            block_size, rail_chunk_size, strided_max, NULL,
+            &hg_bulk_op_id->op_count);
+        if (!hg_bulk_op_id->op_count) {
+            HG_LOG_ERROR("Could not get bulk op_count");
+            ret = HG_INVALID_PARAM;
+            goto done;
+        }
+    }
+
+    /* Allocate memory for NA operation IDs */
+    hg_bulk_op_id->na_op_ids = malloc(sizeof(na_op_id_t) * hg_bulk_op_id->op_count);
+    if (!hg_bulk_op_id->na_op_ids) {
+        HG_LOG_ERROR("Could not allocate memory for op_ids");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    for (i = 0; i < hg_bulk_op_id->op_count; i++)
+        hg_bulk_op_id->na_op_ids[i] = NA_Op_create(hg_bulk_op_id->na_class);
+
+    /* Allocate pieces if checksums must be verified or if progress of
+     * multiple NA operations must be tracked */
+    if (hg_bulk_op_id->block_count || hg_bulk_op_id->op_count > 1) {
+        hg_bulk_op_id->pieces = (struct hg_bulk_piece *) malloc(
+            sizeof(struct hg_bulk_piece) * hg_bulk_op_id->op_count);
+        if (!hg_bulk_op_id->pieces) {
+            HG_LOG_ERROR("Could not allocate memory for pieces");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        /* Pieces that are not posted yet may be canceled */
+        for (i = 0; i < hg_bulk_op_id->op_count; i++)
+            hg_bulk_op_id->pieces[i].na_context = hg_bulk_op_id->na_context;
+    }
+
+    /* Record range before copying, callback may trigger response */
+    if (op == HG_BULK_PUSH && hg_bulk_origin->eager_push) {
+        ret = hg_bulk_eager_range_add(hg_bulk_origin, origin_offset, size);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not record eager range");
+            goto done;
+        }
+    }
+
+    /* Transfer may complete before pieces are posted */
+    if (timeout)
+        hg_bulk_deadline_add(hg_bulk_op_id, timeout);
+
+    /* Do actual transfer */
+    ret = hg_bulk_transfer_pieces(na_bulk_op, na_origin_addr, origin_id, use_sm,
+        hg_bulk_origin, origin_segment_start_index, origin_segment_start_offset,
+        hg_bulk_local, local_segment_start_index, local_segment_start_offset,
+        size, scatter_gather, origin_offset, block_size, rail_chunk_size,
+        strided_max, hg_bulk_op_id, NULL);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not transfer data pieces");
+        hg_bulk_deadline_remove(hg_bulk_op_id);
+        goto done;
+    }
+    hg_atomic_set32(&hg_bulk_op_id->posted, 1);
+
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+done:
+    /* Entries are released with parent */
+    if (ret != HG_SUCCESS && hg_bulk_op_id && !hg_bulk_op_id_entry) {
+        free(hg_bulk_op_id->na_op_ids);
+        free(hg_bulk_op_id->pieces);
+        free(hg_bulk_op_id->block_remaining);
+        free(hg_bulk_op_id);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_check(hg_context_t *context, hg_bulk_op_t op,
+    struct hg_addr *origin_addr, hg_uint8_t origin_id,
+    struct hg_bulk *hg_bulk_origin, struct hg_bulk *hg_bulk_local,
+    hg_size_t size)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG bulk context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!hg_bulk_origin || !hg_bulk_local) {
+        HG_LOG_ERROR("NULL memory handle passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL
+        && hg_bulk_origin->addr != (hg_core_addr_t) origin_addr) {
+        HG_LOG_ERROR("Mismatched address information passed with origin handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL
+        && hg_bulk_origin->context_id != origin_id) {
+        HG_LOG_ERROR("Mismatched context ID information passed with origin handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!size) {
+        HG_LOG_ERROR("Transfer size must be non-zero");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    if (size > hg_bulk_origin->total_size) {
+        HG_LOG_ERROR("Exceeding size of memory exposed by origin handle");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    if (size > hg_bulk_local->total_size) {
+        HG_LOG_ERROR("Exceeding size of memory exposed by local handle");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    switch (op) {
+        case HG_BULK_PUSH:
+            if (!(hg_bulk_origin->flags & HG_BULK_WRITE_ONLY)
+                || !(hg_bulk_local->flags & HG_BULK_READ_ONLY)) {
+                HG_LOG_ERROR("Invalid permission flags for PUSH operation "
+                    "(origin=%d, local=%d)", hg_bulk_origin->flags,
+                    hg_bulk_local->flags);
+                ret = HG_INVALID_PARAM;
+                goto done;
+            }
+            break;
+        case HG_BULK_PULL:
+            if (!(hg_bulk_origin->flags & HG_BULK_READ_ONLY)
+                || !(hg_bulk_local->flags & HG_BULK_WRITE_ONLY)) {
+                HG_LOG_ERROR("Invalid permission flags for PULL operation "
+                    "(origin=%d, local=%d)", hg_bulk_origin->flags,
+                    hg_bulk_local->flags);
+                ret = HG_INVALID_PARAM;
+                goto done;
+            }
+            break;
+        default:
+            HG_LOG_ERROR("Unknown bulk operation");
+            ret = HG_INVALID_PARAM;
+            goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_pipeline_issue(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_pipeline *pipeline = hg_bulk_op_id->pipeline;
+    hg_bool_t complete;
+
+    hg_thread_spin_lock(&pipeline->lock);
+    if (pipeline->issuing) {
+        /* Thread currently issuing chunks reuses released chunks */
+        hg_thread_spin_unlock(&pipeline->lock);
+        return;
+    }
+    pipeline->issuing = HG_TRUE;
+
+    while (pipeline->ret == HG_SUCCESS
+        && pipeline->next_offset < pipeline->size && pipeline->free_chunks) {
+        struct hg_bulk_chunk *chunk = pipeline->free_chunks;
+        hg_size_t offset = pipeline->next_offset;
+        hg_size_t size = HG_BULK_MIN(pipeline->chunk_size,
+            pipeline->size - offset);
+        hg_op_id_t op_id = HG_OP_ID_NULL;
+        hg_return_t ret;
+
+        pipeline->free_chunks = chunk->next;
+        chunk->op_id = HG_OP_ID_NULL;
+        chunk->offset = offset;
+        chunk->size = size;
+        chunk->in_flight = HG_TRUE;
+        pipeline->next_offset += size;
+        pipeline->pending++;
+        hg_thread_spin_unlock(&pipeline->lock);
+
+        /* Chunk may complete before transfer returns */
+        ret = hg_bulk_transfer(hg_bulk_op_id->context, hg_bulk_pipeline_cb,
+            chunk, hg_bulk_op_id->op, pipeline->origin_addr,
+            pipeline->origin_id, hg_bulk_op_id->hg_bulk_origin,
+            hg_bulk_op_id->origin_offset + offset, hg_bulk_op_id->hg_bulk_local,
+            hg_bulk_op_id->local_offset + offset, size, 0, NULL, &op_id);
+
+        hg_thread_spin_lock(&pipeline->lock);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not transfer chunk");
+            chunk->in_flight = HG_FALSE;
+            chunk->next = pipeline->free_chunks;
+            pipeline->free_chunks = chunk;
+            pipeline->pending--;
+            if (pipeline->ret == HG_SUCCESS)
+                pipeline->ret = ret;
+        } else if (chunk->in_flight) {
+            chunk->op_id = op_id;
+            /* Pipeline was canceled while chunk was issued */
+            if (pipeline->ret == HG_CANCELED)
+                HG_Bulk_cancel(op_id);
+        }
+    }
+
+    pipeline->issuing = HG_FALSE;
+    complete = hg_bulk_pipeline_done(pipeline);
+    hg_thread_spin_unlock(&pipeline->lock);
+
+    if (complete)
+        hg_bulk_complete(hg_bulk_op_id);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_bool_t
+hg_bulk_pipeline_done(struct hg_bulk_pipeline *pipeline)
+{
+    if (pipeline->completed || pipeline->issuing || pipeline->pending
+        || (pipeline->ret == HG_SUCCESS
+            && pipeline->next_offset < pipeline->size))
+        return HG_FALSE;
+    pipeline->completed = HG_TRUE;
+
+    return HG_TRUE;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pipeline_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_bulk_chunk *chunk = (struct hg_bulk_chunk *) callback_info->arg;
+    struct hg_bulk_op_id *hg_bulk_op_id = chunk->hg_bulk_op_id;
+    struct hg_bulk_pipeline *pipeline = hg_bulk_op_id->pipeline;
+    hg_size_t offset = chunk->offset, size = chunk->size;
+    hg_bool_t complete;
+
+    /* Release chunk and refill window before calling chunk callback */
+    hg_thread_spin_lock(&pipeline->lock);
+    chunk->in_flight = HG_FALSE;
+    chunk->next = pipeline->free_chunks;
+    pipeline->free_chunks = chunk;
+    if (callback_info->ret != HG_SUCCESS && pipeline->ret == HG_SUCCESS)
+        pipeline->ret = callback_info->ret;
+    else if (callback_info->ret == HG_SUCCESS)
+        pipeline->completed_size += size;
+    hg_thread_spin_unlock(&pipeline->lock);
+
+    hg_bulk_pipeline_issue(hg_bulk_op_id);
+
+    if (pipeline->chunk_callback) {
+        struct hg_cb_info hg_cb_info = *callback_info;
+
+        hg_cb_info.arg = hg_bulk_op_id->arg;
+        pipeline->chunk_callback(&hg_cb_info, offset, size);
+    }
+
+    /* Pipeline completes once last chunk callback has returned */
+    hg_thread_spin_lock(&pipeline->lock);
+    pipeline->pending--;
+    complete = hg_bulk_pipeline_done(pipeline);
+    hg_thread_spin_unlock(&pipeline->lock);
+
+    if (complete)
+        hg_bulk_complete(hg_bulk_op_id);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pipeline_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_pipeline *pipeline = hg_bulk_op_id->pipeline;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    hg_thread_spin_lock(&pipeline->lock);
+    if (pipeline->completed)
+        goto unlock;
+
+    /* Stop issuing chunks and cancel chunks in flight, chunks for which no
+     * ID was returned yet are canceled once issued */
+    if (pipeline->ret == HG_SUCCESS)
+        pipeline->ret = HG_CANCELED;
+    for (i = 0; i < pipeline->window; i++) {
+        struct hg_bulk_chunk *chunk = &pipeline->chunks[i];
+
+        if (!chunk->in_flight || chunk->op_id == HG_OP_ID_NULL)
+            continue;
+        ret = HG_Bulk_cancel(chunk->op_id);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not cancel chunk");
+            break;
+        }
+    }
+
+unlock:
+    hg_thread_spin_unlock(&pipeline->lock);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_deadline_add(struct hg_bulk_op_id *hg_bulk_op_id, unsigned int timeout)
+{
+    struct hg_bulk_deadlines *deadlines =
+        hg_bulk_op_id->context->bulk_deadlines;
+    hg_time_t now;
+
+    hg_time_get_current(&now);
+    hg_bulk_op_id->deadline = hg_time_add(now,
+        hg_time_from_double((double) timeout / 1000.0));
+
+    hg_thread_mutex_lock(&deadlines->lock);
+    HG_LIST_INSERT_HEAD(&deadlines->ops, hg_bulk_op_id, deadline_entry);
+    hg_bulk_op_id->has_deadline = HG_TRUE;
+    hg_atomic_incr32(&deadlines->count);
+    hg_thread_mutex_unlock(&deadlines->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_deadline_remove(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_deadlines *deadlines =
+        hg_bulk_op_id->context->bulk_deadlines;
+
+    hg_thread_mutex_lock(&deadlines->lock);
+    if (hg_bulk_op_id->has_deadline) {
+        HG_LIST_REMOVE(hg_bulk_op_id, deadline_entry);
+        hg_bulk_op_id->has_deadline = HG_FALSE;
+        hg_atomic_decr32(&deadlines->count);
+    }
+    hg_thread_mutex_unlock(&deadlines->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_multi_complete(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id_parent = hg_bulk_op_id->parent;
+    struct hg_bulk_multi *multi = hg_bulk_op_id_parent->multi;
+    struct hg_bulk_transfer_entry *entry =
+        &multi->entries[hg_bulk_op_id - multi->entry_op_ids];
+
+    if (hg_atomic_get32(&hg_bulk_op_id->canceled))
+        entry->ret = HG_CANCELED;
+    else if (hg_atomic_get32(&hg_bulk_op_id->failed))
+        entry->ret = HG_NA_ERROR;
+    else if (hg_atomic_get32(&hg_bulk_op_id->corrupted))
+        entry->ret = HG_CHECKSUM_ERROR;
+    else
+        entry->ret = HG_SUCCESS;
+    hg_atomic_incr32(&hg_bulk_op_id->completed);
+
+    /* Last entry completes transfer */
+    if (hg_atomic_decr32(&multi->remaining) == 0)
+        hg_bulk_complete(hg_bulk_op_id_parent);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_multi_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_multi *multi = hg_bulk_op_id->multi;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    if (hg_atomic_get32(&hg_bulk_op_id->completed))
+        goto done;
+
+    /* Cancel NA operations of entries that did not complete */
+    for (i = 0; i < multi->count; i++) {
+        struct hg_bulk_op_id *hg_bulk_op_id_entry = &multi->entry_op_ids[i];
+        unsigned int j;
+
+        if (!hg_bulk_op_id_entry->na_op_ids
+            || hg_atomic_get32(&hg_bulk_op_id_entry->completed))
+            continue;
+
+        for (j = 0; j < hg_bulk_op_id_entry->op_count; j++) {
+            na_return_t na_ret = NA_Cancel(hg_bulk_op_id_entry->na_class,
+                hg_bulk_op_na_context(hg_bulk_op_id_entry, j),
+                hg_bulk_op_id_entry->na_op_ids[j]);
+            if (na_ret != NA_SUCCESS) {
+                HG_LOG_ERROR("Could not cancel op id");
+                ret = HG_NA_ERROR;
+                goto done;
+            }
+        }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_multi_free(struct hg_bulk_multi *multi)
+{
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    for (i = 0; i < multi->count; i++) {
+        struct hg_bulk_op_id *hg_bulk_op_id_entry = &multi->entry_op_ids[i];
+        unsigned int j;
+
+        /* Entry was not posted */
+        if (!hg_bulk_op_id_entry->hg_bulk_origin)
+            continue;
+
+        ret = hg_bulk_free(hg_bulk_op_id_entry->hg_bulk_origin);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not free bulk handle");
+            goto done;
+        }
+        ret = hg_bulk_free(hg_bulk_op_id_entry->hg_bulk_local);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not free bulk handle");
+            goto done;
+        }
+        if (hg_bulk_op_id_entry->na_op_ids)
+            for (j = 0; j < hg_bulk_op_id_entry->op_count; j++)
+                NA_Op_destroy(hg_bulk_op_id_entry->na_class,
+                    hg_bulk_op_id_entry->na_op_ids[j]);
+        free(hg_bulk_op_id_entry->na_op_ids);
+        free(hg_bulk_op_id_entry->pieces);
+        free(hg_bulk_op_id_entry->block_remaining);
+    }
+    free(multi->entry_op_ids);
+    free(multi);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_atomic_address(struct hg_bulk *hg_bulk, hg_size_t offset,
+    hg_size_t size, hg_uint32_t *segment_index, hg_size_t *segment_offset)
+{
+    hg_ptr_t address;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (size != sizeof(hg_uint32_t) && size != sizeof(hg_uint64_t)) {
+        HG_LOG_ERROR("Atomic operations only apply to 32 or 64-bit words");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (offset > hg_bulk->total_size || size > hg_bulk->total_size - offset) {
+        HG_LOG_ERROR("Exceeding size of memory exposed by origin handle");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    /* Contiguous handles are addressed as a single segment */
+    *segment_index = 0;
+    *segment_offset = offset;
+    if (offset && !hg_bulk->contiguous)
+        hg_bulk_offset_translate(hg_bulk, offset, segment_index,
+            segment_offset);
+
+    if (*segment_offset + size > hg_bulk_segment_size(hg_bulk,
+        *segment_index)) {
+        HG_LOG_ERROR("Atomic word crosses segments of origin handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    address = hg_bulk_segment_get(hg_bulk, *segment_index).address
+        + (hg_ptr_t) *segment_offset;
+    if (address % size) {
+        HG_LOG_ERROR("Atomic word is not aligned on its size");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_atomic_target_add(struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk_atomic_targets *targets =
+        hg_bulk->hg_class->bulk_atomic_targets;
+
+    /* Words of handles that cannot be both read and written are never
+     * updated on behalf of peers */
+    if (hg_bulk->flags != HG_BULK_READWRITE || !targets)
+        return;
+
+    hg_thread_mutex_lock(&targets->lock);
+    HG_LIST_INSERT_HEAD(&targets->handles, hg_bulk, atomic_entry);
+    hg_bulk->atomic_target = HG_TRUE;
+    hg_thread_mutex_unlock(&targets->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_atomic_target_remove(struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk_atomic_targets *targets =
+        hg_bulk->hg_class->bulk_atomic_targets;
+
+    /* Also waits for emulated operations updating words of handle */
+    hg_thread_mutex_lock(&targets->lock);
+    HG_LIST_REMOVE(hg_bulk, atomic_entry);
+    hg_bulk->atomic_target = HG_FALSE;
+    hg_thread_mutex_unlock(&targets->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_bulk_atomic_target_contains(struct hg_bulk *hg_bulk, hg_ptr_t address,
+    hg_size_t size)
+{
+    hg_ptr_t first = hg_bulk->segments[0].address;
+    hg_uint32_t i;
+
+    /* Contiguous segments are addressed as a single segment */
+    if (hg_bulk->contiguous)
+        return (address >= first && size <= hg_bulk->total_size
+            && address - first <= hg_bulk->total_size - size);
+
+    if (hg_bulk->stride) {
+        hg_size_t offset;
+
+        if (address < first || size > hg_bulk->segments[0].size)
+            return HG_FALSE;
+        offset = (hg_size_t) (address - first);
+
+        return (offset / hg_bulk->stride < hg_bulk->segment_count
+            && offset % hg_bulk->stride <= hg_bulk->segments[0].size - size);
+    }
+
+    for (i = 0; i < hg_bulk->segment_count; i++) {
+        struct hg_bulk_segment *segment = &hg_bulk->segments[i];
+
+        if (address >= segment->address && size <= segment->size
+            && address - segment->address <= segment->size - size)
+            return HG_TRUE;
+    }
+
+    return HG_FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_bulk_atomic_na_cb(const struct na_cb_info *callback_info)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id =
+        (struct hg_bulk_op_id *) callback_info->arg;
+    struct hg_bulk_atomic *atomic = hg_bulk_op_id->atomic;
+
+    if (callback_info->ret == NA_CANCELED) {
+        /* If canceled, mark handle as canceled */
+        hg_atomic_cas32(&hg_bulk_op_id->canceled, 0, 1);
+    } else if (callback_info->ret != NA_SUCCESS) {
+        HG_LOG_ERROR("Error in NA callback: %s",
+            NA_Error_to_string(callback_info->ret));
+        atomic->ret = HG_NA_ERROR;
+    } else
+        atomic->value = (atomic->size == sizeof(hg_uint32_t)) ?
+            atomic->fetched.u32 : atomic->fetched.u64;
+
+    hg_atomic_incr32(&hg_bulk_op_id->op_completed_count);
+    hg_bulk_complete(hg_bulk_op_id);
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_complete(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    hg_context_t *context = hg_bulk_op_id->context;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Mark operation as completed */
+    hg_atomic_incr32(&hg_bulk_op_id->completed);
+
+    /* Deadline no longer applies, has_deadline can only be read under the
+     * lock but the count cannot drop to zero while this op is still listed.
+     * This blocks while hg_bulk_deadlines_check() is canceling the op, which
+     * keeps it from being triggered and freed under the check */
+    if (hg_atomic_get32(&context->bulk_deadlines->count))
+        hg_bulk_deadline_remove(hg_bulk_op_id);
+
+    /* Vectored transfers have no origin handle */
+    if (hg_bulk_op_id->hg_bulk_origin && ((hg_bulk_op_id->op == HG_BULK_PULL
+        && hg_bulk_op_id->hg_bulk_origin->eager_mode)
+        || (hg_bulk_op_id->op == HG_BULK_PUSH
+        && hg_bulk_op_id->hg_bulk_origin->eager_push))) {
+        /* In the case of eager bulk transfer, directly trigger the operation
+         * to avoid potential deadlocks */
+        ret = hg_bulk_trigger_entry(hg_bulk_op_id);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not trigger completion entry");
+            goto done;
+        }
+    } else {
+        struct hg_completion_entry *hg_completion_entry =
+            &hg_bulk_op_id->hg_completion_entry;
+
+        hg_completion_entry->op_type = HG_BULK;
+        hg_completion_entry->op_id.hg_bulk_op_id = hg_bulk_op_id;
+
+        ret = hg_core_completion_add(context->core_context, hg_completion_entry,
+            hg_bulk_op_id->is_self);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not add HG completion entry to completion queue");
+            goto done;
+        }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    /* Result of atomic operation is set before callback is triggered */
+    if (hg_bulk_op_id->atomic && hg_bulk_op_id->atomic->result
+        && hg_bulk_op_id->atomic->ret == HG_SUCCESS
+        && !hg_atomic_get32(&hg_bulk_op_id->canceled))
+        *hg_bulk_op_id->atomic->result = hg_bulk_op_id->atomic->value;
+
+    /* Execute callback */
+    if (hg_bulk_op_id->callback) {
+        struct hg_cb_info hg_cb_info;
+
+        hg_cb_info.arg = hg_bulk_op_id->arg;
+        if (hg_bulk_op_id->pipeline)
+            hg_cb_info.ret = hg_bulk_op_id->pipeline->ret;
+        else if (hg_bulk_op_id->multi) {
+            /* Status of first entry that did not complete */
+            hg_cb_info.ret = HG_SUCCESS;
+            for (i = 0; i < hg_bulk_op_id->multi->count; i++)
+                if (hg_bulk_op_id->multi->entries[i].ret != HG_SUCCESS) {
+                    hg_cb_info.ret = hg_bulk_op_id->multi->entries[i].ret;
+                    break;
+                }
+        } else if (hg_atomic_get32(&hg_bulk_op_id->timed_out)
+            && hg_atomic_get32(&hg_bulk_op_id->canceled))
+            /* Transfers that completed before the cancel landed succeed */
+            hg_cb_info.ret = HG_TIMEOUT;
+        else if (hg_atomic_get32(&hg_bulk_op_id->canceled))
+            hg_cb_info.ret = HG_CANCELED;
+        else if (hg_bulk_op_id->atomic)
+            hg_cb_info.ret = hg_bulk_op_id->atomic->ret;
+        else if (hg_atomic_get32(&hg_bulk_op_id->corrupted))
+            hg_cb_info.ret = HG_CHECKSUM_ERROR;
+        else
+            hg_cb_info.ret = HG_SUCCESS;
+        hg_cb_info.type = HG_CB_BULK;
+        hg_cb_info.info.bulk.op = hg_bulk_op_id->op;
+        hg_cb_info.info.bulk.origin_handle =
+            (hg_bulk_t) hg_bulk_op_id->hg_bulk_origin;
+        hg_cb_info.info.bulk.local_handle =
+            (hg_bulk_t) hg_bulk_op_id->hg_bulk_local;
+
+        hg_bulk_op_id->callback(&hg_cb_info);
+    }
+
+    /* Decrement ref_count */
+    ret = hg_bulk_free(hg_bulk_op_id->hg_bulk_origin);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not free bulk handle");
+        goto done;
+    }
+    ret = hg_bulk_free(hg_bulk_op_id->hg_bulk_local);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not free bulk handle");
+        goto done;
+    }
+
+    /* Free op */
+    for (i = 0; i < hg_bulk_op_id->op_count; i++)
+        NA_Op_destroy(hg_bulk_op_id->na_class, hg_bulk_op_id->na_op_ids[i]);
+    free(hg_bulk_op_id->na_op_ids);
+    free(hg_bulk_op_id->pieces);
+    free(hg_bulk_op_id->block_remaining);
+    if (hg_bulk_op_id->pipeline) {
+        free(hg_bulk_op_id->pipeline->chunks);
+        hg_thread_spin_destroy(&hg_bulk_op_id->pipeline->lock);
+        free(hg_bulk_op_id->pipeline);
+    }
+    if (hg_bulk_op_id->multi) {
+        ret = hg_bulk_multi_free(hg_bulk_op_id->multi);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not release entries");
+            goto done;
+        }
+    }
+    if (hg_bulk_op_id->atomic) {
+        if (hg_bulk_op_id->atomic->handle != HG_HANDLE_NULL)
+            hg_bulk_atomic_release(hg_bulk_op_id->atomic->handle);
+        free(hg_bulk_op_id->atomic);
+    }
+    free(hg_bulk_op_id);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_proc_eager_data(hg_proc_t proc, hg_bulk_t handle)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    hg_uint32_t range_count = 0, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    switch (hg_proc_get_op(proc)) {
+        case HG_ENCODE:
+            /* Pushes must have completed at this point */
+            range_count = hg_bulk->eager_range_count;
+            ret = hg_proc_hg_uint32_t(proc, &range_count);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not encode range count");
+                goto done;
+            }
+            for (i = 0; i < range_count; i++) {
+                struct hg_bulk_range *range = &hg_bulk->eager_ranges[i];
+                void *buf;
+
+                ret = hg_proc_hg_size_t(proc, &range->offset);
+                if (ret != HG_SUCCESS)
+                    goto done;
+                ret = hg_proc_hg_size_t(proc, &range->size);
+                if (ret != HG_SUCCESS)
+                    goto done;
+                buf = hg_proc_save_ptr(proc, range->size);
+                hg_bulk_copy(hg_bulk, range->offset, buf, range->size,
+                    HG_FALSE);
+                ret = hg_proc_restore_ptr(proc, buf, range->size);
+                if (ret != HG_SUCCESS)
+                    goto done;
+            }
+            break;
+        case HG_DECODE:
+            ret = hg_proc_hg_uint32_t(proc, &range_count);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not decode range count");
+                goto done;
+            }
+            for (i = 0; i < range_count; i++) {
+                struct hg_bulk_range range;
+                void *buf;
+
+                ret = hg_proc_hg_size_t(proc, &range.offset);
+                if (ret != HG_SUCCESS)
+                    goto done;
+                ret = hg_proc_hg_size_t(proc, &range.size);
+                if (ret != HG_SUCCESS)
+                    goto done;
+                if (range.offset > hg_bulk->total_size
+                    || range.size > hg_bulk->total_size - range.offset
+                    || range.size > hg_proc_get_size_left(proc)) {
+                    HG_LOG_ERROR("Invalid eager range");
+                    ret = HG_PROTOCOL_ERROR;
+                    goto done;
+                }
+                buf = hg_proc_save_ptr(proc, range.size);
+                hg_bulk_copy(hg_bulk, range.offset, buf, range.size, HG_TRUE);
+                ret = hg_proc_restore_ptr(proc, buf, range.size);
+                if (ret != HG_SUCCESS)
+                    goto done;
+            }
+            break;
+        default:
+            break;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_cache_create(hg_class_t *hg_class)
+{
+    struct hg_bulk_cache *hg_bulk_cache = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_cache = (struct hg_bulk_cache *) malloc(
+        sizeof(struct hg_bulk_cache));
+    if (!hg_bulk_cache) {
+        HG_LOG_ERROR("Could not allocate registration cache");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk_cache, 0, sizeof(struct hg_bulk_cache));
+
+    hg_bulk_cache->table = hg_hash_table_new(hg_bulk_cache_hash,
+        hg_bulk_cache_equal);
+    if (!hg_bulk_cache->table) {
+        HG_LOG_ERROR("Could not create registration cache table");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_thread_spin_init(&hg_bulk_cache->lock);
+
+    hg_class->bulk_cache = hg_bulk_cache;
+
+done:
+    if (ret != HG_SUCCESS)
+        free(hg_bulk_cache);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_cache_destroy(hg_class_t *hg_class)
+{
+    struct hg_bulk_cache *hg_bulk_cache = hg_class->bulk_cache;
+
+    if (!hg_bulk_cache)
+        return;
+
+    hg_bulk_cache_flush(hg_bulk_cache, NULL, 0);
+    hg_hash_table_free(hg_bulk_cache->table);
+    hg_thread_spin_destroy(&hg_bulk_cache->lock);
+    free(hg_bulk_cache);
+    hg_class->bulk_cache = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_pool_create(hg_class_t *hg_class)
+{
+    struct hg_bulk_pool *hg_bulk_pool = NULL;
+    struct hg_bulk_arena_info arena_info;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_pool = (struct hg_bulk_pool *) malloc(sizeof(struct hg_bulk_pool));
+    if (!hg_bulk_pool) {
+        HG_LOG_ERROR("Could not allocate arena pool");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk_pool, 0, sizeof(struct hg_bulk_pool));
+    hg_thread_spin_init(&hg_bulk_pool->lock);
+
+    arena_info.arena_size = HG_BULK_ARENA_SIZE;
+    arena_info.min_class_size = HG_BULK_ARENA_MIN_CLASS_SIZE;
+    arena_info.max_class_size = HG_BULK_ARENA_MAX_CLASS_SIZE;
+    arena_info.huge_pages = HG_FALSE;
+    ret = hg_bulk_pool_set_info(hg_bulk_pool, &arena_info);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not set arena info");
+        goto done;
+    }
+
+    hg_class->bulk_pool = hg_bulk_pool;
+
+done:
+    if (ret != HG_SUCCESS && hg_bulk_pool) {
+        hg_thread_spin_destroy(&hg_bulk_pool->lock);
+        free(hg_bulk_pool);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_pool_destroy(hg_class_t *hg_class)
+{
+    struct hg_bulk_pool *hg_bulk_pool = hg_class->bulk_pool;
+
+    if (!hg_bulk_pool)
+        return;
+
+    /* Handles allocated from arenas must have been freed */
+    while (hg_bulk_pool->arenas) {
+        struct hg_bulk_arena *arena = hg_bulk_pool->arenas;
+
+        hg_bulk_pool->arenas = arena->next;
+        hg_bulk_arena_destroy(arena);
+    }
+    free(hg_bulk_pool->free_arenas);
+    hg_thread_spin_destroy(&hg_bulk_pool->lock);
+    free(hg_bulk_pool);
+    hg_class->bulk_pool = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_deadlines_create(hg_context_t *context)
+{
+    struct hg_bulk_deadlines *deadlines = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    deadlines = (struct hg_bulk_deadlines *) malloc(
+        sizeof(struct hg_bulk_deadlines));
+    if (!deadlines) {
+        HG_LOG_ERROR("Could not allocate deadline list");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    HG_LIST_INIT(&deadlines->ops);
+    hg_thread_mutex_init(&deadlines->lock);
+    hg_atomic_init32(&deadlines->count, 0);
+    context->bulk_deadlines = deadlines;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_deadlines_destroy(hg_context_t *context)
+{
+    struct hg_bulk_deadlines *deadlines = context->bulk_deadlines;
+
+    if (!deadlines)
+        return;
+
+    hg_thread_mutex_destroy(&deadlines->lock);
+    free(deadlines);
+    context->bulk_deadlines = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+unsigned int
+hg_bulk_deadlines_timeout(hg_context_t *context, unsigned int timeout)
+{
+    struct hg_bulk_deadlines *deadlines = context->bulk_deadlines;
+    struct hg_bulk_op_id *hg_bulk_op_id;
+    hg_time_t now;
+
+    if (!timeout || !hg_atomic_get32(&deadlines->count))
+        return timeout;
+
+    hg_time_get_current(&now);
+    hg_thread_mutex_lock(&deadlines->lock);
+    HG_LIST_FOREACH(hg_bulk_op_id, &deadlines->ops, deadline_entry) {
+        double left;
+
+        if (!hg_time_less(now, hg_bulk_op_id->deadline)) {
+            timeout = 0;
+            break;
+        }
+        /* Round up so that deadline has expired once progress returns */
+        left = hg_time_to_double(hg_time_subtract(hg_bulk_op_id->deadline,
+            now)) * 1000.0 + 1.0;
+        if (left < (double) timeout)
+            timeout = (unsigned int) left;
+    }
+    hg_thread_mutex_unlock(&deadlines->lock);
+
+    return timeout;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_deadlines_check(hg_context_t *context)
+{
+    struct hg_bulk_deadlines *deadlines = context->bulk_deadlines;
+    struct hg_bulk_op_id *hg_bulk_op_id, *next;
+    hg_time_t now;
+
+    if (!hg_atomic_get32(&deadlines->count))
+        return;
+
+    hg_time_get_current(&now);
+
+    /* Expired ops are kept listed until canceled: hg_bulk_complete() must
+     * take the lock to unlist them, so they cannot be queued for completion
+     * (and freed) while HG_Bulk_cancel() walks their NA op IDs. NA callbacks
+     * are not triggered from NA_Cancel() so this cannot deadlock */
+    hg_thread_mutex_lock(&deadlines->lock);
+    for (hg_bulk_op_id = HG_LIST_FIRST(&deadlines->ops); hg_bulk_op_id;
+        hg_bulk_op_id = next) {
+        next = HG_LIST_NEXT(hg_bulk_op_id, deadline_entry);
+
+        /* Pieces may still be being posted, completed ops are waiting on the
+         * lock to unlist themselves */
+        if (hg_time_less(now, hg_bulk_op_id->deadline)
+            || !hg_atomic_get32(&hg_bulk_op_id->posted)
+            || hg_atomic_get32(&hg_bulk_op_id->completed))
+            continue;
+
+        hg_atomic_set32(&hg_bulk_op_id->timed_out, 1);
+#ifdef HG_HAS_COLLECT_STATS
+        hg_atomic_incr32(&hg_bulk_timeout_count_g);
+#endif
+        if (HG_Bulk_cancel((hg_op_id_t) hg_bulk_op_id) != HG_SUCCESS)
+            HG_LOG_ERROR("Could not cancel transfer on deadline");
+
+        HG_LIST_REMOVE(hg_bulk_op_id, deadline_entry);
+        hg_bulk_op_id->has_deadline = HG_FALSE;
+        hg_atomic_decr32(&deadlines->count);
+    }
+    hg_thread_mutex_unlock(&deadlines->lock);
+}
+
+#ifdef HG_HAS_COLLECT_STATS
+/*---------------------------------------------------------------------------*/
+hg_uint64_t
+hg_bulk_stat_timeout_count(void)
+{
+    return (hg_uint64_t) hg_atomic_get32(&hg_bulk_timeout_count_g);
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_atomic_exec(void *address, hg_bulk_atomic_op_t op, hg_size_t size,
+    hg_uint64_t operand, hg_uint64_t compare, hg_uint64_t *value)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (op != HG_BULK_ATOMIC_FADD && op != HG_BULK_ATOMIC_CSWAP
+        && op != HG_BULK_ATOMIC_SWAP) {
+        HG_LOG_ERROR("Unknown atomic operation");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (size == sizeof(hg_uint32_t)) {
+        hg_atomic_int32_t *word = (hg_atomic_int32_t *) address;
+        hg_util_int32_t old_value, new_value;
+
+        do {
+            old_value = hg_atomic_get32(word);
+            if (op == HG_BULK_ATOMIC_FADD)
+                new_value = (hg_util_int32_t) ((hg_uint32_t) old_value
+                    + (hg_uint32_t) operand);
+            else if (op == HG_BULK_ATOMIC_CSWAP
+                && (hg_uint32_t) old_value != (hg_uint32_t) compare)
+                break; /* Word is left unchanged */
+            else
+                new_value = (hg_util_int32_t) operand;
+        } while (!hg_atomic_cas32(word, old_value, new_value));
+        *value = (hg_uint32_t) old_value;
+    } else if (size == sizeof(hg_uint64_t)) {
+        hg_atomic_int64_t *word = (hg_atomic_int64_t *) address;
+        hg_util_int64_t old_value, new_value;
+
+        do {
+            old_value = hg_atomic_get64(word);
+            if (op == HG_BULK_ATOMIC_FADD)
+                new_value = (hg_util_int64_t) ((hg_uint64_t) old_value
+                    + operand);
+            else if (op == HG_BULK_ATOMIC_CSWAP
+                && (hg_uint64_t) old_value != compare)
+                break; /* Word is left unchanged */
+            else
+                new_value = (hg_util_int64_t) operand;
+        } while (!hg_atomic_cas64(word, old_value, new_value));
+        *value = (hg_uint64_t) old_value;
+    } else {
+        HG_LOG_ERROR("Atomic operations only apply to 32 or 64-bit words");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_atomic_targets_create(hg_class_t *hg_class)
+{
+    struct hg_bulk_atomic_targets *targets = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    targets = (struct hg_bulk_atomic_targets *) malloc(
+        sizeof(struct hg_bulk_atomic_targets));
+    if (!targets) {
+        HG_LOG_ERROR("Could not allocate atomic target list");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    HG_LIST_INIT(&targets->handles);
+    hg_thread_mutex_init(&targets->lock);
+    hg_class->bulk_atomic_targets = targets;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_atomic_targets_destroy(hg_class_t *hg_class)
+{
+    struct hg_bulk_atomic_targets *targets = hg_class->bulk_atomic_targets;
+
+    if (!targets)
+        return;
+
+    hg_thread_mutex_destroy(&targets->lock);
+    free(targets);
+    hg_class->bulk_atomic_targets = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_atomic_target_exec(hg_class_t *hg_class, hg_uint64_t address,
+    hg_bulk_atomic_op_t op, hg_size_t size, hg_uint64_t operand,
+    hg_uint64_t compare, hg_uint64_t *value)
+{
+    struct hg_bulk_atomic_targets *targets = hg_class->bulk_atomic_targets;
+    struct hg_bulk *hg_bulk;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (size != sizeof(hg_uint32_t) && size != sizeof(hg_uint64_t)) {
+        HG_LOG_ERROR("Atomic operations only apply to 32 or 64-bit words");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (address != (hg_uint64_t) (hg_ptr_t) address || address % size) {
+        HG_LOG_ERROR("Atomic word is not aligned on its size");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    /* Lock is held until word is updated so that handle cannot be freed */
+    hg_thread_mutex_lock(&targets->lock);
+    HG_LIST_FOREACH(hg_bulk, &targets->handles, atomic_entry) {
+        if (hg_bulk_atomic_target_contains(hg_bulk, (hg_ptr_t) address, size))
+            break;
+    }
+    if (hg_bulk)
+        ret = hg_bulk_atomic_exec((void *) (hg_ptr_t) address, op, size,
+            operand, compare, value);
+    hg_thread_mutex_unlock(&targets->lock);
+
+    if (!hg_bulk) {
+        HG_LOG_ERROR("Atomic word does not lie within a read-write handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_atomic_complete(void *arg, hg_return_t ret, hg_uint64_t value)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = (struct hg_bulk_op_id *) arg;
+
+    if (ret == HG_CANCELED)
+        hg_atomic_cas32(&hg_bulk_op_id->canceled, 0, 1);
+    hg_bulk_op_id->atomic->ret = ret;
+    hg_bulk_op_id->atomic->value = value;
+
+    hg_atomic_incr32(&hg_bulk_op_id->op_completed_count);
+    hg_bulk_complete(hg_bulk_op_id);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
+    const hg_size_t *buf_sizes, hg_uint8_t flags, hg_bulk_t *handle)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!count) {
+        HG_LOG_ERROR("Invalid number of segments");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!buf_sizes) {
+        HG_LOG_ERROR("NULL segment pointer");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    switch (flags) {
+        case HG_BULK_READWRITE:
+            break;
+        case HG_BULK_READ_ONLY:
+            break;
+        case HG_BULK_WRITE_ONLY:
+            break;
+        default:
+            HG_LOG_ERROR("Unrecognized handle flag");
+            ret = HG_INVALID_PARAM;
+            goto done;
+    }
+
+    ret = hg_bulk_create(hg_class, count, buf_ptrs, buf_sizes, flags, &hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create bulk handle");
+        goto done;
+    }
+    hg_bulk_atomic_target_add(hg_bulk);
+
+    *handle = (hg_bulk_t) hg_bulk;
+
+done:
+    if (ret != HG_SUCCESS) {
+        hg_bulk_free(hg_bulk);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_create_strided(hg_class_t *hg_class, void *buf_ptr,
+    hg_size_t block_size, hg_size_t stride, hg_uint32_t block_count,
+    hg_uint8_t flags, hg_bulk_t *handle)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!buf_ptr) {
+        HG_LOG_ERROR("NULL buffer pointer");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!block_count || !block_size || stride < block_size) {
+        HG_LOG_ERROR("Invalid block count, block size or stride");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    switch (flags) {
+        case HG_BULK_READWRITE:
+            break;
+        case HG_BULK_READ_ONLY:
+            break;
+        case HG_BULK_WRITE_ONLY:
+            break;
+        default:
+            HG_LOG_ERROR("Unrecognized handle flag");
+            ret = HG_INVALID_PARAM;
+            goto done;
+    }
+
+    ret = hg_bulk_create_strided(hg_class, buf_ptr, block_size, stride,
+        block_count, flags, &hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create strided bulk handle");
+        goto done;
+    }
+    hg_bulk_atomic_target_add(hg_bulk);
+
+    *handle = (hg_bulk_t) hg_bulk;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_create_file(hg_class_t *hg_class, int fd, hg_size_t offset,
+    hg_size_t size, hg_uint8_t flags, hg_bulk_t *handle)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (fd < 0 || !handle) {
+        HG_LOG_ERROR("Invalid file descriptor or NULL pointer passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!size) {
+        HG_LOG_ERROR("Size of file range must be non-zero");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    switch (flags) {
+        case HG_BULK_READWRITE:
             break;
-        case HG_BULK_PULL:
-            /* Eager mode can only be used when data is pulled from origin */
-            na_bulk_op = (is_self || hg_bulk_origin->eager_mode) ?
-                hg_bulk_memcpy_get : hg_bulk_na_get;
-            if (hg_bulk_origin->eager_mode) /* Force scatter gather to false */
-                scatter_gather = HG_FALSE;
+        case HG_BULK_READ_ONLY:
+            break;
+        case HG_BULK_WRITE_ONLY:
             break;
         default:
-            HG_LOG_ERROR("Unknown bulk operation");
+            HG_LOG_ERROR("Unrecognized handle flag");
             ret = HG_INVALID_PARAM;
             goto done;
     }
 
-    /* Allocate op_id */
-    hg_bulk_op_id = (struct hg_bulk_op_id *) malloc(
-        sizeof(struct hg_bulk_op_id));
-    if (!hg_bulk_op_id) {
-        HG_LOG_ERROR("Could not allocate HG Bulk operation ID");
-        ret = HG_NOMEM_ERROR;
+    ret = hg_bulk_create_file(hg_class, fd, offset, size, flags, &hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create file bulk handle");
         goto done;
     }
-    hg_bulk_op_id->context = context;
-#ifdef HG_HAS_SM_ROUTING
-    if (na_sm_class == na_origin_addr_class) {
-        hg_bulk_op_id->na_class = na_sm_class;
-        hg_bulk_op_id->na_context = na_sm_context;
-        use_sm = HG_TRUE;
-    } else {
-#endif
-        hg_bulk_op_id->na_class = na_class;
-        hg_bulk_op_id->na_context = na_context;
-#ifdef HG_HAS_SM_ROUTING
+    hg_bulk_atomic_target_add(hg_bulk);
+
+    *handle = (hg_bulk_t) hg_bulk;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_view(hg_bulk_t handle, hg_size_t offset, hg_size_t size,
+    hg_uint8_t flags, hg_bulk_t *view_handle)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    struct hg_bulk *hg_bulk_new = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_bulk) {
+        HG_LOG_ERROR("NULL memory handle passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
     }
-#endif
-    hg_bulk_op_id->callback = callback;
-    hg_bulk_op_id->arg = arg;
-    hg_atomic_set32(&hg_bulk_op_id->completed, 0);
-    hg_atomic_set32(&hg_bulk_op_id->canceled, 0);
-    hg_bulk_op_id->op_count = 1; /* Default */
-    hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
-    hg_bulk_op_id->op = op;
-    hg_bulk_op_id->hg_bulk_origin = hg_bulk_origin;
-    hg_atomic_incr32(&hg_bulk_origin->ref_count); /* Increment ref count */
-    hg_bulk_op_id->hg_bulk_local = hg_bulk_local;
-    hg_atomic_incr32(&hg_bulk_local->ref_count); /* Increment ref count */
-    hg_bulk_op_id->na_op_ids = NULL;
-    hg_bulk_op_id->is_self = is_self;
 
-    /* Translate bulk_offset */
-    if (origin_offset && !scatter_gather)
-        hg_bulk_offset_translate(hg_bulk_origin, origin_offset,
-            &origin_segment_start_index, &origin_segment_start_offset);
+    if (!view_handle) {
+        HG_LOG_ERROR("NULL pointer passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
 
-    /* Translate block offset */
-    if (local_offset && !scatter_gather)
-        hg_bulk_offset_translate(hg_bulk_local, local_offset,
-            &local_segment_start_index, &local_segment_start_offset);
+    if (hg_bulk->remote) {
+        HG_LOG_ERROR("Cannot create view of handle deserialized from origin");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
 
-    /* Figure out number of NA operations required */
-    if (!scatter_gather) {
-        hg_bulk_transfer_pieces(NULL, NA_ADDR_NULL, origin_id, use_sm, hg_bulk_origin,
-            origin_segment_start_index, origin_segment_start_offset,
-            hg_bulk_local, local_segment_start_index,
-            local_segment_start_offset, size, HG_FALSE, NULL,
-            &hg_bulk_op_id->op_count);
-        if (!hg_bulk_op_id->op_count) {
-            HG_LOG_ERROR("Could not get bulk op_count");
+    if (!size || offset + size > hg_bulk->total_size) {
+        HG_LOG_ERROR("Exceeding size of memory exposed by handle");
+        ret = HG_SIZE_ERROR;
+        goto done;
+    }
+
+    switch (flags) {
+        case HG_BULK_READWRITE:
+            break;
+        case HG_BULK_READ_ONLY:
+            break;
+        case HG_BULK_WRITE_ONLY:
+            break;
+        default:
+            HG_LOG_ERROR("Unrecognized handle flag");
             ret = HG_INVALID_PARAM;
             goto done;
-        }
     }
 
-    /* Allocate memory for NA operation IDs */
-    hg_bulk_op_id->na_op_ids = malloc(sizeof(na_op_id_t) * hg_bulk_op_id->op_count);
-    if (!hg_bulk_op_id->na_op_ids) {
-        HG_LOG_ERROR("Could not allocate memory for op_ids");
-        ret = HG_NOMEM_ERROR;
+    if (flags & ~hg_bulk->flags) {
+        HG_LOG_ERROR("View cannot extend permissions of handle");
+        ret = HG_INVALID_PARAM;
         goto done;
     }
-    for (i = 0; i < hg_bulk_op_id->op_count; i++)
-        hg_bulk_op_id->na_op_ids[i] = NA_Op_create(hg_bulk_op_id->na_class);
 
-    /* Do actual transfer */
-    ret = hg_bulk_transfer_pieces(na_bulk_op, na_origin_addr, origin_id, use_sm,
-        hg_bulk_origin, origin_segment_start_index, origin_segment_start_offset,
-        hg_bulk_local, local_segment_start_index, local_segment_start_offset,
-        size, scatter_gather, hg_bulk_op_id, NULL);
+    ret = hg_bulk_view(hg_bulk, offset, size, flags, &hg_bulk_new);
     if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not transfer data pieces");
+        HG_LOG_ERROR("Could not create view of bulk handle");
         goto done;
     }
+    hg_bulk_atomic_target_add(hg_bulk_new);
 
-    /* Assign op_id */
-    if (op_id && op_id != HG_OP_ID_IGNORE)
-        *op_id = (hg_op_id_t) hg_bulk_op_id;
+    *view_handle = (hg_bulk_t) hg_bulk_new;
 
 done:
-    if (ret != HG_SUCCESS && hg_bulk_op_id) {
-        free(hg_bulk_op_id->na_op_ids);
-        free(hg_bulk_op_id);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_free(hg_bulk_t handle)
+{
+    hg_return_t ret = HG_SUCCESS;
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+
+    if (!hg_bulk) goto done;
+
+    ret = hg_bulk_free(hg_bulk);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_ref_incr(hg_bulk_t handle)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_bulk) {
+        HG_LOG_ERROR("NULL memory handle passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
     }
+
+    /* Increment ref count */
+    hg_atomic_incr32(&hg_bulk->ref_count);
+
+done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_complete(struct hg_bulk_op_id *hg_bulk_op_id)
+hg_return_t
+HG_Bulk_cache_set_size(hg_class_t *hg_class, unsigned int size)
 {
-    hg_context_t *context = hg_bulk_op_id->context;
     hg_return_t ret = HG_SUCCESS;
 
-    /* Mark operation as completed */
-    hg_atomic_incr32(&hg_bulk_op_id->completed);
+    if (!hg_class || !hg_class->bulk_cache) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
 
-    if (hg_bulk_op_id->hg_bulk_origin->eager_mode) {
-        /* In the case of eager bulk transfer, directly trigger the operation
-         * to avoid potential deadlocks */
-        ret = hg_bulk_trigger_entry(hg_bulk_op_id);
-        if (ret != HG_SUCCESS) {
-            HG_LOG_ERROR("Could not trigger completion entry");
-            goto done;
-        }
-    } else {
-        struct hg_completion_entry *hg_completion_entry =
-            &hg_bulk_op_id->hg_completion_entry;
+    hg_thread_spin_lock(&hg_class->bulk_cache->lock);
+    hg_class->bulk_cache->size = size;
+    hg_thread_spin_unlock(&hg_class->bulk_cache->lock);
 
-        hg_completion_entry->op_type = HG_BULK;
-        hg_completion_entry->op_id.hg_bulk_op_id = hg_bulk_op_id;
+    /* Release cached handles */
+    hg_bulk_cache_flush(hg_class->bulk_cache, NULL, 0);
 
-        ret = hg_core_completion_add(context->core_context, hg_completion_entry,
-            hg_bulk_op_id->is_self);
-        if (ret != HG_SUCCESS) {
-            HG_LOG_ERROR("Could not add HG completion entry to completion queue");
-            goto done;
-        }
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_cache_invalidate(hg_class_t *hg_class, const void *buf, hg_size_t size)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class || !hg_class->bulk_cache) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (!buf) {
+        HG_LOG_ERROR("NULL buffer");
+        ret = HG_INVALID_PARAM;
+        goto done;
     }
 
+    hg_bulk_cache_flush(hg_class->bulk_cache, buf, size);
+
 done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id)
+HG_Bulk_set_arena_info(hg_class_t *hg_class,
+    const struct hg_bulk_arena_info *arena_info)
 {
     hg_return_t ret = HG_SUCCESS;
-    unsigned int i;
 
-    /* Execute callback */
-    if (hg_bulk_op_id->callback) {
-        struct hg_cb_info hg_cb_info;
+    if (!hg_class || !hg_class->bulk_pool) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
 
-        hg_cb_info.arg = hg_bulk_op_id->arg;
-        hg_cb_info.ret =
-            hg_atomic_get32(&hg_bulk_op_id->canceled) ? HG_CANCELED :
-                HG_SUCCESS;
-        hg_cb_info.type = HG_CB_BULK;
-        hg_cb_info.info.bulk.op = hg_bulk_op_id->op;
-        hg_cb_info.info.bulk.origin_handle =
-            (hg_bulk_t) hg_bulk_op_id->hg_bulk_origin;
-        hg_cb_info.info.bulk.local_handle =
-            (hg_bulk_t) hg_bulk_op_id->hg_bulk_local;
+    if (!arena_info) {
+        HG_LOG_ERROR("NULL arena info");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
 
-        hg_bulk_op_id->callback(&hg_cb_info);
+    /* Size classes are powers of two */
+    if (!arena_info->min_class_size
+        || (arena_info->min_class_size & (arena_info->min_class_size - 1))
+        || arena_info->max_class_size < arena_info->min_class_size
+        || (arena_info->max_class_size & (arena_info->max_class_size - 1))) {
+        HG_LOG_ERROR("Size classes must be powers of two");
+        ret = HG_INVALID_PARAM;
+        goto done;
     }
 
-    /* Decrement ref_count */
-    ret = hg_bulk_free(hg_bulk_op_id->hg_bulk_origin);
-    if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not free bulk handle");
+    if (arena_info->arena_size < arena_info->max_class_size) {
+        HG_LOG_ERROR("Arena size must be at least the largest class size");
+        ret = HG_INVALID_PARAM;
         goto done;
     }
-    ret = hg_bulk_free(hg_bulk_op_id->hg_bulk_local);
+
+    ret = hg_bulk_pool_set_info(hg_class->bulk_pool, arena_info);
     if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not free bulk handle");
+        HG_LOG_ERROR("Could not set arena info");
         goto done;
     }
 
-    /* Free op */
-    for (i = 0; i < hg_bulk_op_id->op_count; i++)
-        NA_Op_destroy(hg_bulk_op_id->na_class, hg_bulk_op_id->na_op_ids[i]);
-    free(hg_bulk_op_id->na_op_ids);
-    free(hg_bulk_op_id);
-
 done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
-    const hg_size_t *buf_sizes, hg_uint8_t flags, hg_bulk_t *handle)
+HG_Bulk_alloc(hg_class_t *hg_class, hg_size_t size, hg_uint8_t flags,
+    void **buf_ptr, hg_bulk_t *handle)
 {
     struct hg_bulk *hg_bulk = NULL;
+    struct hg_bulk_arena *arena = NULL;
+    void *block = NULL;
     hg_return_t ret = HG_SUCCESS;
 
-    if (!hg_class) {
+    if (!hg_class || !hg_class->bulk_pool) {
         HG_LOG_ERROR("NULL HG class");
         ret = HG_INVALID_PARAM;
         goto done;
     }
 
-    if (!count) {
-        HG_LOG_ERROR("Invalid number of segments");
+    if (!size) {
+        HG_LOG_ERROR("Invalid size");
         ret = HG_INVALID_PARAM;
         goto done;
     }
 
-    if (!buf_sizes) {
-        HG_LOG_ERROR("NULL segment pointer");
+    if (!buf_ptr || !handle) {
+        HG_LOG_ERROR("NULL pointer passed");
         ret = HG_INVALID_PARAM;
         goto done;
     }
@@ -1104,12 +4968,53 @@ HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
             goto done;
     }
 
-    ret = hg_bulk_create(hg_class, count, buf_ptrs, buf_sizes, flags, &hg_bulk);
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    if (!hg_bulk) {
+        HG_LOG_ERROR("Could not allocate handle");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->hg_class = hg_class;
+    hg_bulk->na_class = HG_Core_class_get_na(hg_class->core_class);
+#ifdef HG_HAS_SM_ROUTING
+    hg_bulk->na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
+#endif
+    hg_bulk->total_size = size;
+    hg_bulk->segment_count = 1;
+    hg_bulk->na_mem_handle_count = 1;
+    hg_bulk->flags = flags;
+    hg_atomic_set32(&hg_bulk->ref_count, 1);
+
+    hg_bulk->segments = (struct hg_bulk_segment *) malloc(
+        sizeof(struct hg_bulk_segment));
+    if (!hg_bulk->segments) {
+        HG_LOG_ERROR("Could not allocate segment array");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+
+    ret = hg_bulk_pool_get(hg_class, size, &arena, &block);
     if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not create bulk handle");
+        HG_LOG_ERROR("Could not allocate memory from arena");
         goto done;
     }
+    hg_bulk->segments[0].address = (hg_ptr_t) block;
+    hg_bulk->segments[0].size = size;
+    hg_bulk->arena = arena;
+
+    /* Share NA memory handles of arena, which are already published */
+    hg_atomic_incr32(&arena->hg_bulk->ref_count);
+    hg_bulk->reg_bulk = arena->hg_bulk;
+    hg_bulk->na_mem_handles = arena->hg_bulk->na_mem_handles;
+#ifdef HG_HAS_SM_ROUTING
+    hg_bulk->na_sm_mem_handles = arena->hg_bulk->na_sm_mem_handles;
+#endif
+    hg_bulk->segment_published = HG_TRUE;
+    hg_bulk->na_mem_offset = (hg_size_t) ((char *) block - (char *) arena->base);
+    hg_bulk_atomic_target_add(hg_bulk);
 
+    *buf_ptr = block;
     *handle = (hg_bulk_t) hg_bulk;
 
 done:
@@ -1121,22 +5026,7 @@ done:
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_free(hg_bulk_t handle)
-{
-    hg_return_t ret = HG_SUCCESS;
-    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
-
-    if (!hg_bulk) goto done;
-
-    ret = hg_bulk_free(hg_bulk);
-
-done:
-    return ret;
-}
-
-/*---------------------------------------------------------------------------*/
-hg_return_t
-HG_Bulk_ref_incr(hg_bulk_t handle)
+HG_Bulk_free_mem(hg_bulk_t handle)
 {
     struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
     hg_return_t ret = HG_SUCCESS;
@@ -1147,8 +5037,13 @@ HG_Bulk_ref_incr(hg_bulk_t handle)
         goto done;
     }
 
-    /* Increment ref count */
-    hg_atomic_incr32(&hg_bulk->ref_count);
+    if (!hg_bulk->arena) {
+        HG_LOG_ERROR("Handle was not allocated with HG_Bulk_alloc()");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = hg_bulk_free(hg_bulk);
 
 done:
     return ret;
@@ -1294,6 +5189,69 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_set_checksum(hg_bulk_t handle, hg_size_t block_size)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_bulk) {
+        HG_LOG_ERROR("NULL bulk handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (block_size > HG_BULK_CHECKSUM_BLOCK_SIZE_MAX) {
+        HG_LOG_ERROR("Checksum block size exceeds %d",
+            HG_BULK_CHECKSUM_BLOCK_SIZE_MAX);
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (hg_bulk->checksum_remote) {
+        HG_LOG_ERROR("Cannot set checksum on deserialized handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    /* Checksums are computed when handle gets serialized, previously cached
+     * serialization does not carry them */
+    hg_bulk->checksum_block_size = (hg_uint32_t) block_size;
+    free(hg_bulk->checksums);
+    hg_bulk->checksums = NULL;
+    hg_bulk->serialize_ptr = NULL;
+    hg_bulk->serialize_size = 0;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_uint8_t
+HG_Bulk_get_eager_flags(hg_bulk_t handle, hg_uint8_t request_eager)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    hg_uint8_t ret = 0;
+
+    if (!hg_bulk) {
+        HG_LOG_ERROR("NULL bulk handle");
+        goto done;
+    }
+
+    if (hg_bulk->remote) {
+        if (hg_bulk->eager_mode)
+            ret |= HG_BULK_EAGER_PULL;
+        if (hg_bulk->eager_push)
+            ret |= HG_BULK_EAGER_PUSH;
+        ret &= request_eager;
+    } else
+        ret = hg_bulk_eager_flags(hg_bulk, request_eager);
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_size_t
 HG_Bulk_get_serialize_size(hg_bulk_t handle, hg_bool_t request_eager)
@@ -1322,7 +5280,8 @@ HG_Bulk_get_serialize_size(hg_bulk_t handle, hg_bool_t request_eager)
 
     /* Segments */
     ret += sizeof(hg_bulk->total_size) + sizeof(hg_bulk->segment_count)
-        + hg_bulk->segment_count * sizeof(*hg_bulk->segments);
+        + hg_bulk_segments_get_serialize_size(hg_bulk)
+        + sizeof(hg_bulk->na_mem_offset);
 
     /* NA mem handles */
     ret += sizeof(hg_bulk->na_mem_handle_count);
@@ -1346,10 +5305,14 @@ HG_Bulk_get_serialize_size(hg_bulk_t handle, hg_bool_t request_eager)
     }
 
     /* Eager mode */
-    ret += sizeof(hg_bulk->eager_mode);
-    if (request_eager && (hg_bulk->flags == HG_BULK_READ_ONLY))
+    ret += sizeof(hg_uint8_t);
+    if (hg_bulk_eager_flags(hg_bulk, request_eager) & HG_BULK_EAGER_PULL)
         ret += hg_bulk->total_size;
 
+    /* Checksums */
+    ret += sizeof(hg_bulk->checksum_block_size)
+        + hg_bulk_checksum_count(hg_bulk) * sizeof(*hg_bulk->checksums);
+
 done:
     return ret;
 }
@@ -1365,7 +5328,9 @@ HG_Bulk_serialize(void *buf, hg_size_t buf_size, hg_bool_t request_eager,
     hg_return_t ret = HG_SUCCESS;
     na_return_t na_ret;
     hg_bool_t bind_addr;
-    hg_bool_t eager_mode;
+    hg_uint8_t eager_flags;
+    hg_uint32_t checksum_block_size, checksum_count;
+    hg_ptr_t prev_end = 0;
     na_class_t *na_class;
 #ifdef HG_HAS_SM_ROUTING
     na_class_t *na_sm_class;
@@ -1385,29 +5350,10 @@ HG_Bulk_serialize(void *buf, hg_size_t buf_size, hg_bool_t request_eager,
 #endif
 
     /* Publish handle at this point if not published yet */
-    if (!hg_bulk->segment_published) {
-        for (i = 0; i < hg_bulk->na_mem_handle_count; i++) {
-            if (!hg_bulk->na_mem_handles[i])
-                continue;
-
-            na_ret = NA_Mem_publish(na_class, hg_bulk->na_mem_handles[i]);
-            if (na_ret != NA_SUCCESS) {
-                HG_LOG_ERROR("NA_Mem_publish failed");
-                ret = HG_NA_ERROR;
-                goto done;
-            }
-#ifdef HG_HAS_SM_ROUTING
-            if (hg_bulk->na_sm_mem_handles && hg_bulk->na_sm_mem_handles[i]) {
-                na_ret = NA_Mem_publish(na_sm_class, hg_bulk->na_sm_mem_handles[i]);
-                if (na_ret != NA_SUCCESS) {
-                    HG_LOG_ERROR("NA_Mem_publish for SM failed");
-                    ret = HG_NA_ERROR;
-                    goto done;
-                }
-            }
-#endif
-        }
-        hg_bulk->segment_published = HG_TRUE;
+    ret = hg_bulk_publish(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not publish handle");
+        goto done;
     }
 
     /* Add the permission flags */
@@ -1473,14 +5419,38 @@ HG_Bulk_serialize(void *buf, hg_size_t buf_size, hg_bool_t request_eager,
         goto done;
     }
 
-    /* Add the array of segments */
-    for (i = 0; i < hg_bulk->segment_count; i++) {
-        ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left,
-            &hg_bulk->segments[i], sizeof(hg_bulk->segments[i]));
+    /* Add the stride, strided handles only encode first block */
+    ret = hg_bulk_serialize_varint(&buf_ptr, &buf_size_left, hg_bulk->stride);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not encode stride");
+        goto done;
+    }
+
+    /* Add the array of segments, addresses are encoded relative to the end
+     * of the previous segment so that adjacent segments take a few bytes */
+    for (i = 0; i < (hg_bulk->stride ? 1 : hg_bulk->segment_count); i++) {
+        ret = hg_bulk_serialize_varint(&buf_ptr, &buf_size_left,
+            hg_bulk_segment_delta(hg_bulk->segments[i].address, prev_end));
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not encode segment address");
+            goto done;
+        }
+        ret = hg_bulk_serialize_varint(&buf_ptr, &buf_size_left,
+            hg_bulk->segments[i].size);
         if (ret != HG_SUCCESS) {
-            HG_LOG_ERROR("Could not encode segment");
+            HG_LOG_ERROR("Could not encode segment size");
             goto done;
         }
+        prev_end = hg_bulk->segments[i].address
+            + (hg_ptr_t) hg_bulk->segments[i].size;
+    }
+
+    /* Add the offset of segments within NA memory handles */
+    ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left,
+        &hg_bulk->na_mem_offset, sizeof(hg_bulk->na_mem_offset));
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not encode NA memory offset");
+        goto done;
     }
 
     /* Add the number of NA memory handles */
@@ -1545,24 +5515,25 @@ HG_Bulk_serialize(void *buf, hg_size_t buf_size, hg_bool_t request_eager,
 #endif
     }
 
-    /* Eager mode is used only when data is set to HG_BULK_READ_ONLY */
-    eager_mode = (request_eager && (hg_bulk->flags == HG_BULK_READ_ONLY));
-    ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left, &eager_mode,
-        sizeof(eager_mode));
+    /* Eager flags depend on permission flags and size */
+    eager_flags = hg_bulk_eager_flags(hg_bulk, request_eager);
+    ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left, &eager_flags,
+        sizeof(eager_flags));
     if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not encode eager_mode bool");
+        HG_LOG_ERROR("Could not encode eager flags");
         goto done;
     }
 
     /* Add the serialized data */
-    if (eager_mode) {
+    if (eager_flags & HG_BULK_EAGER_PULL) {
         for (i = 0; i < hg_bulk->segment_count; i++) {
-            if (!hg_bulk->segments[i].size)
+            struct hg_bulk_segment segment = hg_bulk_segment_get(hg_bulk, i);
+
+            if (!segment.size)
                 continue;
 
             ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left,
-                (const void *) hg_bulk->segments[i].address,
-                hg_bulk->segments[i].size);
+                (const void *) segment.address, segment.size);
             if (ret != HG_SUCCESS) {
                 HG_LOG_ERROR("Could not encode segment data");
                 goto done;
@@ -1570,6 +5541,32 @@ HG_Bulk_serialize(void *buf, hg_size_t buf_size, hg_bool_t request_eager,
         }
     }
 
+    /* Add the checksums, data may have changed since last serialization so
+     * checksums of local data are always recomputed */
+    checksum_count = hg_bulk_checksum_count(hg_bulk);
+    if (checksum_count && !hg_bulk->checksum_remote) {
+        ret = hg_bulk_checksum_update(hg_bulk);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not compute checksums");
+            goto done;
+        }
+    }
+    checksum_block_size = (checksum_count) ? hg_bulk->checksum_block_size : 0;
+    ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left,
+        &checksum_block_size, sizeof(checksum_block_size));
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not encode checksum block size");
+        goto done;
+    }
+    if (checksum_count) {
+        ret = hg_bulk_serialize_memcpy(&buf_ptr, &buf_size_left,
+            hg_bulk->checksums, checksum_count * sizeof(*hg_bulk->checksums));
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not encode checksums");
+            goto done;
+        }
+    }
+
     if (buf_size_left)
         HG_LOG_WARNING("Buf size left greater than 0, %zd", buf_size_left);
 
@@ -1588,6 +5585,11 @@ HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
     hg_return_t ret = HG_SUCCESS;
     na_return_t na_ret;
     hg_bool_t bind_addr;
+    hg_uint8_t eager_flags;
+    hg_uint32_t checksum_count;
+    hg_ptr_t prev_end = 0;
+    hg_uint64_t stride;
+    hg_uint32_t segment_array_count;
     hg_uint32_t i;
 
     if (!handle) {
@@ -1609,6 +5611,7 @@ HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
     hg_bulk->na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
 #endif
     hg_atomic_set32(&hg_bulk->ref_count, 1);
+    hg_bulk->remote = HG_TRUE;
 
     /* Get the permission flags */
     ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
@@ -1681,21 +5684,61 @@ HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
         goto done;
     }
 
+    /* Get the stride */
+    ret = hg_bulk_deserialize_varint(&buf_ptr, &buf_size_left, &stride);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not decode stride");
+        goto done;
+    }
+    hg_bulk->stride = (hg_size_t) stride;
+    segment_array_count = hg_bulk->stride ? 1 : hg_bulk->segment_count;
+
     /* Get the array of segments */
     hg_bulk->segments = (struct hg_bulk_segment *) malloc(
-            hg_bulk->segment_count * sizeof(struct hg_bulk_segment));
+            segment_array_count * sizeof(struct hg_bulk_segment));
     if (!hg_bulk->segments) {
         HG_LOG_ERROR("Could not allocate segment array");
         ret = HG_NOMEM_ERROR;
         goto done;
     }
-    for (i = 0; i < hg_bulk->segment_count; i++) {
-        ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
-            &hg_bulk->segments[i], sizeof(hg_bulk->segments[i]));
+    for (i = 0; i < segment_array_count; i++) {
+        hg_uint64_t delta, size;
+
+        ret = hg_bulk_deserialize_varint(&buf_ptr, &buf_size_left, &delta);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not decode segment address");
+            goto done;
+        }
+        ret = hg_bulk_deserialize_varint(&buf_ptr, &buf_size_left, &size);
         if (ret != HG_SUCCESS) {
-            HG_LOG_ERROR("Could not decode segment");
+            HG_LOG_ERROR("Could not decode segment size");
             goto done;
         }
+        delta = (delta >> 1) ^ ((delta & 1) ? ~(hg_uint64_t) 0 : 0);
+        hg_bulk->segments[i].address = prev_end + (hg_ptr_t) delta;
+        hg_bulk->segments[i].size = (hg_size_t) size;
+        prev_end = hg_bulk->segments[i].address + (hg_ptr_t) size;
+    }
+    if (hg_bulk->stride && (!hg_bulk->segments[0].size
+        || hg_bulk->total_size != hg_bulk->segment_count
+            * hg_bulk->segments[0].size)) {
+        HG_LOG_ERROR("Invalid strided segments");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+    ret = hg_bulk_index_create(hg_bulk);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not create segment index");
+        goto done;
+    }
+
+    /* Get the offset of segments within NA memory handles */
+    ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
+        &hg_bulk->na_mem_offset, sizeof(hg_bulk->na_mem_offset));
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not decode NA memory offset");
+        goto done;
     }
 
     /* Get the number of NA memory handles */
@@ -1778,15 +5821,26 @@ HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
 
     /* Get whether data is serialized or not */
     ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
-        &hg_bulk->eager_mode, sizeof(hg_bulk->eager_mode));
+        &eager_flags, sizeof(eager_flags));
     if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not decode eager_mode bool");
+        HG_LOG_ERROR("Could not decode eager flags");
         goto done;
     }
-
-    /* Get the serialized data */
-    if (hg_bulk->eager_mode) {
+    hg_bulk->eager_mode = (hg_bool_t) ((eager_flags & HG_BULK_EAGER_PULL) != 0);
+    hg_bulk->eager_push = (hg_bool_t) ((eager_flags & HG_BULK_EAGER_PUSH) != 0);
+    if (hg_bulk->eager_push)
+        hg_thread_spin_init(&hg_bulk->eager_lock);
+
+    /* Get the serialized data, data pushed eagerly is copied to local
+     * segments that mirror origin's segments */
+    if (hg_bulk->eager_mode || hg_bulk->eager_push) {
         hg_bulk->segment_alloc = HG_TRUE;
+        /* Strided blocks are mirrored by adjacent blocks */
+        if (hg_bulk->stride) {
+            hg_bulk->segments[0].size = hg_bulk->total_size;
+            hg_bulk->stride = 0;
+            hg_bulk->segment_count = 1;
+        }
         for (i = 0; i < hg_bulk->segment_count; i++) {
             if (!hg_bulk->segments[i].size)
                 continue;
@@ -1799,6 +5853,8 @@ HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
                 ret = HG_NOMEM_ERROR;
                 goto done;
             }
+            if (!hg_bulk->eager_mode)
+                continue;
             ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
                 (void *) hg_bulk->segments[i].address,
                 hg_bulk->segments[i].size);
@@ -1809,6 +5865,37 @@ HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
         }
     }
 
+    /* Adjacent segments sharing a single NA memory handle can be transferred
+     * as one region */
+    hg_bulk->contiguous = (hg_bool_t) (hg_bulk->na_mem_handle_count == 1
+        && hg_bulk->segment_count > 1 && !hg_bulk->segment_alloc
+        && hg_bulk_segments_adjacent(hg_bulk));
+
+    /* Get the checksums */
+    ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
+        &hg_bulk->checksum_block_size, sizeof(hg_bulk->checksum_block_size));
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not decode checksum block size");
+        goto done;
+    }
+    checksum_count = hg_bulk_checksum_count(hg_bulk);
+    if (checksum_count) {
+        hg_bulk->checksums = (hg_uint32_t *) malloc(
+            checksum_count * sizeof(*hg_bulk->checksums));
+        if (!hg_bulk->checksums) {
+            HG_LOG_ERROR("Could not allocate checksum array");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        ret = hg_bulk_deserialize_memcpy(&buf_ptr, &buf_size_left,
+            hg_bulk->checksums, checksum_count * sizeof(*hg_bulk->checksums));
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not decode checksums");
+            goto done;
+        }
+        hg_bulk->checksum_remote = HG_TRUE;
+    }
+
     if (buf_size_left)
         HG_LOG_WARNING("Buf size left greater than 0, %zd", buf_size_left);
 
@@ -1832,6 +5919,10 @@ HG_Bulk_get_serialize_cached_ptr(hg_bulk_t handle)
         return NULL;
     }
 
+    /* Cached checksums may no longer match the data */
+    if (hg_bulk->checksum_block_size)
+        return NULL;
+
     return hg_bulk->serialize_ptr;
 }
 
@@ -1841,102 +5932,393 @@ HG_Bulk_get_serialize_cached_size(hg_bulk_t handle)
 {
     struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
 
-    if (!hg_bulk) {
-        HG_LOG_ERROR("NULL bulk handle");
-        return 0;
+    if (!hg_bulk) {
+        HG_LOG_ERROR("NULL bulk handle");
+        return 0;
+    }
+
+    return hg_bulk->serialize_size;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_set_serialize_cached_ptr(hg_bulk_t handle, void *buf,
+    na_size_t buf_size)
+{
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+
+    if (!hg_bulk) {
+        HG_LOG_ERROR("NULL bulk handle");
+        return HG_INVALID_PARAM;
+    }
+
+    hg_bulk->serialize_ptr = buf;
+    hg_bulk->serialize_size = buf_size;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_addr_t origin_addr, hg_bulk_t origin_handle,
+    hg_size_t origin_offset, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_size_t size, hg_op_id_t *op_id)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_bulk_origin) {
+        HG_LOG_ERROR("NULL origin handle passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL
+        && hg_bulk_origin->addr != (hg_core_addr_t) origin_addr) {
+        HG_LOG_ERROR("Mismatched address information passed with origin handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = HG_Bulk_transfer_id(context, callback, arg, op, origin_addr, 0,
+        origin_handle, origin_offset, local_handle, local_offset, size, op_id);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_bind_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_bulk_t origin_handle, hg_size_t origin_offset,
+    hg_bulk_t local_handle, hg_size_t local_offset, hg_size_t size,
+    hg_op_id_t *op_id)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_bulk_origin) {
+        HG_LOG_ERROR("NULL origin handle passed");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (hg_bulk_origin->addr == HG_CORE_ADDR_NULL) {
+        HG_LOG_ERROR("No address information found on bulk handle, "
+            "HG_Bulk_bind() must be called on bulk handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = HG_Bulk_transfer_id(context, callback, arg, op,
+        (hg_addr_t) hg_bulk_origin->addr, hg_bulk_origin->context_id,
+        origin_handle, origin_offset, local_handle, local_offset, size, op_id);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_addr_t origin_addr, hg_uint8_t origin_id,
+    hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = hg_bulk_transfer_check(context, op, (struct hg_addr *) origin_addr,
+        origin_id, hg_bulk_origin, hg_bulk_local, size);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    ret = hg_bulk_transfer(context, callback, arg, op, origin_addr, origin_id,
+        hg_bulk_origin, origin_offset, hg_bulk_local, local_offset, size,
+        0, NULL, op_id);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not transfer data");
+        goto done;
     }
 
-    return hg_bulk->serialize_size;
+done:
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_set_serialize_cached_ptr(hg_bulk_t handle, void *buf,
-    na_size_t buf_size)
+HG_Bulk_transfer_timeout(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_addr_t origin_addr, hg_uint8_t origin_id,
+    hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
+    hg_size_t local_offset, hg_size_t size, unsigned int timeout,
+    hg_op_id_t *op_id)
 {
-    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    hg_return_t ret = HG_SUCCESS;
 
-    if (!hg_bulk) {
-        HG_LOG_ERROR("NULL bulk handle");
-        return HG_INVALID_PARAM;
-    }
+    ret = hg_bulk_transfer_check(context, op, (struct hg_addr *) origin_addr,
+        origin_id, hg_bulk_origin, hg_bulk_local, size);
+    if (ret != HG_SUCCESS)
+        goto done;
 
-    hg_bulk->serialize_ptr = buf;
-    hg_bulk->serialize_size = buf_size;
+    ret = hg_bulk_transfer(context, callback, arg, op, origin_addr, origin_id,
+        hg_bulk_origin, origin_offset, hg_bulk_local, local_offset, size,
+        timeout, NULL, op_id);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not transfer data");
+        goto done;
+    }
 
-    return HG_SUCCESS;
+done:
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
-    hg_bulk_op_t op, hg_addr_t origin_addr, hg_bulk_t origin_handle,
+HG_Bulk_transfer_pipelined(hg_context_t *context, hg_cb_t callback,
+    hg_bulk_chunk_cb_t chunk_callback, void *arg, hg_bulk_op_t op,
+    hg_addr_t origin_addr, hg_uint8_t origin_id, hg_bulk_t origin_handle,
     hg_size_t origin_offset, hg_bulk_t local_handle, hg_size_t local_offset,
-    hg_size_t size, hg_op_id_t *op_id)
+    hg_size_t size, hg_size_t chunk_size, unsigned int window,
+    hg_op_id_t *op_id)
 {
     struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_pipeline *pipeline = NULL;
     hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
 
-    if (!hg_bulk_origin) {
-        HG_LOG_ERROR("NULL origin handle passed");
-        ret = HG_INVALID_PARAM;
+    ret = hg_bulk_transfer_check(context, op, (struct hg_addr *) origin_addr,
+        origin_id, hg_bulk_origin, hg_bulk_local, size);
+    if (ret != HG_SUCCESS)
         goto done;
-    }
 
-    if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL
-        && hg_bulk_origin->addr != (hg_core_addr_t) origin_addr) {
-        HG_LOG_ERROR("Mismatched address information passed with origin handle");
-        ret = HG_INVALID_PARAM;
+    if (!chunk_size)
+        chunk_size = HG_BULK_PIPELINE_CHUNK_SIZE;
+    if (!window)
+        window = HG_BULK_PIPELINE_WINDOW;
+    /* No more chunks than needed */
+    if ((size + chunk_size - 1) / chunk_size < window)
+        window = (unsigned int) ((size + chunk_size - 1) / chunk_size);
+
+    /* Operation ID of pipeline, no NA operation is attached to it */
+    hg_bulk_op_id = (struct hg_bulk_op_id *) malloc(
+        sizeof(struct hg_bulk_op_id));
+    if (!hg_bulk_op_id) {
+        HG_LOG_ERROR("Could not allocate HG Bulk operation ID");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_bulk_op_id, 0, sizeof(struct hg_bulk_op_id));
+    hg_bulk_op_id->context = context;
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->arg = arg;
+    hg_atomic_init32(&hg_bulk_op_id->completed, 0);
+    hg_atomic_init32(&hg_bulk_op_id->canceled, 0);
+    hg_atomic_init32(&hg_bulk_op_id->op_completed_count, 0);
+    hg_atomic_init32(&hg_bulk_op_id->corrupted, 0);
+    hg_bulk_op_id->op = op;
+    hg_bulk_op_id->hg_bulk_origin = hg_bulk_origin;
+    hg_bulk_op_id->hg_bulk_local = hg_bulk_local;
+    hg_bulk_op_id->is_self = NA_Addr_is_self(
+        HG_Core_addr_get_na_class((hg_core_addr_t) origin_addr),
+        HG_Core_addr_get_na((hg_core_addr_t) origin_addr));
+    hg_bulk_op_id->origin_offset = origin_offset;
+    hg_bulk_op_id->local_offset = local_offset;
+
+    pipeline = (struct hg_bulk_pipeline *) malloc(
+        sizeof(struct hg_bulk_pipeline));
+    if (!pipeline) {
+        HG_LOG_ERROR("Could not allocate pipeline");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(pipeline, 0, sizeof(struct hg_bulk_pipeline));
+    pipeline->chunk_callback = chunk_callback;
+    pipeline->origin_addr = (struct hg_addr *) origin_addr;
+    pipeline->origin_id = origin_id;
+    pipeline->size = size;
+    pipeline->chunk_size = chunk_size;
+    pipeline->window = window;
+    pipeline->ret = HG_SUCCESS;
+    hg_thread_spin_init(&pipeline->lock);
+
+    pipeline->chunks = (struct hg_bulk_chunk *) malloc(
+        window * sizeof(struct hg_bulk_chunk));
+    if (!pipeline->chunks) {
+        HG_LOG_ERROR("Could not allocate chunks");
+        ret = HG_NOMEM_ERROR;
         goto done;
     }
+    memset(pipeline->chunks, 0, window * sizeof(struct hg_bulk_chunk));
+    for (i = 0; i < window; i++) {
+        pipeline->chunks[i].hg_bulk_op_id = hg_bulk_op_id;
+        pipeline->chunks[i].next = (i + 1 < window) ?
+            &pipeline->chunks[i + 1] : NULL;
+    }
+    pipeline->free_chunks = &pipeline->chunks[0];
+    hg_bulk_op_id->pipeline = pipeline;
 
-    ret = HG_Bulk_transfer_id(context, callback, arg, op, origin_addr, 0,
-        origin_handle, origin_offset, local_handle, local_offset, size, op_id);
+    /* Handles are released when pipeline completes */
+    hg_atomic_incr32(&hg_bulk_origin->ref_count);
+    hg_atomic_incr32(&hg_bulk_local->ref_count);
+
+    /* Assign op_id before chunks can complete */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    /* Errors that occur from now on are passed to callback */
+    hg_bulk_pipeline_issue(hg_bulk_op_id);
 
 done:
+    if (ret != HG_SUCCESS) {
+        if (pipeline) {
+            free(pipeline->chunks);
+            hg_thread_spin_destroy(&pipeline->lock);
+            free(pipeline);
+        }
+        free(hg_bulk_op_id);
+    }
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_bind_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
-    hg_bulk_op_t op, hg_bulk_t origin_handle, hg_size_t origin_offset,
-    hg_bulk_t local_handle, hg_size_t local_offset, hg_size_t size,
+HG_Bulk_transfer_multi(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, hg_bulk_t local_handle,
+    struct hg_bulk_transfer_entry *entries, hg_uint32_t count,
     hg_op_id_t *op_id)
 {
-    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_multi *multi = NULL;
     hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
 
-    if (!hg_bulk_origin) {
-        HG_LOG_ERROR("NULL origin handle passed");
+    if (!entries || !count) {
+        HG_LOG_ERROR("No transfer entry passed");
         ret = HG_INVALID_PARAM;
         goto done;
     }
 
-    if (hg_bulk_origin->addr == HG_CORE_ADDR_NULL) {
-        HG_LOG_ERROR("No address information found on bulk handle, "
-            "HG_Bulk_bind() must be called on bulk handle");
-        ret = HG_INVALID_PARAM;
+    for (i = 0; i < count; i++) {
+        ret = hg_bulk_transfer_check(context, op,
+            (struct hg_addr *) entries[i].origin_addr, entries[i].origin_id,
+            (struct hg_bulk *) entries[i].origin_handle, hg_bulk_local,
+            entries[i].size);
+        if (ret != HG_SUCCESS)
+            goto done;
+    }
+
+    /* Operation ID of vectored transfer, NA operations are attached to
+     * entries */
+    hg_bulk_op_id = (struct hg_bulk_op_id *) malloc(
+        sizeof(struct hg_bulk_op_id));
+    if (!hg_bulk_op_id) {
+        HG_LOG_ERROR("Could not allocate HG Bulk operation ID");
+        ret = HG_NOMEM_ERROR;
         goto done;
     }
+    memset(hg_bulk_op_id, 0, sizeof(struct hg_bulk_op_id));
+    hg_bulk_op_id->context = context;
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->arg = arg;
+    hg_atomic_init32(&hg_bulk_op_id->completed, 0);
+    hg_atomic_init32(&hg_bulk_op_id->canceled, 0);
+    hg_atomic_init32(&hg_bulk_op_id->op_completed_count, 0);
+    hg_atomic_init32(&hg_bulk_op_id->corrupted, 0);
+    hg_atomic_init32(&hg_bulk_op_id->failed, 0);
+    hg_bulk_op_id->op = op;
+    hg_bulk_op_id->hg_bulk_local = hg_bulk_local;
 
-    ret = HG_Bulk_transfer_id(context, callback, arg, op,
-        (hg_addr_t) hg_bulk_origin->addr, hg_bulk_origin->context_id,
-        origin_handle, origin_offset, local_handle, local_offset, size, op_id);
+    multi = (struct hg_bulk_multi *) malloc(sizeof(struct hg_bulk_multi));
+    if (!multi) {
+        HG_LOG_ERROR("Could not allocate vectored transfer");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    multi->entries = entries;
+    multi->count = count;
+    multi->entry_op_ids = (struct hg_bulk_op_id *) malloc(
+        count * sizeof(struct hg_bulk_op_id));
+    if (!multi->entry_op_ids) {
+        HG_LOG_ERROR("Could not allocate operation IDs of entries");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(multi->entry_op_ids, 0, count * sizeof(struct hg_bulk_op_id));
+    for (i = 0; i < count; i++) {
+        multi->entry_op_ids[i].parent = hg_bulk_op_id;
+        hg_atomic_init32(&multi->entry_op_ids[i].failed, 0);
+    }
+    /* Extra reference prevents completion until all entries are posted */
+    hg_atomic_init32(&multi->remaining, (hg_util_int32_t) count + 1);
+    hg_bulk_op_id->multi = multi;
+
+    /* Local handle is released when transfer completes */
+    hg_atomic_incr32(&hg_bulk_local->ref_count);
+
+    /* Assign op_id before entries can complete */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    /* Errors that occur from now on are passed to callback */
+    for (i = 0; i < count; i++) {
+        struct hg_bulk_op_id *hg_bulk_op_id_entry = &multi->entry_op_ids[i];
+        hg_return_t entry_ret;
+
+        entries[i].ret = HG_SUCCESS;
+        entry_ret = hg_bulk_transfer(context, NULL, NULL, op,
+            (struct hg_addr *) entries[i].origin_addr, entries[i].origin_id,
+            (struct hg_bulk *) entries[i].origin_handle,
+            entries[i].origin_offset, hg_bulk_local, entries[i].local_offset,
+            entries[i].size, 0, hg_bulk_op_id_entry, NULL);
+        if (entry_ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not transfer entry %u", i);
+            entries[i].ret = entry_ret;
+            hg_atomic_incr32(&hg_bulk_op_id_entry->completed);
+            hg_atomic_decr32(&multi->remaining);
+            continue;
+        }
+        if (hg_bulk_op_id_entry->is_self)
+            hg_bulk_op_id->is_self = HG_TRUE;
+    }
+
+    /* Complete if all entries have already completed */
+    if (hg_atomic_decr32(&multi->remaining) == 0)
+        hg_bulk_complete(hg_bulk_op_id);
 
 done:
+    if (ret != HG_SUCCESS) {
+        if (multi)
+            free(multi->entry_op_ids);
+        free(multi);
+        free(hg_bulk_op_id);
+    }
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
-    hg_bulk_op_t op, hg_addr_t origin_addr, hg_uint8_t origin_id,
-    hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
-    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id)
+HG_Bulk_atomic(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_atomic_op_t op, hg_addr_t origin_addr, hg_uint8_t origin_id,
+    hg_bulk_t origin_handle, hg_size_t origin_offset, hg_size_t size,
+    hg_uint64_t operand, hg_uint64_t compare, hg_uint64_t *result,
+    hg_op_id_t *op_id)
 {
     struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
-    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_atomic *atomic = NULL;
+    struct hg_bulk_segment segment;
+    hg_uint32_t segment_index;
+    hg_size_t segment_offset;
+    na_addr_t na_origin_addr;
+    na_class_t *na_origin_addr_class;
+    na_mem_handle_t *na_mem_handles;
     hg_return_t ret = HG_SUCCESS;
 
     if (!context) {
@@ -1945,79 +6327,267 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
         goto done;
     }
 
-    if (!hg_bulk_origin || !hg_bulk_local) {
+    if (!hg_bulk_origin) {
         HG_LOG_ERROR("NULL memory handle passed");
         ret = HG_INVALID_PARAM;
         goto done;
     }
 
+    if (op != HG_BULK_ATOMIC_FADD && op != HG_BULK_ATOMIC_CSWAP
+        && op != HG_BULK_ATOMIC_SWAP) {
+        HG_LOG_ERROR("Unknown atomic operation");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
     if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL
-        && hg_bulk_origin->addr != (hg_core_addr_t) origin_addr) {
+        && (hg_bulk_origin->addr != (hg_core_addr_t) origin_addr
+            || hg_bulk_origin->context_id != origin_id)) {
         HG_LOG_ERROR("Mismatched address information passed with origin handle");
         ret = HG_INVALID_PARAM;
         goto done;
     }
 
-    if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL
-        && hg_bulk_origin->context_id != origin_id) {
-        HG_LOG_ERROR("Mismatched context ID information passed with origin handle");
+    if ((hg_bulk_origin->flags & HG_BULK_READWRITE) != HG_BULK_READWRITE) {
+        HG_LOG_ERROR("Invalid permission flags for atomic operation "
+            "(origin=%d)", hg_bulk_origin->flags);
         ret = HG_INVALID_PARAM;
         goto done;
     }
 
-    if (!size) {
-        HG_LOG_ERROR("Transfer size must be non-zero");
-        ret = HG_SIZE_ERROR;
+    /* Data transferred eagerly is a copy of origin memory */
+    if (hg_bulk_origin->eager_mode || hg_bulk_origin->eager_push) {
+        HG_LOG_ERROR("Cannot update origin handle transferred eagerly");
+        ret = HG_INVALID_PARAM;
         goto done;
     }
 
-    if (size > hg_bulk_origin->total_size) {
-        HG_LOG_ERROR("Exceeding size of memory exposed by origin handle");
-        ret = HG_SIZE_ERROR;
+    ret = hg_bulk_atomic_address(hg_bulk_origin, origin_offset, size,
+        &segment_index, &segment_offset);
+    if (ret != HG_SUCCESS)
+        goto done;
+    segment = hg_bulk_segment_get(hg_bulk_origin, segment_index);
+
+    atomic = (struct hg_bulk_atomic *) malloc(sizeof(struct hg_bulk_atomic));
+    if (!atomic) {
+        HG_LOG_ERROR("Could not allocate atomic operation");
+        ret = HG_NOMEM_ERROR;
         goto done;
     }
+    atomic->op = op;
+    atomic->size = size;
+    if (size == sizeof(hg_uint32_t)) {
+        atomic->operand.u32 = (hg_uint32_t) operand;
+        atomic->compare.u32 = (hg_uint32_t) compare;
+    } else {
+        atomic->operand.u64 = operand;
+        atomic->compare.u64 = compare;
+    }
+    atomic->fetched.u64 = 0;
+    atomic->result = result;
+    atomic->value = 0;
+    atomic->ret = HG_SUCCESS;
+    atomic->handle = HG_HANDLE_NULL;
 
-    if (size > hg_bulk_local->total_size) {
-        HG_LOG_ERROR("Exceeding size of memory exposed by local handle");
-        ret = HG_SIZE_ERROR;
+    hg_bulk_op_id = (struct hg_bulk_op_id *) malloc(
+        sizeof(struct hg_bulk_op_id));
+    if (!hg_bulk_op_id) {
+        HG_LOG_ERROR("Could not allocate HG Bulk operation ID");
+        ret = HG_NOMEM_ERROR;
         goto done;
     }
+    memset(hg_bulk_op_id, 0, sizeof(struct hg_bulk_op_id));
 
-    switch (op) {
-        case HG_BULK_PUSH:
-            if (!(hg_bulk_origin->flags & HG_BULK_WRITE_ONLY)
-                || !(hg_bulk_local->flags & HG_BULK_READ_ONLY)) {
-                HG_LOG_ERROR("Invalid permission flags for PUSH operation "
-                    "(origin=%d, local=%d)", hg_bulk_origin->flags,
-                    hg_bulk_local->flags);
-                ret = HG_INVALID_PARAM;
+    na_origin_addr = HG_Core_addr_get_na((hg_core_addr_t) origin_addr);
+    na_origin_addr_class = HG_Core_addr_get_na_class(
+        (hg_core_addr_t) origin_addr);
+    hg_bulk_op_id->context = context;
+#ifdef HG_HAS_SM_ROUTING
+    if (hg_bulk_origin->na_sm_class == na_origin_addr_class) {
+        hg_bulk_op_id->na_class = hg_bulk_origin->na_sm_class;
+        hg_bulk_op_id->na_context =
+            HG_Core_context_get_na_sm(context->core_context);
+        na_mem_handles = hg_bulk_origin->na_sm_mem_handles;
+    } else {
+#endif
+        hg_bulk_op_id->na_class = hg_bulk_origin->na_class;
+        hg_bulk_op_id->na_context =
+            HG_Core_context_get_na(context->core_context);
+        na_mem_handles = hg_bulk_origin->na_mem_handles;
+#ifdef HG_HAS_SM_ROUTING
+    }
+#endif
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->arg = arg;
+    hg_atomic_init32(&hg_bulk_op_id->completed, 0);
+    hg_atomic_init32(&hg_bulk_op_id->canceled, 0);
+    hg_atomic_init32(&hg_bulk_op_id->op_completed_count, 0);
+    hg_atomic_init32(&hg_bulk_op_id->corrupted, 0);
+    hg_atomic_init32(&hg_bulk_op_id->failed, 0);
+    hg_atomic_init32(&hg_bulk_op_id->posted, 0);
+    hg_atomic_init32(&hg_bulk_op_id->timed_out, 0);
+    hg_bulk_op_id->op = HG_BULK_ATOMIC;
+    hg_bulk_op_id->hg_bulk_origin = hg_bulk_origin;
+    hg_atomic_incr32(&hg_bulk_origin->ref_count); /* Increment ref count */
+    hg_bulk_op_id->is_self = NA_Addr_is_self(na_origin_addr_class,
+        na_origin_addr);
+    hg_bulk_op_id->origin_offset = origin_offset;
+    hg_bulk_op_id->size = size;
+    hg_bulk_op_id->atomic = atomic;
+
+    if (hg_bulk_op_id->is_self) {
+        /* Origin memory is local, update word directly */
+        atomic->ret = hg_bulk_atomic_target_exec(context->hg_class,
+            (hg_uint64_t) (segment.address + (hg_ptr_t) segment_offset), op,
+            size, operand, compare, &atomic->value);
+        hg_atomic_incr32(&hg_bulk_op_id->op_completed_count);
+        ret = hg_bulk_complete(hg_bulk_op_id);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not complete atomic operation");
+            goto done;
+        }
+    } else {
+        hg_size_t na_segment_index =
+            (hg_bulk_origin->na_mem_handle_count > 1) ? segment_index : 0;
+        hg_ptr_t origin_base = hg_bulk_na_base(hg_bulk_origin, segment_index);
+        hg_size_t na_offset = segment_offset
+            + (segment.address - origin_base);
+        na_return_t na_ret = NA_OPNOTSUPPORTED;
+
+        /* See hg_bulk_transfer_pieces() */
+        if (hg_bulk_na_segmented(hg_bulk_origin))
+            na_offset = origin_offset + hg_bulk_origin->na_mem_offset;
+
+        if (na_mem_handles
+            && na_mem_handles[na_segment_index] != NA_MEM_HANDLE_NULL) {
+            hg_bulk_op_id->na_op_ids = (na_op_id_t *) malloc(
+                sizeof(na_op_id_t));
+            if (!hg_bulk_op_id->na_op_ids) {
+                HG_LOG_ERROR("Could not allocate memory for op_ids");
+                ret = HG_NOMEM_ERROR;
                 goto done;
             }
-            break;
-        case HG_BULK_PULL:
-            if (!(hg_bulk_origin->flags & HG_BULK_READ_ONLY)
-                || !(hg_bulk_local->flags & HG_BULK_WRITE_ONLY)) {
-                HG_LOG_ERROR("Invalid permission flags for PULL operation "
-                    "(origin=%d, local=%d)", hg_bulk_origin->flags,
-                    hg_bulk_local->flags);
-                ret = HG_INVALID_PARAM;
+            hg_bulk_op_id->na_op_ids[0] =
+                NA_Op_create(hg_bulk_op_id->na_class);
+            hg_bulk_op_id->op_count = 1;
+
+            /* NA atomic operations follow the same order */
+            na_ret = NA_Atomic(hg_bulk_op_id->na_class,
+                hg_bulk_op_id->na_context, hg_bulk_atomic_na_cb,
+                hg_bulk_op_id, (na_atomic_op_t) op, size, &atomic->operand,
+                &atomic->compare, &atomic->fetched,
+                na_mem_handles[na_segment_index], na_offset, na_origin_addr,
+                origin_id, &hg_bulk_op_id->na_op_ids[0]);
+            if (na_ret == NA_OPNOTSUPPORTED) {
+                NA_Op_destroy(hg_bulk_op_id->na_class,
+                    hg_bulk_op_id->na_op_ids[0]);
+                free(hg_bulk_op_id->na_op_ids);
+                hg_bulk_op_id->na_op_ids = NULL;
+                hg_bulk_op_id->op_count = 0;
+            } else if (na_ret != NA_SUCCESS) {
+                HG_LOG_ERROR("Could not post atomic operation");
+                ret = HG_NA_ERROR;
                 goto done;
             }
-            break;
-        default:
-            HG_LOG_ERROR("Unknown bulk operation");
-            ret = HG_INVALID_PARAM;
-            goto done;
+        }
+
+        /* Emulate operation with RPC executed by origin, address of word is
+         * passed as is and checked by origin against its live read-write
+         * handles */
+        if (na_ret == NA_OPNOTSUPPORTED) {
+            ret = hg_bulk_atomic_forward(context, origin_addr, origin_id,
+                (hg_uint64_t) (segment.address + (hg_ptr_t) segment_offset),
+                op, size, operand, compare, hg_bulk_op_id, &atomic->handle);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not forward atomic operation");
+                goto done;
+            }
+        }
     }
+    hg_atomic_set32(&hg_bulk_op_id->posted, 1);
 
-    ret = hg_bulk_transfer(context, callback, arg, op, origin_addr, origin_id,
-        hg_bulk_origin, origin_offset, hg_bulk_local, local_offset, size,
-        op_id);
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+done:
     if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not transfer data");
+        if (hg_bulk_op_id) {
+            if (hg_bulk_op_id->op_count)
+                NA_Op_destroy(hg_bulk_op_id->na_class,
+                    hg_bulk_op_id->na_op_ids[0]);
+            free(hg_bulk_op_id->na_op_ids);
+            hg_bulk_free(hg_bulk_op_id->hg_bulk_origin);
+            free(hg_bulk_op_id);
+        }
+        free(atomic);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_get_progress(hg_op_id_t op_id, hg_size_t *completed_size,
+    hg_uint32_t *outstanding_count)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = (struct hg_bulk_op_id *) op_id;
+    hg_size_t size = 0;
+    hg_uint32_t count = 0, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_bulk_op_id) {
+        HG_LOG_ERROR("NULL HG bulk operation ID");
+        ret = HG_INVALID_PARAM;
         goto done;
     }
 
+    if (hg_bulk_op_id->pipeline) {
+        struct hg_bulk_pipeline *pipeline = hg_bulk_op_id->pipeline;
+
+        /* Chunks in flight and chunks not issued yet */
+        hg_thread_spin_lock(&pipeline->lock);
+        size = pipeline->completed_size;
+        count = pipeline->pending;
+        if (pipeline->ret == HG_SUCCESS)
+            count += (hg_uint32_t) ((pipeline->size - pipeline->next_offset
+                + pipeline->chunk_size - 1) / pipeline->chunk_size);
+        hg_thread_spin_unlock(&pipeline->lock);
+    } else if (hg_bulk_op_id->multi) {
+        struct hg_bulk_multi *multi = hg_bulk_op_id->multi;
+
+        for (i = 0; i < multi->count; i++) {
+            hg_size_t entry_size = 0;
+            hg_uint32_t entry_count = 0;
+
+            /* Entry was not posted */
+            if (!multi->entry_op_ids[i].hg_bulk_origin)
+                continue;
+            HG_Bulk_get_progress((hg_op_id_t) &multi->entry_op_ids[i],
+                &entry_size, &entry_count);
+            size += entry_size;
+            count += entry_count;
+        }
+    } else if (hg_bulk_op_id->pieces) {
+        for (i = 0; i < hg_bulk_op_id->op_count; i++) {
+            if (hg_atomic_get32(&hg_bulk_op_id->pieces[i].completed))
+                size += hg_bulk_op_id->pieces[i].size;
+            else
+                count++;
+        }
+    } else {
+        /* Single NA operation (or emulated atomic operation) */
+        if (hg_atomic_get32(&hg_bulk_op_id->op_completed_count)
+            && !hg_atomic_get32(&hg_bulk_op_id->canceled))
+            size = hg_bulk_op_id->size;
+        else
+            count = (hg_bulk_op_id->atomic) ? 1 : hg_bulk_op_id->op_count;
+    }
+
+    if (completed_size)
+        *completed_size = size;
+    if (outstanding_count)
+        *outstanding_count = count;
+
 done:
     return ret;
 }
@@ -2035,6 +6605,24 @@ HG_Bulk_cancel(hg_op_id_t op_id)
         goto done;
     }
 
+    if (hg_bulk_op_id->pipeline) {
+        ret = hg_bulk_pipeline_cancel(hg_bulk_op_id);
+        goto done;
+    }
+
+    if (hg_bulk_op_id->multi) {
+        ret = hg_bulk_multi_cancel(hg_bulk_op_id);
+        goto done;
+    }
+
+    /* Atomic operation emulated with RPC */
+    if (hg_bulk_op_id->atomic
+        && hg_bulk_op_id->atomic->handle != HG_HANDLE_NULL) {
+        if (!hg_atomic_get32(&hg_bulk_op_id->completed))
+            ret = hg_bulk_atomic_cancel(hg_bulk_op_id->atomic->handle);
+        goto done;
+    }
+
     if (HG_UTIL_TRUE != hg_atomic_cas32(&hg_bulk_op_id->completed, 1, 0)) {
         unsigned int i = 0;
 
@@ -2044,7 +6632,8 @@ HG_Bulk_cancel(hg_op_id_t op_id)
 
             /* Cancel NA operation */
             na_ret = NA_Cancel(hg_bulk_op_id->na_class,
-                hg_bulk_op_id->na_context, hg_bulk_op_id->na_op_ids[i]);
+                hg_bulk_op_na_context(hg_bulk_op_id, i),
+                hg_bulk_op_id->na_op_ids[i]);
             if (na_ret != NA_SUCCESS) {
                 HG_LOG_ERROR("Could not cancel op id");
                 ret = HG_NA_ERROR;
@@ -17,6 +17,36 @@
 /* Public Type and Struct Definition */
 /*************************************/
 
+/* Arenas used by HG_Bulk_alloc() (see HG_Bulk_set_arena_info), requests are
+ * rounded up to a power-of-two size class and served from arenas of
+ * arena_size bytes that are registered once, requests larger than
+ * max_class_size are registered separately */
+struct hg_bulk_arena_info {
+    hg_size_t arena_size;       /* Size of each arena */
+    hg_size_t min_class_size;   /* Smallest size class (power of two) */
+    hg_size_t max_class_size;   /* Largest size class (power of two) */
+    hg_bool_t huge_pages;       /* Allocate arenas on huge pages */
+};
+
+/* Callback of pipelined transfers (see HG_Bulk_transfer_pipelined), called
+ * once per chunk with the offset of the chunk from the start of the transfer
+ * and its size */
+typedef hg_return_t (*hg_bulk_chunk_cb_t)(
+    const struct hg_cb_info *callback_info, hg_size_t offset, hg_size_t size);
+
+/* Entry of vectored transfers (see HG_Bulk_transfer_multi), data is
+ * transferred between origin_handle at origin_offset and the local handle at
+ * local_offset, ret is set to the status of the entry on completion */
+struct hg_bulk_transfer_entry {
+    hg_addr_t origin_addr;      /* Abstract address of origin */
+    hg_uint8_t origin_id;       /* Context ID of origin */
+    hg_bulk_t origin_handle;    /* Abstract bulk handle of origin */
+    hg_size_t origin_offset;    /* Offset in origin handle */
+    hg_size_t local_offset;     /* Offset in local handle */
+    hg_size_t size;             /* Size of data to be transferred */
+    hg_return_t ret;            /* Status of entry (OUT) */
+};
+
 /*****************/
 /* Public Macros */
 /*****************/
@@ -27,6 +57,26 @@
 #define HG_BULK_WRITE_ONLY  0x02
 #define HG_BULK_READWRITE   0x03
 
+/* Default block size used for bulk data checksums (see HG_Bulk_set_checksum) */
+#define HG_BULK_CHECKSUM_BLOCK_SIZE (64 * 1024)
+
+/* Default arena configuration (see HG_Bulk_set_arena_info) */
+#define HG_BULK_ARENA_SIZE              (4 * 1024 * 1024)
+#define HG_BULK_ARENA_MIN_CLASS_SIZE    (4 * 1024)
+#define HG_BULK_ARENA_MAX_CLASS_SIZE    (1024 * 1024)
+
+/* Default chunk size and window of pipelined transfers */
+#define HG_BULK_PIPELINE_CHUNK_SIZE     (1024 * 1024)
+#define HG_BULK_PIPELINE_WINDOW         4
+
+/* Eager flags that can be passed as request_eager when serializing handles:
+ * - HG_BULK_EAGER_PULL encodes data along the handle so that data pulled by
+ *   the target is copied from the RPC message (HG_TRUE)
+ * - HG_BULK_EAGER_PUSH does not expose memory, data pushed by the target is
+ *   sent back along with the RPC response */
+#define HG_BULK_EAGER_PULL  0x01
+#define HG_BULK_EAGER_PUSH  0x02
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -64,6 +114,114 @@ HG_Bulk_create(
         hg_bulk_t *handle
         );
 
+/**
+ * Create an abstract bulk handle from block_count blocks of block_size bytes
+ * separated by stride bytes (vector layout, e.g., column of a matrix). The
+ * layout is stored and serialized in constant size and blocks are only
+ * expanded when data is transferred. The whole span of memory from buf_ptr
+ * to the end of the last block is registered and must therefore be
+ * accessible. Blocks are exposed as segments (see HG_Bulk_access()).
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param buf_ptr [IN]          pointer to first block
+ * \param block_size [IN]       size of blocks
+ * \param stride [IN]           distance between the start of two blocks
+ *                              (must be greater than or equal to block_size)
+ * \param block_count [IN]      number of blocks
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param handle [OUT]          pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_create_strided(
+        hg_class_t *hg_class,
+        void *buf_ptr,
+        hg_size_t block_size,
+        hg_size_t stride,
+        hg_uint32_t block_count,
+        hg_uint8_t flags,
+        hg_bulk_t *handle
+        );
+
+/**
+ * Create an abstract bulk handle from the range [offset, offset + size) of
+ * file fd. The range is mapped and the pages of the file cache are
+ * registered, so that data is transferred from / to the file without being
+ * copied into an intermediate buffer (e.g., a single copy is made by NA SM
+ * between the file cache and the peer). fd must be open for reading, and for
+ * writing unless flags is HG_BULK_READ_ONLY, it can be closed once the handle
+ * is created.
+ *
+ * \remark The mapping lives as long as the handle or any reference to it
+ * (e.g., views, pending transfers) and is released by the last
+ * HG_Bulk_free(). Registered file cache pages remain pinned in memory while
+ * the mapping lives. The file must not be truncated below offset + size
+ * during that time, accessing pages beyond the end of the file results in a
+ * bus error. Data written through the handle reaches the file cache, it is
+ * not synced to storage.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param fd [IN]               file descriptor
+ * \param offset [IN]           offset of range in file (no alignment is
+ *                              required)
+ * \param size [IN]             size of range
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param handle [OUT]          pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_create_file(
+        hg_class_t *hg_class,
+        int fd,
+        hg_size_t offset,
+        hg_size_t size,
+        hg_uint8_t flags,
+        hg_bulk_t *handle
+        );
+
+/**
+ * Create a view of the sub-range [offset, offset + size) of an existing bulk
+ * handle. The view shares the memory registration of handle, which is
+ * therefore not registered again, and keeps a reference to handle until the
+ * view is freed. The descriptor of the view only covers the sub-range, so
+ * that a single large registered buffer can be exposed in slices. Permission
+ * flags of the view can only restrict the ones of handle (e.g.,
+ * HG_BULK_READ_ONLY view of a HG_BULK_READWRITE handle). Views of handles
+ * deserialized from a remote origin are not supported.
+ *
+ * \remark Views of strided handles (see HG_Bulk_create_strided()) must
+ * either be within a block or cover whole blocks. Permission flags of views
+ * are enforced by mercury, memory remains registered with the permissions of
+ * handle.
+ *
+ * \param handle [IN]           abstract bulk handle
+ * \param offset [IN]           offset of the view in handle
+ * \param size [IN]             size of the view
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param view_handle [OUT]     pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_view(
+        hg_bulk_t handle,
+        hg_size_t offset,
+        hg_size_t size,
+        hg_uint8_t flags,
+        hg_bulk_t *view_handle
+        );
+
 /**
  * Free bulk handle.
  *
@@ -88,6 +246,107 @@ HG_Bulk_ref_incr(
         hg_bulk_t handle
         );
 
+/**
+ * Set the max number of memory registrations cached by HG_Bulk_create().
+ * Handles created on the same user segments with the same permission flags
+ * then share NA memory handles, which remain registered after HG_Bulk_free()
+ * until they are evicted (least recently used first, once no handle uses
+ * them anymore) or invalidated. User memory that is cached must therefore
+ * be invalidated using HG_Bulk_cache_invalidate() before it is freed.
+ * Memory allocated by HG_Bulk_create() is never cached. Setting a new size
+ * releases all cached registrations, the cache is disabled (0) by default.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param size [IN]             max number of cached registrations
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_cache_set_size(
+        hg_class_t *hg_class,
+        unsigned int size
+        );
+
+/**
+ * Invalidate cached registrations that overlap the memory range. Handles
+ * that are still in use keep their registration until they are freed.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param buf [IN]              pointer to memory range
+ * \param size [IN]             size of memory range
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_cache_invalidate(
+        hg_class_t *hg_class,
+        const void *buf,
+        hg_size_t size
+        );
+
+/**
+ * Set the configuration of arenas used by HG_Bulk_alloc(). Arenas are
+ * allocated on demand and registered once, each arena is divided into blocks
+ * of a single size class. Configuration can only be changed before memory is
+ * first allocated, default is HG_BULK_ARENA_SIZE arenas and size classes
+ * ranging from HG_BULK_ARENA_MIN_CLASS_SIZE to HG_BULK_ARENA_MAX_CLASS_SIZE.
+ * If huge pages are requested, explicit huge pages are used when reserved,
+ * transparent huge pages otherwise.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param arena_info [IN]       pointer to arena configuration
+ *
+ * 
+eturn HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_set_arena_info(
+        hg_class_t *hg_class,
+        const struct hg_bulk_arena_info *arena_info
+        );
+
+/**
+ * Allocate memory from pre-registered arenas and create a bulk handle of
+ * one segment that describes it. Unlike HG_Bulk_create(), no memory
+ * registration takes place unless a new arena is needed. Memory is not
+ * initialized and is returned to its arena once the handle is released with
+ * HG_Bulk_free_mem() (or HG_Bulk_free()) and is no longer referenced.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param size [IN]             size of memory requested
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param buf_ptr [OUT]         pointer to allocated memory
+ * \param handle [OUT]          pointer to returned abstract bulk handle
+ *
+ * 
+eturn HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_alloc(
+        hg_class_t *hg_class,
+        hg_size_t size,
+        hg_uint8_t flags,
+        void **buf_ptr,
+        hg_bulk_t *handle
+        );
+
+/**
+ * Free bulk handle created with HG_Bulk_alloc() and return its memory to the
+ * arena it was allocated from.
+ *
+ * \param handle [IN]           abstract bulk handle
+ *
+ * 
+eturn HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_free_mem(
+        hg_bulk_t handle
+        );
+
 /**
  * Bind an existing bulk handle to a local HG context and associate its local
  * address. This function can be used to forward and share a bulk handle
@@ -199,13 +458,62 @@ HG_Bulk_get_segment_count(
         hg_bulk_t handle
         );
 
+/**
+ * Enable end-to-end checksums on bulk handle. When set, a CRC32C of every
+ * block_size block of the data abstracted by the handle is computed each time
+ * the handle is serialized and sent along with the handle. The target
+ * verifies blocks as soon as they have been fully pulled, reporting
+ * HG_CHECKSUM_ERROR to the transfer callback on mismatch. Transfers are split
+ * into NA operations on block boundaries so that verification overlaps with
+ * the rest of the transfer.
+ * \remark Only data pulled from a HG_BULK_READ_ONLY / HG_BULK_READWRITE
+ * origin handle (HG_BULK_PULL) is verified. Blocks only partly covered by a
+ * transfer (when the transfer offset or end is not aligned on block_size) are
+ * left unchecked, the data they contain is delivered without verification.
+ *
+ * \param handle [IN/OUT]       abstract bulk handle
+ * \param block_size [IN]       checksum block size (e.g.,
+ *                              HG_BULK_CHECKSUM_BLOCK_SIZE), 0 disables
+ *                              checksums
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_set_checksum(
+        hg_bulk_t handle,
+        hg_size_t block_size
+        );
+
+/**
+ * Get eager flags that apply to bulk handle. For a local handle, this is the
+ * subset of request_eager that would be used when serializing it, which
+ * depends on the handle permission flags and on the class eager bulk sizes
+ * (see HG_Class_set_eager_bulk_size()):
+ *   - HG_BULK_READ_ONLY handles support HG_BULK_EAGER_PULL
+ *   - HG_BULK_WRITE_ONLY handles support HG_BULK_EAGER_PUSH
+ *   - HG_BULK_READWRITE handles support both flags, only if both are requested
+ * For a handle returned by HG_Bulk_deserialize(), this is the subset of
+ * request_eager that was used by origin.
+ *
+ * \param handle [IN]           abstract bulk handle
+ * \param request_eager [IN]    combination of HG_BULK_EAGER_* flags
+ *
+ * \return Combination of HG_BULK_EAGER_* flags
+ */
+HG_EXPORT hg_uint8_t
+HG_Bulk_get_eager_flags(
+        hg_bulk_t handle,
+        hg_uint8_t request_eager
+        );
+
 /**
  * Get size required to serialize bulk handle.
  *
  * \param handle [IN]           abstract bulk handle
- * \param request_eager [IN]    boolean (passing HG_TRUE adds size of encoding
- *                              actual data along the handle if handle meets
- *                              HG_BULK_READ_ONLY flag condition)
+ * \param request_eager [IN]    combination of HG_BULK_EAGER_* flags (passing
+ *                              HG_TRUE adds size of encoding actual data along
+ *                              the handle if handle meets HG_BULK_READ_ONLY
+ *                              flag condition)
  *
  * \return Non-negative value
  */
@@ -220,10 +528,11 @@ HG_Bulk_get_serialize_size(
  *
  * \param buf [IN/OUT]          pointer to buffer
  * \param buf_size [IN]         buffer size
- * \param request_eager [IN]    boolean (passing HG_TRUE encodes actual data
- *                              along the handle, which is more efficient for
- *                              small data, this is only valid if bulk handle
- *                              has HG_BULK_READ_ONLY permission)
+ * \param request_eager [IN]    combination of HG_BULK_EAGER_* flags (passing
+ *                              HG_TRUE encodes actual data along the handle,
+ *                              which is more efficient for small data, this is
+ *                              only valid if bulk handle has HG_BULK_READ_ONLY
+ *                              permission, see HG_Bulk_get_eager_flags())
  * \param handle [IN]           abstract bulk handle
  *
  * \return HG_SUCCESS or corresponding HG error code
@@ -255,7 +564,9 @@ HG_Bulk_deserialize(
         );
 
 /**
- * Get pointer to cached serialized buffer if any was priorly set.
+ * Get pointer to cached serialized buffer if any was priorly set. Handles
+ * with checksums never return a cached buffer so that they are serialized
+ * again with current checksums.
  *
  * \param handle [IN]           abstract bulk handle
  *
@@ -297,7 +608,10 @@ HG_Bulk_set_serialize_cached_ptr(
 /**
  * Transfer data to/from origin using abstract bulk handles and explicit origin
  * address information. After completion, user callback is placed into a
- * completion queue and can be triggered using HG_Trigger().
+ * completion queue and can be triggered using HG_Trigger(). If the class was
+ * initialized with several rails, transfers larger than the rail chunk size
+ * are split into chunks that are posted to the rails of context in turn, the
+ * callback is placed into the completion queue once all chunks completed.
  *
  * \param context [IN]          pointer to HG context
  * \param callback [IN]         pointer to function callback
@@ -403,6 +717,204 @@ HG_Bulk_transfer_id(
         hg_op_id_t *op_id
         );
 
+/**
+ * Transfer data to/from origin as HG_Bulk_transfer_id() does, with a deadline
+ * of timeout ms from now. Deadlines are checked by HG_Progress(), which does
+ * not block past the first deadline of its context. A transfer that has not
+ * completed once its deadline has expired is canceled and HG_TIMEOUT is
+ * passed to callback.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param origin_addr [IN]      abstract address of origin
+ * \param origin_id [IN]        context ID of origin
+ * \param origin_handle [IN]    abstract bulk handle
+ * \param origin_offset [IN]    offset
+ * \param local_handle [IN]     abstract bulk handle
+ * \param local_offset [IN]     offset
+ * \param size [IN]             size of data to be transferred
+ * \param timeout [IN]          timeout (in milliseconds, 0 for no deadline)
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_transfer_timeout(
+        hg_context_t *context,
+        hg_cb_t callback,
+        void *arg,
+        hg_bulk_op_t op,
+        hg_addr_t origin_addr,
+        hg_uint8_t origin_id,
+        hg_bulk_t origin_handle,
+        hg_size_t origin_offset,
+        hg_bulk_t local_handle,
+        hg_size_t local_offset,
+        hg_size_t size,
+        unsigned int timeout,
+        hg_op_id_t *op_id
+        );
+
+/**
+ * Transfer data to/from origin in chunks of chunk_size bytes, with at most
+ * window chunks in flight at any time. Chunks are issued as soon as previous
+ * chunks complete and chunk_callback is triggered once for each completed
+ * chunk, so that data can be processed while the rest of the transfer is
+ * still in flight. After all chunks have completed, callback is triggered
+ * using HG_Trigger(). If an error occurs once chunks are issued, remaining
+ * chunks are not issued and the error is passed to callback. Canceling the
+ * returned operation ID cancels all chunks in flight.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param chunk_callback [IN]   pointer to chunk callback (may be NULL)
+ * \param arg [IN]              pointer to data passed to both callbacks
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param origin_addr [IN]      abstract address of origin
+ * \param origin_id [IN]        context ID of origin
+ * \param origin_handle [IN]    abstract bulk handle
+ * \param origin_offset [IN]    offset
+ * \param local_handle [IN]     abstract bulk handle
+ * \param local_offset [IN]     offset
+ * \param size [IN]             size of data to be transferred
+ * \param chunk_size [IN]       size of chunks (0 for
+ *                              HG_BULK_PIPELINE_CHUNK_SIZE)
+ * \param window [IN]           max number of chunks in flight (0 for
+ *                              HG_BULK_PIPELINE_WINDOW)
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_transfer_pipelined(
+        hg_context_t *context,
+        hg_cb_t callback,
+        hg_bulk_chunk_cb_t chunk_callback,
+        void *arg,
+        hg_bulk_op_t op,
+        hg_addr_t origin_addr,
+        hg_uint8_t origin_id,
+        hg_bulk_t origin_handle,
+        hg_size_t origin_offset,
+        hg_bulk_t local_handle,
+        hg_size_t local_offset,
+        hg_size_t size,
+        hg_size_t chunk_size,
+        unsigned int window,
+        hg_op_id_t *op_id
+        );
+
+/**
+ * Transfer data between count origins and a single local handle, each entry
+ * describing the origin address, handle and range of one transfer. All
+ * entries are posted at once and callback is triggered using HG_Trigger()
+ * once all entries have completed, with the status of the first entry that
+ * failed (HG_SUCCESS if none). The status of each entry is set in its ret
+ * field, entries must therefore remain valid until callback is triggered.
+ * Canceling the returned operation ID cancels all entries in flight.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param local_handle [IN]     abstract bulk handle
+ * \param entries [IN/OUT]      array of transfer entries
+ * \param count [IN]            number of entries
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_transfer_multi(
+        hg_context_t *context,
+        hg_cb_t callback,
+        void *arg,
+        hg_bulk_op_t op,
+        hg_bulk_t local_handle,
+        struct hg_bulk_transfer_entry *entries,
+        hg_uint32_t count,
+        hg_op_id_t *op_id
+        );
+
+/**
+ * Atomically update a 32 or 64-bit word located at origin_offset in the
+ * memory exposed by origin_handle and fetch its previous value. The word must
+ * be aligned on size and must not cross segments, origin handle must be
+ * created with HG_BULK_READWRITE. Operations map to native atomics when the
+ * NA plugin supports them (currently only ofi, for which the atomics field of
+ * na_init_info must be set to request them; sm does not map handles into the
+ * peer's address space and has no native atomics) and are otherwise emulated
+ * with an internal RPC executed by the origin, in which case the origin must
+ * make progress on one of its contexts and only updates words that lie within
+ * one of its live HG_BULK_READWRITE handles (HG_INVALID_PARAM is returned
+ * otherwise).
+ * Callback is triggered using HG_Trigger(), result is set before callback is
+ * triggered.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               atomic operation:
+ *                                  - HG_BULK_ATOMIC_FADD (add operand)
+ *                                  - HG_BULK_ATOMIC_CSWAP (store operand if
+ *                                    word is equal to compare)
+ *                                  - HG_BULK_ATOMIC_SWAP (store operand)
+ * \param origin_addr [IN]      abstract address of origin
+ * \param origin_id [IN]        context ID of origin
+ * \param origin_handle [IN]    abstract bulk handle
+ * \param origin_offset [IN]    offset of word
+ * \param size [IN]             size of word (4 or 8 bytes)
+ * \param operand [IN]          operand of operation
+ * \param compare [IN]          compared value (HG_BULK_ATOMIC_CSWAP)
+ * \param result [OUT]          pointer to previous value of word (may be NULL)
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_atomic(
+        hg_context_t *context,
+        hg_cb_t callback,
+        void *arg,
+        hg_bulk_atomic_op_t op,
+        hg_addr_t origin_addr,
+        hg_uint8_t origin_id,
+        hg_bulk_t origin_handle,
+        hg_size_t origin_offset,
+        hg_size_t size,
+        hg_uint64_t operand,
+        hg_uint64_t compare,
+        hg_uint64_t *result,
+        hg_op_id_t *op_id
+        );
+
+/**
+ * Get progress of an ongoing operation: number of bytes that have landed and
+ * number of pieces not completed yet (NA operations, or chunks of pipelined
+ * transfers). The operation ID must not be used once callback has been
+ * triggered.
+ *
+ * \param op_id [IN]            operation ID
+ * \param completed_size [OUT]  pointer to size of data transferred
+ * \param outstanding_count [OUT] pointer to number of pieces outstanding
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Bulk_get_progress(
+        hg_op_id_t op_id,
+        hg_size_t *completed_size,
+        hg_uint32_t *outstanding_count
+        );
+
 /**
  * Cancel an ongoing operation.
  *
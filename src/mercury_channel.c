@@ -0,0 +1,863 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_channel.h"
+
+#include "mercury_atomic.h"
+#include "mercury_mem.h"
+#include "mercury_thread_mutex.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+
+/****************/
+/* Local Macros */
+/****************/
+
+#define HG_CHANNEL_MAGIC        0x48474348  /* "HGCH" */
+#define HG_CHANNEL_VERSION      1
+#define HG_CHANNEL_SHM_NAME_MAX 48
+
+/* Item header value marking the end of the ring, next item is at offset 0 */
+#define HG_CHANNEL_WRAP         0xffffffff
+
+/* Size taken by item in ring */
+#define HG_CHANNEL_ITEM_SIZE(size)                                          \
+    (HG_CHANNEL_ITEM_OVERHEAD + (((size) + 7) & ~((hg_size_t) 7)))
+
+/* Offset of ring field */
+#define HG_CHANNEL_OFFSET(field)                                            \
+    ((hg_size_t) offsetof(struct hg_channel_header, field))
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/* Ring header, followed by ring data. Indices are byte positions that only
+ * grow, the producer and consumer indices are kept on separate cache lines */
+struct hg_channel_header {
+    hg_uint32_t magic;                          /* Magic number */
+    hg_uint32_t version;                        /* Ring format version */
+    hg_uint64_t size;                           /* Size of ring data */
+    char shm_name[HG_CHANNEL_SHM_NAME_MAX];     /* Shared memory name */
+    hg_atomic_int64_t head;                     /* Written by producer */
+    char pad0[64 - sizeof(hg_atomic_int64_t)];
+    hg_atomic_int64_t tail;                     /* Written by consumer */
+    char pad1[64 - sizeof(hg_atomic_int64_t)];
+};
+
+/* Item header */
+struct hg_channel_item {
+    hg_uint32_t size;                           /* Size or HG_CHANNEL_WRAP */
+    hg_uint32_t reserved;
+};
+
+/* HG channel */
+struct hg_channel {
+    hg_class_t *hg_class;                   /* HG class */
+    hg_context_t *context;                  /* Context (producer) */
+    struct hg_channel_header *header;       /* Ring or staging copy of it */
+    char *data;                             /* Ring data */
+    hg_size_t size;                         /* Size of ring data */
+    hg_size_t region_size;                  /* Size of header and data */
+    char shm_name[HG_CHANNEL_SHM_NAME_MAX]; /* Shared memory name if mapped */
+    hg_bool_t producer;                     /* Producer end */
+    hg_bool_t shared;                       /* Ring is in shared memory */
+    hg_bulk_t local_handle;                 /* Handle of ring/staging copy */
+    hg_addr_t addr;                         /* Consumer address (producer) */
+    hg_uint8_t target_id;                   /* Consumer context ID */
+    hg_bulk_t ring_handle;                  /* Consumer handle (producer) */
+    hg_uint64_t reserved;                   /* Position of next item */
+    hg_uint64_t flushed;                    /* End of data being written */
+    hg_uint64_t committed;                  /* Position seen by consumer */
+    hg_uint64_t tail;                       /* Last known consumer position */
+    hg_uint64_t reserved_count;             /* Items enqueued */
+    hg_uint64_t flushed_count;              /* Items being written */
+    hg_uint64_t committed_count;            /* Items seen by consumer */
+    struct hg_bulk_transfer_entry entries[2]; /* Data transfer entries */
+    hg_bool_t flushing;                     /* Data/index write in flight */
+    hg_bool_t refreshing;                   /* Index read in flight */
+    hg_return_t error;                      /* First transfer error */
+    hg_thread_mutex_t mutex;                /* Protects producer state */
+};
+
+/* Connect completion */
+struct hg_channel_connect_arg {
+    hg_bool_t completed;                    /* Pull has completed */
+    hg_return_t ret;                        /* Return value of pull */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Allocate and register ring (or staging copy of ring).
+ */
+static hg_return_t
+hg_channel_alloc(
+        struct hg_channel *hg_channel,
+        hg_bool_t shared
+        );
+
+/**
+ * Pull ring header from consumer.
+ */
+static hg_return_t
+hg_channel_get_header(
+        hg_context_t *context,
+        hg_addr_t addr,
+        hg_uint8_t target_id,
+        hg_bulk_t ring_handle,
+        struct hg_channel_header *header
+        );
+
+/**
+ * Header pull callback.
+ */
+static hg_return_t
+hg_channel_get_header_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/**
+ * Write items enqueued since last flush, must be called with mutex held.
+ */
+static hg_return_t
+hg_channel_flush(
+        struct hg_channel *hg_channel
+        );
+
+/**
+ * Data write callback, writes producer index.
+ */
+static hg_return_t
+hg_channel_flush_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/**
+ * Index write callback.
+ */
+static hg_return_t
+hg_channel_commit_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/**
+ * Read consumer index, must be called with mutex held.
+ */
+static hg_return_t
+hg_channel_refresh(
+        struct hg_channel *hg_channel
+        );
+
+/**
+ * Index read callback.
+ */
+static hg_return_t
+hg_channel_refresh_cb(
+        const struct hg_cb_info *callback_info
+        );
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Used to generate shared memory names */
+static hg_atomic_int32_t hg_channel_shm_id_g = HG_ATOMIC_VAR_INIT(0);
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_alloc(struct hg_channel *hg_channel, hg_bool_t shared)
+{
+    void *buf_ptr = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_channel->region_size = sizeof(struct hg_channel_header)
+        + hg_channel->size;
+
+#ifndef _WIN32
+    if (shared) {
+        snprintf(hg_channel->shm_name, HG_CHANNEL_SHM_NAME_MAX,
+            "hg_channel-%d-%d", (int) getpid(),
+            (int) hg_atomic_incr32(&hg_channel_shm_id_g));
+        buf_ptr = hg_mem_shm_map(hg_channel->shm_name,
+            (size_t) hg_channel->region_size, HG_UTIL_TRUE);
+        if (!buf_ptr) {
+            HG_LOG_WARNING("Could not map ring in shared memory");
+            hg_channel->shm_name[0] = '\0';
+        } else
+            hg_channel->shared = HG_TRUE;
+    }
+#else
+    (void) shared;
+#endif
+    if (!buf_ptr) {
+        buf_ptr = hg_mem_aligned_alloc((size_t) hg_mem_get_page_size(),
+            (size_t) hg_channel->region_size);
+        if (!buf_ptr) {
+            HG_LOG_ERROR("Could not allocate ring");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+    }
+    memset(buf_ptr, 0, (size_t) hg_channel->region_size);
+    hg_channel->header = (struct hg_channel_header *) buf_ptr;
+    hg_channel->data = (char *) (hg_channel->header + 1);
+
+    ret = HG_Bulk_create(hg_channel->hg_class, 1, &buf_ptr,
+        &hg_channel->region_size, HG_BULK_READWRITE, &hg_channel->local_handle);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register ring");
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_get_header(hg_context_t *context, hg_addr_t addr,
+    hg_uint8_t target_id, hg_bulk_t ring_handle,
+    struct hg_channel_header *header)
+{
+    struct hg_channel_connect_arg connect_arg;
+    hg_bulk_t header_handle = HG_BULK_NULL;
+    void *buf_ptr = header;
+    hg_size_t buf_size = sizeof(struct hg_channel_header);
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = HG_Bulk_create(HG_Context_get_class(context), 1, &buf_ptr,
+        &buf_size, HG_BULK_WRITE_ONLY, &header_handle);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not register ring header");
+        goto done;
+    }
+
+    connect_arg.completed = HG_FALSE;
+    connect_arg.ret = HG_SUCCESS;
+    ret = HG_Bulk_transfer_id(context, hg_channel_get_header_cb, &connect_arg,
+        HG_BULK_PULL, addr, target_id, ring_handle, 0, header_handle, 0,
+        buf_size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not pull ring header");
+        goto done;
+    }
+
+    do {
+        unsigned int actual_count = 0;
+
+        do {
+            ret = HG_Trigger(context, 0, 1, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count && !connect_arg.completed);
+
+        if (connect_arg.completed)
+            break;
+
+        ret = HG_Progress(context, HG_MAX_IDLE_TIME);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+    if (!connect_arg.completed) {
+        HG_LOG_ERROR("Could not complete ring header pull");
+        goto done;
+    }
+    ret = connect_arg.ret;
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Ring header pull failed");
+        goto done;
+    }
+
+    if (header->magic != HG_CHANNEL_MAGIC
+        || header->version != HG_CHANNEL_VERSION) {
+        HG_LOG_ERROR("Bulk handle does not describe a channel ring");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+
+done:
+    HG_Bulk_free(header_handle);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_get_header_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_channel_connect_arg *connect_arg =
+        (struct hg_channel_connect_arg *) callback_info->arg;
+
+    connect_arg->ret = callback_info->ret;
+    connect_arg->completed = HG_TRUE;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_flush(struct hg_channel *hg_channel)
+{
+    hg_uint64_t start = hg_channel->committed, end = hg_channel->reserved;
+    hg_size_t offset = (hg_size_t) (start % hg_channel->size);
+    hg_size_t len = (hg_size_t) (end - start);
+    unsigned int count = 1;
+    unsigned int i;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (hg_channel->flushing || hg_channel->error != HG_SUCCESS
+        || start == end)
+        goto done;
+
+    /* Data wraps around at most once */
+    hg_channel->entries[0].local_offset = sizeof(struct hg_channel_header)
+        + offset;
+    if (offset + len > hg_channel->size) {
+        hg_channel->entries[0].size = hg_channel->size - offset;
+        hg_channel->entries[1].local_offset = sizeof(struct hg_channel_header);
+        hg_channel->entries[1].size = len - hg_channel->entries[0].size;
+        count = 2;
+    } else
+        hg_channel->entries[0].size = len;
+    for (i = 0; i < count; i++) {
+        hg_channel->entries[i].origin_addr = hg_channel->addr;
+        hg_channel->entries[i].origin_id = hg_channel->target_id;
+        hg_channel->entries[i].origin_handle = hg_channel->ring_handle;
+        hg_channel->entries[i].origin_offset =
+            hg_channel->entries[i].local_offset;
+    }
+
+    hg_channel->flushed = end;
+    hg_channel->flushed_count = hg_channel->reserved_count;
+    hg_channel->flushing = HG_TRUE;
+    ret = HG_Bulk_transfer_multi(hg_channel->context, hg_channel_flush_cb,
+        hg_channel, HG_BULK_PUSH, hg_channel->local_handle,
+        hg_channel->entries, count, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not write channel data");
+        hg_channel->flushing = HG_FALSE;
+        hg_channel->error = ret;
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_flush_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_channel *hg_channel = (struct hg_channel *) callback_info->arg;
+    hg_return_t ret = callback_info->ret;
+
+    hg_thread_mutex_lock(&hg_channel->mutex);
+
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Channel data write failed");
+        goto done;
+    }
+
+    /* Data is in place, publish new producer index */
+    hg_atomic_set64(&hg_channel->header->head,
+        (hg_util_int64_t) hg_channel->flushed);
+    ret = HG_Bulk_transfer_id(hg_channel->context, hg_channel_commit_cb,
+        hg_channel, HG_BULK_PUSH, hg_channel->addr, hg_channel->target_id,
+        hg_channel->ring_handle, HG_CHANNEL_OFFSET(head),
+        hg_channel->local_handle, HG_CHANNEL_OFFSET(head),
+        sizeof(hg_atomic_int64_t), HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not write channel index");
+        goto done;
+    }
+
+done:
+    if (ret != HG_SUCCESS) {
+        hg_channel->flushing = HG_FALSE;
+        hg_channel->error = ret;
+    }
+    hg_thread_mutex_unlock(&hg_channel->mutex);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_commit_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_channel *hg_channel = (struct hg_channel *) callback_info->arg;
+
+    hg_thread_mutex_lock(&hg_channel->mutex);
+
+    hg_channel->flushing = HG_FALSE;
+    if (callback_info->ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Channel index write failed");
+        hg_channel->error = callback_info->ret;
+        goto done;
+    }
+    hg_channel->committed = hg_channel->flushed;
+    hg_channel->committed_count = hg_channel->flushed_count;
+
+    /* Items enqueued in the meantime are written together */
+    hg_channel_flush(hg_channel);
+
+    /* Read consumer index ahead of time when ring is more than half full */
+    if (hg_channel->reserved - hg_channel->tail > hg_channel->size / 2)
+        hg_channel_refresh(hg_channel);
+
+done:
+    hg_thread_mutex_unlock(&hg_channel->mutex);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_refresh(struct hg_channel *hg_channel)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (hg_channel->refreshing || hg_channel->error != HG_SUCCESS)
+        goto done;
+
+    hg_channel->refreshing = HG_TRUE;
+    ret = HG_Bulk_transfer_id(hg_channel->context, hg_channel_refresh_cb,
+        hg_channel, HG_BULK_PULL, hg_channel->addr, hg_channel->target_id,
+        hg_channel->ring_handle, HG_CHANNEL_OFFSET(tail),
+        hg_channel->local_handle, HG_CHANNEL_OFFSET(tail),
+        sizeof(hg_atomic_int64_t), HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not read channel index");
+        hg_channel->refreshing = HG_FALSE;
+        hg_channel->error = ret;
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_channel_refresh_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_channel *hg_channel = (struct hg_channel *) callback_info->arg;
+
+    hg_thread_mutex_lock(&hg_channel->mutex);
+
+    hg_channel->refreshing = HG_FALSE;
+    if (callback_info->ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Channel index read failed");
+        hg_channel->error = callback_info->ret;
+    } else
+        hg_channel->tail =
+            (hg_uint64_t) hg_atomic_get64(&hg_channel->header->tail);
+
+    hg_thread_mutex_unlock(&hg_channel->mutex);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Channel_create(hg_class_t *hg_class, hg_size_t size, hg_bool_t shared,
+    hg_channel_t **channel)
+{
+    struct hg_channel *hg_channel = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (size < 4 * HG_CHANNEL_ITEM_OVERHEAD) {
+        HG_LOG_ERROR("Ring size is too small");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!channel) {
+        HG_LOG_ERROR("NULL pointer to channel");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_channel = (struct hg_channel *) malloc(sizeof(struct hg_channel));
+    if (!hg_channel) {
+        HG_LOG_ERROR("Could not allocate channel");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_channel, 0, sizeof(struct hg_channel));
+    hg_channel->hg_class = hg_class;
+    hg_channel->size = (size + 7) & ~((hg_size_t) 7);
+    hg_thread_mutex_init(&hg_channel->mutex);
+
+    /* Only producers using the sm plugin can map the ring */
+    ret = hg_channel_alloc(hg_channel,
+        shared && strcmp(HG_Class_get_protocol(hg_class), "sm") == 0);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    hg_channel->header->magic = HG_CHANNEL_MAGIC;
+    hg_channel->header->version = HG_CHANNEL_VERSION;
+    hg_channel->header->size = hg_channel->size;
+    strncpy(hg_channel->header->shm_name, hg_channel->shm_name,
+        HG_CHANNEL_SHM_NAME_MAX);
+    hg_atomic_init64(&hg_channel->header->head, 0);
+    hg_atomic_init64(&hg_channel->header->tail, 0);
+
+    *channel = hg_channel;
+
+done:
+    if (ret != HG_SUCCESS && hg_channel)
+        HG_Channel_destroy(hg_channel);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Channel_connect(hg_context_t *context, hg_addr_t addr,
+    hg_uint8_t target_id, hg_bulk_t ring_handle, hg_channel_t **channel)
+{
+    struct hg_channel_header header;
+    struct hg_channel *hg_channel = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (addr == HG_ADDR_NULL || ring_handle == HG_BULK_NULL) {
+        HG_LOG_ERROR("NULL address or bulk handle");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!channel) {
+        HG_LOG_ERROR("NULL pointer to channel");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    ret = hg_channel_get_header(context, addr, target_id, ring_handle,
+        &header);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    hg_channel = (struct hg_channel *) malloc(sizeof(struct hg_channel));
+    if (!hg_channel) {
+        HG_LOG_ERROR("Could not allocate channel");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_channel, 0, sizeof(struct hg_channel));
+    hg_channel->hg_class = HG_Context_get_class(context);
+    hg_channel->context = context;
+    hg_channel->size = (hg_size_t) header.size;
+    hg_channel->region_size = sizeof(struct hg_channel_header)
+        + hg_channel->size;
+    hg_channel->producer = HG_TRUE;
+    hg_channel->target_id = target_id;
+    hg_channel->error = HG_SUCCESS;
+    hg_thread_mutex_init(&hg_channel->mutex);
+
+    /* Resume from indices of ring, it may have been written to before */
+    hg_channel->reserved = hg_channel->flushed = hg_channel->committed =
+        (hg_uint64_t) hg_atomic_get64(&header.head);
+    hg_channel->tail = (hg_uint64_t) hg_atomic_get64(&header.tail);
+
+    /* Consumer is local if both ends use the sm plugin, write ring directly */
+#ifndef _WIN32
+    header.shm_name[HG_CHANNEL_SHM_NAME_MAX - 1] = '\0';
+    if (header.shm_name[0]
+        && strcmp(HG_Class_get_protocol(hg_channel->hg_class), "sm") == 0) {
+        void *buf_ptr = hg_mem_shm_map(header.shm_name,
+            (size_t) hg_channel->region_size, HG_UTIL_FALSE);
+
+        if (buf_ptr) {
+            hg_channel->header = (struct hg_channel_header *) buf_ptr;
+            hg_channel->data = (char *) (hg_channel->header + 1);
+            hg_channel->shared = HG_TRUE;
+            *channel = hg_channel;
+            goto done;
+        }
+        HG_LOG_WARNING("Could not map ring %s, using bulk transfers",
+            header.shm_name);
+    }
+#endif
+
+    /* Items are staged at the same offsets as in the consumer ring */
+    ret = hg_channel_alloc(hg_channel, HG_FALSE);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    ret = HG_Addr_dup(hg_channel->hg_class, addr, &hg_channel->addr);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not duplicate address");
+        goto done;
+    }
+    HG_Bulk_ref_incr(ring_handle);
+    hg_channel->ring_handle = ring_handle;
+
+    *channel = hg_channel;
+
+done:
+    if (ret != HG_SUCCESS && hg_channel)
+        HG_Channel_destroy(hg_channel);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Channel_destroy(hg_channel_t *channel)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!channel)
+        goto done;
+
+    hg_thread_mutex_lock(&channel->mutex);
+    if (channel->flushing || channel->refreshing) {
+        hg_thread_mutex_unlock(&channel->mutex);
+        HG_LOG_ERROR("Channel has transfers in flight");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    hg_thread_mutex_unlock(&channel->mutex);
+
+    HG_Bulk_free(channel->local_handle);
+    HG_Bulk_free(channel->ring_handle);
+    if (channel->addr != HG_ADDR_NULL)
+        HG_Addr_free(channel->hg_class, channel->addr);
+    if (channel->header) {
+#ifndef _WIN32
+        /* Segment is removed by the consumer that created it */
+        if (channel->shared)
+            hg_mem_shm_unmap(channel->producer ? NULL : channel->shm_name,
+                channel->header, (size_t) channel->region_size);
+        else
+#endif
+            hg_mem_aligned_free(channel->header);
+    }
+    hg_thread_mutex_destroy(&channel->mutex);
+    free(channel);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bulk_t
+HG_Channel_get_bulk(const hg_channel_t *channel)
+{
+    return (channel && !channel->producer) ? channel->local_handle
+        : HG_BULK_NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_size_t
+HG_Channel_get_max_size(const hg_channel_t *channel)
+{
+    /* Room must remain to wrap an item around wherever the ring ends */
+    return channel ? channel->size / 2 - HG_CHANNEL_ITEM_OVERHEAD : 0;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+HG_Channel_is_shared(const hg_channel_t *channel)
+{
+    return channel ? channel->shared : HG_FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Channel_enqueue(hg_channel_t *channel, unsigned int count,
+    const void *const *bufs, const hg_size_t *sizes,
+    unsigned int *actual_count)
+{
+    hg_size_t max_size;
+    hg_uint64_t reserved;
+    unsigned int i = 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!channel || !channel->producer) {
+        HG_LOG_ERROR("NULL or non-producer channel");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (count && (!bufs || !sizes)) {
+        HG_LOG_ERROR("NULL item buffers or sizes");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_thread_mutex_lock(&channel->mutex);
+
+    if (channel->error != HG_SUCCESS) {
+        ret = channel->error;
+        goto unlock;
+    }
+
+    max_size = HG_Channel_get_max_size(channel);
+    reserved = channel->reserved;
+    for (i = 0; i < count; i++) {
+        hg_size_t item_size = HG_CHANNEL_ITEM_SIZE(sizes[i]);
+        hg_size_t offset = (hg_size_t) (reserved % channel->size);
+        hg_size_t needed = item_size;
+        struct hg_channel_item *item;
+
+        if (sizes[i] > max_size) {
+            HG_LOG_ERROR("Item size (%lu) exceeds max size (%lu)",
+                (unsigned long) sizes[i], (unsigned long) max_size);
+            ret = HG_SIZE_ERROR;
+            break;
+        }
+
+        /* Items do not wrap around, skip end of ring if needed */
+        if (offset + item_size > channel->size)
+            needed += channel->size - offset;
+        if (reserved + needed - channel->tail > channel->size) {
+            if (channel->shared)
+                channel->tail =
+                    (hg_uint64_t) hg_atomic_get64(&channel->header->tail);
+            else
+                hg_channel_refresh(channel);
+            if (reserved + needed - channel->tail > channel->size)
+                break;
+        }
+
+        if (needed != item_size) {
+            item = (struct hg_channel_item *) (channel->data + offset);
+            item->size = HG_CHANNEL_WRAP;
+            reserved += channel->size - offset;
+            offset = 0;
+        }
+        item = (struct hg_channel_item *) (channel->data + offset);
+        item->size = (hg_uint32_t) sizes[i];
+        memcpy(item + 1, bufs[i], (size_t) sizes[i]);
+        reserved += item_size;
+    }
+    if (reserved == channel->reserved)
+        goto unlock;
+
+    channel->reserved = reserved;
+    channel->reserved_count += i;
+    if (channel->shared) {
+        /* Release items to the consumer with a single index update */
+        hg_atomic_set64(&channel->header->head, (hg_util_int64_t) reserved);
+        channel->flushed = channel->committed = reserved;
+        channel->flushed_count = channel->committed_count =
+            channel->reserved_count;
+    } else
+        hg_channel_flush(channel);
+
+unlock:
+    hg_thread_mutex_unlock(&channel->mutex);
+
+done:
+    if (actual_count)
+        *actual_count = i;
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_uint64_t
+HG_Channel_get_pending(hg_channel_t *channel)
+{
+    hg_uint64_t ret;
+
+    if (!channel)
+        return 0;
+
+    hg_thread_mutex_lock(&channel->mutex);
+    ret = channel->reserved_count - channel->committed_count;
+    hg_thread_mutex_unlock(&channel->mutex);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Channel_dequeue(hg_channel_t *channel, unsigned int count, void **bufs,
+    hg_size_t *sizes, unsigned int *actual_count)
+{
+    hg_uint64_t head, tail;
+    unsigned int i = 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!channel || channel->producer) {
+        HG_LOG_ERROR("NULL or non-consumer channel");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (count && (!bufs || !sizes)) {
+        HG_LOG_ERROR("NULL item buffers or sizes");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    head = (hg_uint64_t) hg_atomic_get64(&channel->header->head);
+    tail = channel->tail;
+    while (i < count && tail < head) {
+        hg_size_t offset = (hg_size_t) (tail % channel->size);
+        struct hg_channel_item *item =
+            (struct hg_channel_item *) (channel->data + offset);
+        hg_size_t size, item_size;
+
+        /* Ring memory may be written by the producer, read size once */
+        size = *(volatile hg_uint32_t *) &item->size;
+        if (size == HG_CHANNEL_WRAP) {
+            if (tail + (channel->size - offset) > head) {
+                HG_LOG_ERROR("Wrap marker exceeds written data");
+                ret = HG_PROTOCOL_ERROR;
+                break;
+            }
+            tail += channel->size - offset;
+            continue;
+        }
+        if (size > channel->size) {
+            HG_LOG_ERROR("Invalid item size (%lu)", (unsigned long) size);
+            ret = HG_PROTOCOL_ERROR;
+            break;
+        }
+        item_size = HG_CHANNEL_ITEM_SIZE(size);
+        if (offset + item_size > channel->size || tail + item_size > head) {
+            HG_LOG_ERROR("Item of size %lu exceeds ring or written data",
+                (unsigned long) size);
+            ret = HG_PROTOCOL_ERROR;
+            break;
+        }
+        if (size > sizes[i]) {
+            sizes[i] = size;
+            ret = HG_SIZE_ERROR;
+            break;
+        }
+        memcpy(bufs[i], item + 1, size);
+        sizes[i] = size;
+        tail += item_size;
+        i++;
+    }
+
+    /* Give space back to the producer once items have been copied */
+    if (tail != channel->tail) {
+        channel->tail = tail;
+        hg_atomic_set64(&channel->header->tail, (hg_util_int64_t) tail);
+    }
+
+done:
+    if (actual_count)
+        *actual_count = i;
+    return ret;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_CHANNEL_H
+#define MERCURY_CHANNEL_H
+
+#include "mercury.h"
+#include "mercury_bulk.h"
+
+/*************************************/
+/* Public Type and Struct Definition */
+/*************************************/
+
+typedef struct hg_channel hg_channel_t; /* Opaque HG channel */
+
+/*****************/
+/* Public Macros */
+/*****************/
+
+/* Space taken in ring by each item in addition to its (8-byte aligned) data */
+#define HG_CHANNEL_ITEM_OVERHEAD 8
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Create consumer end of a streaming channel: a ring buffer of size bytes is
+ * allocated and registered so that a single producer can write items to it
+ * with bulk transfers. The bulk handle returned by HG_Channel_get_bulk() must
+ * be sent to the producer (e.g., as part of an RPC), which then connects to
+ * it with HG_Channel_connect(). If shared is set and hg_class uses the sm
+ * plugin, the ring is allocated in named shared memory and producers using
+ * the sm plugin write to it directly without any bulk transfer.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param size [IN]             size of ring (rounded up to a multiple of 8),
+ *                              items can be up to half of that size minus
+ *                              HG_CHANNEL_ITEM_OVERHEAD
+ * \param shared [IN]           allocate ring in shared memory
+ * \param channel [OUT]         pointer to HG channel
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Channel_create(
+        hg_class_t *hg_class,
+        hg_size_t size,
+        hg_bool_t shared,
+        hg_channel_t **channel
+        );
+
+/**
+ * Connect producer end of a streaming channel to the ring exposed by a
+ * consumer at addr. The ring geometry is pulled from the consumer, this call
+ * therefore progresses and triggers context until it has completed. Items
+ * enqueued are then written with bulk transfers posted to context, which
+ * must be progressed for them to complete, or written directly if the ring
+ * could be mapped in shared memory.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param addr [IN]             abstract address of consumer
+ * \param target_id [IN]        context ID of consumer
+ * \param ring_handle [IN]      bulk handle of consumer (see
+ *                              HG_Channel_get_bulk())
+ * \param channel [OUT]         pointer to HG channel
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Channel_connect(
+        hg_context_t *context,
+        hg_addr_t addr,
+        hg_uint8_t target_id,
+        hg_bulk_t ring_handle,
+        hg_channel_t **channel
+        );
+
+/**
+ * Destroy channel. A producer can only be destroyed once
+ * HG_Channel_get_pending() has returned 0 and the consumer must outlive its
+ * producer.
+ *
+ * \param channel [IN]          pointer to HG channel
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Channel_destroy(
+        hg_channel_t *channel
+        );
+
+/**
+ * Get bulk handle of ring exposed by consumer. The handle remains owned by
+ * the channel and is valid until the channel is destroyed.
+ *
+ * \param channel [IN]          pointer to HG channel
+ *
+ * \return abstract bulk handle
+ */
+HG_EXPORT hg_bulk_t
+HG_Channel_get_bulk(
+        const hg_channel_t *channel
+        );
+
+/**
+ * Get max size of items that can be enqueued to channel.
+ *
+ * \param channel [IN]          pointer to HG channel
+ *
+ * \return max item size
+ */
+HG_EXPORT hg_size_t
+HG_Channel_get_max_size(
+        const hg_channel_t *channel
+        );
+
+/**
+ * Check whether channel writes/reads ring directly in shared memory.
+ *
+ * \param channel [IN]          pointer to HG channel
+ *
+ * \return HG_TRUE if ring is shared, HG_FALSE otherwise
+ */
+HG_EXPORT hg_bool_t
+HG_Channel_is_shared(
+        const hg_channel_t *channel
+        );
+
+/**
+ * Enqueue up to count items to channel. Items are copied so that buffers can
+ * be reused once this call returns, and items enqueued by successive calls
+ * are written to the consumer together: a single transfer of the data of
+ * all items followed by a single update of the ring index. Fewer than count
+ * items are enqueued if the ring does not have enough room, in which case
+ * the consumer position is refreshed in the background and the call should
+ * be retried after making progress. The ring index of the consumer is only
+ * ever read when the ring appears full. Only one thread may enqueue to a
+ * channel at a time.
+ *
+ * \param channel [IN]          pointer to HG channel (producer)
+ * \param count [IN]            number of items
+ * \param bufs [IN]             array of pointers to item data
+ * \param sizes [IN]            array of item sizes
+ * \param actual_count [OUT]    number of items enqueued
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Channel_enqueue(
+        hg_channel_t *channel,
+        unsigned int count,
+        const void *const *bufs,
+        const hg_size_t *sizes,
+        unsigned int *actual_count
+        );
+
+/**
+ * Get number of items enqueued that are not yet visible to the consumer.
+ *
+ * \param channel [IN]          pointer to HG channel (producer)
+ *
+ * \return number of items
+ */
+HG_EXPORT hg_uint64_t
+HG_Channel_get_pending(
+        hg_channel_t *channel
+        );
+
+/**
+ * Dequeue up to count items from channel, items are copied to bufs. On
+ * input, the i-th size is the size of the i-th buffer, on output it is set
+ * to the size of the i-th item. If an item does not fit into its buffer,
+ * items dequeued so far are returned, the item is left in the channel, its
+ * size is returned in place of the buffer size and HG_SIZE_ERROR is
+ * returned. The ring index seen by the producer is updated once per call.
+ * Only one thread may dequeue from a channel at a time.
+ *
+ * \param channel [IN]          pointer to HG channel (consumer)
+ * \param count [IN]            max number of items
+ * \param bufs [IN]             array of pointers to buffers
+ * \param sizes [IN/OUT]        array of buffer sizes / item sizes
+ * \param actual_count [OUT]    number of items dequeued
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Channel_dequeue(
+        hg_channel_t *channel,
+        unsigned int count,
+        void **bufs,
+        hg_size_t *sizes,
+        unsigned int *actual_count
+        );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_CHANNEL_H */
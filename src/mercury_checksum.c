@@ -0,0 +1,365 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_checksum.h"
+
+#include "mercury_atomic.h"
+#include "mercury_thread.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# include <nmmintrin.h>
+# define HG_CHECKSUM_HAS_SSE42
+#endif
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* CRC32C (Castagnoli) polynomial, reversed */
+#define HG_CHECKSUM_CRC32C_POLY 0x82F63B78
+
+/* Block sizes used to interleave three crc32 streams */
+#define HG_CHECKSUM_CRC32C_LONG     8192
+#define HG_CHECKSUM_CRC32C_SHORT    256
+
+/* Init states */
+#define HG_CHECKSUM_INIT_NONE       0
+#define HG_CHECKSUM_INIT_PENDING    1
+#define HG_CHECKSUM_INIT_DONE       2
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+typedef hg_uint32_t (*hg_checksum_crc32c_cb_t)(hg_uint32_t crc,
+    const unsigned char *buf, hg_size_t buf_size);
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Initialize tables and select implementation.
+ */
+static void
+hg_checksum_init(
+        void
+        );
+
+/**
+ * Multiply 32x32 GF(2) matrix by vector.
+ */
+static hg_uint32_t
+hg_checksum_gf2_matrix_times(
+        const hg_uint32_t *mat,
+        hg_uint32_t vec
+        );
+
+/**
+ * Square 32x32 GF(2) matrix.
+ */
+static void
+hg_checksum_gf2_matrix_square(
+        hg_uint32_t *square,
+        const hg_uint32_t *mat
+        );
+
+/**
+ * Build tables that shift a CRC by len zero bytes (len is a power of 2).
+ */
+static void
+hg_checksum_crc32c_zeros(
+        hg_uint32_t zeros[][256],
+        hg_size_t len
+        );
+
+/**
+ * Table-driven CRC32C (slicing-by-8).
+ */
+static hg_uint32_t
+hg_checksum_crc32c_sw(
+        hg_uint32_t crc,
+        const unsigned char *buf,
+        hg_size_t buf_size
+        );
+
+#ifdef HG_CHECKSUM_HAS_SSE42
+/**
+ * SSE4.2 CRC32C.
+ */
+static hg_uint32_t
+hg_checksum_crc32c_sse42(
+        hg_uint32_t crc,
+        const unsigned char *buf,
+        hg_size_t buf_size
+        );
+#endif
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+static hg_atomic_int32_t hg_checksum_init_state_g =
+    HG_ATOMIC_VAR_INIT(HG_CHECKSUM_INIT_NONE);
+static hg_checksum_crc32c_cb_t hg_checksum_crc32c_cb_g = NULL;
+
+/* Slicing-by-8 tables */
+static hg_uint32_t hg_checksum_crc32c_table_g[8][256];
+
+#ifdef HG_CHECKSUM_HAS_SSE42
+/* Tables to shift a CRC by LONG and SHORT zero bytes */
+static hg_uint32_t hg_checksum_crc32c_long_g[4][256];
+static hg_uint32_t hg_checksum_crc32c_short_g[4][256];
+#endif
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_checksum_init(void)
+{
+    unsigned int i, j;
+
+    if (hg_atomic_get32(&hg_checksum_init_state_g) == HG_CHECKSUM_INIT_DONE)
+        return;
+
+    /* Only one thread builds tables, others wait for them */
+    if (!hg_atomic_cas32(&hg_checksum_init_state_g, HG_CHECKSUM_INIT_NONE,
+        HG_CHECKSUM_INIT_PENDING)) {
+        while (hg_atomic_get32(&hg_checksum_init_state_g)
+            != HG_CHECKSUM_INIT_DONE)
+            hg_thread_yield();
+        return;
+    }
+
+    for (i = 0; i < 256; i++) {
+        hg_uint32_t crc = i;
+
+        for (j = 0; j < 8; j++)
+            crc = (crc & 1) ? (crc >> 1) ^ HG_CHECKSUM_CRC32C_POLY : crc >> 1;
+        hg_checksum_crc32c_table_g[0][i] = crc;
+    }
+    for (i = 0; i < 256; i++) {
+        hg_uint32_t crc = hg_checksum_crc32c_table_g[0][i];
+
+        for (j = 1; j < 8; j++) {
+            crc = hg_checksum_crc32c_table_g[0][crc & 0xFF] ^ (crc >> 8);
+            hg_checksum_crc32c_table_g[j][i] = crc;
+        }
+    }
+    hg_checksum_crc32c_cb_g = hg_checksum_crc32c_sw;
+
+#ifdef HG_CHECKSUM_HAS_SSE42
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        hg_checksum_crc32c_zeros(hg_checksum_crc32c_long_g,
+            HG_CHECKSUM_CRC32C_LONG);
+        hg_checksum_crc32c_zeros(hg_checksum_crc32c_short_g,
+            HG_CHECKSUM_CRC32C_SHORT);
+        hg_checksum_crc32c_cb_g = hg_checksum_crc32c_sse42;
+    }
+#endif
+
+    hg_atomic_set32(&hg_checksum_init_state_g, HG_CHECKSUM_INIT_DONE);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_checksum_gf2_matrix_times(const hg_uint32_t *mat, hg_uint32_t vec)
+{
+    hg_uint32_t sum = 0;
+
+    while (vec) {
+        if (vec & 1)
+            sum ^= *mat;
+        vec >>= 1;
+        mat++;
+    }
+
+    return sum;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_checksum_gf2_matrix_square(hg_uint32_t *square, const hg_uint32_t *mat)
+{
+    unsigned int n;
+
+    for (n = 0; n < 32; n++)
+        square[n] = hg_checksum_gf2_matrix_times(mat, mat[n]);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_checksum_crc32c_zeros(hg_uint32_t zeros[][256], hg_size_t len)
+{
+    hg_uint32_t even[32], odd[32], *op = NULL;
+    hg_uint32_t row = 1;
+    unsigned int n;
+
+    /* Operator for one zero bit */
+    odd[0] = HG_CHECKSUM_CRC32C_POLY;
+    for (n = 1; n < 32; n++) {
+        odd[n] = row;
+        row <<= 1;
+    }
+    /* Operators for two and four zero bits */
+    hg_checksum_gf2_matrix_square(even, odd);
+    hg_checksum_gf2_matrix_square(odd, even);
+
+    /* Square until operator for len zero bytes is reached (first square gives
+     * one zero byte) */
+    for (;;) {
+        hg_checksum_gf2_matrix_square(even, odd);
+        len >>= 1;
+        if (len == 0) {
+            op = even;
+            break;
+        }
+        hg_checksum_gf2_matrix_square(odd, even);
+        len >>= 1;
+        if (len == 0) {
+            op = odd;
+            break;
+        }
+    }
+
+    /* Apply operator byte by byte */
+    for (n = 0; n < 256; n++) {
+        zeros[0][n] = hg_checksum_gf2_matrix_times(op, n);
+        zeros[1][n] = hg_checksum_gf2_matrix_times(op, n << 8);
+        zeros[2][n] = hg_checksum_gf2_matrix_times(op, n << 16);
+        zeros[3][n] = hg_checksum_gf2_matrix_times(op, n << 24);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_checksum_crc32c_sw(hg_uint32_t crc, const unsigned char *buf,
+    hg_size_t buf_size)
+{
+    hg_uint32_t (*table)[256] = hg_checksum_crc32c_table_g;
+
+    crc = ~crc;
+
+    /* Slicing-by-8, words are assembled byte by byte so that neither
+     * alignment nor host byte order matter */
+    while (buf_size >= 8) {
+        hg_uint32_t lo = crc ^ ((hg_uint32_t) buf[0]
+            | (hg_uint32_t) buf[1] << 8 | (hg_uint32_t) buf[2] << 16
+            | (hg_uint32_t) buf[3] << 24);
+
+        crc = table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF]
+            ^ table[5][(lo >> 16) & 0xFF] ^ table[4][lo >> 24]
+            ^ table[3][buf[4]] ^ table[2][buf[5]]
+            ^ table[1][buf[6]] ^ table[0][buf[7]];
+        buf += 8;
+        buf_size -= 8;
+    }
+
+    while (buf_size--)
+        crc = table[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+#ifdef HG_CHECKSUM_HAS_SSE42
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_uint32_t
+hg_checksum_crc32c_shift(hg_uint32_t zeros[][256], hg_uint32_t crc)
+{
+    return zeros[0][crc & 0xFF] ^ zeros[1][(crc >> 8) & 0xFF]
+        ^ zeros[2][(crc >> 16) & 0xFF] ^ zeros[3][crc >> 24];
+}
+
+/*---------------------------------------------------------------------------*/
+#ifdef __x86_64__
+# define HG_CHECKSUM_CRC32C_WORD        hg_uint64_t
+# define HG_CHECKSUM_CRC32C_STEP(c, p)  \
+    (hg_uint32_t) _mm_crc32_u64(c, *(const hg_uint64_t *) (p))
+#else
+# define HG_CHECKSUM_CRC32C_WORD        hg_uint32_t
+# define HG_CHECKSUM_CRC32C_STEP(c, p)  \
+    _mm_crc32_u32(c, *(const hg_uint32_t *) (p))
+#endif
+
+/* Run three interleaved streams over 3 * block bytes and combine them */
+#define HG_CHECKSUM_CRC32C_STREAMS(crc0, next, buf_size, block, zeros) do { \
+    while (buf_size >= 3 * block) {                                         \
+        const unsigned char *end = next + block;                            \
+        hg_uint32_t crc1 = 0, crc2 = 0;                                     \
+        do {                                                                \
+            crc0 = HG_CHECKSUM_CRC32C_STEP(crc0, next);                     \
+            crc1 = HG_CHECKSUM_CRC32C_STEP(crc1, next + block);             \
+            crc2 = HG_CHECKSUM_CRC32C_STEP(crc2, next + 2 * block);         \
+            next += sizeof(HG_CHECKSUM_CRC32C_WORD);                        \
+        } while (next < end);                                               \
+        crc0 = hg_checksum_crc32c_shift(zeros, crc0) ^ crc1;                \
+        crc0 = hg_checksum_crc32c_shift(zeros, crc0) ^ crc2;                \
+        next += 2 * block;                                                  \
+        buf_size -= 3 * block;                                              \
+    }                                                                       \
+} while (0)
+
+__attribute__((target("sse4.2")))
+static hg_uint32_t
+hg_checksum_crc32c_sse42(hg_uint32_t crc, const unsigned char *buf,
+    hg_size_t buf_size)
+{
+    const unsigned char *next = buf;
+    hg_uint32_t crc0 = ~crc;
+
+    /* Align to word size */
+    while (buf_size
+        && ((uintptr_t) next & (sizeof(HG_CHECKSUM_CRC32C_WORD) - 1))) {
+        crc0 = _mm_crc32_u8(crc0, *next++);
+        buf_size--;
+    }
+
+    /* crc32 has a latency of 3 cycles but a throughput of 1, keep three
+     * independent streams in flight on large buffers */
+    HG_CHECKSUM_CRC32C_STREAMS(crc0, next, buf_size, HG_CHECKSUM_CRC32C_LONG,
+        hg_checksum_crc32c_long_g);
+    HG_CHECKSUM_CRC32C_STREAMS(crc0, next, buf_size, HG_CHECKSUM_CRC32C_SHORT,
+        hg_checksum_crc32c_short_g);
+
+    while (buf_size >= sizeof(HG_CHECKSUM_CRC32C_WORD)) {
+        crc0 = HG_CHECKSUM_CRC32C_STEP(crc0, next);
+        next += sizeof(HG_CHECKSUM_CRC32C_WORD);
+        buf_size -= sizeof(HG_CHECKSUM_CRC32C_WORD);
+    }
+
+    while (buf_size--)
+        crc0 = _mm_crc32_u8(crc0, *next++);
+
+    return ~crc0;
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+hg_uint32_t
+hg_checksum_crc32c(hg_uint32_t crc, const void *buf, hg_size_t buf_size)
+{
+    hg_checksum_init();
+
+    return hg_checksum_crc32c_cb_g(crc, (const unsigned char *) buf,
+        buf_size);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_checksum_crc32c_is_accelerated(void)
+{
+    hg_checksum_init();
+
+#ifdef HG_CHECKSUM_HAS_SSE42
+    return (hg_bool_t) (hg_checksum_crc32c_cb_g == hg_checksum_crc32c_sse42);
+#else
+    return HG_FALSE;
+#endif
+}
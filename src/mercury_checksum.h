@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_CHECKSUM_H
+#define MERCURY_CHECKSUM_H
+
+#include "mercury_types.h"
+
+/*************************************/
+/* Public Type and Struct Definition */
+/*************************************/
+
+/*****************/
+/* Public Macros */
+/*****************/
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Compute CRC32C (Castagnoli) of buffer in a single pass. Uses the SSE4.2
+ * crc32 instruction when the CPU supports it (three interleaved streams on
+ * large buffers), otherwise falls back to a table-driven (slicing-by-8)
+ * implementation. Both paths produce the same value.
+ *
+ * \param crc [IN]              CRC of previous data (0 to start a new one)
+ * \param buf [IN]              pointer to data
+ * \param buf_size [IN]         data size
+ *
+ * \return Updated CRC
+ */
+HG_EXPORT hg_uint32_t
+hg_checksum_crc32c(
+        hg_uint32_t crc,
+        const void *buf,
+        hg_size_t buf_size
+        );
+
+/**
+ * Indicate whether hg_checksum_crc32c() is hardware accelerated.
+ *
+ * \return HG_TRUE if accelerated or HG_FALSE otherwise
+ */
+HG_EXPORT hg_bool_t
+hg_checksum_crc32c_is_accelerated(
+        void
+        );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_CHECKSUM_H */
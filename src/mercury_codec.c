@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_codec.h"
+
+#include <string.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* LZ parameters (LZ4 block format) */
+#define HG_CODEC_LZ_MIN_MATCH       4
+#define HG_CODEC_LZ_MAX_OFFSET      65535
+#define HG_CODEC_LZ_LAST_LITERALS   5   /* Last bytes are always literals */
+#define HG_CODEC_LZ_MF_LIMIT        12  /* No match starts in last bytes */
+#define HG_CODEC_LZ_HASH_BITS       12
+#define HG_CODEC_LZ_SKIP_TRIGGER    6   /* Speed up on incompressible data */
+#define HG_CODEC_LZ_RUN_MASK        15
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Pass-through bound.
+ */
+static hg_size_t
+hg_codec_none_bound(
+        hg_size_t src_size
+        );
+
+/**
+ * Pass-through copy.
+ */
+static hg_return_t
+hg_codec_none_copy(
+        const void *src,
+        hg_size_t src_size,
+        void *dest,
+        hg_size_t *dest_size
+        );
+
+/**
+ * Read 32-bit value from unaligned pointer.
+ */
+static HG_INLINE hg_uint32_t
+hg_codec_lz_read32(
+        const unsigned char *ptr
+        );
+
+/**
+ * Hash sequence of 4 bytes.
+ */
+static HG_INLINE hg_uint32_t
+hg_codec_lz_hash(
+        hg_uint32_t sequence
+        );
+
+/**
+ * Write extended length.
+ */
+static HG_INLINE unsigned char *
+hg_codec_lz_write_len(
+        unsigned char *op,
+        hg_size_t len
+        );
+
+/**
+ * Read extended length.
+ */
+static HG_INLINE hg_return_t
+hg_codec_lz_read_len(
+        const unsigned char **ip_ptr,
+        const unsigned char *ip_end,
+        hg_size_t *len
+        );
+
+/**
+ * Emit sequence of literals followed by match (no match if match_len is 0).
+ */
+static HG_INLINE hg_return_t
+hg_codec_lz_emit(
+        unsigned char **op_ptr,
+        const unsigned char *op_end,
+        const unsigned char *literals,
+        hg_size_t literal_len,
+        hg_uint32_t offset,
+        hg_size_t match_len
+        );
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+static const struct hg_codec hg_codec_none_g = {
+    "none",
+    hg_codec_none_bound,
+    hg_codec_none_copy,
+    hg_codec_none_copy
+};
+
+static const struct hg_codec hg_codec_lz_g = {
+    "lz",
+    hg_codec_lz_bound,
+    hg_codec_lz_encode,
+    hg_codec_lz_decode
+};
+
+/*---------------------------------------------------------------------------*/
+static hg_size_t
+hg_codec_none_bound(hg_size_t src_size)
+{
+    return src_size;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_codec_none_copy(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size)
+{
+    if (*dest_size < src_size)
+        return HG_SIZE_ERROR;
+
+    memcpy(dest, src, src_size);
+    *dest_size = src_size;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_uint32_t
+hg_codec_lz_read32(const unsigned char *ptr)
+{
+    hg_uint32_t value;
+
+    memcpy(&value, ptr, sizeof(value));
+
+    return value;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_uint32_t
+hg_codec_lz_hash(hg_uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - HG_CODEC_LZ_HASH_BITS);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned char *
+hg_codec_lz_write_len(unsigned char *op, hg_size_t len)
+{
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (unsigned char) len;
+
+    return op;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_codec_lz_read_len(const unsigned char **ip_ptr, const unsigned char *ip_end,
+    hg_size_t *len)
+{
+    const unsigned char *ip = *ip_ptr;
+    unsigned char byte;
+
+    do {
+        if (ip == ip_end)
+            return HG_PROTOCOL_ERROR;
+        byte = *ip++;
+        *len += byte;
+    } while (byte == 255);
+    *ip_ptr = ip;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_codec_lz_emit(unsigned char **op_ptr, const unsigned char *op_end,
+    const unsigned char *literals, hg_size_t literal_len, hg_uint32_t offset,
+    hg_size_t match_len)
+{
+    unsigned char *op = *op_ptr, *token;
+
+    /* Token, literal length, literals, offset and match length */
+    if ((hg_size_t) (op_end - op) < 1 + literal_len / 255 + 1 + literal_len
+        + 2 + match_len / 255 + 1)
+        return HG_SIZE_ERROR;
+
+    token = op++;
+    if (literal_len >= HG_CODEC_LZ_RUN_MASK) {
+        *token = HG_CODEC_LZ_RUN_MASK << 4;
+        op = hg_codec_lz_write_len(op, literal_len - HG_CODEC_LZ_RUN_MASK);
+    } else
+        *token = (unsigned char) (literal_len << 4);
+    memcpy(op, literals, literal_len);
+    op += literal_len;
+
+    if (match_len) {
+        hg_size_t len = match_len - HG_CODEC_LZ_MIN_MATCH;
+
+        *op++ = (unsigned char) (offset & 0xff);
+        *op++ = (unsigned char) (offset >> 8);
+        if (len >= HG_CODEC_LZ_RUN_MASK) {
+            *token |= HG_CODEC_LZ_RUN_MASK;
+            op = hg_codec_lz_write_len(op, len - HG_CODEC_LZ_RUN_MASK);
+        } else
+            *token |= (unsigned char) len;
+    }
+    *op_ptr = op;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+const struct hg_codec *
+hg_codec_get_builtin(hg_uint8_t codec_id)
+{
+    switch (codec_id) {
+        case HG_CODEC_NONE:
+            return &hg_codec_none_g;
+        case HG_CODEC_LZ:
+            return &hg_codec_lz_g;
+        default:
+            return NULL;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+hg_size_t
+hg_codec_lz_bound(hg_size_t src_size)
+{
+    return src_size + src_size / 255 + 16;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_codec_lz_encode(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size)
+{
+    const unsigned char *in = (const unsigned char *) src;
+    unsigned char *op = (unsigned char *) dest;
+    const unsigned char *op_end = op + *dest_size;
+    hg_uint32_t table[1 << HG_CODEC_LZ_HASH_BITS];
+    hg_size_t match_limit = (src_size > HG_CODEC_LZ_MF_LIMIT) ?
+        src_size - HG_CODEC_LZ_MF_LIMIT : 0;
+    hg_size_t ip = 0, anchor = 0;
+    hg_return_t ret;
+
+    /* Positions are stored modulo 2^32, candidates are always checked */
+    memset(table, 0, sizeof(table));
+
+    while (ip < match_limit) {
+        hg_uint32_t sequence = hg_codec_lz_read32(in + ip);
+        hg_uint32_t hash = hg_codec_lz_hash(sequence);
+        hg_uint32_t offset = (hg_uint32_t) ip - table[hash];
+        hg_size_t match_len = HG_CODEC_LZ_MIN_MATCH;
+
+        table[hash] = (hg_uint32_t) ip;
+        if (offset == 0 || offset > HG_CODEC_LZ_MAX_OFFSET || offset > ip
+            || hg_codec_lz_read32(in + ip - offset) != sequence) {
+            ip += 1 + ((ip - anchor) >> HG_CODEC_LZ_SKIP_TRIGGER);
+            continue;
+        }
+
+        /* Extend match */
+        while (ip + match_len < src_size - HG_CODEC_LZ_LAST_LITERALS
+            && in[ip + match_len] == in[ip - offset + match_len])
+            match_len++;
+
+        ret = hg_codec_lz_emit(&op, op_end, in + anchor, ip - anchor, offset,
+            match_len);
+        if (ret != HG_SUCCESS)
+            return ret;
+        ip += match_len;
+        anchor = ip;
+    }
+
+    /* Last literals */
+    ret = hg_codec_lz_emit(&op, op_end, in + anchor, src_size - anchor, 0, 0);
+    if (ret != HG_SUCCESS)
+        return ret;
+    *dest_size = (hg_size_t) (op - (unsigned char *) dest);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_codec_lz_decode(const void *src, hg_size_t src_size, void *dest,
+    hg_size_t *dest_size)
+{
+    const unsigned char *ip = (const unsigned char *) src;
+    const unsigned char *ip_end = ip + src_size;
+    unsigned char *op = (unsigned char *) dest;
+    const unsigned char *op_start = op, *op_end = op + *dest_size;
+
+    while (ip < ip_end) {
+        unsigned int token = *ip++;
+        hg_size_t len = token >> 4, offset;
+        const unsigned char *match;
+
+        /* Literals */
+        if (len == HG_CODEC_LZ_RUN_MASK
+            && hg_codec_lz_read_len(&ip, ip_end, &len) != HG_SUCCESS)
+            return HG_PROTOCOL_ERROR;
+        if ((hg_size_t) (ip_end - ip) < len)
+            return HG_PROTOCOL_ERROR;
+        if ((hg_size_t) (op_end - op) < len)
+            return HG_SIZE_ERROR;
+        memcpy(op, ip, len);
+        ip += len;
+        op += len;
+
+        /* Last sequence has no match */
+        if (ip == ip_end)
+            break;
+
+        /* Match */
+        if (ip_end - ip < 2)
+            return HG_PROTOCOL_ERROR;
+        offset = (hg_size_t) ip[0] | ((hg_size_t) ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (hg_size_t) (op - op_start))
+            return HG_PROTOCOL_ERROR;
+        len = token & HG_CODEC_LZ_RUN_MASK;
+        if (len == HG_CODEC_LZ_RUN_MASK
+            && hg_codec_lz_read_len(&ip, ip_end, &len) != HG_SUCCESS)
+            return HG_PROTOCOL_ERROR;
+        len += HG_CODEC_LZ_MIN_MATCH;
+        if ((hg_size_t) (op_end - op) < len)
+            return HG_SIZE_ERROR;
+
+        match = op - offset;
+        if (offset >= len)
+            memcpy(op, match, len);
+        else {
+            /* Overlapping copy (repeated pattern) */
+            hg_size_t i;
+
+            for (i = 0; i < len; i++)
+                op[i] = match[i];
+        }
+        op += len;
+    }
+    *dest_size = (hg_size_t) (op - op_start);
+
+    return HG_SUCCESS;
+}
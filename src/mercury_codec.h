@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_CODEC_H
+#define MERCURY_CODEC_H
+
+#include "mercury_types.h"
+
+/*************************************/
+/* Public Type and Struct Definition */
+/*************************************/
+
+/* Codec used to compress RPC payloads (see HG_Registered_set_codec()).
+ * encode() / decode() are passed the capacity of dest in dest_size and
+ * return the number of bytes written to dest in dest_size. */
+struct hg_codec {
+    const char *name;                   /* Codec name */
+    hg_size_t (*bound)(hg_size_t src_size); /* Max encoded size */
+    hg_return_t (*encode)(const void *src, hg_size_t src_size, void *dest,
+        hg_size_t *dest_size);          /* Encode (compress) */
+    hg_return_t (*decode)(const void *src, hg_size_t src_size, void *dest,
+        hg_size_t *dest_size);          /* Decode (decompress) */
+};
+
+/*****************/
+/* Public Macros */
+/*****************/
+
+/* Codec IDs, IDs are sent along with payloads and must therefore refer to
+ * the same codec on origin and target */
+#define HG_CODEC_NONE   0   /* Pass-through */
+#define HG_CODEC_LZ     1   /* Built-in LZ codec */
+#define HG_CODEC_MAX    16  /* Max number of codecs */
+
+/* Max ratio between decoded and encoded payload sizes (bound of the LZ4 block
+ * format), payloads announcing a larger decoded size are rejected */
+#define HG_CODEC_RATIO_MAX  255
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Get built-in codec.
+ *
+ * \param codec_id [IN]         codec ID (HG_CODEC_NONE or HG_CODEC_LZ)
+ *
+ * \return Pointer to codec or NULL if codec_id is not a built-in codec
+ */
+HG_EXPORT const struct hg_codec *
+hg_codec_get_builtin(
+        hg_uint8_t codec_id
+        );
+
+/**
+ * Compress buffer using the built-in LZ codec. This is a byte-oriented
+ * LZ77 variant (LZ4 block format) that favors speed over ratio, input that
+ * does not compress expands by at most hg_codec_lz_bound() bytes.
+ *
+ * \param src [IN]              pointer to data
+ * \param src_size [IN]         data size
+ * \param dest [OUT]            pointer to destination buffer
+ * \param dest_size [IN/OUT]    destination buffer size / compressed size
+ *
+ * \return HG_SUCCESS or HG_SIZE_ERROR if dest is too small
+ */
+HG_EXPORT hg_return_t
+hg_codec_lz_encode(
+        const void *src,
+        hg_size_t src_size,
+        void *dest,
+        hg_size_t *dest_size
+        );
+
+/**
+ * Decompress buffer compressed with hg_codec_lz_encode().
+ *
+ * \param src [IN]              pointer to compressed data
+ * \param src_size [IN]         compressed data size
+ * \param dest [OUT]            pointer to destination buffer
+ * \param dest_size [IN/OUT]    destination buffer size / decompressed size
+ *
+ * \return HG_SUCCESS or HG_SIZE_ERROR / HG_PROTOCOL_ERROR if dest is too
+ * small or if data is malformed
+ */
+HG_EXPORT hg_return_t
+hg_codec_lz_decode(
+        const void *src,
+        hg_size_t src_size,
+        void *dest,
+        hg_size_t *dest_size
+        );
+
+/**
+ * Max size of data compressed with hg_codec_lz_encode().
+ *
+ * \param src_size [IN]         data size
+ *
+ * \return Size
+ */
+HG_EXPORT hg_size_t
+hg_codec_lz_bound(
+        hg_size_t src_size
+        );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_CODEC_H */
@@ -12,17 +12,18 @@
 #include "mercury_private.h"
 
 #include "mercury_atomic_queue.h"
-#ifdef HG_HAS_SELF_FORWARD
 #include "mercury_event.h"
-#endif
+#include "mercury_hash_string.h"
 #include "mercury_hash_table.h"
 #include "mercury_list.h"
 #include "mercury_mem.h"
+#include "mercury_mem_copy.h"
 #include "mercury_poll.h"
 #include "mercury_queue.h"
 #include "mercury_thread_condition.h"
 #include "mercury_thread_mutex.h"
 #include "mercury_thread_pool.h"
+#include "mercury_thread_rwlock.h"
 #include "mercury_thread_spin.h"
 #include "mercury_time.h"
 
@@ -37,12 +38,20 @@
 /* Local Macros */
 /****************/
 
-#define HG_CORE_MAX_SELF_THREADS    4
 #define HG_CORE_MASK_NBITS          8
+#define HG_CORE_TAG_MIN_NBITS       16
+#define HG_CORE_TAG_MAX_NBITS       31
+#ifdef HG_HAS_TAG_CHECK
+# define HG_CORE_TAG_CHECK_RETRIES  16
+#endif
 #define HG_CORE_ATOMIC_QUEUE_SIZE   1024
 #define HG_CORE_PENDING_INCR        256
 #define HG_CORE_PROCESSING_TIMEOUT  1000
 #define HG_CORE_MAX_TRIGGER_COUNT   1
+#define HG_CORE_MAX_CONTEXTS        256 /* Context IDs are 8-bit */
+#define HG_CORE_MAX_RAILS           16
+#define HG_CORE_RAIL_CHUNK_SIZE_DEFAULT (1 << 20)
+#define HG_CORE_RAIL_PROGRESS_TIMEOUT 1 /* ms */
 #ifdef HG_HAS_SM_ROUTING
 # define HG_CORE_UUID_MAX_LEN       36
 # define HG_CORE_ADDR_MAX_SIZE      256
@@ -94,15 +103,35 @@ struct hg_core_private_class {
 #endif
     hg_hash_table_t *func_map;          /* Function map */
     hg_thread_spin_t func_map_lock;     /* Function map mutex */
-    hg_atomic_int32_t request_tag;      /* Atomic used for tag generation */
     na_tag_t request_max_tag;           /* Max value for tag */
+    na_tag_t request_tag_mask;          /* Mask applied to per-context tags */
+    unsigned int request_tag_shift;     /* Number of bits used by context index */
+    hg_atomic_int32_t context_index;    /* Atomic used for context indices */
+    hg_atomic_int32_t request_tag;      /* Tags of contexts without own index */
     hg_bool_t na_ext_init;              /* NA externally initialized */
     na_progress_mode_t progress_mode;   /* NA progress mode */
+#ifdef HG_HAS_SELF_FORWARD
+    hg_bool_t self_inline;              /* Execute self RPCs inline */
+#endif
+    struct hg_executor executor;        /* Default RPC executor */
+    hg_thread_pool_t *executor_pool;    /* Built-in executor pool */
+    hg_bool_t mem_copy;                 /* Local copy engine initialized */
+    unsigned int rail_context_base;     /* NA context ID of first rail */
+    struct hg_core_private_context *steer_contexts[HG_CORE_MAX_CONTEXTS]; /* Steering targets indexed by context ID */
+    struct hg_core_private_context *share_contexts[HG_CORE_MAX_CONTEXTS]; /* Contexts sharing work */
+    unsigned int n_share_contexts;      /* Number of contexts sharing work */
+    hg_thread_rwlock_t steer_lock;      /* Steering lock */
+    hg_atomic_int32_t n_steer_contexts; /* Number of steering contexts */
+    hg_atomic_int32_t share_index;      /* Round-robin index for sharing */
 #ifdef HG_HAS_COLLECT_STATS
     hg_bool_t stats;                    /* (Debug) Print stats at exit */
 #endif
     hg_atomic_int32_t n_contexts;       /* Atomic used for number of contexts */
     hg_atomic_int32_t n_addrs;          /* Atomic used for number of addrs */
+    hg_hash_table_t *addr_cache;        /* Lookup cache (name -> addr) */
+    hg_thread_spin_t addr_cache_lock;   /* Lookup cache lock */
+    unsigned int addr_cache_size;       /* Max number of cached addrs */
+    unsigned long addr_cache_clock;     /* Lookup cache use counter */
 
     /* Callbacks */
     hg_return_t (*more_data_acquire)(hg_core_handle_t, hg_op_t,
@@ -129,15 +158,27 @@ struct hg_core_private_context {
     HG_LIST_HEAD(hg_core_private_handle) sm_pending_list; /* List of SM pending handles */
     hg_thread_spin_t sm_pending_list_lock;      /* SM pending list lock */
 #endif
+#ifdef HG_HAS_HANDLE_TRACKING
     HG_LIST_HEAD(hg_core_private_handle) created_list;  /* List of handles for that context */
     hg_thread_spin_t created_list_lock;         /* Handle list lock */
-#ifdef HG_HAS_SELF_FORWARD
-    int completion_queue_notify;                /* Self notification */
 #endif
+    int completion_queue_notify;                /* Self notification */
     hg_return_t (*handle_create)(hg_core_handle_t, void *); /* handle_create */
     void *handle_create_arg;                    /* handle_create arg */
     hg_bool_t finalizing;                       /* Prevent reposts */
     hg_atomic_int32_t n_handles;                /* Atomic used for number of handles */
+    hg_atomic_int32_t request_tag;              /* Atomic used for tag generation */
+    hg_atomic_int32_t *request_tag_counter;     /* Own or class-wide counter */
+    na_tag_t request_tag_index;                 /* Context index folded into tags */
+    hg_bool_t steering;                         /* Registered for steering */
+    unsigned int share_threshold;               /* Queue depth above which work is shared */
+    hg_atomic_int32_t rpc_count;                /* Number of RPCs queued */
+    hg_atomic_int32_t rpc_steered_count;        /* Number of RPCs steered here */
+    hg_atomic_int32_t rpc_shared_count;         /* Number of RPCs shared here */
+#ifdef HG_HAS_TAG_CHECK
+    hg_hash_table_t *tag_map;                   /* (Debug) Outstanding tags */
+    hg_thread_spin_t tag_map_lock;              /* (Debug) Tag map lock */
+#endif
 };
 
 #ifdef HG_HAS_SELF_FORWARD
@@ -158,6 +199,14 @@ struct hg_core_private_addr {
 #endif
     hg_bool_t is_mine;                  /* Created internally or not */
     hg_atomic_int32_t ref_count;        /* Reference count */
+    char *cache_name;                   /* Key in lookup cache (if cached) */
+    unsigned long cache_stamp;          /* Last use of cache entry */
+};
+
+/* HG core RPC registration info */
+struct hg_core_private_rpc_info {
+    struct hg_core_rpc_info core_rpc_info;  /* Must remain as first field */
+    struct hg_executor executor;            /* RPC executor */
 };
 
 /* HG core op type */
@@ -184,10 +233,14 @@ struct hg_core_private_handle {
     hg_core_op_type_t op_type;          /* Core operation type */
     na_tag_t tag;                       /* Tag used for request and response */
     hg_uint8_t cookie;                  /* Cookie */
+    hg_uint8_t target_id;               /* Target context ID (steering) */
     hg_return_t ret;                    /* Return code associated to handle */
+#ifdef HG_HAS_HANDLE_TRACKING
     HG_LIST_ENTRY(hg_core_private_handle) created;  /* Created list entry */
+#endif
     HG_LIST_ENTRY(hg_core_private_handle) pending;  /* Pending list entry */
     struct hg_completion_entry hg_completion_entry; /* Entry in completion queue */
+    struct hg_thread_work thread_work;  /* Work item posted to executor */
     hg_bool_t repost;                   /* Repost handle on completion (listen) */
     hg_bool_t is_self;                  /* Self processed */
     hg_atomic_int32_t in_use;           /* Is in use */
@@ -228,6 +281,13 @@ struct hg_core_private_handle {
 struct hg_core_op_info_lookup {
     struct hg_core_private_addr *hg_core_addr; /* Address */
     na_op_id_t na_lookup_op_id;         /* Operation ID for lookup */
+    char *name;                         /* Name to cache address under */
+    struct hg_core_op_id *parent;       /* Multi lookup that lookup is part of */
+    struct hg_core_op_id *children;     /* Lookups of multi lookup */
+    hg_core_addr_t *addrs;              /* Addresses of multi lookup */
+    unsigned int index;                 /* Index in multi lookup / count */
+    hg_atomic_int32_t n_remaining;      /* Lookups remaining in multi lookup */
+    hg_return_t ret;                    /* Return value of multi lookup */
 };
 
 struct hg_core_op_id {
@@ -286,8 +346,43 @@ hg_core_func_map_value_free(
  */
 static HG_INLINE na_tag_t
 hg_core_gen_request_tag(
-        struct hg_core_private_class *hg_core_class
+        struct hg_core_private_context *context
+        );
+
+#ifdef HG_HAS_TAG_CHECK
+/**
+ * Equal function for tag map.
+ */
+static HG_INLINE int
+hg_core_tag_equal(
+        void *vlocation1,
+        void *vlocation2
+        );
+
+/**
+ * Hash function for tag map.
+ */
+static HG_INLINE unsigned int
+hg_core_tag_hash(
+        void *vlocation
+        );
+
+/**
+ * Generate a new tag that does not collide with an outstanding tag.
+ */
+static hg_return_t
+hg_core_tag_acquire(
+        struct hg_core_private_handle *hg_core_handle
+        );
+
+/**
+ * Release tag of completed request.
+ */
+static void
+hg_core_tag_release(
+        struct hg_core_private_handle *hg_core_handle
         );
+#endif
 
 /**
  * Proc request header and verify it if decoded.
@@ -328,7 +423,7 @@ hg_core_sm_pending_list_cancel(
 #endif
 
 /**
- * Wail until handle list is empty.
+ * Wait until all handles created on context have been destroyed.
  */
 static hg_return_t
 hg_core_created_list_wait(
@@ -374,6 +469,40 @@ hg_core_addr_lookup(
         hg_core_op_id_t *op_id
         );
 
+/**
+ * Start lookup of name using already allocated operation ID.
+ */
+static hg_return_t
+hg_core_addr_lookup_start(
+        struct hg_core_private_context *context,
+        struct hg_core_op_id *hg_core_op_id,
+        const char *name
+        );
+
+/**
+ * Lookup multiple addrs concurrently.
+ */
+static hg_return_t
+hg_core_addr_lookup_multi(
+        struct hg_core_private_context *context,
+        hg_core_cb_t callback,
+        void *arg,
+        const char **names,
+        hg_core_addr_t *addrs,
+        unsigned int count,
+        hg_core_op_id_t *op_id
+        );
+
+/**
+ * Complete one lookup of multi lookup and complete multi lookup once all
+ * of its lookups have completed.
+ */
+static hg_return_t
+hg_core_addr_lookup_multi_complete(
+        struct hg_core_op_id *hg_core_op_id,
+        hg_return_t ret
+        );
+
 /**
  * Lookup callback.
  */
@@ -399,6 +528,43 @@ hg_core_addr_free(
         struct hg_core_private_addr *hg_core_addr
         );
 
+/**
+ * Get address from lookup cache and take a reference to it.
+ */
+static struct hg_core_private_addr *
+hg_core_addr_cache_get(
+        struct hg_core_private_class *hg_core_class,
+        const char *name
+        );
+
+/**
+ * Add looked up address to cache, evicting the least recently used
+ * address that is no longer referenced if the cache is full.
+ */
+static void
+hg_core_addr_cache_add(
+        struct hg_core_private_class *hg_core_class,
+        const char *name,
+        struct hg_core_private_addr *hg_core_addr
+        );
+
+/**
+ * Remove address from lookup cache.
+ */
+static void
+hg_core_addr_cache_remove(
+        struct hg_core_private_class *hg_core_class,
+        struct hg_core_private_addr *hg_core_addr
+        );
+
+/**
+ * Release all addresses from lookup cache.
+ */
+static void
+hg_core_addr_cache_flush(
+        struct hg_core_private_class *hg_core_class
+        );
+
 /**
  * Self addr.
  */
@@ -653,6 +819,35 @@ hg_core_complete(
         hg_core_handle_t handle
         );
 
+/**
+ * Steer received RPC to the context matching its target ID, sharing it with
+ * the least loaded steering context if that one is too busy. Only the trigger
+ * moves: the handle still belongs to the receiving context, whose NA context
+ * the request arrived on, so the response is sent and the handle reposted
+ * there (trigger_only contexts post no receives of their own).
+ */
+static hg_return_t
+hg_core_steer(
+        struct hg_core_private_handle *hg_core_handle,
+        hg_bool_t *steered
+        );
+
+/**
+ * Get number of entries currently in completion queue.
+ */
+static HG_INLINE unsigned int
+hg_core_completion_count(
+        struct hg_core_private_context *context
+        );
+
+/**
+ * Unregister context from steering.
+ */
+static void
+hg_core_steering_remove(
+        struct hg_core_private_context *context
+        );
+
 /**
  * Add entry to completion queue.
  */
@@ -699,7 +894,25 @@ hg_core_progress_na(
         unsigned int timeout
         );
 
-#ifdef HG_HAS_SELF_FORWARD
+/**
+ * Make progress on NA contexts of rails and trigger their callbacks.
+ */
+static hg_return_t
+hg_core_progress_na_rails(
+        struct hg_core_private_context *context,
+        unsigned int *completed_count
+        );
+
+/**
+ * Get poll fd of rail if it must be added to poll set of context, rails of
+ * plugins that progress all NA contexts together share fd with first rail.
+ */
+static int
+hg_core_rail_poll_fd(
+        struct hg_core_private_context *context,
+        unsigned int rail
+        );
+
 /**
  * Completion queue notification callback.
  */
@@ -709,7 +922,6 @@ hg_core_completion_queue_notify_cb(
         int error,
         hg_util_bool_t *progressed
         );
-#endif
 
 /**
  * Progress callback on NA layer when hg_core_progress_poll() is used.
@@ -777,6 +989,49 @@ hg_core_trigger_entry(
         struct hg_core_private_handle *hg_core_handle
         );
 
+/**
+ * Repost or destroy handle once its callback has been triggered.
+ */
+static hg_return_t
+hg_core_trigger_release(
+        struct hg_core_private_handle *hg_core_handle
+        );
+
+/**
+ * Look up RPC info of handle and copy the executor that must be used for
+ * running its RPC callback (returns HG_FALSE if callback runs from trigger).
+ */
+static HG_INLINE hg_bool_t
+hg_core_get_executor(
+        struct hg_core_private_handle *hg_core_handle,
+        struct hg_executor *executor
+        );
+
+/**
+ * Run RPC callback and send response if callback failed.
+ */
+static hg_return_t
+hg_core_process_run(
+        struct hg_core_private_handle *hg_core_handle
+        );
+
+/**
+ * Work item function used for running RPC callbacks from an executor.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_core_process_thread(
+        void *arg
+        );
+
+/**
+ * Post function of built-in executor.
+ */
+static int
+hg_core_executor_pool_post(
+        void *arg,
+        struct hg_thread_work *work
+        );
+
 /**
  * Trigger callback from HG bulk op ID.
  */
@@ -810,6 +1065,7 @@ static hg_bool_t hg_core_print_stats_registered_g = HG_FALSE;
 static hg_core_stat_t hg_core_rpc_count_g = HG_CORE_STAT_INIT(0);
 static hg_core_stat_t hg_core_rpc_extra_count_g = HG_CORE_STAT_INIT(0);
 static hg_core_stat_t hg_core_bulk_count_g = HG_CORE_STAT_INIT(0);
+static hg_core_stat_t hg_core_addr_cache_hit_count_g = HG_CORE_STAT_INIT(0);
 #endif
 
 /*---------------------------------------------------------------------------*/
@@ -826,6 +1082,8 @@ hg_core_print_stats(void)
         (unsigned long) hg_core_stat_get(&hg_core_rpc_extra_count_g));
     printf("Bulk transfer count:  %lu\n",
         (unsigned long) hg_core_stat_get(&hg_core_bulk_count_g));
+    printf("Addr cache hits:      %lu\n",
+        (unsigned long) hg_core_stat_get(&hg_core_addr_cache_hit_count_g));
 }
 #endif
 
@@ -880,6 +1138,20 @@ hg_core_int_hash(void *vlocation)
     return *((unsigned int *) vlocation);
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE int
+hg_core_string_equal(void *vlocation1, void *vlocation2)
+{
+    return strcmp((const char *) vlocation1, (const char *) vlocation2) == 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_core_string_hash(void *vlocation)
+{
+    return hg_hash_string((const char *) vlocation);
+}
+
 /*---------------------------------------------------------------------------*/
 static void
 hg_core_func_map_value_free(hg_hash_table_value_t value)
@@ -893,19 +1165,89 @@ hg_core_func_map_value_free(hg_hash_table_value_t value)
 
 /*---------------------------------------------------------------------------*/
 static HG_INLINE na_tag_t
-hg_core_gen_request_tag(struct hg_core_private_class *hg_core_class)
+hg_core_gen_request_tag(struct hg_core_private_context *context)
+{
+    struct hg_core_private_class *hg_core_class = HG_CORE_CONTEXT_CLASS(context);
+    na_tag_t request_tag;
+
+    /* Contexts whose index fits into the tag own their counter, others share
+     * the class counter, wrap around is done by masking the counter so that
+     * no compare and swap is needed, the context index is then folded into
+     * the low bits of the tag */
+    request_tag = (na_tag_t) hg_atomic_incr32(context->request_tag_counter)
+        & hg_core_class->request_tag_mask;
+
+    return (request_tag << hg_core_class->request_tag_shift)
+        | context->request_tag_index;
+}
+
+#ifdef HG_HAS_TAG_CHECK
+/*---------------------------------------------------------------------------*/
+static HG_INLINE int
+hg_core_tag_equal(void *vlocation1, void *vlocation2)
+{
+    return vlocation1 == vlocation2;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_core_tag_hash(void *vlocation)
+{
+    return (unsigned int) (hg_ptr_t) vlocation;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_tag_acquire(struct hg_core_private_handle *hg_core_handle)
 {
-    na_tag_t request_tag = 0;
+    struct hg_core_private_context *context =
+        HG_CORE_HANDLE_CONTEXT(hg_core_handle);
+    unsigned int retries = 0;
+    hg_return_t ret = HG_SUCCESS;
 
-    /* Compare and swap tag if reached max tag */
-    if (!hg_atomic_cas32(&hg_core_class->request_tag,
-        (hg_util_int32_t) hg_core_class->request_max_tag, 0)) {
-        /* Increment tag */
-        request_tag = (na_tag_t) hg_atomic_incr32(&hg_core_class->request_tag);
+    hg_thread_spin_lock(&context->tag_map_lock);
+    /* Skip tags that are still used by outstanding requests */
+    while (hg_hash_table_lookup(context->tag_map,
+        (hg_hash_table_key_t) (hg_ptr_t) hg_core_handle->tag)
+        != HG_HASH_TABLE_NULL) {
+        HG_LOG_WARNING("Tag %u is still in use by an outstanding request",
+            hg_core_handle->tag);
+        if (++retries > HG_CORE_TAG_CHECK_RETRIES) {
+            HG_LOG_ERROR("Could not find unused tag");
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+        hg_core_handle->tag = hg_core_gen_request_tag(context);
+    }
+    if (!hg_hash_table_insert(context->tag_map,
+        (hg_hash_table_key_t) (hg_ptr_t) hg_core_handle->tag,
+        (hg_hash_table_value_t) hg_core_handle)) {
+        HG_LOG_ERROR("Could not insert tag into tag map");
+        ret = HG_NOMEM_ERROR;
+        goto done;
     }
 
-    return request_tag;
+done:
+    hg_thread_spin_unlock(&context->tag_map_lock);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_tag_release(struct hg_core_private_handle *hg_core_handle)
+{
+    struct hg_core_private_context *context =
+        HG_CORE_HANDLE_CONTEXT(hg_core_handle);
+
+    hg_thread_spin_lock(&context->tag_map_lock);
+    if (hg_hash_table_lookup(context->tag_map,
+        (hg_hash_table_key_t) (hg_ptr_t) hg_core_handle->tag)
+        == (hg_hash_table_value_t) hg_core_handle)
+        hg_hash_table_remove(context->tag_map,
+            (hg_hash_table_key_t) (hg_ptr_t) hg_core_handle->tag);
+    hg_thread_spin_unlock(&context->tag_map_lock);
 }
+#endif
 
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_return_t
@@ -1033,7 +1375,6 @@ hg_core_sm_pending_list_cancel(struct hg_core_private_context *context)
 static hg_return_t
 hg_core_created_list_wait(struct hg_core_private_context *context)
 {
-    hg_util_bool_t created_list_empty = HG_UTIL_FALSE;
     /* Convert timeout in ms into seconds */
     double remaining = HG_CORE_PROCESSING_TIMEOUT / 1000.0;
     hg_return_t ret = HG_SUCCESS;
@@ -1050,11 +1391,8 @@ hg_core_created_list_wait(struct hg_core_private_context *context)
             trigger_ret = hg_core_trigger(context, 0, 1, &actual_count);
         } while ((trigger_ret == HG_SUCCESS) && actual_count);
 
-        hg_thread_spin_lock(&context->created_list_lock);
-        created_list_empty = HG_LIST_IS_EMPTY(&context->created_list);
-        hg_thread_spin_unlock(&context->created_list_lock);
-
-        if (created_list_empty)
+        /* Handles are counted whether they are tracked or not */
+        if (hg_atomic_get32(&context->n_handles) == 0)
             break;
 
         ret = context->progress(context, (unsigned int) (remaining * 1000.0));
@@ -1077,6 +1415,7 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
 {
     struct hg_core_private_class *hg_core_class = NULL;
     na_tag_t na_max_tag;
+    unsigned int tag_nbits;
 #ifdef HG_HAS_SM_ROUTING
     na_tag_t na_sm_max_tag;
     hg_bool_t auto_sm = HG_FALSE;
@@ -1092,6 +1431,9 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
         goto done;
     }
     memset(hg_core_class, 0, sizeof(struct hg_core_private_class));
+    hg_core_class->core_class.na_rail_count = 1;
+    hg_core_class->core_class.na_rail_chunk_size =
+        HG_CORE_RAIL_CHUNK_SIZE_DEFAULT;
 
     /* Parse options */
     if (hg_init_info) {
@@ -1101,6 +1443,14 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
             hg_core_class->na_ext_init = HG_TRUE;
         }
         hg_core_class->progress_mode = hg_init_info->na_init_info.progress_mode;
+#ifdef HG_HAS_SELF_FORWARD
+        hg_core_class->self_inline = hg_init_info->self_inline;
+#else
+        if (hg_init_info->self_inline) {
+            HG_LOG_WARNING("Inline self execution requested but not enabled, "
+                "please turn ON MERCURY_USE_SELF_FORWARD in CMake options");
+        }
+#endif
 #ifdef HG_HAS_SM_ROUTING
         auto_sm = hg_init_info->auto_sm;
 #else
@@ -1109,6 +1459,44 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
                 "please turn ON MERCURY_USE_SM_ROUTING in CMake options");
         }
 #endif
+        hg_core_class->executor = hg_init_info->executor;
+        hg_core_class->addr_cache_size = hg_init_info->addr_cache_size;
+        if (!hg_core_class->executor.post && hg_init_info->executor_threads) {
+            /* Create built-in executor */
+            if (hg_thread_pool_init(hg_init_info->executor_threads,
+                &hg_core_class->executor_pool) != HG_UTIL_SUCCESS) {
+                HG_LOG_ERROR("Could not create executor thread pool");
+                ret = HG_NOMEM_ERROR;
+                goto done;
+            }
+            hg_core_class->executor.post = hg_core_executor_pool_post;
+            hg_core_class->executor.arg = hg_core_class->executor_pool;
+        }
+        if (hg_init_info->copy_threads > 1 || hg_init_info->copy_nt_size) {
+            /* Configure process-wide local copy engine */
+            if (hg_mem_copy_init(hg_init_info->copy_threads,
+                (size_t) hg_init_info->copy_nt_size) != HG_UTIL_SUCCESS) {
+                HG_LOG_ERROR("Could not initialize local copy engine");
+                ret = HG_NOMEM_ERROR;
+                goto done;
+            }
+            hg_core_class->mem_copy = HG_TRUE;
+        }
+        if (hg_init_info->rail_count > 1) {
+            /* NA context IDs past the ones of HG contexts are used for rails,
+             * so that HG contexts keep an NA context ID equal to their ID */
+            hg_core_class->core_class.na_rail_count =
+                (hg_init_info->rail_count > HG_CORE_MAX_RAILS) ?
+                HG_CORE_MAX_RAILS : hg_init_info->rail_count;
+            hg_core_class->rail_context_base =
+                hg_init_info->na_init_info.max_contexts
+                / hg_core_class->core_class.na_rail_count;
+            if (!hg_core_class->rail_context_base)
+                hg_core_class->rail_context_base = 1;
+        }
+        if (hg_init_info->rail_chunk_size)
+            hg_core_class->core_class.na_rail_chunk_size =
+                hg_init_info->rail_chunk_size;
 #ifdef HG_HAS_COLLECT_STATS
         hg_core_class->stats = hg_init_info->stats;
         if (hg_core_class->stats && !hg_core_print_stats_registered_g) {
@@ -1185,7 +1573,21 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     }
 #endif
 
-    /* Initialize atomic for tags */
+    /* Compute number of usable tag bits and keep HG_CORE_MASK_NBITS of them
+     * for the context index if the tag space is large enough */
+    for (tag_nbits = 0; tag_nbits < HG_CORE_TAG_MAX_NBITS
+        && ((2U << tag_nbits) - 1) <= hg_core_class->request_max_tag;
+        tag_nbits++)
+        continue;
+    if (tag_nbits >= HG_CORE_MASK_NBITS + HG_CORE_TAG_MIN_NBITS)
+        hg_core_class->request_tag_shift = HG_CORE_MASK_NBITS;
+    else
+        hg_core_class->request_tag_shift = 0;
+    hg_core_class->request_tag_mask =
+        (na_tag_t) ((1U << (tag_nbits - hg_core_class->request_tag_shift)) - 1);
+
+    /* Initialize atomics for context indices and shared tags */
+    hg_atomic_init32(&hg_core_class->context_index, 0);
     hg_atomic_init32(&hg_core_class->request_tag, 0);
 
     /* No context created yet */
@@ -1194,6 +1596,11 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     /* No addr created yet */
     hg_atomic_init32(&hg_core_class->n_addrs, 0);
 
+    /* No context registered for steering yet */
+    hg_atomic_init32(&hg_core_class->n_steer_contexts, 0);
+    hg_atomic_init32(&hg_core_class->share_index, 0);
+    hg_thread_rwlock_init(&hg_core_class->steer_lock);
+
     /* Create new function map */
     hg_core_class->func_map = hg_hash_table_new(hg_core_int_hash, hg_core_int_equal);
     if (!hg_core_class->func_map) {
@@ -1208,6 +1615,21 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     /* Initialize mutex */
     hg_thread_spin_init(&hg_core_class->func_map_lock);
 
+    /* Create lookup cache (keys are freed with the cache, addresses are
+     * released separately as they are ref counted) */
+    if (hg_core_class->addr_cache_size) {
+        hg_core_class->addr_cache = hg_hash_table_new(hg_core_string_hash,
+            hg_core_string_equal);
+        if (!hg_core_class->addr_cache) {
+            HG_LOG_ERROR("Could not create address cache");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        hg_hash_table_register_free_functions(hg_core_class->addr_cache, free,
+            NULL);
+    }
+    hg_thread_spin_init(&hg_core_class->addr_cache_lock);
+
 done:
     if (ret != HG_SUCCESS) {
         hg_core_finalize(hg_core_class);
@@ -1225,6 +1647,13 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
 
     if (!hg_core_class) goto done;
 
+    /* Release cached addresses first */
+    if (hg_core_class->addr_cache) {
+        hg_core_addr_cache_flush(hg_core_class);
+        hg_hash_table_free(hg_core_class->addr_cache);
+        hg_core_class->addr_cache = NULL;
+    }
+
     n_contexts = hg_atomic_get32(&hg_core_class->n_contexts);
     if (n_contexts != 0) {
         HG_LOG_ERROR("HG contexts must be destroyed before finalizing HG"
@@ -1241,6 +1670,24 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
         goto done;
     }
 
+    /* Wait for callbacks that are still running and destroy executor */
+    if (hg_core_class->executor_pool
+        && hg_thread_pool_destroy(hg_core_class->executor_pool)
+            != HG_UTIL_SUCCESS) {
+        HG_LOG_ERROR("Could not destroy executor thread pool");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    hg_core_class->executor_pool = NULL;
+
+    /* Release local copy engine */
+    if (hg_core_class->mem_copy && hg_mem_copy_finalize() != HG_UTIL_SUCCESS) {
+        HG_LOG_ERROR("Could not finalize local copy engine");
+        ret = HG_PROTOCOL_ERROR;
+        goto done;
+    }
+    hg_core_class->mem_copy = HG_FALSE;
+
     /* Delete function map */
     if(hg_core_class->func_map)
         hg_hash_table_free(hg_core_class->func_map);
@@ -1253,6 +1700,8 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
 
     /* Destroy mutex */
     hg_thread_spin_destroy(&hg_core_class->func_map_lock);
+    hg_thread_rwlock_destroy(&hg_core_class->steer_lock);
+    hg_thread_spin_destroy(&hg_core_class->addr_cache_lock);
 
     if (!hg_core_class->na_ext_init) {
         /* Finalize interface */
@@ -1313,16 +1762,7 @@ static hg_return_t
 hg_core_addr_lookup(struct hg_core_private_context *context,
     hg_core_cb_t callback, void *arg, const char *name, hg_core_op_id_t *op_id)
 {
-    na_class_t *na_class = context->core_context.core_class->na_class;
-    na_context_t *na_context = context->core_context.na_context;
     struct hg_core_op_id *hg_core_op_id = NULL;
-    struct hg_core_private_addr *hg_core_addr = NULL;
-    na_addr_t na_addr = NA_ADDR_NULL;
-    na_return_t na_ret;
-#ifdef HG_HAS_SM_ROUTING
-    char lookup_name[HG_CORE_ADDR_MAX_SIZE] = {'\0'};
-#endif
-    const char *name_str = name;
     hg_return_t ret = HG_SUCCESS, progress_ret;
 
     /* Allocate op_id */
@@ -1332,32 +1772,101 @@ hg_core_addr_lookup(struct hg_core_private_context *context,
         ret = HG_NOMEM_ERROR;
         goto done;
     }
+    memset(hg_core_op_id, 0, sizeof(struct hg_core_op_id));
     hg_core_op_id->context = context;
     hg_core_op_id->type = HG_CB_LOOKUP;
     hg_core_op_id->callback = callback;
     hg_core_op_id->arg = arg;
     hg_atomic_init32(&hg_core_op_id->completed, 0);
-    hg_core_op_id->info.lookup.hg_core_addr = NULL;
+    hg_core_op_id->info.lookup.na_lookup_op_id = NA_OP_ID_NULL;
 
-    /* Allocate addr */
-    hg_core_addr = hg_core_addr_create(HG_CORE_CONTEXT_CLASS(context), NULL);
-    if (!hg_core_addr) {
-        HG_LOG_ERROR("Could not create HG addr");
-        ret = HG_NOMEM_ERROR;
+    ret = hg_core_addr_lookup_start(context, hg_core_op_id, name);
+    if (ret != HG_SUCCESS)
+        goto done;
+
+    /* TODO to avoid blocking after lookup make progress on the HG layer with
+     * timeout of 0 */
+    progress_ret = context->progress(context, 0);
+    if (progress_ret != HG_SUCCESS && progress_ret != HG_TIMEOUT) {
+        HG_LOG_ERROR("Could not make progress");
+        ret = progress_ret;
         goto done;
     }
-    hg_core_op_id->info.lookup.hg_core_addr = hg_core_addr;
 
-#ifdef HG_HAS_SM_ROUTING
-    /* Parse name string */
-    if (strstr(name, HG_CORE_ADDR_DELIMITER)) {
-        char *lookup_names, *local_id_str;
-        char *remote_name, *local_name;
+    /* Assign op_id */
+    if (op_id && op_id != HG_CORE_OP_ID_IGNORE)
+        *op_id = (hg_core_op_id_t) hg_core_op_id;
 
-        strcpy(lookup_name, name);
+done:
+    if (ret != HG_SUCCESS && hg_core_op_id) {
+        free(hg_core_op_id->info.lookup.name);
+        hg_core_addr_free(HG_CORE_CONTEXT_CLASS(context),
+            hg_core_op_id->info.lookup.hg_core_addr);
+        free(hg_core_op_id);
+    }
 
-        /* Get first part of address string with UUID */
-        strtok_r(lookup_name, HG_CORE_ADDR_DELIMITER, &lookup_names);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_addr_lookup_start(struct hg_core_private_context *context,
+    struct hg_core_op_id *hg_core_op_id, const char *name)
+{
+    na_class_t *na_class = context->core_context.core_class->na_class;
+    na_context_t *na_context = context->core_context.na_context;
+    struct hg_core_private_addr *hg_core_addr = NULL;
+    na_addr_t na_addr = NA_ADDR_NULL;
+    na_return_t na_ret;
+#ifdef HG_HAS_SM_ROUTING
+    char lookup_name[HG_CORE_ADDR_MAX_SIZE] = {'\0'};
+#endif
+    const char *name_str = name;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (HG_CORE_CONTEXT_CLASS(context)->addr_cache) {
+        /* Complete lookup right away if address was already looked up */
+        hg_core_addr = hg_core_addr_cache_get(HG_CORE_CONTEXT_CLASS(context),
+            name);
+        if (hg_core_addr) {
+#ifdef HG_HAS_COLLECT_STATS
+            hg_core_stat_incr(&hg_core_addr_cache_hit_count_g);
+#endif
+            hg_core_op_id->info.lookup.hg_core_addr = hg_core_addr;
+            ret = hg_core_addr_lookup_complete(hg_core_op_id);
+            if (ret != HG_SUCCESS)
+                HG_LOG_ERROR("Could not complete operation");
+            goto done;
+        }
+
+        /* Keep name so that address can be cached once looked up */
+        hg_core_op_id->info.lookup.name = strdup(name);
+        if (!hg_core_op_id->info.lookup.name) {
+            HG_LOG_ERROR("Could not duplicate lookup name");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+    }
+
+    /* Allocate addr (released by caller on failure) */
+    hg_core_addr = hg_core_addr_create(HG_CORE_CONTEXT_CLASS(context), NULL);
+    if (!hg_core_addr) {
+        HG_LOG_ERROR("Could not create HG addr");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_core_op_id->info.lookup.hg_core_addr = hg_core_addr;
+
+#ifdef HG_HAS_SM_ROUTING
+    /* Parse name string */
+    if (strstr(name, HG_CORE_ADDR_DELIMITER)) {
+        char *lookup_names, *local_id_str;
+        char *remote_name, *local_name;
+
+        strcpy(lookup_name, name);
+
+        /* Get first part of address string with UUID */
+        strtok_r(lookup_name, HG_CORE_ADDR_DELIMITER, &lookup_names);
 
         if (!strstr(name, HG_CORE_PROTO_DELIMITER)) {
             HG_LOG_ERROR("Malformed address format");
@@ -1417,8 +1926,87 @@ hg_core_addr_lookup(struct hg_core_private_context *context,
         }
     }
 
-    /* TODO to avoid blocking after lookup make progress on the HG layer with
-     * timeout of 0 */
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_addr_lookup_multi(struct hg_core_private_context *context,
+    hg_core_cb_t callback, void *arg, const char **names, hg_core_addr_t *addrs,
+    unsigned int count, hg_core_op_id_t *op_id)
+{
+    struct hg_core_op_id *hg_core_op_id = NULL;
+    hg_return_t ret = HG_SUCCESS, progress_ret;
+    unsigned int i;
+
+    /* Allocate op_id */
+    hg_core_op_id = (struct hg_core_op_id *) malloc(sizeof(struct hg_core_op_id));
+    if (!hg_core_op_id) {
+        HG_LOG_ERROR("Could not allocate HG operation ID");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_core_op_id, 0, sizeof(struct hg_core_op_id));
+    hg_core_op_id->context = context;
+    hg_core_op_id->type = HG_CB_LOOKUP;
+    hg_core_op_id->callback = callback;
+    hg_core_op_id->arg = arg;
+    hg_atomic_init32(&hg_core_op_id->completed, 0);
+    hg_core_op_id->info.lookup.na_lookup_op_id = NA_OP_ID_NULL;
+    hg_core_op_id->info.lookup.addrs = addrs;
+    hg_core_op_id->info.lookup.index = count;
+    hg_core_op_id->info.lookup.ret = HG_SUCCESS;
+
+    /* Allocate one op_id per name */
+    hg_core_op_id->info.lookup.children = (struct hg_core_op_id *) malloc(
+        count * sizeof(struct hg_core_op_id));
+    if (!hg_core_op_id->info.lookup.children) {
+        HG_LOG_ERROR("Could not allocate HG operation IDs");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_core_op_id->info.lookup.children, 0,
+        count * sizeof(struct hg_core_op_id));
+
+    /* Extra count is released once all lookups are started so that the multi
+     * lookup cannot complete before */
+    hg_atomic_init32(&hg_core_op_id->info.lookup.n_remaining, (int) count + 1);
+
+    /* Start all lookups before making progress so that plugins can set up
+     * connections concurrently, lookups that fail to start are reported
+     * through the callback of the multi lookup */
+    for (i = 0; i < count; i++) {
+        struct hg_core_op_id *child = &hg_core_op_id->info.lookup.children[i];
+        hg_return_t child_ret;
+
+        addrs[i] = HG_CORE_ADDR_NULL;
+        child->context = context;
+        child->type = HG_CB_LOOKUP;
+        hg_atomic_init32(&child->completed, 0);
+        child->info.lookup.na_lookup_op_id = NA_OP_ID_NULL;
+        child->info.lookup.parent = hg_core_op_id;
+        child->info.lookup.index = i;
+
+        child_ret = hg_core_addr_lookup_start(context, child, names[i]);
+        if (child_ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not start lookup of %s", names[i]);
+            hg_core_addr_lookup_multi_complete(child, child_ret);
+        }
+    }
+
+    /* Assign op_id before completion can be triggered */
+    if (op_id && op_id != HG_CORE_OP_ID_IGNORE)
+        *op_id = (hg_core_op_id_t) hg_core_op_id;
+
+    if (hg_atomic_decr32(&hg_core_op_id->info.lookup.n_remaining) == 0) {
+        ret = hg_core_addr_lookup_complete(hg_core_op_id);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not complete operation");
+            goto done;
+        }
+    }
+
     progress_ret = context->progress(context, 0);
     if (progress_ret != HG_SUCCESS && progress_ret != HG_TIMEOUT) {
         HG_LOG_ERROR("Could not make progress");
@@ -1426,20 +2014,37 @@ hg_core_addr_lookup(struct hg_core_private_context *context,
         goto done;
     }
 
-    /* Assign op_id */
-    if (op_id && op_id != HG_CORE_OP_ID_IGNORE)
-        *op_id = (hg_core_op_id_t) hg_core_op_id;
-
 done:
-    if (ret != HG_SUCCESS) {
+    if (ret != HG_SUCCESS && hg_core_op_id
+        && !hg_core_op_id->info.lookup.children)
         free(hg_core_op_id);
-        if (hg_core_addr != NULL)
-            hg_core_addr_free(HG_CORE_CONTEXT_CLASS(context), hg_core_addr);
-    }
 
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_addr_lookup_multi_complete(struct hg_core_op_id *hg_core_op_id,
+    hg_return_t ret)
+{
+    struct hg_core_op_id *parent = hg_core_op_id->info.lookup.parent;
+
+    /* Mark operation as completed */
+    hg_atomic_incr32(&hg_core_op_id->completed);
+
+    /* Failed addresses are released when multi lookup is triggered */
+    if (ret == HG_SUCCESS)
+        parent->info.lookup.addrs[hg_core_op_id->info.lookup.index] =
+            (hg_core_addr_t) hg_core_op_id->info.lookup.hg_core_addr;
+    else
+        parent->info.lookup.ret = ret;
+
+    if (hg_atomic_decr32(&parent->info.lookup.n_remaining) == 0)
+        return hg_core_addr_lookup_complete(parent);
+
+    return HG_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 static int
 hg_core_addr_lookup_cb(const struct na_cb_info *callback_info)
@@ -1450,6 +2055,9 @@ hg_core_addr_lookup_cb(const struct na_cb_info *callback_info)
     int ret = 0;
 
     if (callback_info->ret != NA_SUCCESS) {
+        /* Report failure through multi lookup */
+        if (hg_core_op_id->info.lookup.parent)
+            hg_core_addr_lookup_multi_complete(hg_core_op_id, HG_NA_ERROR);
         return ret;
     }
 
@@ -1457,6 +2065,15 @@ hg_core_addr_lookup_cb(const struct na_cb_info *callback_info)
     hg_core_op_id->info.lookup.hg_core_addr->core_addr.na_addr =
         callback_info->info.lookup.addr;
 
+    /* Cache addr for subsequent lookups */
+    if (hg_core_op_id->info.lookup.name) {
+        hg_core_addr_cache_add(HG_CORE_CONTEXT_CLASS(hg_core_op_id->context),
+            hg_core_op_id->info.lookup.name,
+            hg_core_op_id->info.lookup.hg_core_addr);
+        free(hg_core_op_id->info.lookup.name);
+        hg_core_op_id->info.lookup.name = NULL;
+    }
+
     /* Mark as completed */
     if (hg_core_addr_lookup_complete(hg_core_op_id) != HG_SUCCESS) {
         HG_LOG_ERROR("Could not complete operation");
@@ -1478,6 +2095,10 @@ hg_core_addr_lookup_complete(struct hg_core_op_id *hg_core_op_id)
         &hg_core_op_id->hg_completion_entry;
     hg_return_t ret = HG_SUCCESS;
 
+    /* Lookups of multi lookup only complete their parent */
+    if (hg_core_op_id->info.lookup.parent)
+        return hg_core_addr_lookup_multi_complete(hg_core_op_id, HG_SUCCESS);
+
     /* Mark operation as completed */
     hg_atomic_incr32(&hg_core_op_id->completed);
 
@@ -1539,6 +2160,134 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static struct hg_core_private_addr *
+hg_core_addr_cache_get(struct hg_core_private_class *hg_core_class,
+    const char *name)
+{
+    struct hg_core_private_addr *hg_core_addr;
+
+    hg_thread_spin_lock(&hg_core_class->addr_cache_lock);
+    hg_core_addr = (struct hg_core_private_addr *) hg_hash_table_lookup(
+        hg_core_class->addr_cache, (hg_hash_table_key_t) (hg_ptr_t) name);
+    if (hg_core_addr == HG_HASH_TABLE_NULL)
+        hg_core_addr = NULL;
+    else {
+        hg_atomic_incr32(&hg_core_addr->ref_count);
+        hg_core_addr->cache_stamp = ++hg_core_class->addr_cache_clock;
+    }
+    hg_thread_spin_unlock(&hg_core_class->addr_cache_lock);
+
+    return hg_core_addr;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_addr_cache_add(struct hg_core_private_class *hg_core_class,
+    const char *name, struct hg_core_private_addr *hg_core_addr)
+{
+    struct hg_core_private_addr *evicted_addr = NULL;
+    char *cache_name = NULL;
+
+    hg_thread_spin_lock(&hg_core_class->addr_cache_lock);
+
+    /* Concurrent lookup of the same name already cached it */
+    if (hg_hash_table_lookup(hg_core_class->addr_cache,
+        (hg_hash_table_key_t) (hg_ptr_t) name) != HG_HASH_TABLE_NULL)
+        goto unlock;
+
+    if (hg_hash_table_num_entries(hg_core_class->addr_cache)
+        >= hg_core_class->addr_cache_size) {
+        hg_hash_table_iter_t iter;
+
+        /* Only evict addresses that are no longer used outside the cache */
+        hg_hash_table_iterate(hg_core_class->addr_cache, &iter);
+        while (hg_hash_table_iter_has_more(&iter)) {
+            struct hg_core_private_addr *cached_addr =
+                (struct hg_core_private_addr *) hg_hash_table_iter_next(&iter);
+
+            if (hg_atomic_get32(&cached_addr->ref_count) > 1)
+                continue;
+            if (!evicted_addr
+                || cached_addr->cache_stamp < evicted_addr->cache_stamp)
+                evicted_addr = cached_addr;
+        }
+        if (!evicted_addr)
+            goto unlock;
+        hg_hash_table_remove(hg_core_class->addr_cache,
+            (hg_hash_table_key_t) evicted_addr->cache_name);
+        evicted_addr->cache_name = NULL;
+    }
+
+    cache_name = strdup(name);
+    if (!cache_name) {
+        HG_LOG_ERROR("Could not duplicate cache name");
+        goto unlock;
+    }
+    if (!hg_hash_table_insert(hg_core_class->addr_cache,
+        (hg_hash_table_key_t) cache_name, (hg_hash_table_value_t) hg_core_addr)) {
+        HG_LOG_ERROR("Could not insert address into cache");
+        free(cache_name);
+        goto unlock;
+    }
+    /* Cache holds its own reference */
+    hg_atomic_incr32(&hg_core_addr->ref_count);
+    hg_core_addr->cache_name = cache_name;
+    hg_core_addr->cache_stamp = ++hg_core_class->addr_cache_clock;
+
+unlock:
+    hg_thread_spin_unlock(&hg_core_class->addr_cache_lock);
+
+    /* Drop reference of evicted address outside of lock */
+    if (evicted_addr)
+        hg_core_addr_free(hg_core_class, evicted_addr);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_addr_cache_remove(struct hg_core_private_class *hg_core_class,
+    struct hg_core_private_addr *hg_core_addr)
+{
+    hg_bool_t removed = HG_FALSE;
+
+    hg_thread_spin_lock(&hg_core_class->addr_cache_lock);
+    if (hg_core_addr->cache_name) {
+        hg_hash_table_remove(hg_core_class->addr_cache,
+            (hg_hash_table_key_t) hg_core_addr->cache_name);
+        hg_core_addr->cache_name = NULL;
+        removed = HG_TRUE;
+    }
+    hg_thread_spin_unlock(&hg_core_class->addr_cache_lock);
+
+    if (removed)
+        hg_core_addr_free(hg_core_class, hg_core_addr);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_addr_cache_flush(struct hg_core_private_class *hg_core_class)
+{
+    for (;;) {
+        struct hg_core_private_addr *hg_core_addr = NULL;
+        hg_hash_table_iter_t iter;
+
+        hg_thread_spin_lock(&hg_core_class->addr_cache_lock);
+        hg_hash_table_iterate(hg_core_class->addr_cache, &iter);
+        if (hg_hash_table_iter_has_more(&iter)) {
+            hg_core_addr =
+                (struct hg_core_private_addr *) hg_hash_table_iter_next(&iter);
+            hg_hash_table_remove(hg_core_class->addr_cache,
+                (hg_hash_table_key_t) hg_core_addr->cache_name);
+            hg_core_addr->cache_name = NULL;
+        }
+        hg_thread_spin_unlock(&hg_core_class->addr_cache_lock);
+
+        if (!hg_core_addr)
+            break;
+        hg_core_addr_free(hg_core_class, hg_core_addr);
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_addr_self(struct hg_core_private_class *hg_core_class,
@@ -1725,11 +2474,13 @@ hg_core_create(struct hg_core_private_context *context, hg_bool_t use_sm)
     /* Default return code */
     hg_core_handle->ret = HG_SUCCESS;
 
+#ifdef HG_HAS_HANDLE_TRACKING
     /* Add handle to handle list so that we can track it */
     hg_thread_spin_lock(&HG_CORE_HANDLE_CONTEXT(hg_core_handle)->created_list_lock);
     HG_LIST_INSERT_HEAD(&HG_CORE_HANDLE_CONTEXT(hg_core_handle)->created_list,
         hg_core_handle, created);
     hg_thread_spin_unlock(&HG_CORE_HANDLE_CONTEXT(hg_core_handle)->created_list_lock);
+#endif
 
     /* Handle is not in use */
     hg_atomic_init32(&hg_core_handle->in_use, HG_FALSE);
@@ -1769,10 +2520,12 @@ hg_core_destroy(struct hg_core_private_handle *hg_core_handle)
     if (hg_atomic_decr32(&hg_core_handle->ref_count))
         goto done; /* Cannot free yet */
 
+#ifdef HG_HAS_HANDLE_TRACKING
     /* Remove handle from list */
     hg_thread_spin_lock(&HG_CORE_HANDLE_CONTEXT(hg_core_handle)->created_list_lock);
     HG_LIST_REMOVE(hg_core_handle, created);
     hg_thread_spin_unlock(&HG_CORE_HANDLE_CONTEXT(hg_core_handle)->created_list_lock);
+#endif
 
     /* Decrement N handles from HG context */
     hg_atomic_decr32(&HG_CORE_HANDLE_CONTEXT(hg_core_handle)->n_handles);
@@ -2050,9 +2803,17 @@ hg_core_forward_na(struct hg_core_private_handle *hg_core_handle)
 
     /* Generate tag */
     hg_core_handle->tag = hg_core_gen_request_tag(
-        HG_CORE_HANDLE_CLASS(hg_core_handle));
+        HG_CORE_HANDLE_CONTEXT(hg_core_handle));
 
     if (!hg_core_handle->no_response) {
+#ifdef HG_HAS_TAG_CHECK
+        /* Make sure that tag is not used by an outstanding request */
+        ret = hg_core_tag_acquire(hg_core_handle);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not acquire tag");
+            goto done;
+        }
+#endif
         /* Increment number of expected NA operations */
         hg_core_handle->na_op_count++;
 
@@ -2067,6 +2828,9 @@ hg_core_forward_na(struct hg_core_private_handle *hg_core_handle)
             &hg_core_handle->na_recv_op_id);
         if (na_ret != NA_SUCCESS) {
             HG_LOG_ERROR("Could not post recv for output buffer");
+#ifdef HG_HAS_TAG_CHECK
+            hg_core_tag_release(hg_core_handle);
+#endif
             ret = HG_NA_ERROR;
             goto done;
         }
@@ -2106,11 +2870,21 @@ hg_core_respond_self(struct hg_core_private_handle *hg_core_handle)
     /* Set operation type for trigger */
     hg_core_handle->op_type = HG_CORE_RESPOND_SELF;
 
-    /* Complete and add to completion queue */
-    ret = hg_core_complete((hg_core_handle_t) hg_core_handle);
-    if (ret != HG_SUCCESS) {
-        HG_LOG_ERROR("Could not complete handle");
-        goto done;
+    /* Deliver response directly if inline, only the forward completion
+     * then goes through the completion queue */
+    if (HG_CORE_HANDLE_CLASS(hg_core_handle)->self_inline) {
+        ret = hg_core_trigger_entry(hg_core_handle);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not trigger handle");
+            goto done;
+        }
+    } else {
+        /* Complete and add to completion queue */
+        ret = hg_core_complete((hg_core_handle_t) hg_core_handle);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not complete handle");
+            goto done;
+        }
     }
 
 done:
@@ -2383,6 +3157,7 @@ hg_core_process_input(struct hg_core_private_handle *hg_core_handle,
     hg_core_handle->cookie = hg_core_handle->in_header.msg.request.cookie;
     /* TODO assign target ID from cookie directly for now */
     hg_core_handle->core_handle.info.context_id = hg_core_handle->cookie;
+    hg_core_handle->target_id = hg_core_handle->in_header.msg.request.target_id;
 
     /* Parse flags */
     hg_core_handle->no_response = hg_core_handle->in_header.msg.request.flags
@@ -2700,7 +3475,17 @@ hg_core_process_self(struct hg_core_private_handle *hg_core_handle)
     }
 
     /* Mark as completed */
-    if (completed) {
+    if (!completed)
+        goto done;
+
+    if (HG_CORE_HANDLE_CLASS(hg_core_handle)->self_inline) {
+        /* Execute RPC callback directly from the calling thread */
+        ret = hg_core_trigger_entry(hg_core_handle);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not trigger handle");
+            goto done;
+        }
+    } else {
         ret = hg_core_complete((hg_core_handle_t) hg_core_handle);
         if (ret != HG_SUCCESS) {
             HG_LOG_ERROR("Could not complete operation");
@@ -2717,15 +3502,11 @@ done:
 static hg_return_t
 hg_core_process(struct hg_core_private_handle *hg_core_handle)
 {
-    struct hg_core_rpc_info *hg_core_rpc_info;
+    /* RPC info was cached by hg_core_get_executor() */
+    struct hg_core_rpc_info *hg_core_rpc_info =
+        hg_core_handle->core_handle.rpc_info;
     hg_return_t ret = HG_SUCCESS;
 
-    /* Retrieve exe function from function map */
-    hg_thread_spin_lock(&HG_CORE_HANDLE_CLASS(hg_core_handle)->func_map_lock);
-    hg_core_rpc_info = (struct hg_core_rpc_info *) hg_hash_table_lookup(
-        HG_CORE_HANDLE_CLASS(hg_core_handle)->func_map,
-        (hg_hash_table_key_t) &hg_core_handle->core_handle.info.id);
-    hg_thread_spin_unlock(&HG_CORE_HANDLE_CLASS(hg_core_handle)->func_map_lock);
     if (!hg_core_rpc_info) {
         HG_LOG_WARNING("Could not find RPC ID in function map");
         ret = HG_NO_MATCH;
@@ -2738,9 +3519,6 @@ hg_core_process(struct hg_core_private_handle *hg_core_handle)
         goto done;
     }
 
-    /* Cache RPC info */
-    hg_core_handle->core_handle.rpc_info = hg_core_rpc_info;
-
     /* Increment ref count here so that a call to HG_Destroy in user's RPC
      * callback does not free the handle but only schedules its completion */
     hg_atomic_incr32(&hg_core_handle->ref_count);
@@ -2798,6 +3576,22 @@ hg_core_complete(hg_core_handle_t handle)
     hg_completion_entry->op_type = HG_RPC;
     hg_completion_entry->op_id.hg_core_handle = handle;
 
+    if (hg_core_handle->op_type == HG_CORE_PROCESS && !hg_core_handle->is_self
+        && hg_atomic_get32(&HG_CORE_HANDLE_CLASS(hg_core_handle)->n_steer_contexts)) {
+        hg_bool_t steered = HG_FALSE;
+
+        ret = hg_core_steer(hg_core_handle, &steered);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not steer HG completion entry");
+            goto done;
+        }
+        if (steered)
+            goto done;
+    }
+
+    if (hg_core_handle->op_type == HG_CORE_PROCESS)
+        hg_atomic_incr32(&((struct hg_core_private_context *) context)->rpc_count);
+
     ret = hg_core_completion_add(context, hg_completion_entry,
         hg_core_handle->is_self);
     if (ret != HG_SUCCESS) {
@@ -2809,6 +3603,98 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_steer(struct hg_core_private_handle *hg_core_handle,
+    hg_bool_t *steered)
+{
+    struct hg_core_private_class *hg_core_class =
+        HG_CORE_HANDLE_CLASS(hg_core_handle);
+    struct hg_core_private_context *context =
+        HG_CORE_HANDLE_CONTEXT(hg_core_handle);
+    struct hg_core_private_context *target;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_rwlock_rdlock(&hg_core_class->steer_lock);
+
+    /* Default to receiving context if nobody registered that target ID */
+    target = hg_core_class->steer_contexts[hg_core_handle->target_id];
+    if (!target)
+        target = context;
+
+    /* Target is too busy, hand RPC over to least loaded context */
+    if (target->share_threshold && hg_core_class->n_share_contexts
+        && hg_core_completion_count(target) > target->share_threshold) {
+        unsigned int min_count = hg_core_completion_count(target), i, start;
+
+        start = (unsigned int) hg_atomic_incr32(&hg_core_class->share_index);
+        for (i = 0; i < hg_core_class->n_share_contexts; i++) {
+            struct hg_core_private_context *share_context =
+                hg_core_class->share_contexts[
+                    (start + i) % hg_core_class->n_share_contexts];
+            unsigned int count = hg_core_completion_count(share_context);
+
+            if (count < min_count) {
+                target = share_context;
+                min_count = count;
+            }
+        }
+        if (target != context)
+            hg_atomic_incr32(&target->rpc_shared_count);
+    } else if (target != context)
+        hg_atomic_incr32(&target->rpc_steered_count);
+
+    if (target == context)
+        goto unlock;
+
+    hg_atomic_incr32(&target->rpc_count);
+
+    /* Target may be blocked in progress, notify it */
+    ret = hg_core_completion_add((struct hg_core_context *) target,
+        &hg_core_handle->hg_completion_entry, HG_TRUE);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not add HG completion entry to completion queue");
+        goto unlock;
+    }
+    *steered = HG_TRUE;
+
+unlock:
+    hg_thread_rwlock_release_rdlock(&hg_core_class->steer_lock);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_core_completion_count(struct hg_core_private_context *context)
+{
+    return hg_atomic_queue_count(context->completion_queue)
+        + (unsigned int) hg_atomic_get32(&context->backfill_queue_count);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_steering_remove(struct hg_core_private_context *context)
+{
+    struct hg_core_private_class *hg_core_class =
+        HG_CORE_CONTEXT_CLASS(context);
+    unsigned int i;
+
+    hg_thread_rwlock_wrlock(&hg_core_class->steer_lock);
+    if (hg_core_class->steer_contexts[context->core_context.id] == context)
+        hg_core_class->steer_contexts[context->core_context.id] = NULL;
+    for (i = 0; i < hg_core_class->n_share_contexts; i++) {
+        if (hg_core_class->share_contexts[i] != context)
+            continue;
+        hg_core_class->share_contexts[i] =
+            hg_core_class->share_contexts[--hg_core_class->n_share_contexts];
+        break;
+    }
+    context->steering = HG_FALSE;
+    hg_atomic_decr32(&hg_core_class->n_steer_contexts);
+    hg_thread_rwlock_release_wrlock(&hg_core_class->steer_lock);
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 hg_core_completion_add(struct hg_core_context *context,
@@ -2842,16 +3728,12 @@ hg_core_completion_add(struct hg_core_context *context,
         hg_thread_mutex_unlock(&private_context->completion_queue_mutex);
     }
 
-#ifdef HG_HAS_SELF_FORWARD
     /* TODO could prevent from self notifying if hg_poll_wait() not entered */
     if (self_notify && private_context->completion_queue_notify
         && hg_event_set(private_context->completion_queue_notify) != HG_UTIL_SUCCESS) {
         HG_LOG_ERROR("Could not signal completion queue");
         ret = HG_PROTOCOL_ERROR;
     }
-#else
-    (void) self_notify;
-#endif
 
     return ret;
 }
@@ -2991,7 +3873,6 @@ done:
 }
 
 /*---------------------------------------------------------------------------*/
-#ifdef HG_HAS_SELF_FORWARD
 static HG_INLINE int
 hg_core_completion_queue_notify_cb(void *arg,
     int HG_UNUSED error, hg_util_bool_t *progressed)
@@ -3019,48 +3900,124 @@ hg_core_completion_queue_notify_cb(void *arg,
 done:
     return ret;
 }
-#endif
 
 /*---------------------------------------------------------------------------*/
-static int
-hg_core_progress_na_cb(void *arg, int HG_UNUSED error,
-    hg_util_bool_t *progressed)
+static hg_return_t
+hg_core_progress_na_rails(struct hg_core_private_context *context,
+    unsigned int *completed_count)
 {
-    struct hg_core_private_context *context =
-        (struct hg_core_private_context *) arg;
-     unsigned int actual_count = 0;
-    na_return_t na_ret;
-    unsigned int completed_count = 0;
+    na_class_t *na_class = HG_CORE_CONTEXT_CLASS(context)->core_class.na_class;
+    unsigned int rail_count =
+        HG_CORE_CONTEXT_CLASS(context)->core_class.na_rail_count;
     int cb_ret[HG_CORE_MAX_TRIGGER_COUNT] = {0};
-    int ret = HG_UTIL_SUCCESS;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int rail;
 
-    /* Check progress on NA (no need to call try_wait here) */
-    na_ret = NA_Progress(HG_CORE_CONTEXT_CLASS(context)->core_class.na_class,
-        context->core_context.na_context, 0);
-    if (na_ret != NA_SUCCESS && na_ret != NA_TIMEOUT) {
-        HG_LOG_ERROR("Could not make progress on NA");
-        ret = HG_UTIL_FAIL;
-        goto done;
-    }
-    if (na_ret != NA_SUCCESS) {
-        /* Nothing progressed */
-        *progressed = HG_UTIL_FALSE;
-        goto done;
-    }
+    /* First rail is progressed by caller */
+    for (rail = 1; rail < rail_count; rail++) {
+        na_context_t *na_context = context->core_context.na_rails[rail];
+        unsigned int actual_count = 0;
+        na_return_t na_ret;
 
-    /* Trigger everything we can from NA, if something completed it will
-     * be moved to the HG context completion queue */
-    do {
-        unsigned int i;
+        na_ret = NA_Progress(na_class, na_context, 0);
+        if (na_ret != NA_SUCCESS && na_ret != NA_TIMEOUT) {
+            HG_LOG_ERROR("Could not make progress on NA rail %u", rail);
+            ret = HG_NA_ERROR;
+            goto done;
+        }
 
-        na_ret = NA_Trigger(context->core_context.na_context, 0,
-            HG_CORE_MAX_TRIGGER_COUNT, cb_ret, &actual_count);
+        /* Operations may also have completed when they were posted */
+        do {
+            unsigned int i;
+
+            na_ret = NA_Trigger(na_context, 0, HG_CORE_MAX_TRIGGER_COUNT,
+                cb_ret, &actual_count);
+
+            /* Return value of callback is completion count */
+            for (i = 0; i < actual_count; i++)
+                *completed_count += (unsigned int) cb_ret[i];
+        } while ((na_ret == NA_SUCCESS) && actual_count);
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_core_rail_poll_fd(struct hg_core_private_context *context,
+    unsigned int rail)
+{
+    na_class_t *na_class = HG_CORE_CONTEXT_CLASS(context)->core_class.na_class;
+    unsigned int i;
+    int fd;
+
+    /* Rails are progressed together with first rail when not waiting */
+    if (HG_CORE_CONTEXT_CLASS(context)->progress_mode == NA_NO_BLOCK
+        || context->progress != hg_core_progress_poll)
+        return -1;
+
+    fd = NA_Poll_get_fd(na_class, context->core_context.na_rails[rail]);
+    if (fd < 0)
+        return -1;
+
+    for (i = 0; i < rail; i++)
+        if (NA_Poll_get_fd(na_class, context->core_context.na_rails[i]) == fd)
+            return -1;
+
+    return fd;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_core_progress_na_cb(void *arg, int HG_UNUSED error,
+    hg_util_bool_t *progressed)
+{
+    struct hg_core_private_context *context =
+        (struct hg_core_private_context *) arg;
+     unsigned int actual_count = 0;
+    na_return_t na_ret;
+    unsigned int completed_count = 0;
+    int cb_ret[HG_CORE_MAX_TRIGGER_COUNT] = {0};
+    int ret = HG_UTIL_SUCCESS;
+
+    /* Check progress on NA (no need to call try_wait here) */
+    na_ret = NA_Progress(HG_CORE_CONTEXT_CLASS(context)->core_class.na_class,
+        context->core_context.na_context, 0);
+    if (na_ret != NA_SUCCESS && na_ret != NA_TIMEOUT) {
+        HG_LOG_ERROR("Could not make progress on NA");
+        ret = HG_UTIL_FAIL;
+        goto done;
+    }
+    if (na_ret != NA_SUCCESS && !context->core_context.na_rails) {
+        /* Nothing progressed */
+        *progressed = HG_UTIL_FALSE;
+        goto done;
+    }
+
+    /* Trigger everything we can from NA, if something completed it will
+     * be moved to the HG context completion queue */
+    do {
+        unsigned int i;
+
+        na_ret = NA_Trigger(context->core_context.na_context, 0,
+            HG_CORE_MAX_TRIGGER_COUNT, cb_ret, &actual_count);
 
         /* Return value of callback is completion count */
         for (i = 0; i < actual_count; i++)
             completed_count += (unsigned int) cb_ret[i];
     } while ((na_ret == NA_SUCCESS) && actual_count);
 
+    /* Rails share this callback, progress them even if nothing happened on
+     * the first one */
+    if (context->core_context.na_rails
+        && hg_core_progress_na_rails(context, &completed_count)
+            != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not make progress on NA rails");
+        ret = HG_UTIL_FAIL;
+        goto done;
+    }
+
     /* We can't only verify that the completion queue is not empty, we need
      * to check what was added to the completion queue, as the completion queue
      * may have been concurrently emptied */
@@ -3172,6 +4129,14 @@ hg_core_progress_na(struct hg_core_private_context *context,
                 completed_count += (unsigned int)cb_ret[i];
         } while ((na_ret == NA_SUCCESS) && actual_count);
 
+        if (context->core_context.na_rails
+            && hg_core_progress_na_rails(context, &completed_count)
+                != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not make progress on NA rails");
+            ret = HG_NA_ERROR;
+            goto done;
+        }
+
         /* We can't only verify that the completion queue is not empty, we need
          * to check what was added to the completion queue, as the completion
          * queue may have been concurrently emptied */
@@ -3196,6 +4161,11 @@ hg_core_progress_na(struct hg_core_private_context *context,
         else
             progress_timeout = 0;
 
+        /* Do not block on first rail while others may complete */
+        if (context->core_context.na_rails
+            && progress_timeout > HG_CORE_RAIL_PROGRESS_TIMEOUT)
+            progress_timeout = HG_CORE_RAIL_PROGRESS_TIMEOUT;
+
         /* Otherwise try to make progress on NA */
         na_ret = NA_Progress(
             HG_CORE_CONTEXT_CLASS(context)->core_class.na_class,
@@ -3210,6 +4180,8 @@ hg_core_progress_na(struct hg_core_private_context *context,
             /* Trigger NA callbacks and check whether we completed something */
             continue;
         } else if (na_ret == NA_TIMEOUT) {
+            if (context->core_context.na_rails && remaining > 0)
+                continue;
             break;
         } else {
             HG_LOG_ERROR("Could not make NA Progress");
@@ -3249,6 +4221,15 @@ hg_core_poll_try_wait_cb(void *arg)
     }
 #endif
 
+    if (context->core_context.na_rails) {
+        unsigned int i;
+
+        for (i = 1; i < context->core_context.core_class->na_rail_count; i++)
+            if (!NA_Poll_try_wait(context->core_context.core_class->na_class,
+                context->core_context.na_rails[i]))
+                return NA_FALSE;
+    }
+
     return NA_Poll_try_wait(context->core_context.core_class->na_class,
         context->core_context.na_context);
 }
@@ -3424,6 +4405,7 @@ static hg_return_t
 hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id)
 {
     hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
 
     /* Free op */
     if (hg_core_op_id->info.lookup.na_lookup_op_id != NA_OP_ID_NULL)
@@ -3431,12 +4413,27 @@ hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id)
             hg_core_op_id->info.lookup.hg_core_addr->core_addr.na_class,
             hg_core_op_id->info.lookup.na_lookup_op_id);
 
+    /* Free ops of multi lookup, along with addresses that failed */
+    for (i = 0; hg_core_op_id->info.lookup.children
+        && i < hg_core_op_id->info.lookup.index; i++) {
+        struct hg_core_op_id *child = &hg_core_op_id->info.lookup.children[i];
+
+        if (child->info.lookup.na_lookup_op_id != NA_OP_ID_NULL)
+            NA_Op_destroy(child->info.lookup.hg_core_addr->core_addr.na_class,
+                child->info.lookup.na_lookup_op_id);
+        if (hg_core_op_id->info.lookup.addrs[i] == HG_CORE_ADDR_NULL)
+            hg_core_addr_free(HG_CORE_CONTEXT_CLASS(hg_core_op_id->context),
+                child->info.lookup.hg_core_addr);
+        free(child->info.lookup.name);
+    }
+
     /* Execute callback */
     if (hg_core_op_id->callback) {
         struct hg_core_cb_info hg_core_cb_info;
 
         hg_core_cb_info.arg = hg_core_op_id->arg;
-        hg_core_cb_info.ret =  HG_SUCCESS; /* TODO report failure */
+        hg_core_cb_info.ret = hg_core_op_id->info.lookup.children ?
+            hg_core_op_id->info.lookup.ret : HG_SUCCESS; /* TODO report failure */
         hg_core_cb_info.type = HG_CB_LOOKUP;
         hg_core_cb_info.info.lookup.addr =
             (hg_core_addr_t) hg_core_op_id->info.lookup.hg_core_addr;
@@ -3444,6 +4441,8 @@ hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id)
         hg_core_op_id->callback(&hg_core_cb_info);
     }
 
+    free(hg_core_op_id->info.lookup.children);
+    free(hg_core_op_id->info.lookup.name);
     free(hg_core_op_id);
     return ret;
 }
@@ -3455,33 +4454,27 @@ hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle)
     hg_return_t ret = HG_SUCCESS;
 
     if (hg_core_handle->op_type == HG_CORE_PROCESS) {
+        struct hg_executor executor;
+
         /* Take another reference to make sure the handle does not get freed */
         hg_atomic_incr32(&hg_core_handle->ref_count);
 
-        /* Run RPC callback */
-        ret = hg_core_process(hg_core_handle);
-        if (ret != HG_SUCCESS && !hg_core_handle->no_response) {
-            hg_size_t header_size = hg_core_header_response_get_size() +
-                hg_core_handle->core_handle.na_out_header_offset;
-
-            /* Respond in case of error */
-            hg_core_handle->ret = ret;
-            ret = HG_Core_respond((hg_core_handle_t) hg_core_handle, NULL, NULL,
-                0, header_size);
-            if (ret != HG_SUCCESS) {
-                HG_LOG_ERROR("Could not respond");
+        /* Hand RPC callback over to executor, which also takes care of
+         * releasing the handle once the callback has run */
+        if (hg_core_get_executor(hg_core_handle, &executor)) {
+            hg_core_handle->thread_work.func = hg_core_process_thread;
+            hg_core_handle->thread_work.args = hg_core_handle;
+            if (executor.post(executor.arg, &hg_core_handle->thread_work)
+                == HG_UTIL_SUCCESS)
                 goto done;
-            }
+            HG_LOG_WARNING("Could not post RPC callback to executor, "
+                "executing it from trigger");
         }
 
-        /* No response callback */
-        if (hg_core_handle->no_response) {
-            ret = hg_core_handle->no_respond(hg_core_handle);
-            if (ret != HG_SUCCESS) {
-                HG_LOG_ERROR("Could not complete handle");
-                goto done;
-            }
-        }
+        /* Run RPC callback */
+        ret = hg_core_process_run(hg_core_handle);
+        if (ret != HG_SUCCESS)
+            goto done;
     } else {
         hg_core_cb_t hg_cb = NULL;
         struct hg_core_cb_info hg_core_cb_info;
@@ -3496,6 +4489,12 @@ hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle)
                 HG_FALLTHROUGH();
 #endif
             case HG_CORE_FORWARD:
+#ifdef HG_HAS_TAG_CHECK
+                /* Request tag can now be reused */
+                if (hg_core_handle->op_type == HG_CORE_FORWARD
+                    && !hg_core_handle->no_response)
+                    hg_core_tag_release(hg_core_handle);
+#endif
                 hg_cb = hg_core_handle->request_callback;
                 hg_core_cb_info.arg = hg_core_handle->request_arg;
                 hg_core_cb_info.type = HG_CB_FORWARD;
@@ -3533,6 +4532,18 @@ hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle)
             hg_cb(&hg_core_cb_info);
     }
 
+    ret = hg_core_trigger_release(hg_core_handle);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_trigger_release(struct hg_core_private_handle *hg_core_handle)
+{
+    hg_return_t ret = HG_SUCCESS;
+
     /* Repost handle if we were listening, otherwise destroy it */
     if (hg_core_handle->repost
         && !HG_CORE_HANDLE_CONTEXT(hg_core_handle)->finalizing) {
@@ -3549,6 +4560,101 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_bool_t
+hg_core_get_executor(struct hg_core_private_handle *hg_core_handle,
+    struct hg_executor *executor)
+{
+    struct hg_core_private_class *hg_core_class =
+        HG_CORE_HANDLE_CLASS(hg_core_handle);
+    struct hg_core_private_rpc_info *hg_core_rpc_info;
+
+    /* Retrieve exe function from function map, executor is copied while the
+     * lock is held as HG_Core_registered_set_executor() may update it */
+    executor->post = NULL;
+    hg_thread_spin_lock(&hg_core_class->func_map_lock);
+    hg_core_rpc_info = (struct hg_core_private_rpc_info *) hg_hash_table_lookup(
+        hg_core_class->func_map,
+        (hg_hash_table_key_t) &hg_core_handle->core_handle.info.id);
+    if (hg_core_rpc_info)
+        *executor = hg_core_rpc_info->executor;
+    hg_thread_spin_unlock(&hg_core_class->func_map_lock);
+
+    /* Cache RPC info */
+    hg_core_handle->core_handle.rpc_info = (struct hg_core_rpc_info *)
+        hg_core_rpc_info;
+
+    /* RPC executor takes precedence over class executor */
+    if (hg_core_rpc_info && !executor->post)
+        *executor = hg_core_class->executor;
+
+    return (executor->post != NULL);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_process_run(struct hg_core_private_handle *hg_core_handle)
+{
+    hg_return_t ret;
+
+    /* Run RPC callback */
+    ret = hg_core_process(hg_core_handle);
+    if (ret != HG_SUCCESS && !hg_core_handle->no_response) {
+        hg_size_t header_size = hg_core_header_response_get_size() +
+            hg_core_handle->core_handle.na_out_header_offset;
+
+        /* Respond in case of error */
+        hg_core_handle->ret = ret;
+        ret = HG_Core_respond((hg_core_handle_t) hg_core_handle, NULL, NULL,
+            0, header_size);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not respond");
+            goto done;
+        }
+    }
+
+    /* No response callback */
+    if (hg_core_handle->no_response) {
+        ret = hg_core_handle->no_respond(hg_core_handle);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not complete handle");
+            goto done;
+        }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_core_process_thread(void *arg)
+{
+    struct hg_core_private_handle *hg_core_handle =
+        (struct hg_core_private_handle *) arg;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+
+    if (hg_core_process_run(hg_core_handle) != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not process handle");
+        goto done;
+    }
+
+    if (hg_core_trigger_release(hg_core_handle) != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not release handle");
+        goto done;
+    }
+
+done:
+    return thread_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_core_executor_pool_post(void *arg, struct hg_thread_work *work)
+{
+    return hg_thread_pool_post((hg_thread_pool_t *) arg, work);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_cancel(struct hg_core_private_handle *hg_core_handle)
@@ -3697,10 +4803,11 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
 {
     hg_return_t ret = HG_SUCCESS;
     struct hg_core_private_context *context = NULL;
+    hg_util_uint32_t context_index;
+    na_tag_t shared_index;
     int na_poll_fd;
-#ifdef HG_HAS_SELF_FORWARD
     int fd;
-#endif
+    unsigned int i;
 
     if (!hg_core_class) {
         HG_LOG_ERROR("NULL HG core class");
@@ -3730,11 +4837,47 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
 #ifdef HG_HAS_SM_ROUTING
     HG_LIST_INIT(&context->sm_pending_list);
 #endif
+#ifdef HG_HAS_HANDLE_TRACKING
     HG_LIST_INIT(&context->created_list);
+#endif
 
     /* No handle created yet */
     hg_atomic_init32(&context->n_handles, 0);
 
+    /* Reset per-context RPC counters */
+    hg_atomic_init32(&context->rpc_count, 0);
+    hg_atomic_init32(&context->rpc_steered_count, 0);
+    hg_atomic_init32(&context->rpc_shared_count, 0);
+
+    /* Initialize atomic for tags and assign context index used in tags, the
+     * last index is reserved for contexts that do not fit into the reserved
+     * bits (all contexts if no bit is reserved) and that share the class
+     * counter so that their tags do not collide */
+    hg_atomic_init32(&context->request_tag, 0);
+    context_index = (hg_util_uint32_t) (hg_atomic_incr32(
+        &HG_CORE_CONTEXT_CLASS(context)->context_index) - 1);
+    shared_index = (na_tag_t) ((1U
+        << HG_CORE_CONTEXT_CLASS(context)->request_tag_shift) - 1);
+    if (context_index < shared_index) {
+        context->request_tag_index = (na_tag_t) context_index;
+        context->request_tag_counter = &context->request_tag;
+    } else {
+        context->request_tag_index = shared_index;
+        context->request_tag_counter =
+            &HG_CORE_CONTEXT_CLASS(context)->request_tag;
+    }
+
+#ifdef HG_HAS_TAG_CHECK
+    /* Create map of outstanding tags */
+    context->tag_map = hg_hash_table_new(hg_core_tag_hash, hg_core_tag_equal);
+    if (!context->tag_map) {
+        HG_LOG_ERROR("Could not create tag map");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    hg_thread_spin_init(&context->tag_map_lock);
+#endif
+
     /* Initialize completion queue mutex/cond */
     hg_thread_mutex_init(&context->completion_queue_mutex);
     hg_thread_cond_init(&context->completion_queue_cond);
@@ -3744,7 +4887,9 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
 #ifdef HG_HAS_SM_ROUTING
     hg_thread_spin_init(&context->sm_pending_list_lock);
 #endif
+#ifdef HG_HAS_HANDLE_TRACKING
     hg_thread_spin_init(&context->created_list_lock);
+#endif
 
     context->core_context.na_context = NA_Context_create_id(
         hg_core_class->na_class, id);
@@ -3765,6 +4910,30 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
     }
 #endif
 
+    /* Create NA contexts of rails, the first rail is the NA context */
+    if (hg_core_class->na_rail_count > 1) {
+        unsigned int rail_id = HG_CORE_CONTEXT_CLASS(context)->rail_context_base
+            + (unsigned int) id * (hg_core_class->na_rail_count - 1);
+
+        context->core_context.na_rails = (na_context_t **) calloc(
+            hg_core_class->na_rail_count, sizeof(na_context_t *));
+        if (!context->core_context.na_rails) {
+            HG_LOG_ERROR("Could not allocate NA rails");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        context->core_context.na_rails[0] = context->core_context.na_context;
+        for (i = 1; i < hg_core_class->na_rail_count; i++) {
+            context->core_context.na_rails[i] = NA_Context_create_id(
+                hg_core_class->na_class, (na_uint8_t) (rail_id + i - 1));
+            if (!context->core_context.na_rails[i]) {
+                HG_LOG_ERROR("Could not create NA context of rail %u", i);
+                ret = HG_NA_ERROR;
+                goto done;
+            }
+        }
+    }
+
     /* Create poll set */
     context->poll_set = hg_poll_create();
     if (!context->poll_set) {
@@ -3773,8 +4942,9 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
         goto done;
     }
 
-#ifdef HG_HAS_SELF_FORWARD
-    /* Create event for completion queue notification */
+    /* Create event for completion queue notification (used when completions
+     * are added to the queue by a thread that is not making progress on
+     * that context, e.g., self forward or steered RPCs) */
     fd = hg_event_create();
     if (fd < 0) {
         HG_LOG_ERROR("Could not create event");
@@ -3786,7 +4956,6 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
     /* Add event to context poll set */
     hg_poll_add(context->poll_set, fd, HG_POLLIN,
         hg_core_completion_queue_notify_cb, context);
-#endif
 
     if (HG_CORE_CONTEXT_CLASS(context)->progress_mode == NA_NO_BLOCK)
         /* Force to use progress poll */
@@ -3805,6 +4974,15 @@ HG_Core_context_create_id(hg_core_class_t *hg_core_class, hg_uint8_t id)
     } else
         context->progress = hg_core_progress_na;
 
+    /* Rails that have their own fd wake up the same callback */
+    for (i = 1; context->core_context.na_rails
+        && i < hg_core_class->na_rail_count; i++) {
+        na_poll_fd = hg_core_rail_poll_fd(context, i);
+        if (na_poll_fd >= 0)
+            hg_poll_add(context->poll_set, na_poll_fd, HG_POLLIN,
+                hg_core_progress_na_cb, context);
+    }
+
 #ifdef HG_HAS_SM_ROUTING
     /* Auto SM requires hg_core_progress_poll */
     if (context->core_context.na_sm_context) {
@@ -3855,9 +5033,14 @@ HG_Core_context_destroy(hg_core_context_t *context)
     unsigned int actual_count;
     int na_poll_fd;
     hg_util_int32_t n_handles;
+    unsigned int i;
 
     if (!context) goto done;
 
+    /* Stop steering RPCs to that context */
+    if (private_context->steering)
+        hg_core_steering_remove(private_context);
+
     /* Prevent repost of handles */
     private_context->finalizing = HG_TRUE;
 
@@ -3894,6 +5077,13 @@ HG_Core_context_destroy(hg_core_context_t *context)
         } while ((na_ret == NA_SUCCESS) && actual_count);
     }
 #endif
+    for (i = 1; context->na_rails && i < context->core_class->na_rail_count
+        && context->na_rails[i]; i++) {
+        do {
+            na_ret = NA_Trigger(context->na_rails[i], 0, 1, NULL,
+                &actual_count);
+        } while ((na_ret == NA_SUCCESS) && actual_count);
+    }
 
     /* Check that operations have completed */
     ret = hg_core_created_list_wait(private_context);
@@ -3905,15 +5095,19 @@ HG_Core_context_destroy(hg_core_context_t *context)
     /* Number of handles for that context should be 0 */
     n_handles = hg_atomic_get32(&private_context->n_handles);
     if (n_handles != 0) {
+#ifdef HG_HAS_HANDLE_TRACKING
         struct hg_core_private_handle *hg_core_handle = NULL;
+#endif
         HG_LOG_ERROR("HG core handles must be freed before destroying context "
             "(%d remaining)", n_handles);
+#ifdef HG_HAS_HANDLE_TRACKING
         hg_thread_spin_lock(&private_context->created_list_lock);
         HG_LIST_FOREACH(hg_core_handle, &private_context->created_list, created) {
             HG_LOG_ERROR("HG core handle at address %p was not destroyed",
                 hg_core_handle);
         }
         hg_thread_spin_unlock(&private_context->created_list_lock);
+#endif
         ret = HG_PROTOCOL_ERROR;
         goto done;
     }
@@ -3936,7 +5130,6 @@ HG_Core_context_destroy(hg_core_context_t *context)
     }
     hg_thread_mutex_unlock(&private_context->completion_queue_mutex);
 
-#ifdef HG_HAS_SELF_FORWARD
     if (private_context->completion_queue_notify > 0) {
         if (hg_poll_remove(private_context->poll_set,
             private_context->completion_queue_notify) != HG_UTIL_SUCCESS) {
@@ -3951,7 +5144,6 @@ HG_Core_context_destroy(hg_core_context_t *context)
             goto done;
         }
     }
-#endif
 
     if (HG_CORE_CONTEXT_CLASS(private_context)->progress_mode == NA_NO_BLOCK)
         /* Was forced to use progress poll */
@@ -3967,6 +5159,17 @@ HG_Core_context_destroy(hg_core_context_t *context)
         ret = HG_PROTOCOL_ERROR;
         goto done;
     }
+    for (i = 1; context->na_rails && i < context->core_class->na_rail_count
+        && context->na_rails[i]; i++) {
+        na_poll_fd = hg_core_rail_poll_fd(private_context, i);
+        if ((na_poll_fd >= 0)
+            && hg_poll_remove(private_context->poll_set, na_poll_fd)
+            != HG_UTIL_SUCCESS) {
+            HG_LOG_ERROR("Could not remove NA rail descriptor from poll set");
+            ret = HG_PROTOCOL_ERROR;
+            goto done;
+        }
+    }
 
 #ifdef HG_HAS_SM_ROUTING
     if (context->na_sm_context) {
@@ -4012,6 +5215,20 @@ HG_Core_context_destroy(hg_core_context_t *context)
     }
 #endif
 
+    /* Destroy NA contexts of rails (first one is NA context) */
+    if (context->na_rails) {
+        for (i = 1; i < context->core_class->na_rail_count; i++) {
+            if (context->na_rails[i] && NA_Context_destroy(
+                context->core_class->na_class, context->na_rails[i])
+                != NA_SUCCESS) {
+                HG_LOG_ERROR("Could not destroy NA context of rail %u", i);
+                ret = HG_NA_ERROR;
+                goto done;
+            }
+        }
+        free(context->na_rails);
+    }
+
     /* Free user data */
     if (context->data_free_callback)
         context->data_free_callback(context->data);
@@ -4023,7 +5240,14 @@ HG_Core_context_destroy(hg_core_context_t *context)
 #ifdef HG_HAS_SM_ROUTING
     hg_thread_spin_destroy(&private_context->sm_pending_list_lock);
 #endif
+#ifdef HG_HAS_HANDLE_TRACKING
     hg_thread_spin_destroy(&private_context->created_list_lock);
+#endif
+#ifdef HG_HAS_TAG_CHECK
+    if (private_context->tag_map)
+        hg_hash_table_free(private_context->tag_map);
+    hg_thread_spin_destroy(&private_context->tag_map_lock);
+#endif
 
     /* Decrement context count of parent class */
     hg_atomic_decr32(&HG_CORE_CONTEXT_CLASS(private_context)->n_contexts);
@@ -4056,6 +5280,76 @@ HG_Core_context_set_handle_create_callback(hg_core_context_t *context,
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_context_set_steering(hg_core_context_t *context, hg_bool_t enable,
+    unsigned int share_threshold)
+{
+    struct hg_core_private_context *private_context =
+        (struct hg_core_private_context *) context;
+    struct hg_core_private_class *hg_core_class;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    hg_core_class = HG_CORE_CONTEXT_CLASS(private_context);
+
+    if (!enable) {
+        if (private_context->steering)
+            hg_core_steering_remove(private_context);
+        goto done;
+    }
+
+    hg_thread_rwlock_wrlock(&hg_core_class->steer_lock);
+    private_context->share_threshold = share_threshold;
+    if (!private_context->steering) {
+        /* Last context registered with a given ID receives its RPCs */
+        hg_core_class->steer_contexts[context->id] = private_context;
+        hg_core_class->share_contexts[hg_core_class->n_share_contexts++] =
+            private_context;
+        private_context->steering = HG_TRUE;
+        hg_atomic_incr32(&hg_core_class->n_steer_contexts);
+    }
+    hg_thread_rwlock_release_wrlock(&hg_core_class->steer_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_context_get_stats(hg_core_context_t *context,
+    struct hg_context_stats *stats)
+{
+    struct hg_core_private_context *private_context =
+        (struct hg_core_private_context *) context;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!stats) {
+        HG_LOG_ERROR("NULL stats pointer");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    stats->rpc_count =
+        (hg_uint64_t) hg_atomic_get32(&private_context->rpc_count);
+    stats->rpc_steered =
+        (hg_uint64_t) hg_atomic_get32(&private_context->rpc_steered_count);
+    stats->rpc_shared =
+        (hg_uint64_t) hg_atomic_get32(&private_context->rpc_shared_count);
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_context_post(hg_core_context_t *context, unsigned int request_count,
@@ -4094,6 +5388,58 @@ HG_Core_context_post(hg_core_context_t *context, unsigned int request_count,
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_context_unpost(hg_core_context_t *context)
+{
+    struct hg_core_private_context *private_context =
+        (struct hg_core_private_context *) context;
+    unsigned int actual_count;
+    na_return_t na_ret;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    /* Check pending list and cancel posted handles */
+    if (!HG_LIST_IS_EMPTY(&private_context->pending_list)) {
+        ret = hg_core_pending_list_cancel(private_context);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Cannot cancel list of pending entries");
+            goto done;
+        }
+    }
+#ifdef HG_HAS_SM_ROUTING
+    /* Check pending list and cancel posted handles */
+    if (!HG_LIST_IS_EMPTY(&private_context->sm_pending_list)) {
+        ret = hg_core_sm_pending_list_cancel(private_context);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Cannot cancel list of SM pending entries");
+            goto done;
+        }
+    }
+#endif
+
+    /* Trigger canceled operations so that handles get released */
+    do {
+        na_ret = NA_Trigger(context->na_context, 0, 1, NULL, &actual_count);
+    } while ((na_ret == NA_SUCCESS) && actual_count);
+#ifdef HG_HAS_SM_ROUTING
+    if (context->na_sm_context) {
+        do {
+            na_ret = NA_Trigger(context->na_sm_context, 0, 1, NULL,
+                &actual_count);
+        } while ((na_ret == NA_SUCCESS) && actual_count);
+    }
+#endif
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_register(hg_core_class_t *hg_core_class, hg_id_t id,
@@ -4102,6 +5448,7 @@ HG_Core_register(hg_core_class_t *hg_core_class, hg_id_t id,
     struct hg_core_private_class *private_class =
         (struct hg_core_private_class *) hg_core_class;
     hg_id_t *func_key = NULL;
+    struct hg_core_private_rpc_info *private_rpc_info = NULL;
     struct hg_core_rpc_info *hg_core_rpc_info = NULL;
     hg_return_t ret = HG_SUCCESS;
     int hash_ret;
@@ -4131,17 +5478,20 @@ HG_Core_register(hg_core_class_t *hg_core_class, hg_id_t id,
         *func_key = id;
 
         /* Fill info and store it into the function map */
-        hg_core_rpc_info = (struct hg_core_rpc_info *) malloc(
-            sizeof(struct hg_core_rpc_info));
-        if (!hg_core_rpc_info) {
+        private_rpc_info = (struct hg_core_private_rpc_info *) malloc(
+            sizeof(struct hg_core_private_rpc_info));
+        if (!private_rpc_info) {
             HG_LOG_ERROR("Could not allocate HG info");
             ret = HG_NOMEM_ERROR;
             goto done;
         }
+        hg_core_rpc_info = &private_rpc_info->core_rpc_info;
 
         hg_core_rpc_info->rpc_cb = rpc_cb;
         hg_core_rpc_info->data = NULL;
         hg_core_rpc_info->free_callback = NULL;
+        private_rpc_info->executor.post = NULL;
+        private_rpc_info->executor.arg = NULL;
 
         hg_thread_spin_lock(&private_class->func_map_lock);
         hash_ret = hg_hash_table_insert(private_class->func_map,
@@ -4157,7 +5507,7 @@ HG_Core_register(hg_core_class_t *hg_core_class, hg_id_t id,
 done:
     if (ret != HG_SUCCESS) {
         free(func_key);
-        free(hg_core_rpc_info);
+        free(private_rpc_info);
     }
     return ret;
 }
@@ -4283,6 +5633,49 @@ done:
    return data;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_registered_set_executor(hg_core_class_t *hg_core_class, hg_id_t id,
+    const struct hg_executor *executor)
+{
+    struct hg_core_private_class *private_class =
+        (struct hg_core_private_class *) hg_core_class;
+    struct hg_core_private_rpc_info *hg_core_rpc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_core_class) {
+        HG_LOG_ERROR("NULL HG core class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (executor && !executor->post) {
+        HG_LOG_ERROR("NULL executor post function");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_thread_spin_lock(&private_class->func_map_lock);
+    hg_core_rpc_info = (struct hg_core_private_rpc_info *) hg_hash_table_lookup(
+        private_class->func_map, (hg_hash_table_key_t) &id);
+    if (hg_core_rpc_info) {
+        if (executor)
+            hg_core_rpc_info->executor = *executor;
+        else {
+            hg_core_rpc_info->executor.post = NULL;
+            hg_core_rpc_info->executor.arg = NULL;
+        }
+    }
+    hg_thread_spin_unlock(&private_class->func_map_lock);
+    if (!hg_core_rpc_info) {
+        HG_LOG_ERROR("Could not find RPC ID in function map");
+        ret = HG_NO_MATCH;
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_addr_lookup(hg_core_context_t *context, hg_core_cb_t callback,
@@ -4317,6 +5710,49 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_addr_lookup_multi(hg_core_context_t *context, hg_core_cb_t callback,
+    void *arg, const char **names, hg_core_addr_t *addrs, unsigned int count,
+    hg_core_op_id_t *op_id)
+{
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!callback) {
+        HG_LOG_ERROR("NULL callback");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!names || !addrs || !count) {
+        HG_LOG_ERROR("NULL lookup names or addresses");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    for (i = 0; i < count; i++) {
+        if (!names[i]) {
+            HG_LOG_ERROR("NULL lookup name at index %u", i);
+            ret = HG_INVALID_PARAM;
+            goto done;
+        }
+    }
+
+    ret = hg_core_addr_lookup_multi((struct hg_core_private_context *) context,
+        callback, arg, names, addrs, count, op_id);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not lookup addresses");
+        goto done;
+    }
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_addr_create(hg_core_class_t *hg_core_class, hg_core_addr_t *addr)
@@ -4385,6 +5821,11 @@ HG_Core_addr_set_remove(hg_core_class_t *hg_core_class, hg_core_addr_t addr)
         goto done;
     }
 
+    /* Address must no longer be returned by lookups */
+    if (((struct hg_core_private_class *) hg_core_class)->addr_cache)
+        hg_core_addr_cache_remove(
+            (struct hg_core_private_class *) hg_core_class, hg_core_addr);
+
     na_ret = NA_Addr_set_remove(hg_core_addr->core_addr.na_class,
         hg_core_addr->core_addr.na_addr);
     if (na_ret != NA_SUCCESS) {
@@ -4754,6 +6195,9 @@ HG_Core_forward(hg_core_handle_t handle, hg_core_cb_t callback, void *arg,
      * which context ID it needs to send the response to. */
     hg_core_handle->in_header.msg.request.cookie =
         hg_core_handle->core_handle.info.context->id;
+    /* Target ID is used by the target to steer the RPC to that context */
+    hg_core_handle->in_header.msg.request.target_id =
+        hg_core_handle->core_handle.info.context_id;
 
     /* Encode request header */
     ret = hg_core_proc_header_request(&hg_core_handle->core_handle,
@@ -365,6 +365,45 @@ HG_Core_context_get_na_sm(
         );
 #endif
 
+/**
+ * Retrieve number of rails of context, i.e., NA contexts that large bulk
+ * transfers are striped across (see hg_init_info rail_count).
+ *
+ * \param context [IN]          pointer to HG core context
+ *
+ * \return Number of rails (1 if context has no additional rail)
+ */
+static HG_INLINE unsigned int
+HG_Core_context_get_na_rail_count(
+        const hg_core_context_t *context
+        );
+
+/**
+ * Retrieve NA context of rail, rail 0 is the underlying NA context.
+ *
+ * \param context [IN]          pointer to HG core context
+ * \param rail [IN]             rail index
+ *
+ * \return the associated context
+ */
+static HG_INLINE na_context_t *
+HG_Core_context_get_na_rail(
+        const hg_core_context_t *context,
+        unsigned int rail
+        );
+
+/**
+ * Retrieve size of chunks striped across rails of context.
+ *
+ * \param context [IN]          pointer to HG core context
+ *
+ * \return chunk size
+ */
+static HG_INLINE hg_size_t
+HG_Core_context_get_na_rail_chunk_size(
+        const hg_core_context_t *context
+        );
+
 /**
  * Retrieve context ID from context.
  *
@@ -425,6 +464,47 @@ HG_Core_context_set_handle_create_callback(
         void *arg
         );
 
+/**
+ * Register context for RPC steering. Once registered, RPCs received on any
+ * context of the class whose target ID matches the ID of that context are
+ * queued to it (see HG_Core_set_target_id()), so that each context can be
+ * progressed and triggered by its own thread. If share_threshold is non-zero
+ * and the number of entries in the completion queue of the target context
+ * exceeds it, RPCs are instead queued to the least loaded registered context.
+ * Setting enable to HG_FALSE unregisters the context, which is also done
+ * implicitly when the context is destroyed.
+ *
+ * \remark If the NA plugin does not expose a poll descriptor, steered RPCs
+ * are only noticed by the target context once its progress timeout expires.
+ *
+ * \param context [IN]          pointer to HG core context
+ * \param enable [IN]           enable / disable steering to that context
+ * \param share_threshold [IN]  queue depth above which RPCs are shared
+ *                              (0 disables sharing)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Core_context_set_steering(
+        hg_core_context_t *context,
+        hg_bool_t enable,
+        unsigned int share_threshold
+        );
+
+/**
+ * Retrieve RPC counters of a given context.
+ *
+ * \param context [IN]          pointer to HG core context
+ * \param stats [OUT]           pointer to stats struct
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Core_context_get_stats(
+        hg_core_context_t *context,
+        struct hg_context_stats *stats
+        );
+
 /**
  * Post requests associated to context in order to receive incoming RPCs.
  * Requests are automatically re-posted after completion depending on the
@@ -445,6 +525,22 @@ HG_Core_context_post(
         hg_bool_t repost
         );
 
+/**
+ * Cancel requests previously posted on context, the context then no longer
+ * receives RPCs by itself and only executes RPCs steered to it (see
+ * HG_Core_context_set_steering()). This is meant for plugins where all
+ * contexts share the same endpoint and where a single context can therefore
+ * receive RPCs on behalf of other contexts.
+ *
+ * \param context [IN]          pointer to HG core context
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Core_context_unpost(
+        hg_core_context_t *context
+        );
+
 /**
  * Dynamically register an RPC ID as well as the RPC callback executed
  * when the RPC request ID is received.
@@ -529,10 +625,32 @@ HG_Core_registered_data(
         hg_id_t id
         );
 
+/**
+ * Set executor used for running the RPC callback associated to id. By
+ * default, RPC callbacks are executed from HG_Core_trigger() or, if an
+ * executor was passed through hg_init_info, from that executor. Work items
+ * are embedded in the handle so that dispatching requires no allocation.
+ *
+ * \param hg_core_class [IN]    pointer to HG core class
+ * \param id [IN]               registered function ID
+ * \param executor [IN]         pointer to executor (NULL to reset default)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Core_registered_set_executor(
+        hg_core_class_t *hg_core_class,
+        hg_id_t id,
+        const struct hg_executor *executor
+        );
+
 /**
  * Lookup an addr from a peer address/name. Addresses need to be
  * freed by calling HG_Core_addr_free(). After completion, user callback is
  * placed into a completion queue and can be triggered using HG_Core_trigger().
+ * If the class was initialized with a non-zero addr_cache_size, addresses
+ * are cached by name and subsequent lookups of the same name complete
+ * immediately.
  *
  * \param context [IN]          pointer to context of execution
  * \param callback [IN]         pointer to function callback
@@ -551,6 +669,37 @@ HG_Core_addr_lookup(
         hg_core_op_id_t *op_id
         );
 
+/**
+ * Lookup multiple addrs concurrently. All lookups are started before
+ * progress is made so that plugins can overlap connection setup. Once all
+ * lookups have completed, addrs is filled and a single user callback is
+ * placed into a completion queue and can be triggered using HG_Core_trigger().
+ * Addresses that could not be looked up are set to HG_CORE_ADDR_NULL and the
+ * callback return value is set to the error of the last failed lookup.
+ * Addresses need to be freed by calling HG_Core_addr_free().
+ *
+ * \param context [IN]          pointer to context of execution
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param names [IN]            array of lookup names
+ * \param addrs [OUT]           array of count addresses, must remain valid
+ *                              until callback is triggered
+ * \param count [IN]            number of names to lookup
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Core_addr_lookup_multi(
+        hg_core_context_t *context,
+        hg_core_cb_t callback,
+        void *arg,
+        const char **names,
+        hg_core_addr_t *addrs,
+        unsigned int count,
+        hg_core_op_id_t *op_id
+        );
+
 /**
  * Create a HG core address.
  *
@@ -583,7 +732,7 @@ HG_Core_addr_free(
  * Hint that the address is no longer valid. This may happen if the peer is
  * no longer responding. This can be used to force removal of the
  * peer address from the list of the peers, before freeing it and reclaim
- * resources.
+ * resources. The address is also removed from the lookup cache.
  *
  * \param hg_core_class [IN]    pointer to HG core class
  * \param addr [IN]             abstract address
@@ -979,6 +1128,8 @@ struct hg_core_class {
 #ifdef HG_HAS_SM_ROUTING
     na_class_t *na_sm_class;            /* NA SM class */
 #endif
+    unsigned int na_rail_count;         /* Number of NA contexts per context */
+    hg_size_t na_rail_chunk_size;       /* Size of chunks striped on rails */
     void *data;                         /* User data */
     void (*data_free_callback)(void *); /* User data free callback */
 };
@@ -990,6 +1141,7 @@ struct hg_core_context {
 #ifdef HG_HAS_SM_ROUTING
     na_context_t *na_sm_context;        /* NA SM context */
 #endif
+    na_context_t **na_rails;            /* NA contexts of rails (or NULL) */
     hg_uint8_t id;                      /* Context ID */
     void *data;                         /* User data */
     void (*data_free_callback)(void *); /* User data free callback */
@@ -1199,6 +1351,46 @@ HG_Core_context_get_na_sm(const hg_core_context_t *context)
 }
 #endif
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+HG_Core_context_get_na_rail_count(const hg_core_context_t *context)
+{
+#ifdef HG_HAS_VERBOSE_ERROR
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        return 0;
+    }
+#endif
+    return context->na_rails ? context->core_class->na_rail_count : 1;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE na_context_t *
+HG_Core_context_get_na_rail(const hg_core_context_t *context,
+    unsigned int rail)
+{
+#ifdef HG_HAS_VERBOSE_ERROR
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        return NULL;
+    }
+#endif
+    return context->na_rails ? context->na_rails[rail] : context->na_context;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+HG_Core_context_get_na_rail_chunk_size(const hg_core_context_t *context)
+{
+#ifdef HG_HAS_VERBOSE_ERROR
+    if (!context) {
+        HG_LOG_ERROR("NULL HG core context");
+        return 0;
+    }
+#endif
+    return context->core_class->na_rail_chunk_size;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_uint8_t
 HG_Core_context_get_id(const hg_core_context_t *context)
@@ -13,7 +13,7 @@
 #include "mercury_error.h"
 
 #ifdef HG_HAS_CHECKSUMS
-# include <mchecksum.h>
+# include "mercury_checksum.h"
 #endif
 
 #ifdef _WIN32
@@ -28,19 +28,10 @@
 /* Local Macros */
 /****************/
 
-#define HG_CORE_HEADER_CHECKSUM "crc16"
-
 /* Helper macros for encoding header */
-#ifdef HG_HAS_CHECKSUMS
-# define HG_CORE_HEADER_PROC(hg_header, buf_ptr, data, op) do {     \
+#define HG_CORE_HEADER_PROC(hg_header, buf_ptr, data, op) do {      \
     buf_ptr = hg_proc_buf_memcpy(buf_ptr, &data, sizeof(data), op); \
-    mchecksum_update(hg_header->checksum, &data, sizeof(data));     \
 } while (0)
-#else
-# define HG_CORE_HEADER_PROC(hg_header, buf_ptr, data, op) do {     \
-    buf_ptr = hg_proc_buf_memcpy(buf_ptr, &data, sizeof(data), op); \
-} while (0)
-#endif
 
 #define HG_CORE_HEADER_PROC16(hg_header, buf_ptr, data, op, tmp) do {       \
     hg_uint16_t tmp;                                                        \
@@ -82,10 +73,6 @@ HG_Error_to_string(
 void
 hg_core_header_request_init(struct hg_core_header *hg_core_header)
 {
-#ifdef HG_HAS_CHECKSUMS
-    /* Create a new checksum (CRC16) */
-    mchecksum_init(HG_CORE_HEADER_CHECKSUM, &hg_core_header->checksum);
-#endif
     hg_core_header_request_reset(hg_core_header);
 }
 
@@ -93,10 +80,6 @@ hg_core_header_request_init(struct hg_core_header *hg_core_header)
 void
 hg_core_header_response_init(struct hg_core_header *hg_core_header)
 {
-#ifdef HG_HAS_CHECKSUMS
-    /* Create a new checksum (CRC16) */
-    mchecksum_init(HG_CORE_HEADER_CHECKSUM, &hg_core_header->checksum);
-#endif
     hg_core_header_response_reset(hg_core_header);
 }
 
@@ -104,24 +87,14 @@ hg_core_header_response_init(struct hg_core_header *hg_core_header)
 void
 hg_core_header_request_finalize(struct hg_core_header *hg_core_header)
 {
-#ifdef HG_HAS_CHECKSUMS
-    mchecksum_destroy(hg_core_header->checksum);
-    hg_core_header->checksum = MCHECKSUM_OBJECT_NULL;
-#else
     (void) hg_core_header;
-#endif
 }
 
 /*---------------------------------------------------------------------------*/
 void
 hg_core_header_response_finalize(struct hg_core_header *hg_core_header)
 {
-#ifdef HG_HAS_CHECKSUMS
-    mchecksum_destroy(hg_core_header->checksum);
-    hg_core_header->checksum = MCHECKSUM_OBJECT_NULL;
-#else
     (void) hg_core_header;
-#endif
 }
 
 /*---------------------------------------------------------------------------*/
@@ -132,9 +105,6 @@ hg_core_header_request_reset(struct hg_core_header *hg_core_header)
         sizeof(struct hg_core_header_request));
     hg_core_header->msg.request.hg = HG_CORE_IDENTIFIER;
     hg_core_header->msg.request.protocol = HG_CORE_PROTOCOL_VERSION;
-#ifdef HG_HAS_CHECKSUMS
-    mchecksum_reset(hg_core_header->checksum);
-#endif
 }
 
 /*---------------------------------------------------------------------------*/
@@ -143,9 +113,6 @@ hg_core_header_response_reset(struct hg_core_header *hg_core_header)
 {
     memset(&hg_core_header->msg.response, 0,
         sizeof(struct hg_core_header_response));
-#ifdef HG_HAS_CHECKSUMS
-    mchecksum_reset(hg_core_header->checksum);
-#endif
 }
 
 /*---------------------------------------------------------------------------*/
@@ -156,7 +123,7 @@ hg_core_header_request_proc(hg_proc_op_t op, void *buf, size_t buf_size,
     void *buf_ptr = buf;
     struct hg_core_header_request *header = &hg_core_header->msg.request;
 #ifdef HG_HAS_CHECKSUMS
-    hg_uint16_t n_hash_header;
+    hg_uint32_t n_hash_header;
 #endif
     hg_return_t ret = HG_SUCCESS;
 
@@ -166,11 +133,6 @@ hg_core_header_request_proc(hg_proc_op_t op, void *buf, size_t buf_size,
         goto done;
     }
 
-#ifdef HG_HAS_CHECKSUMS
-    /* Reset header checksum first */
-    mchecksum_reset(hg_core_header->checksum);
-#endif
-
     /* HG byte */
     HG_CORE_HEADER_PROC(hg_core_header, buf_ptr, header->hg, op);
 
@@ -186,17 +148,20 @@ hg_core_header_request_proc(hg_proc_op_t op, void *buf, size_t buf_size,
     /* Cookie */
     HG_CORE_HEADER_PROC(hg_core_header, buf_ptr, header->cookie, op);
 
+    /* Target ID */
+    HG_CORE_HEADER_PROC(hg_core_header, buf_ptr, header->target_id, op);
+
 #ifdef HG_HAS_CHECKSUMS
-    /* Checksum of header */
-    mchecksum_get(hg_core_header->checksum, &header->hash.header,
-        sizeof(header->hash.header), MCHECKSUM_FINALIZE);
+    /* Checksum of header (single pass over encoded fields) */
+    header->hash.header = hg_checksum_crc32c(0, buf,
+        (hg_size_t) ((char *) buf_ptr - (char *) buf));
     if (op == HG_ENCODE)
-        n_hash_header = (hg_uint16_t) htons(header->hash.header);
+        n_hash_header = (hg_uint32_t) htonl(header->hash.header);
     hg_proc_buf_memcpy(buf_ptr, &n_hash_header, sizeof(n_hash_header), op);
     if (op == HG_DECODE) {
-        hg_uint16_t h_hash_header = ntohs(n_hash_header);
+        hg_uint32_t h_hash_header = ntohl(n_hash_header);
         if (header->hash.header != h_hash_header) {
-            HG_LOG_ERROR("checksum 0x%04X does not match (expected 0x%04X!)",
+            HG_LOG_ERROR("checksum 0x%08X does not match (expected 0x%08X!)",
                 header->hash.header, h_hash_header);
             ret = HG_CHECKSUM_ERROR;
             goto done;
@@ -216,7 +181,7 @@ hg_core_header_response_proc(hg_proc_op_t op, void *buf, size_t buf_size,
     void *buf_ptr = buf;
     struct hg_core_header_response *header = &hg_core_header->msg.response;
 #ifdef HG_HAS_CHECKSUMS
-    hg_uint16_t n_hash_header;
+    hg_uint32_t n_hash_header;
 #endif
     hg_return_t ret = HG_SUCCESS;
 
@@ -226,11 +191,6 @@ hg_core_header_response_proc(hg_proc_op_t op, void *buf, size_t buf_size,
         goto done;
     }
 
-#ifdef HG_HAS_CHECKSUMS
-    /* Reset header checksum first */
-    mchecksum_reset(hg_core_header->checksum);
-#endif
-
     /* Return code */
     HG_CORE_HEADER_PROC(hg_core_header, buf_ptr, header->ret_code, op);
 
@@ -241,16 +201,16 @@ hg_core_header_response_proc(hg_proc_op_t op, void *buf, size_t buf_size,
     HG_CORE_HEADER_PROC16(hg_core_header, buf_ptr, header->cookie, op, tmp);
 
 #ifdef HG_HAS_CHECKSUMS
-    /* Checksum of header */
-    mchecksum_get(hg_core_header->checksum, &header->hash.header,
-        sizeof(header->hash.header), MCHECKSUM_FINALIZE);
+    /* Checksum of header (single pass over encoded fields) */
+    header->hash.header = hg_checksum_crc32c(0, buf,
+        (hg_size_t) ((char *) buf_ptr - (char *) buf));
     if (op == HG_ENCODE)
-        n_hash_header = (hg_uint16_t) htons(header->hash.header);
+        n_hash_header = (hg_uint32_t) htonl(header->hash.header);
     hg_proc_buf_memcpy(buf_ptr, &n_hash_header, sizeof(n_hash_header), op);
     if (op == HG_DECODE) {
-        hg_uint16_t h_hash_header = ntohs(n_hash_header);
+        hg_uint32_t h_hash_header = ntohl(n_hash_header);
         if (header->hash.header != h_hash_header) {
-            HG_LOG_ERROR("checksum 0x%04X does not match (expected 0x%04X!)",
+            HG_LOG_ERROR("checksum 0x%08X does not match (expected 0x%08X!)",
                 header->hash.header, h_hash_header);
             ret = HG_CHECKSUM_ERROR;
             goto done;
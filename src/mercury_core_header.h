@@ -24,8 +24,7 @@
 #endif
 #ifdef HG_HAS_CHECKSUMS
 union hg_core_header_hash {
-    hg_uint16_t header;         /* Header checksum (16-bits checksum) */
-    hg_uint32_t pad;
+    hg_uint32_t header;         /* Header checksum (32-bits CRC32C) */
 };
 #endif
 
@@ -35,10 +34,11 @@ struct hg_core_header_request {
     hg_uint64_t id;             /* RPC request identifier */
     hg_uint8_t  flags;          /* Flags */
     hg_uint8_t  cookie;         /* Cookie */
-    /* 96 bits here */
+    hg_uint8_t  target_id;      /* Target context ID */
+    /* 104 bits here */
 #ifdef HG_HAS_CHECKSUMS
     union hg_core_header_hash hash; /* Hash */
-    /* 128 bits here */
+    /* 136 bits here */
 #endif
 };
 
@@ -61,9 +61,6 @@ struct hg_core_header {
         struct hg_core_header_request request;
         struct hg_core_header_response response;
     } msg;
-#ifdef HG_HAS_CHECKSUMS
-    void *checksum;        /* Checksum of header */
-#endif
 };
 
 /*
@@ -74,7 +71,8 @@ struct hg_core_header {
  *
  *
  * Request:
- * mercury byte / protocol version number / rpc id / flags / cookie / checksum
+ * mercury byte / protocol version number / rpc id / flags / cookie /
+ * target ID / checksum
  *
  * Response:
  * flags / return code / cookie / checksum
@@ -88,7 +86,7 @@ struct hg_core_header {
 #define HG_CORE_IDENTIFIER (('H' << 1) | ('G')) /* 0xD7 */
 
 /* Mercury protocol version number */
-#define HG_CORE_PROTOCOL_VERSION 0x04
+#define HG_CORE_PROTOCOL_VERSION 0x06
 
 /* Flags */
 #define HG_CORE_SELF_FORWARD 0x80   /* Forward to self */
@@ -21,12 +21,41 @@
 typedef hg_uint64_t hg_size_t;          /* Size */
 typedef hg_uint64_t hg_id_t;            /* RPC ID */
 
+/* Executor used to dispatch RPC callbacks. The work item passed to post()
+ * is owned by the handle and remains valid until its function has run,
+ * post() must return HG_UTIL_SUCCESS (0) if the work was accepted. */
+struct hg_thread_work;
+struct hg_executor {
+    int (*post)(void *arg, struct hg_thread_work *work); /* Post work */
+    void *arg;                          /* Executor argument (e.g., pool) */
+};
+
 /* HG init info struct */
 struct hg_init_info {
     struct na_init_info na_init_info;   /* NA Init Info */
     na_class_t *na_class;               /* NA class */
     hg_bool_t auto_sm;                  /* Use NA SM plugin with local addrs */
     hg_bool_t stats;                    /* (Debug) Print stats at exit */
+    hg_bool_t self_inline;              /* Execute self RPCs inline */
+    struct hg_executor executor;        /* Default RPC executor */
+    unsigned int executor_threads;      /* Threads of built-in executor */
+    unsigned int addr_cache_size;       /* Max cached lookups (0 disables) */
+    /* The copy engine is process-wide, the first class that sets copy_threads
+     * or copy_nt_size configures it and later classes share that setting */
+    unsigned int copy_threads;          /* Threads per local copy (with caller) */
+    hg_size_t copy_nt_size;             /* Non-temporal copy size (0 disables) */
+    /* Large bulk transfers are striped by chunks across the rails of a
+     * context, with SEP the NA context IDs of rails are above the IDs of
+     * contexts, max_contexts of na_init_info must account for them */
+    unsigned int rail_count;            /* NA contexts per context (rails) */
+    hg_size_t rail_chunk_size;          /* Size of chunks striped across rails */
+};
+
+/* HG context stats struct */
+struct hg_context_stats {
+    hg_uint64_t rpc_count;              /* RPCs queued to context */
+    hg_uint64_t rpc_steered;            /* RPCs steered from other contexts */
+    hg_uint64_t rpc_shared;             /* RPCs shared by busy contexts */
 };
 
 /* Error return codes:
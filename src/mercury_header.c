@@ -120,12 +120,13 @@ hg_header_proc(hg_proc_op_t op, void *buf, size_t buf_size,
 #ifdef HG_HAS_CHECKSUMS
     /* Checksum of user payload */
     HG_HEADER_PROC32(hg_header, buf_ptr, header_hash->payload, op, tmp);
-#else
-    (void) hg_header;
-    (void) buf_ptr;
-    (void) op;
 #endif
 
+    /* Output flags */
+    if (hg_header->op == HG_OUTPUT)
+        HG_HEADER_PROC32(hg_header, buf_ptr, hg_header->msg.output.flags, op,
+            tmp);
+
 done:
     return ret;
 }
@@ -41,7 +41,7 @@ struct hg_header_output {
 #ifdef HG_HAS_CHECKSUMS
     struct hg_header_hash hash; /* Hash */
 #endif
-    hg_uint32_t pad;
+    hg_uint32_t flags;          /* Flags */
     /* 128/64 bits here */
 };
 #if defined(__GNUC__) || defined(_WIN32)
@@ -61,6 +61,9 @@ struct hg_header {
 /* Public Macros */
 /*****************/
 
+/* Output flags */
+#define HG_HEADER_EAGER_DATA (1 << 0) /* Eager bulk data follows output */
+
 
 /*********************/
 /* Public Prototypes */
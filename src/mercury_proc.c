@@ -13,6 +13,7 @@
 #include "mercury_mem.h"
 
 #ifdef HG_HAS_CHECKSUMS
+# include "mercury_checksum.h"
 # include <mchecksum.h>
 # include <mchecksum_error.h>
 #endif
@@ -42,8 +43,13 @@ struct hg_proc {
     struct hg_proc_buf proc_buf;
     struct hg_proc_buf extra_buf;
     struct hg_proc_buf *current_buf;
+    hg_bulk_t *eager_bulks;         /* Bulk handles pushed eagerly */
+    hg_uint32_t eager_bulk_count;   /* Number of eager bulk handles */
+    hg_uint32_t eager_bulk_max;     /* Size of eager bulk handle array */
+    hg_bool_t eager_push;           /* Eager push allowed */
 #ifdef HG_HAS_CHECKSUMS
-    mchecksum_object_t checksum;    /* Checksum */
+    hg_proc_hash_t hash;            /* Hash method */
+    mchecksum_object_t checksum;    /* Checksum (NULL if CRC32C/no hash) */
     void *checksum_hash;            /* Base checksum buf */
     size_t checksum_size;           /* Checksum size */
 #endif
@@ -91,6 +97,9 @@ hg_proc_create(hg_class_t *hg_class, hg_proc_hash_t hash, hg_proc_t *proc)
     }
     memset(hg_proc, 0, sizeof(struct hg_proc));
     hg_proc->hg_class = hg_class;
+#ifdef HG_HAS_CHECKSUMS
+    hg_proc->hash = HG_NOHASH;
+#endif
 
     /* Map enum to string */
     switch (hash) {
@@ -110,16 +119,21 @@ hg_proc_create(hg_class_t *hg_class, hg_proc_hash_t hash, hg_proc_t *proc)
 
     if (hash_method) {
 #ifdef HG_HAS_CHECKSUMS
-        int checksum_ret;
-
-        checksum_ret = mchecksum_init(hash_method, &hg_proc->checksum);
-        if (checksum_ret != MCHECKSUM_SUCCESS) {
-            HG_LOG_ERROR("Could not initialize checksum");
-            ret = HG_CHECKSUM_ERROR;
-            goto done;
+        hg_proc->hash = hash;
+        if (hash == HG_CRC32) {
+            /* Computed in one pass over the encoded buffer on flush */
+            hg_proc->checksum_size = sizeof(hg_uint32_t);
+        } else {
+            int checksum_ret;
+
+            checksum_ret = mchecksum_init(hash_method, &hg_proc->checksum);
+            if (checksum_ret != MCHECKSUM_SUCCESS) {
+                HG_LOG_ERROR("Could not initialize checksum");
+                ret = HG_CHECKSUM_ERROR;
+                goto done;
+            }
+            hg_proc->checksum_size = mchecksum_get_size(hg_proc->checksum);
         }
-
-        hg_proc->checksum_size = mchecksum_get_size(hg_proc->checksum);
         hg_proc->checksum_hash = (char *) malloc(hg_proc->checksum_size);
         if (!hg_proc->checksum_hash) {
             HG_LOG_ERROR("Could not allocate space for checksum hash");
@@ -194,6 +208,8 @@ hg_proc_free(hg_proc_t proc)
     if (hg_proc->extra_buf.buf && hg_proc->extra_buf.is_mine)
         hg_mem_aligned_free(hg_proc->extra_buf.buf);
 
+    free(hg_proc->eager_bulks);
+
     /* Free proc */
     free(hg_proc);
 
@@ -251,6 +267,10 @@ hg_proc_reset(hg_proc_t proc, void *buf, hg_size_t buf_size, hg_proc_op_t op)
     /* Default to proc_buf */
     hg_proc->current_buf = &hg_proc->proc_buf;
 
+    /* Forget eager bulk handles */
+    hg_proc->eager_bulk_count = 0;
+    hg_proc->eager_push = HG_FALSE;
+
 #ifdef HG_HAS_CHECKSUMS
     /* Reset checksum */
     if (hg_proc->checksum != MCHECKSUM_OBJECT_NULL) {
@@ -261,8 +281,9 @@ hg_proc_reset(hg_proc_t proc, void *buf, hg_size_t buf_size, hg_proc_op_t op)
             HG_LOG_ERROR("Could not reset checksum");
             ret = HG_CHECKSUM_ERROR;
         }
-        memset(hg_proc->checksum_hash, 0, hg_proc->checksum_size);
     }
+    if (hg_proc->checksum_hash)
+        memset(hg_proc->checksum_hash, 0, hg_proc->checksum_size);
 #endif
 
 done:
@@ -522,6 +543,82 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_proc_set_eager_push(hg_proc_t proc, hg_bool_t eager_push)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_proc) {
+        HG_LOG_ERROR("Proc is not initialized");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_proc->eager_push = eager_push;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_proc_get_eager_push(hg_proc_t proc)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+
+    return (hg_proc) ? hg_proc->eager_push : HG_FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_proc_add_eager_bulk(hg_proc_t proc, hg_bulk_t handle)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_proc) {
+        HG_LOG_ERROR("Proc is not initialized");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    if (hg_proc->eager_bulk_count == hg_proc->eager_bulk_max) {
+        hg_uint32_t new_max = (hg_proc->eager_bulk_max) ?
+            hg_proc->eager_bulk_max * 2 : 4;
+        hg_bulk_t *new_bulks = (hg_bulk_t *) realloc(hg_proc->eager_bulks,
+            new_max * sizeof(hg_bulk_t));
+
+        if (!new_bulks) {
+            HG_LOG_ERROR("Could not allocate eager bulk array");
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+        hg_proc->eager_bulks = new_bulks;
+        hg_proc->eager_bulk_max = new_max;
+    }
+    hg_proc->eager_bulks[hg_proc->eager_bulk_count++] = handle;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bulk_t *
+hg_proc_get_eager_bulks(hg_proc_t proc, hg_uint32_t *count)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+
+    if (!hg_proc) {
+        *count = 0;
+        return NULL;
+    }
+    *count = hg_proc->eager_bulk_count;
+
+    return hg_proc->eager_bulks;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 hg_proc_flush(hg_proc_t proc)
@@ -539,12 +636,21 @@ hg_proc_flush(hg_proc_t proc)
     }
 
 #ifdef HG_HAS_CHECKSUMS
-    checksum_ret = mchecksum_get(hg_proc->checksum, hg_proc->checksum_hash,
-        hg_proc->checksum_size, MCHECKSUM_FINALIZE);
-    if (checksum_ret != MCHECKSUM_SUCCESS) {
-        HG_LOG_ERROR("Could not get checksum");
-        ret = HG_CHECKSUM_ERROR;
-        goto done;
+    if (hg_proc->hash == HG_CRC32) {
+        /* Single pass over everything encoded/decoded since reset, extra
+         * buffer (if used) also contains the start of proc buffer */
+        hg_uint32_t crc = hg_checksum_crc32c(0, hg_proc->current_buf->buf,
+            hg_proc->current_buf->size - hg_proc->current_buf->size_left);
+
+        memcpy(hg_proc->checksum_hash, &crc, sizeof(crc));
+    } else if (hg_proc->checksum != MCHECKSUM_OBJECT_NULL) {
+        checksum_ret = mchecksum_get(hg_proc->checksum, hg_proc->checksum_hash,
+            hg_proc->checksum_size, MCHECKSUM_FINALIZE);
+        if (checksum_ret != MCHECKSUM_SUCCESS) {
+            HG_LOG_ERROR("Could not get checksum");
+            ret = HG_CHECKSUM_ERROR;
+            goto done;
+        }
     }
 #endif
 
@@ -606,6 +712,10 @@ hg_proc_checksum_update(hg_proc_t proc, void *data, hg_size_t data_size)
         goto done;
     }
 
+    /* Nothing to do if no hash or if hash is computed on flush */
+    if (hg_proc->checksum == MCHECKSUM_OBJECT_NULL)
+        goto done;
+
     /* Update checksum */
     checksum_ret = mchecksum_update(hg_proc->checksum, data, data_size);
     if (checksum_ret != MCHECKSUM_SUCCESS) {
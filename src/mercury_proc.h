@@ -67,7 +67,10 @@ extern "C" {
  * \param hg_class [IN]         HG class
  * \param hash [IN]             hash method used for computing checksum
  *                              (if NULL, checksum is not computed)
- *                              hash method: HG_CRC16, HG_CRC64, HG_NOHASH
+ *                              hash method: HG_CRC16, HG_CRC32, HG_CRC64,
+ *                              HG_NOHASH (HG_CRC32 is a CRC32C computed in
+ *                              one pass over the processed buffer when
+ *                              hg_proc_flush() is called)
  * \param proc [OUT]            pointer to abstract processor object
  *
  * \return HG_SUCCESS or corresponding HG error code
@@ -89,7 +92,10 @@ hg_proc_create(
  * \param op [IN]               operation type: HG_ENCODE / HG_DECODE / HG_FREE
  * \param hash [IN]             hash method used for computing checksum
  *                              (if NULL, checksum is not computed)
- *                              hash method: HG_CRC16, HG_CRC64, HG_NOHASH
+ *                              hash method: HG_CRC16, HG_CRC32, HG_CRC64,
+ *                              HG_NOHASH (HG_CRC32 is a CRC32C computed in
+ *                              one pass over the processed buffer when
+ *                              hg_proc_flush() is called)
  * \param proc [OUT]            pointer to abstract processor object
  *
  * \return HG_SUCCESS or corresponding HG error code
@@ -293,6 +299,66 @@ hg_proc_set_extra_buf_is_mine(
         hg_bool_t mine
         );
 
+/**
+ * Allow bulk handles encoded by processor to request HG_BULK_EAGER_PUSH. This
+ * is set by HG when encoding input of RPCs that produce output. Value is
+ * kept across hg_proc_reset().
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param eager_push [IN]       boolean
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+hg_proc_set_eager_push(
+        hg_proc_t proc,
+        hg_bool_t eager_push
+        );
+
+/**
+ * Test whether bulk handles encoded by processor can request
+ * HG_BULK_EAGER_PUSH.
+ *
+ * \param proc [IN]             abstract processor object
+ *
+ * \return HG_TRUE or HG_FALSE
+ */
+HG_EXPORT hg_bool_t
+hg_proc_get_eager_push(
+        hg_proc_t proc
+        );
+
+/**
+ * Record bulk handle encoded / decoded with HG_BULK_EAGER_PUSH so that data
+ * pushed to that handle can be sent back along with the RPC response.
+ * Recorded handles are cleared on hg_proc_reset(), no reference is taken.
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param handle [IN]           abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+hg_proc_add_eager_bulk(
+        hg_proc_t proc,
+        hg_bulk_t handle
+        );
+
+/**
+ * Get bulk handles recorded with hg_proc_add_eager_bulk() since last
+ * hg_proc_reset().
+ *
+ * \param proc [IN]             abstract processor object
+ * \param count [OUT]           number of handles
+ *
+ * \return Pointer to array of handles (valid until next hg_proc_reset())
+ */
+HG_EXPORT hg_bulk_t *
+hg_proc_get_eager_bulks(
+        hg_proc_t proc,
+        hg_uint32_t *count
+        );
+
 /**
  * Flush the proc after data has been encoded or decoded and finalize internal
  * checksum if checksum of data processed was initially requested.
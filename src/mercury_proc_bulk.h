@@ -32,22 +32,28 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
 
     switch (hg_proc_get_op(proc)) {
         case HG_ENCODE: {
-            hg_bool_t request_eager = HG_FALSE;
+            hg_uint8_t request_eager = 0;
             void *cached_ptr = NULL;
 
-            /* If HG_BULK_NULL set 0 to buf_size */
+            /* If HG_BULK_NULL set 0 to buf_size, handles that data is pushed
+             * to must be serialized again to register with the response */
             if (*bulk_ptr == HG_BULK_NULL)
                 buf_size = 0;
-            else if ((cached_ptr = HG_Bulk_get_serialize_cached_ptr(*bulk_ptr))
+            else if (!HG_Bulk_get_eager_flags(*bulk_ptr, HG_BULK_EAGER_PUSH)
+                && (cached_ptr = HG_Bulk_get_serialize_cached_ptr(*bulk_ptr))
                 != NULL)
                 buf_size = HG_Bulk_get_serialize_cached_size(*bulk_ptr);
             else {
 #ifdef HG_HAS_EAGER_BULK
-                hg_size_t serialize_size = HG_Bulk_get_serialize_size(*bulk_ptr,
-                    HG_TRUE);
-                request_eager =
-                    (hg_proc_get_size_left(proc) > serialize_size) ? HG_TRUE :
-                        HG_FALSE;
+                hg_size_t serialize_size;
+
+                request_eager = HG_Bulk_get_eager_flags(*bulk_ptr,
+                    (hg_uint8_t) (HG_BULK_EAGER_PULL
+                    | (hg_proc_get_eager_push(proc) ? HG_BULK_EAGER_PUSH : 0)));
+                serialize_size = HG_Bulk_get_serialize_size(*bulk_ptr,
+                    request_eager);
+                if (hg_proc_get_size_left(proc) <= serialize_size)
+                    request_eager = 0;
                 if (request_eager)
                     buf_size = serialize_size;
                 else
@@ -72,6 +78,14 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
                     return ret;
                 }
                 hg_proc_restore_ptr(proc, buf, buf_size);
+                /* Data pushed by target is returned with response */
+                if (request_eager & HG_BULK_EAGER_PUSH) {
+                    ret = hg_proc_add_eager_bulk(proc, *bulk_ptr);
+                    if (ret != HG_SUCCESS) {
+                        HG_LOG_ERROR("Could not add eager bulk handle");
+                        return ret;
+                    }
+                }
             }
             break;
         }
@@ -103,6 +117,14 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
                 return ret;
             }
             hg_proc_restore_ptr(proc, buf, buf_size);
+            /* Data pushed to handle must be returned with response */
+            if (HG_Bulk_get_eager_flags(*bulk_ptr, HG_BULK_EAGER_PUSH)) {
+                ret = hg_proc_add_eager_bulk(proc, *bulk_ptr);
+                if (ret != HG_SUCCESS) {
+                    HG_LOG_ERROR("Could not add eager bulk handle");
+                    return ret;
+                }
+            }
             break;
         }
         case HG_FREE:
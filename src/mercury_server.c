@@ -0,0 +1,371 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include "mercury_server.h"
+
+#include "mercury_atomic.h"
+#include "mercury_thread.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+#define HG_SERVER_MAX_CONTEXTS 256 /* Context IDs are 8-bit */
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct hg_server;
+
+/* Progress thread */
+struct hg_server_thread {
+    struct hg_server *hg_server;    /* Parent server */
+    hg_context_t *context;          /* Context progressed by thread */
+    hg_thread_t thread;             /* Thread */
+    hg_bool_t started;              /* Thread was started */
+};
+
+/* HG server */
+struct hg_server {
+    hg_class_t *hg_class;                   /* HG class */
+    struct hg_server_thread *threads;       /* Array of threads */
+    unsigned int context_count;             /* Number of contexts */
+    unsigned int progress_timeout;          /* Progress timeout (ms) */
+    hg_bool_t trigger_only;                 /* Only trigger steered RPCs */
+    hg_atomic_int32_t shutdown;             /* Threads must exit */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Progress and trigger context until server is stopped.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_server_progress_thread(
+        void *arg
+        );
+
+/**
+ * Pin thread to the index-th CPU that the process is allowed to run on.
+ */
+static hg_return_t
+hg_server_pin_thread(
+        hg_thread_t thread,
+        unsigned int index
+        );
+
+/**
+ * Stop threads and destroy contexts.
+ */
+static hg_return_t
+hg_server_stop(
+        struct hg_server *hg_server
+        );
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_server_progress_thread(void *arg)
+{
+    struct hg_server_thread *hg_server_thread =
+        (struct hg_server_thread *) arg;
+    struct hg_server *hg_server = hg_server_thread->hg_server;
+    hg_context_t *context = hg_server_thread->context;
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    do {
+        unsigned int actual_count = 0;
+
+        /* Trigger everything that was queued (including steered RPCs) */
+        do {
+            ret = HG_Trigger(context, 0, 1, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count);
+
+        /* Steering is disabled when shutdown is set so nothing else can be
+         * added to that context by other threads */
+        if (hg_atomic_get32(&hg_server->shutdown))
+            break;
+
+        if (hg_server->trigger_only) {
+            /* Wait for steered RPCs and only flush NA on timeout */
+            ret = HG_Trigger(context, hg_server->progress_timeout, 1, NULL);
+            if (ret == HG_TIMEOUT)
+                ret = HG_Progress(context, 0);
+        } else
+            ret = HG_Progress(context, hg_server->progress_timeout);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+
+    if (ret != HG_SUCCESS && ret != HG_TIMEOUT)
+        HG_LOG_ERROR("Could not make progress on context %u",
+            HG_Context_get_id(context));
+
+    hg_thread_exit(tret);
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_server_pin_thread(hg_thread_t thread, unsigned int index)
+{
+    hg_return_t ret = HG_SUCCESS;
+#if !defined(_WIN32) && !defined(__APPLE__)
+    hg_cpu_set_t cpu_mask, new_cpu_mask;
+    unsigned int i, count = 0;
+
+    if (hg_thread_getaffinity(hg_thread_self(), &cpu_mask)
+        != HG_UTIL_SUCCESS) {
+        HG_LOG_ERROR("Could not get CPU affinity");
+        ret = HG_OTHER_ERROR;
+        goto done;
+    }
+
+    /* Wrap around if there are more threads than CPUs */
+    index %= (unsigned int) CPU_COUNT(&cpu_mask);
+    for (i = 0; i < CPU_SETSIZE; i++) {
+        if (!CPU_ISSET(i, &cpu_mask))
+            continue;
+        if (count++ == index)
+            break;
+    }
+
+    CPU_ZERO(&new_cpu_mask);
+    CPU_SET(i, &new_cpu_mask);
+    if (hg_thread_setaffinity(thread, &new_cpu_mask) != HG_UTIL_SUCCESS) {
+        HG_LOG_ERROR("Could not set CPU affinity");
+        ret = HG_OTHER_ERROR;
+        goto done;
+    }
+
+done:
+#else
+    (void) thread;
+    (void) index;
+#endif
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_server_stop(struct hg_server *hg_server)
+{
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    if (!hg_server->threads)
+        goto done;
+
+    /* Stop steering first so that no RPC can be queued to a context once its
+     * thread has exited */
+    for (i = 0; i < hg_server->context_count; i++) {
+        if (!hg_server->threads[i].context)
+            continue;
+        ret = HG_Context_set_steering(hg_server->threads[i].context, HG_FALSE,
+            0);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not disable steering");
+            goto done;
+        }
+    }
+
+    hg_atomic_set32(&hg_server->shutdown, 1);
+    for (i = 0; i < hg_server->context_count; i++) {
+        if (!hg_server->threads[i].started)
+            continue;
+        hg_thread_join(hg_server->threads[i].thread);
+        hg_server->threads[i].started = HG_FALSE;
+    }
+
+    for (i = 0; i < hg_server->context_count; i++) {
+        if (!hg_server->threads[i].context)
+            continue;
+        ret = HG_Context_destroy(hg_server->threads[i].context);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not destroy context %u", i);
+            goto done;
+        }
+        hg_server->threads[i].context = NULL;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Server_start(hg_class_t *hg_class,
+    const struct hg_server_info *hg_server_info, hg_server_t **hg_server_ptr)
+{
+    struct hg_server *hg_server = NULL;
+    unsigned int i;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_class) {
+        HG_LOG_ERROR("NULL HG class");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!hg_server_info) {
+        HG_LOG_ERROR("NULL server info");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!hg_server_info->context_count
+        || hg_server_info->context_count > HG_SERVER_MAX_CONTEXTS) {
+        HG_LOG_ERROR("Invalid context count (%u), must be between 1 and %u",
+            hg_server_info->context_count, HG_SERVER_MAX_CONTEXTS);
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+    if (!hg_server_ptr) {
+        HG_LOG_ERROR("NULL pointer to HG server");
+        ret = HG_INVALID_PARAM;
+        goto done;
+    }
+
+    hg_server = (struct hg_server *) malloc(sizeof(struct hg_server));
+    if (!hg_server) {
+        HG_LOG_ERROR("Could not allocate HG server");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_server, 0, sizeof(struct hg_server));
+    hg_server->hg_class = hg_class;
+    hg_server->context_count = hg_server_info->context_count;
+    hg_server->progress_timeout = hg_server_info->progress_timeout ?
+        hg_server_info->progress_timeout : HG_SERVER_PROGRESS_TIMEOUT_DEFAULT;
+    hg_server->trigger_only = hg_server_info->trigger_only;
+    hg_atomic_init32(&hg_server->shutdown, 0);
+
+    hg_server->threads = (struct hg_server_thread *) malloc(
+        hg_server->context_count * sizeof(struct hg_server_thread));
+    if (!hg_server->threads) {
+        HG_LOG_ERROR("Could not allocate server threads");
+        ret = HG_NOMEM_ERROR;
+        goto done;
+    }
+    memset(hg_server->threads, 0,
+        hg_server->context_count * sizeof(struct hg_server_thread));
+
+    /* Create and register all contexts before starting threads */
+    for (i = 0; i < hg_server->context_count; i++) {
+        hg_server->threads[i].hg_server = hg_server;
+        hg_server->threads[i].context = HG_Context_create_id(hg_class,
+            (hg_uint8_t) i);
+        if (!hg_server->threads[i].context) {
+            HG_LOG_ERROR("Could not create context for ID %u", i);
+            ret = HG_NOMEM_ERROR;
+            goto done;
+        }
+
+        /* Endpoint is shared, leave receives to the caller's context(s) */
+        if (hg_server->trigger_only) {
+            ret = HG_Core_context_unpost(
+                hg_server->threads[i].context->core_context);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not cancel requests of context %u", i);
+                goto done;
+            }
+        }
+
+        ret = HG_Context_set_steering(hg_server->threads[i].context, HG_TRUE,
+            hg_server_info->share_threshold);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not enable steering for context %u", i);
+            goto done;
+        }
+    }
+
+    for (i = 0; i < hg_server->context_count; i++) {
+        if (hg_thread_create(&hg_server->threads[i].thread,
+            hg_server_progress_thread, &hg_server->threads[i])
+            != HG_UTIL_SUCCESS) {
+            HG_LOG_ERROR("Could not create progress thread");
+            ret = HG_OTHER_ERROR;
+            goto done;
+        }
+        hg_server->threads[i].started = HG_TRUE;
+
+        if (hg_server_info->pin_threads) {
+            ret = hg_server_pin_thread(hg_server->threads[i].thread, i);
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not pin progress thread");
+                goto done;
+            }
+        }
+    }
+
+    *hg_server_ptr = hg_server;
+
+done:
+    if (ret != HG_SUCCESS && hg_server) {
+        hg_server_stop(hg_server);
+        free(hg_server->threads);
+        free(hg_server);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Server_stop(hg_server_t *hg_server)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!hg_server) goto done;
+
+    ret = hg_server_stop(hg_server);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not stop server");
+        goto done;
+    }
+
+    free(hg_server->threads);
+    free(hg_server);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+unsigned int
+HG_Server_get_context_count(const hg_server_t *hg_server)
+{
+    return hg_server ? hg_server->context_count : 0;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_context_t *
+HG_Server_get_context(const hg_server_t *hg_server, unsigned int index)
+{
+    hg_context_t *context = NULL;
+
+    if (!hg_server) {
+        HG_LOG_ERROR("NULL HG server");
+        goto done;
+    }
+    if (index >= hg_server->context_count) {
+        HG_LOG_ERROR("Invalid context index (%u)", index);
+        goto done;
+    }
+
+    context = hg_server->threads[index].context;
+
+done:
+    return context;
+}
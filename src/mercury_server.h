@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_SERVER_H
+#define MERCURY_SERVER_H
+
+#include "mercury.h"
+
+/*************************************/
+/* Public Type and Struct Definition */
+/*************************************/
+
+typedef struct hg_server hg_server_t;   /* Opaque HG server */
+
+/* HG server info struct */
+struct hg_server_info {
+    unsigned int context_count;     /* Number of contexts (one thread each) */
+    unsigned int share_threshold;   /* Queue depth above which RPCs are shared */
+    hg_bool_t pin_threads;          /* Pin each thread to its own CPU */
+    hg_bool_t trigger_only;         /* Contexts share endpoint, only trigger */
+    unsigned int progress_timeout;  /* Progress timeout (ms) */
+};
+
+/*****************/
+/* Public Macros */
+/*****************/
+
+/* Default progress timeout (ms) used if none is specified */
+#define HG_SERVER_PROGRESS_TIMEOUT_DEFAULT 100
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Start a context-per-core server: create context_count contexts with IDs
+ * 0 to context_count - 1, register them for RPC steering (see
+ * HG_Context_set_steering()) and start one thread per context that
+ * progresses and triggers it. RPCs whose target ID matches a context ID
+ * are then executed by the thread of that context, whichever context
+ * received them. If pin_threads is set, the i-th thread is bound to the i-th
+ * CPU that the calling process is allowed to run on.
+ *
+ * With plugins that do not support multiple endpoints (e.g., na_sm or
+ * na_ofi without scalable endpoints), all contexts share the same endpoint
+ * and trigger_only should be set: server contexts then do not post requests
+ * and their threads only wait for RPCs steered from the context(s) that
+ * receive them, which must be progressed by the caller.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param hg_server_info [IN]   pointer to server info
+ * \param hg_server [OUT]       pointer to HG server
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Server_start(
+        hg_class_t *hg_class,
+        const struct hg_server_info *hg_server_info,
+        hg_server_t **hg_server
+        );
+
+/**
+ * Stop server: unregister contexts from steering, wait for each thread to
+ * trigger its remaining completions and destroy contexts.
+ *
+ * \param hg_server [IN]        pointer to HG server
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_EXPORT hg_return_t
+HG_Server_stop(
+        hg_server_t *hg_server
+        );
+
+/**
+ * Get number of contexts used by server.
+ *
+ * \param hg_server [IN]        pointer to HG server
+ *
+ * \return Number of contexts
+ */
+HG_EXPORT unsigned int
+HG_Server_get_context_count(
+        const hg_server_t *hg_server
+        );
+
+/**
+ * Get context of given index used by server.
+ *
+ * \param hg_server [IN]        pointer to HG server
+ * \param index [IN]            context index (equal to context ID)
+ *
+ * \return Pointer to HG context or NULL if index is out of range
+ */
+HG_EXPORT hg_context_t *
+HG_Server_get_context(
+        const hg_server_t *hg_server,
+        unsigned int index
+        );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_SERVER_H */
@@ -39,9 +39,17 @@ struct hg_info {
  */
 typedef enum {
     HG_BULK_PUSH,   /*!< push data to origin */
-    HG_BULK_PULL    /*!< pull data from origin */
+    HG_BULK_PULL,   /*!< pull data from origin */
+    HG_BULK_ATOMIC  /*!< atomic update of origin (HG_Bulk_atomic) */
 } hg_bulk_op_t;
 
+/* Bulk atomic operations */
+typedef enum {
+    HG_BULK_ATOMIC_FADD,    /*!< fetch and add */
+    HG_BULK_ATOMIC_CSWAP,   /*!< compare and swap */
+    HG_BULK_ATOMIC_SWAP     /*!< swap */
+} hg_bulk_atomic_op_t;
+
 /* Callback info structs */
 struct hg_cb_info_lookup {
     hg_addr_t addr;     /* HG address */
@@ -349,7 +349,8 @@ NA_Addr_to_string(
         );
 
 /**
- * Get size required to serialize address.
+ * Get size required to serialize address. Returns 0 if the plugin does not
+ * support address serialization.
  *
  * \param na_class [IN/OUT]     pointer to NA class
  * \param addr [IN]             abstract address
@@ -976,6 +977,149 @@ NA_Get(
         na_op_id_t      *op_id
         );
 
+/**
+ * Get maximum number of blocks that a single NA_Put_strided() or
+ * NA_Get_strided() operation can access on each side of the transfer.
+ *
+ * \param na_class [IN]         pointer to NA class
+ *
+ * \return Maximum number of blocks or 0 if strided transfers are not supported
+ */
+static NA_INLINE na_size_t
+NA_Get_strided_max(
+        na_class_t *na_class
+        );
+
+/**
+ * Put strided data to remote address. Offsets count the bytes of data
+ * described by the strided layouts, NULL layouts describe contiguous memory
+ * in which case offsets are plain memory handle offsets. Each side may access
+ * at most NA_Get_strided_max() blocks, strided memory must be registered as
+ * a single region. After completion, user callback is placed into a
+ * completion queue and can be triggered using NA_Trigger().
+ *
+ * Plugins that cannot transfer strided data return NA_OPNOTSUPPORTED without
+ * posting the operation.
+ *
+ * \param na_class [IN/OUT]     pointer to NA class
+ * \param context [IN/OUT]      pointer to context of execution
+ * \param callback [IN]          pointer to function callback
+ * \param arg [IN]               pointer to data passed to callback
+ * \param local_mem_handle [IN]  abstract local memory handle
+ * \param local_stride [IN]      local strided layout (may be NULL)
+ * \param local_offset [IN]      local offset
+ * \param remote_mem_handle [IN] abstract remote memory handle
+ * \param remote_stride [IN]     remote strided layout (may be NULL)
+ * \param remote_offset [IN]     remote offset
+ * \param data_size [IN]         size of data that needs to be transferred
+ * \param remote_addr [IN]       abstract address of remote destination
+ * \param remote_id [IN]         target ID of remote destination
+ * \param op_id [IN/OUT]         pointer to operation ID
+ *
+ * \return NA_SUCCESS or corresponding NA error code
+ */
+static NA_INLINE na_return_t
+NA_Put_strided(
+        na_class_t             *na_class,
+        na_context_t           *context,
+        na_cb_t                 callback,
+        void                   *arg,
+        na_mem_handle_t         local_mem_handle,
+        const struct na_stride *local_stride,
+        na_offset_t             local_offset,
+        na_mem_handle_t         remote_mem_handle,
+        const struct na_stride *remote_stride,
+        na_offset_t             remote_offset,
+        na_size_t               data_size,
+        na_addr_t               remote_addr,
+        na_uint8_t              remote_id,
+        na_op_id_t             *op_id
+        );
+
+/**
+ * Get strided data from remote address, see NA_Put_strided().
+ *
+ * \param na_class [IN/OUT]     pointer to NA class
+ * \param context [IN/OUT]      pointer to context of execution
+ * \param callback [IN]          pointer to function callback
+ * \param arg [IN]               pointer to data passed to callback
+ * \param local_mem_handle [IN]  abstract local memory handle
+ * \param local_stride [IN]      local strided layout (may be NULL)
+ * \param local_offset [IN]      local offset
+ * \param remote_mem_handle [IN] abstract remote memory handle
+ * \param remote_stride [IN]     remote strided layout (may be NULL)
+ * \param remote_offset [IN]     remote offset
+ * \param data_size [IN]         size of data that needs to be transferred
+ * \param remote_addr [IN]       abstract address of remote source
+ * \param remote_id [IN]         target ID of remote source
+ * \param op_id [IN/OUT]         pointer to operation ID
+ *
+ * \return NA_SUCCESS or corresponding NA error code
+ */
+static NA_INLINE na_return_t
+NA_Get_strided(
+        na_class_t             *na_class,
+        na_context_t           *context,
+        na_cb_t                 callback,
+        void                   *arg,
+        na_mem_handle_t         local_mem_handle,
+        const struct na_stride *local_stride,
+        na_offset_t             local_offset,
+        na_mem_handle_t         remote_mem_handle,
+        const struct na_stride *remote_stride,
+        na_offset_t             remote_offset,
+        na_size_t               data_size,
+        na_addr_t               remote_addr,
+        na_uint8_t              remote_id,
+        na_op_id_t             *op_id
+        );
+
+/**
+ * Atomically update a 32 or 64-bit word of remote memory and fetch its
+ * previous value. After completion, user callback is placed into a completion
+ * queue and can be triggered using NA_Trigger(). Operand, compare and result
+ * buffers must remain valid until completion.
+ *
+ * Plugins that cannot update remote memory atomically return
+ * NA_OPNOTSUPPORTED without posting the operation, this is also the case of
+ * plugins that only enable atomics when requested through na_init_info and
+ * the class was not initialized with atomics.
+ *
+ * \param na_class [IN/OUT]     pointer to NA class
+ * \param context [IN/OUT]      pointer to context of execution
+ * \param callback [IN]          pointer to function callback
+ * \param arg [IN]               pointer to data passed to callback
+ * \param op [IN]                atomic operation
+ * \param size [IN]              size of word (4 or 8 bytes)
+ * \param operand [IN]           pointer to operand (value added or swapped)
+ * \param compare [IN]           pointer to compared value (NA_ATOMIC_CSWAP)
+ * \param result [OUT]           pointer to previous value of word
+ * \param remote_mem_handle [IN] abstract remote memory handle
+ * \param remote_offset [IN]     remote offset (aligned on size)
+ * \param remote_addr [IN]       abstract address of remote target
+ * \param remote_id [IN]         target ID of remote target
+ * \param op_id [IN/OUT]         pointer to operation ID
+ *
+ * \return NA_SUCCESS or corresponding NA error code
+ */
+static NA_INLINE na_return_t
+NA_Atomic(
+        na_class_t      *na_class,
+        na_context_t    *context,
+        na_cb_t          callback,
+        void            *arg,
+        na_atomic_op_t   op,
+        na_size_t        size,
+        const void      *operand,
+        const void      *compare,
+        void            *result,
+        na_mem_handle_t  remote_mem_handle,
+        na_offset_t      remote_offset,
+        na_addr_t        remote_addr,
+        na_uint8_t       remote_id,
+        na_op_id_t      *op_id
+        );
+
 /**
  * Retrieve file descriptor from NA plugin when supported. The descriptor
  * can be used by upper layers for manual polling through the usual
@@ -1422,6 +1566,61 @@ struct na_class_ops {
             na_context_t *context,
             na_op_id_t    op_id
             );
+    na_return_t
+    (*atomic)(
+            na_class_t      *na_class,
+            na_context_t    *context,
+            na_cb_t          callback,
+            void            *arg,
+            na_atomic_op_t   op,
+            na_size_t        size,
+            const void      *operand,
+            const void      *compare,
+            void            *result,
+            na_mem_handle_t  remote_mem_handle,
+            na_offset_t      remote_offset,
+            na_addr_t        remote_addr,
+            na_uint8_t       remote_id,
+            na_op_id_t      *op_id
+            );
+    na_size_t
+    (*strided_max)(
+            na_class_t      *na_class
+            );
+    na_return_t
+    (*put_strided)(
+            na_class_t             *na_class,
+            na_context_t           *context,
+            na_cb_t                 callback,
+            void                   *arg,
+            na_mem_handle_t         local_mem_handle,
+            const struct na_stride *local_stride,
+            na_offset_t             local_offset,
+            na_mem_handle_t         remote_mem_handle,
+            const struct na_stride *remote_stride,
+            na_offset_t             remote_offset,
+            na_size_t               length,
+            na_addr_t               remote_addr,
+            na_uint8_t              remote_id,
+            na_op_id_t             *op_id
+            );
+    na_return_t
+    (*get_strided)(
+            na_class_t             *na_class,
+            na_context_t           *context,
+            na_cb_t                 callback,
+            void                   *arg,
+            na_mem_handle_t         local_mem_handle,
+            const struct na_stride *local_stride,
+            na_offset_t             local_offset,
+            na_mem_handle_t         remote_mem_handle,
+            const struct na_stride *remote_stride,
+            na_offset_t             remote_offset,
+            na_size_t               length,
+            na_addr_t               remote_addr,
+            na_uint8_t              remote_id,
+            na_op_id_t             *op_id
+            );
 };
 
 /*---------------------------------------------------------------------------*/
@@ -1456,7 +1655,8 @@ NA_Addr_is_self(na_class_t *na_class, na_addr_t addr)
 static NA_INLINE na_size_t
 NA_Addr_get_serialize_size(na_class_t *na_class, na_addr_t addr)
 {
-    return na_class->ops->addr_get_serialize_size(na_class, addr);
+    return (na_class->ops->addr_get_serialize_size) ?
+        na_class->ops->addr_get_serialize_size(na_class, addr) : 0;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1573,6 +1773,60 @@ NA_Get(na_class_t *na_class, na_context_t *context, na_cb_t callback, void *arg,
         data_size, remote_addr, remote_id, op_id);
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_return_t
+NA_Atomic(na_class_t *na_class, na_context_t *context, na_cb_t callback,
+    void *arg, na_atomic_op_t op, na_size_t size, const void *operand,
+    const void *compare, void *result, na_mem_handle_t remote_mem_handle,
+    na_offset_t remote_offset, na_addr_t remote_addr, na_uint8_t remote_id,
+    na_op_id_t *op_id)
+{
+    return (na_class->ops->atomic) ?
+        na_class->ops->atomic(na_class, context, callback, arg, op, size,
+            operand, compare, result, remote_mem_handle, remote_offset,
+            remote_addr, remote_id, op_id) : NA_OPNOTSUPPORTED;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_size_t
+NA_Get_strided_max(na_class_t *na_class)
+{
+    return (na_class->ops->strided_max) ?
+        na_class->ops->strided_max(na_class) : 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_return_t
+NA_Put_strided(na_class_t *na_class, na_context_t *context, na_cb_t callback,
+    void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t data_size, na_addr_t remote_addr,
+    na_uint8_t remote_id, na_op_id_t *op_id)
+{
+    return (na_class->ops->put_strided) ?
+        na_class->ops->put_strided(na_class, context, callback, arg,
+            local_mem_handle, local_stride, local_offset, remote_mem_handle,
+            remote_stride, remote_offset, data_size, remote_addr, remote_id,
+            op_id) : NA_OPNOTSUPPORTED;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_return_t
+NA_Get_strided(na_class_t *na_class, na_context_t *context, na_cb_t callback,
+    void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t data_size, na_addr_t remote_addr,
+    na_uint8_t remote_id, na_op_id_t *op_id)
+{
+    return (na_class->ops->get_strided) ?
+        na_class->ops->get_strided(na_class, context, callback, arg,
+            local_mem_handle, local_stride, local_offset, remote_mem_handle,
+            remote_stride, remote_offset, data_size, remote_addr, remote_id,
+            op_id) : NA_OPNOTSUPPORTED;
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE int
 NA_Poll_get_fd(na_class_t *na_class, na_context_t *context)
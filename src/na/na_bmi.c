@@ -551,7 +551,8 @@ NA_PLUGIN_OPS(bmi) = {
         NULL,                                 /* poll_get_fd */
         NULL,                                 /* poll_try_wait */
         na_bmi_progress,                      /* progress */
-        na_bmi_cancel                         /* cancel */
+        na_bmi_cancel,                        /* cancel */
+        NULL                                  /* atomic */
 };
 
 /********************/
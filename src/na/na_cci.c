@@ -409,7 +409,8 @@ NA_PLUGIN_OPS(cci) = {
     na_cci_poll_get_fd,                     /* poll_get_fd */
     NULL,                                   /* poll_try_wait */
     na_cci_progress,                        /* progress */
-    na_cci_cancel                           /* cancel */
+    na_cci_cancel,                          /* cancel */
+    NULL                                    /* atomic */
 };
 
 /********************/
@@ -580,7 +580,8 @@ NA_PLUGIN_OPS(mpi) = {
         NULL,                                 /* poll_get_fd */
         NULL,                                 /* poll_try_wait */
         na_mpi_progress,                      /* progress */
-        na_mpi_cancel                         /* cancel */
+        na_mpi_cancel,                        /* cancel */
+        NULL                                  /* atomic */
 };
 
 static MPI_Comm na_mpi_init_comm_g = MPI_COMM_NULL; /* MPI comm used at init */
@@ -59,6 +59,7 @@
 #include <rdma/fi_domain.h>
 #include <rdma/fi_endpoint.h>
 #include <rdma/fi_rma.h>
+#include <rdma/fi_atomic.h>
 #include <rdma/fi_tagged.h>
 #include <rdma/fi_cm.h>
 #include <rdma/fi_errno.h>
@@ -310,6 +311,17 @@ struct na_ofi_info_recv_expected {
     na_tag_t tag;
 };
 
+/* Atomic info, words passed to provider are kept (and registered if
+ * provider requires it) in op ID until completion */
+struct na_ofi_info_atomic {
+    na_uint64_t operand;
+    na_uint64_t compare;
+    na_uint64_t fetched;
+    void *result;
+    na_size_t size;
+    struct fid_mr *fi_mr;
+};
+
 /* Operation ID */
 struct na_ofi_op_id {
     struct na_cb_completion_data completion_data; /* Completion data    */
@@ -317,6 +329,7 @@ struct na_ofi_op_id {
         struct na_ofi_info_lookup lookup;
         struct na_ofi_info_recv_unexpected recv_unexpected;
         struct na_ofi_info_recv_expected recv_expected;
+        struct na_ofi_info_atomic atomic;
     } info;                                 /* Op info                  */
     struct fi_context fi_ctx;               /* Context handle           */
     na_context_t *context;                  /* NA context associated    */
@@ -406,6 +419,7 @@ struct na_ofi_class {
     na_uint8_t max_contexts;                /* Max number of contexts   */
     na_bool_t listen;                       /* Listening flag           */
     na_bool_t no_wait;                      /* Ignore wait object       */
+    na_bool_t atomics;                      /* Request atomic operations */
 };
 
 /********************/
@@ -510,10 +524,12 @@ na_ofi_av_lookup(struct na_ofi_domain *na_ofi_domain, fi_addr_t fi_addr,
     void **addr_ptr, size_t *addrlen_ptr);
 
 /**
- * Get info caps from providers and return matching providers.
+ * Get info caps from providers and return matching providers. If atomics are
+ * requested and no provider supports them, NA_OPNOTSUPPORTED is returned.
  */
 static na_return_t
-na_ofi_getinfo(enum na_ofi_prov_type prov_type, struct fi_info **providers);
+na_ofi_getinfo(enum na_ofi_prov_type prov_type, na_bool_t atomics,
+    struct fi_info **providers);
 
 /**
  * Check and resolve interfaces from hostname.
@@ -743,6 +759,12 @@ na_ofi_cq_process_rma_event(struct na_ofi_op_id *na_ofi_op_id);
 static na_return_t
 na_ofi_complete(struct na_ofi_op_id *na_ofi_op_id, na_return_t ret);
 
+/**
+ * Release registration of atomic words.
+ */
+static NA_INLINE void
+na_ofi_atomic_release(struct na_ofi_op_id *na_ofi_op_id);
+
 /**
  * Release OP ID resources.
  */
@@ -945,6 +967,64 @@ na_ofi_progress(na_class_t *na_class, na_context_t *context,
 static na_return_t
 na_ofi_cancel(na_class_t *na_class, na_context_t *context, na_op_id_t op_id);
 
+/* atomic */
+static na_return_t
+na_ofi_atomic(na_class_t *na_class, na_context_t *context, na_cb_t callback,
+    void *arg, na_atomic_op_t op, na_size_t size, const void *operand,
+    const void *compare, void *result, na_mem_handle_t remote_mem_handle,
+    na_offset_t remote_offset, na_addr_t remote_addr, na_uint8_t remote_id,
+    na_op_id_t *op_id);
+
+/* strided_max */
+static na_size_t
+na_ofi_strided_max(na_class_t *na_class);
+
+/* put_strided */
+static na_return_t
+na_ofi_put_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
+    na_uint8_t remote_id, na_op_id_t *op_id);
+
+/* get_strided */
+static na_return_t
+na_ofi_get_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
+    na_uint8_t remote_id, na_op_id_t *op_id);
+
+/**
+ * Get number of contiguous pieces of strided (or contiguous if stride is
+ * NULL) data.
+ */
+static NA_INLINE size_t
+na_ofi_stride_count(const struct na_stride *stride, na_offset_t offset,
+    na_size_t length);
+
+/**
+ * Translate offset of strided data to memory handle offset, return size of
+ * contiguous piece at offset.
+ */
+static NA_INLINE na_size_t
+na_ofi_stride_translate(const struct na_stride *stride, na_offset_t offset,
+    na_size_t length, na_offset_t *mem_offset);
+
+/**
+ * Post strided RMA operation with a single fi_readmsg()/fi_writemsg().
+ */
+static na_return_t
+na_ofi_rma_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_type_t cb_type, na_cb_t callback, void *arg,
+    na_mem_handle_t local_mem_handle, const struct na_stride *local_stride,
+    na_offset_t local_offset, na_mem_handle_t remote_mem_handle,
+    const struct na_stride *remote_stride, na_offset_t remote_offset,
+    na_size_t length, na_addr_t remote_addr, na_uint8_t remote_id,
+    na_op_id_t *op_id);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -998,7 +1078,11 @@ NA_PLUGIN_OPS(ofi) = {
     na_ofi_poll_get_fd,                     /* poll_get_fd */
     na_ofi_poll_try_wait,                   /* poll_try_wait */
     na_ofi_progress,                        /* progress */
-    na_ofi_cancel                           /* cancel */
+    na_ofi_cancel,                          /* cancel */
+    na_ofi_atomic,                          /* atomic */
+    na_ofi_strided_max,                     /* strided_max */
+    na_ofi_put_strided,                     /* put_strided */
+    na_ofi_get_strided                      /* get_strided */
 };
 
 /* OFI access domain list */
@@ -1405,7 +1489,8 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_ofi_getinfo(enum na_ofi_prov_type prov_type, struct fi_info **providers)
+na_ofi_getinfo(enum na_ofi_prov_type prov_type, na_bool_t atomics,
+    struct fi_info **providers)
 {
     struct fi_info *hints = NULL;
     na_return_t ret = NA_SUCCESS;
@@ -1439,6 +1524,11 @@ na_ofi_getinfo(enum na_ofi_prov_type prov_type, struct fi_info **providers)
     /* add any additional caps that are particular to this provider */
     hints->caps |= na_ofi_prov_extra_caps[prov_type];
 
+    /* atomics are only requested by classes that use them, so that providers
+     * without atomics can still be used */
+    if (atomics)
+        hints->caps |= FI_ATOMIC;
+
     /**
      * msg_order: guarantee that messages with same tag are ordered.
      * (FI_ORDER_SAS - Send after send. If set, message send operations,
@@ -1483,6 +1573,11 @@ na_ofi_getinfo(enum na_ofi_prov_type prov_type, struct fi_info **providers)
                     0ULL,  /* Optional flag */
                     hints, /* In: Hints to filter providers */
                     providers); /* Out: List of matching providers */
+    if (rc == -FI_ENODATA && atomics) {
+        /* Caller retries without atomics */
+        ret = NA_OPNOTSUPPORTED;
+        goto cleanup;
+    }
     NA_CHECK_ERROR(rc != 0, cleanup, ret, NA_PROTOCOL_ERROR,
         "fi_getinfo() failed, rc: %d(%s)", rc, fi_strerror(-rc));
 
@@ -1642,6 +1737,7 @@ na_ofi_domain_open(struct na_ofi_class *priv, enum na_ofi_prov_type prov_type,
     struct fi_av_attr av_attr = {0};
     struct fi_info *prov, *providers = NULL;
     na_bool_t domain_found = NA_FALSE, prov_found = NA_FALSE;
+    na_bool_t atomics = priv->atomics;
     na_return_t ret = NA_SUCCESS;
     int rc;
 
@@ -1667,23 +1763,37 @@ na_ofi_domain_open(struct na_ofi_class *priv, enum na_ofi_prov_type prov_type,
         return ret;
     }
 
-    /* If no pre-existing domain, get OFI providers info */
-    ret = na_ofi_getinfo(prov_type, &providers);
-    NA_CHECK_NA_ERROR(error, ret, "na_ofi_getinfo() failed");
-
-    /* Try to find provider that matches protocol and domain/host name */
-    prov = providers;
-    while (prov != NULL) {
-        if (na_ofi_verify_provider(prov_type, domain_name, prov)) {
-//            NA_LOG_DEBUG("mode 0x%llx, fabric_attr -> prov_name: %s, name: %s; "
-//                "domain_attr -> name: %s, threading: %d.", prov->mode,
-//                prov->fabric_attr->prov_name, prov->fabric_attr->name,
-//                prov->domain_attr->name, prov->domain_attr->threading);
-            prov_found = NA_TRUE;
-            break;
+    /* If no pre-existing domain, get OFI providers info, look them up again
+     * without atomics if none of them supports atomics on that domain (atomic
+     * operations are then emulated by upper layer) */
+    do {
+        ret = na_ofi_getinfo(prov_type, atomics, &providers);
+        if (ret == NA_OPNOTSUPPORTED) {
+            atomics = NA_FALSE;
+            continue;
         }
-        prov = prov->next;
-    }
+        NA_CHECK_NA_ERROR(error, ret, "na_ofi_getinfo() failed");
+
+        /* Try to find provider that matches protocol and domain/host name */
+        prov = providers;
+        while (prov != NULL) {
+            if (na_ofi_verify_provider(prov_type, domain_name, prov)) {
+//                NA_LOG_DEBUG("mode 0x%llx, fabric_attr -> prov_name: %s, name: %s; "
+//                    "domain_attr -> name: %s, threading: %d.", prov->mode,
+//                    prov->fabric_attr->prov_name, prov->fabric_attr->name,
+//                    prov->domain_attr->name, prov->domain_attr->threading);
+                prov_found = NA_TRUE;
+                break;
+            }
+            prov = prov->next;
+        }
+        if (!prov_found && atomics) {
+            fi_freeinfo(providers);
+            providers = NULL;
+            atomics = NA_FALSE;
+            ret = NA_OPNOTSUPPORTED;
+        }
+    } while (ret == NA_OPNOTSUPPORTED);
     NA_CHECK_ERROR(!prov_found, error, ret, NA_PROTOCOL_ERROR,
         "No provider found for \"%s\" provider on domain \"%s\"",
         na_ofi_prov_name[prov_type], domain_name);
@@ -2662,7 +2772,7 @@ na_ofi_cq_process_event(na_class_t *na_class, na_context_t *context,
             NA_CHECK_NA_ERROR(out, ret,
                 "Could not process unexpected recv event");
         }
-    } else if (cq_event->flags & FI_RMA) {
+    } else if (cq_event->flags & (FI_RMA | FI_ATOMIC)) {
         ret = na_ofi_cq_process_rma_event(na_ofi_op_id);
         NA_CHECK_NA_ERROR(out, ret, "Could not process rma event");
     } else
@@ -2782,9 +2892,9 @@ na_ofi_cq_process_rma_event(struct na_ofi_op_id *na_ofi_op_id)
     na_cb_type_t cb_type = na_ofi_op_id->completion_data.callback_info.type;
     na_return_t ret = NA_SUCCESS;
 
-    NA_CHECK_ERROR(cb_type != NA_CB_PUT && cb_type != NA_CB_GET, out, ret,
-        NA_PROTOCOL_ERROR, "Invalid cb_type %d, expected NA_CB_PUT/GET",
-        cb_type);
+    NA_CHECK_ERROR(cb_type != NA_CB_PUT && cb_type != NA_CB_GET
+        && cb_type != NA_CB_ATOMIC, out, ret, NA_PROTOCOL_ERROR,
+        "Invalid cb_type %d, expected NA_CB_PUT/GET/ATOMIC", cb_type);
 
 out:
     return ret;
@@ -2832,6 +2942,14 @@ na_ofi_complete(struct na_ofi_op_id *na_ofi_op_id, na_return_t op_ret)
     case NA_CB_PUT:
     case NA_CB_GET:
         break;
+    case NA_CB_ATOMIC:
+        /* Previous value was fetched into op ID */
+        if (op_ret == NA_SUCCESS && na_ofi_op_id->info.atomic.result)
+            memcpy(na_ofi_op_id->info.atomic.result,
+                &na_ofi_op_id->info.atomic.fetched,
+                na_ofi_op_id->info.atomic.size);
+        na_ofi_atomic_release(na_ofi_op_id);
+        break;
     default:
         NA_GOTO_ERROR(out, ret, NA_INVALID_PARAM,
             "Operation type %d not supported", callback_info->type);
@@ -2850,6 +2968,23 @@ out:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE void
+na_ofi_atomic_release(struct na_ofi_op_id *na_ofi_op_id)
+{
+    int rc;
+
+    if (!na_ofi_op_id->info.atomic.fi_mr)
+        return;
+
+    rc = fi_close(&na_ofi_op_id->info.atomic.fi_mr->fid);
+    NA_CHECK_ERROR_NORET(rc != 0, out,
+        "fi_close() mr_hdl failed, rc: %d(%s)", rc, fi_strerror(-rc));
+
+out:
+    na_ofi_op_id->info.atomic.fi_mr = NULL;
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE void
 na_ofi_release(void *arg)
@@ -2879,7 +3014,7 @@ na_ofi_check_protocol(const char *protocol_name)
         "Protocol %s not supported", protocol_name);
 
     /* Get info from provider */
-    ret = na_ofi_getinfo(type, &providers);
+    ret = na_ofi_getinfo(type, NA_FALSE, &providers);
     NA_CHECK_NA_ERROR(out, ret, "na_ofi_getinfo() failed");
 
     prov = providers;
@@ -2920,6 +3055,7 @@ na_ofi_initialize(na_class_t *na_class, const struct na_info *na_info,
     na_bool_t no_wait = NA_FALSE;
     na_uint8_t max_contexts = 1; /* Default */
     const char *auth_key = NULL;
+    na_bool_t atomics = NA_FALSE;
     na_return_t ret = NA_SUCCESS;
     enum na_ofi_prov_type prov_type;
 
@@ -3023,6 +3159,8 @@ na_ofi_initialize(na_class_t *na_class, const struct na_info *na_info,
         max_contexts = na_info->na_init_info->max_contexts;
         /* Auth key */
         auth_key = na_info->na_init_info->auth_key;
+        /* Atomic operations */
+        atomics = na_info->na_init_info->atomics;
     }
 
     /* Create private data */
@@ -3035,6 +3173,7 @@ na_ofi_initialize(na_class_t *na_class, const struct na_info *na_info,
     priv->no_wait = no_wait;
     priv->listen = listen;
     priv->max_contexts = max_contexts;
+    priv->atomics = atomics;
     priv->contexts = 0;
 
     /* Initialize queue / mutex */
@@ -4446,6 +4585,7 @@ na_ofi_cancel(na_class_t *na_class, na_context_t *context,
     case NA_CB_SEND_EXPECTED:
     case NA_CB_PUT:
     case NA_CB_GET:
+    case NA_CB_ATOMIC:
         /* May or may not be canceled in that case */
         rc = fi_cancel(&NA_OFI_CONTEXT(context)->fi_tx->fid,
             &na_ofi_op_id->fi_ctx);
@@ -4478,3 +4618,321 @@ na_ofi_cancel(na_class_t *na_class, na_context_t *context,
 out:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_ofi_atomic(na_class_t *na_class, na_context_t *context, na_cb_t callback,
+    void *arg, na_atomic_op_t op, na_size_t size, const void *operand,
+    const void *compare, void *result, na_mem_handle_t remote_mem_handle,
+    na_offset_t remote_offset, na_addr_t remote_addr, na_uint8_t remote_id,
+    na_op_id_t *op_id)
+{
+    struct na_ofi_context *ctx = NA_OFI_CONTEXT(context);
+    struct fid_ep *ep_hdl = ctx->fi_tx;
+    struct na_ofi_mem_handle *ofi_remote_mem_handle =
+        (struct na_ofi_mem_handle *) remote_mem_handle;
+    struct na_ofi_addr *na_ofi_addr = (struct na_ofi_addr *) remote_addr;
+    enum fi_datatype datatype = (size == sizeof(na_uint32_t)) ?
+        FI_UINT32 : FI_UINT64;
+    fi_addr_t fi_addr = fi_rx_addr(na_ofi_addr->fi_addr, remote_id,
+        NA_OFI_SEP_RX_CTX_BITS);
+    uint64_t addr = (uint64_t)(ofi_remote_mem_handle->desc.base
+        + remote_offset);
+    uint64_t key = ofi_remote_mem_handle->desc.fi_mr_key;
+    struct na_ofi_domain *domain = NA_OFI_CLASS(na_class)->domain;
+    struct na_ofi_op_id *na_ofi_op_id = NULL;
+    void *desc = NULL;
+    na_return_t ret = NA_SUCCESS;
+    ssize_t rc;
+
+    /* Provider must support atomics (only requested if class uses them), let
+     * upper layer emulate them otherwise */
+    if (!(domain->fi_prov->caps & FI_ATOMIC))
+        return NA_OPNOTSUPPORTED;
+
+    NA_CHECK_ERROR(size != sizeof(na_uint32_t) && size != sizeof(na_uint64_t),
+        out, ret, NA_INVALID_PARAM, "Invalid atomic size (%zu)", (size_t) size);
+
+    /* Check op_id */
+    NA_CHECK_ERROR(
+        op_id == NULL || op_id == NA_OP_ID_IGNORE || *op_id == NA_OP_ID_NULL,
+        out, ret, NA_INVALID_PARAM, "Invalid operation ID");
+
+    na_ofi_op_id = (struct na_ofi_op_id *) *op_id;
+    na_ofi_op_id_addref(na_ofi_op_id);
+    na_ofi_op_id->context = context;
+    na_ofi_op_id->completion_data.callback_info.type = NA_CB_ATOMIC;
+    na_ofi_op_id->completion_data.callback = callback;
+    na_ofi_op_id->completion_data.callback_info.arg = arg;
+    hg_atomic_set32(&na_ofi_op_id->completed, NA_FALSE);
+    hg_atomic_set32(&na_ofi_op_id->canceled, NA_FALSE);
+    na_ofi_addr_addref(na_ofi_addr); /* for na_ofi_complete() */
+    na_ofi_op_id->addr = na_ofi_addr;
+
+    /* Keep operands in op ID until completion, previous value is fetched
+     * into op ID and copied to result on completion */
+    memcpy(&na_ofi_op_id->info.atomic.operand, operand, size);
+    if (op == NA_ATOMIC_CSWAP)
+        memcpy(&na_ofi_op_id->info.atomic.compare, compare, size);
+    na_ofi_op_id->info.atomic.result = result;
+    na_ofi_op_id->info.atomic.size = size;
+    na_ofi_op_id->info.atomic.fi_mr = NULL;
+
+    /* Local buffers must be registered with FI_MR_LOCAL, global handle
+     * covers all memory with FI_MR_SCALABLE */
+    if (domain->fi_prov->domain_attr->mr_mode & FI_MR_LOCAL) {
+        if (!(domain->fi_prov->domain_attr->mr_mode & FI_MR_ALLOCATED))
+            desc = fi_mr_desc(domain->fi_mr);
+        else {
+            rc = fi_mr_reg(domain->fi_domain, &na_ofi_op_id->info.atomic,
+                sizeof(na_ofi_op_id->info.atomic), FI_READ | FI_WRITE,
+                0 /* offset */, 0 /* requested key */, 0 /* flags */,
+                &na_ofi_op_id->info.atomic.fi_mr, NULL /* context */);
+            NA_CHECK_ERROR(rc != 0, error, ret, NA_PROTOCOL_ERROR,
+                "fi_mr_reg() failed, rc: %d(%s)", rc, fi_strerror((int) -rc));
+            desc = fi_mr_desc(na_ofi_op_id->info.atomic.fi_mr);
+        }
+    }
+
+    /* Post the OFI atomic */
+    do {
+        switch (op) {
+        case NA_ATOMIC_FADD:
+            rc = fi_fetch_atomic(ep_hdl, &na_ofi_op_id->info.atomic.operand, 1,
+                desc, &na_ofi_op_id->info.atomic.fetched, desc, fi_addr, addr,
+                key, datatype, FI_SUM, &na_ofi_op_id->fi_ctx);
+            break;
+        case NA_ATOMIC_SWAP:
+            rc = fi_fetch_atomic(ep_hdl, &na_ofi_op_id->info.atomic.operand, 1,
+                desc, &na_ofi_op_id->info.atomic.fetched, desc, fi_addr, addr,
+                key, datatype, FI_ATOMIC_WRITE, &na_ofi_op_id->fi_ctx);
+            break;
+        case NA_ATOMIC_CSWAP:
+            rc = fi_compare_atomic(ep_hdl, &na_ofi_op_id->info.atomic.operand,
+                1, desc, &na_ofi_op_id->info.atomic.compare, desc,
+                &na_ofi_op_id->info.atomic.fetched, desc, fi_addr, addr, key,
+                datatype, FI_CSWAP, &na_ofi_op_id->fi_ctx);
+            break;
+        default:
+            rc = -FI_EOPNOTSUPP;
+            break;
+        }
+        /* for EAGAIN, progress and do it again */
+        if (rc == -FI_EAGAIN)
+            na_ofi_progress(na_class, context, 0);
+        else
+            break;
+    } while (1);
+    if (rc == -FI_EOPNOTSUPP || rc == -FI_ENOSYS) {
+        /* Datatype or operation not supported by provider */
+        ret = NA_OPNOTSUPPORTED;
+        goto error;
+    }
+    NA_CHECK_ERROR(rc != 0, error, ret, NA_PROTOCOL_ERROR,
+        "fi_atomic() failed, rc: %d(%s)", rc, fi_strerror((int) -rc));
+
+out:
+    return ret;
+
+error:
+    na_ofi_atomic_release(na_ofi_op_id);
+    na_ofi_addr_decref(na_ofi_addr);
+    na_ofi_op_id_decref(na_ofi_op_id);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_size_t
+na_ofi_strided_max(na_class_t *na_class)
+{
+    struct fi_tx_attr *tx_attr =
+        NA_OFI_CLASS(na_class)->domain->fi_prov->tx_attr;
+
+    /* Each block is an iovec entry of fi_readmsg()/fi_writemsg() */
+    return (na_size_t) MIN(tx_attr->iov_limit, tx_attr->rma_iov_limit);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_ofi_put_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
+    na_uint8_t remote_id, na_op_id_t *op_id)
+{
+    return na_ofi_rma_strided(na_class, context, NA_CB_PUT, callback, arg,
+        local_mem_handle, local_stride, local_offset, remote_mem_handle,
+        remote_stride, remote_offset, length, remote_addr, remote_id, op_id);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_ofi_get_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
+    na_uint8_t remote_id, na_op_id_t *op_id)
+{
+    return na_ofi_rma_strided(na_class, context, NA_CB_GET, callback, arg,
+        local_mem_handle, local_stride, local_offset, remote_mem_handle,
+        remote_stride, remote_offset, length, remote_addr, remote_id, op_id);
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE size_t
+na_ofi_stride_count(const struct na_stride *stride, na_offset_t offset,
+    na_size_t length)
+{
+    if (!stride)
+        return 1;
+
+    /* First and last blocks may be partially accessed */
+    return (size_t) ((offset % stride->block_size + length
+        + stride->block_size - 1) / stride->block_size);
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_size_t
+na_ofi_stride_translate(const struct na_stride *stride, na_offset_t offset,
+    na_size_t length, na_offset_t *mem_offset)
+{
+    na_size_t block_offset;
+
+    if (!stride) {
+        *mem_offset = offset;
+        return length;
+    }
+
+    block_offset = offset % stride->block_size;
+    *mem_offset = stride->offset + (offset / stride->block_size)
+        * stride->stride + block_offset;
+
+    return MIN(length, stride->block_size - block_offset);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_ofi_rma_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_type_t cb_type, na_cb_t callback, void *arg,
+    na_mem_handle_t local_mem_handle, const struct na_stride *local_stride,
+    na_offset_t local_offset, na_mem_handle_t remote_mem_handle,
+    const struct na_stride *remote_stride, na_offset_t remote_offset,
+    na_size_t length, na_addr_t remote_addr, na_uint8_t remote_id,
+    na_op_id_t *op_id)
+{
+    struct na_ofi_context *ctx = NA_OFI_CONTEXT(context);
+    struct fid_ep *ep_hdl = ctx->fi_tx;
+    struct na_ofi_mem_handle *ofi_local_mem_handle =
+        (struct na_ofi_mem_handle *) local_mem_handle;
+    struct na_ofi_mem_handle *ofi_remote_mem_handle =
+        (struct na_ofi_mem_handle *) remote_mem_handle;
+    struct na_ofi_addr *na_ofi_addr = (struct na_ofi_addr *) remote_addr;
+    void *local_desc = fi_mr_desc(ofi_local_mem_handle->fi_mr);
+    size_t local_count = 0, remote_count = 0, i;
+    struct iovec *local_iov = NULL;
+    void **local_descs = NULL;
+    struct fi_rma_iov *remote_iov = NULL;
+    struct fi_msg_rma msg_rma;
+    struct na_ofi_op_id *na_ofi_op_id = NULL;
+    na_size_t max = na_ofi_strided_max(na_class), transferred;
+    na_offset_t mem_offset;
+    na_return_t ret = NA_SUCCESS;
+    ssize_t rc;
+
+    NA_CHECK_ERROR((local_stride && (!local_stride->block_size
+        || local_stride->stride < local_stride->block_size))
+        || (remote_stride && (!remote_stride->block_size
+        || remote_stride->stride < remote_stride->block_size)), out, ret,
+        NA_INVALID_PARAM, "Invalid strided layout");
+
+    local_count = na_ofi_stride_count(local_stride, local_offset, length);
+    remote_count = na_ofi_stride_count(remote_stride, remote_offset, length);
+    NA_CHECK_ERROR(local_count > max || remote_count > max, out, ret,
+        NA_INVALID_PARAM, "Block count exceeds provider iov limit (%zu)",
+        (size_t) max);
+
+    /* Check op_id */
+    NA_CHECK_ERROR(
+        op_id == NULL || op_id == NA_OP_ID_IGNORE || *op_id == NA_OP_ID_NULL,
+        out, ret, NA_INVALID_PARAM, "Invalid operation ID");
+
+    /* Descriptors of local memory are all the same */
+    local_iov = (struct iovec *) malloc(local_count * sizeof(*local_iov));
+    local_descs = (void **) malloc(local_count * sizeof(*local_descs));
+    remote_iov = (struct fi_rma_iov *) malloc(
+        remote_count * sizeof(*remote_iov));
+    NA_CHECK_ERROR(!local_iov || !local_descs || !remote_iov, out, ret,
+        NA_NOMEM_ERROR, "Could not allocate iovecs");
+    for (i = 0, transferred = 0; i < local_count; i++) {
+        local_iov[i].iov_len = na_ofi_stride_translate(local_stride,
+            local_offset + transferred, length - transferred, &mem_offset);
+        local_iov[i].iov_base = (char *) ofi_local_mem_handle->desc.base
+            + mem_offset;
+        local_descs[i] = local_desc;
+        transferred += local_iov[i].iov_len;
+    }
+    for (i = 0, transferred = 0; i < remote_count; i++) {
+        remote_iov[i].len = na_ofi_stride_translate(remote_stride,
+            remote_offset + transferred, length - transferred, &mem_offset);
+        remote_iov[i].addr = (uint64_t)(ofi_remote_mem_handle->desc.base
+            + mem_offset);
+        remote_iov[i].key = ofi_remote_mem_handle->desc.fi_mr_key;
+        transferred += remote_iov[i].len;
+    }
+
+    na_ofi_op_id = (struct na_ofi_op_id *) *op_id;
+    na_ofi_op_id_addref(na_ofi_op_id);
+    na_ofi_op_id->context = context;
+    na_ofi_op_id->completion_data.callback_info.type = cb_type;
+    na_ofi_op_id->completion_data.callback = callback;
+    na_ofi_op_id->completion_data.callback_info.arg = arg;
+    hg_atomic_set32(&na_ofi_op_id->completed, NA_FALSE);
+    hg_atomic_set32(&na_ofi_op_id->canceled, NA_FALSE);
+    na_ofi_addr_addref(na_ofi_addr); /* for na_ofi_complete() */
+    na_ofi_op_id->addr = na_ofi_addr;
+
+    msg_rma.msg_iov = local_iov;
+    msg_rma.desc = local_descs;
+    msg_rma.iov_count = local_count;
+    msg_rma.addr = fi_rx_addr(na_ofi_addr->fi_addr, remote_id,
+        NA_OFI_SEP_RX_CTX_BITS);
+    msg_rma.rma_iov = remote_iov;
+    msg_rma.rma_iov_count = remote_count;
+    msg_rma.context = &na_ofi_op_id->fi_ctx;
+    msg_rma.data = 0;
+
+    /* Post the OFI RMA, iovecs are no longer used once posted */
+    do {
+        if (cb_type == NA_CB_PUT)
+            rc = fi_writemsg(ep_hdl, &msg_rma,
+                FI_COMPLETION | FI_DELIVERY_COMPLETE);
+        else
+            rc = fi_readmsg(ep_hdl, &msg_rma, FI_COMPLETION);
+        /* for EAGAIN, progress and do it again */
+        if (rc == -FI_EAGAIN)
+            na_ofi_progress(na_class, context, 0);
+        else
+            break;
+    } while (1);
+    NA_CHECK_ERROR(rc != 0, error, ret, NA_PROTOCOL_ERROR,
+        "fi_%smsg() failed, rc: %d(%s)", (cb_type == NA_CB_PUT) ? "write" :
+        "read", rc, fi_strerror((int) -rc));
+
+out:
+    free(local_iov);
+    free(local_descs);
+    free(remote_iov);
+    return ret;
+
+error:
+    na_ofi_addr_decref(na_ofi_addr);
+    na_ofi_op_id_decref(na_ofi_op_id);
+    free(local_iov);
+    free(local_descs);
+    free(remote_iov);
+
+    return ret;
+}
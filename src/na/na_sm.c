@@ -18,6 +18,7 @@
 #include "mercury_poll.h"
 #include "mercury_event.h"
 #include "mercury_mem.h"
+#include "mercury_mem_copy.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -205,6 +206,19 @@ struct na_sm_mem_handle {
     size_t len;
 };
 
+#ifdef NA_SM_HAS_CMA
+/* Concurrent CMA transfer */
+struct na_sm_cma_split {
+    pid_t pid;                              /* Remote PID */
+    struct na_sm_mem_handle *local;         /* Local mem handle */
+    na_offset_t local_offset;               /* Local offset */
+    struct na_sm_mem_handle *remote;        /* Remote mem handle */
+    na_offset_t remote_offset;              /* Remote offset */
+    na_bool_t write;                        /* Write to remote */
+    hg_atomic_int32_t error;                /* errno of failed part */
+};
+#endif
+
 /* Lookup info */
 struct na_sm_info_lookup {
     struct na_sm_addr *na_sm_addr;
@@ -514,6 +528,33 @@ na_sm_offset_translate(
     unsigned long *iovcnt
     );
 
+#ifdef NA_SM_HAS_CMA
+/**
+ * Transfer part of a concurrent CMA transfer.
+ */
+static int
+na_sm_cma_split_part(
+    void *arg,
+    size_t offset,
+    size_t len
+    );
+
+/**
+ * Issue CMA transfer as concurrent process_vm_*() calls on copy engine
+ * threads. Returns number of bytes transferred or -1 and sets errno.
+ */
+static ssize_t
+na_sm_cma_split(
+    pid_t pid,
+    struct na_sm_mem_handle *local,
+    na_offset_t local_offset,
+    struct na_sm_mem_handle *remote,
+    na_offset_t remote_offset,
+    na_size_t length,
+    na_bool_t write
+    );
+#endif
+
 /**
  * Progress callback.
  */
@@ -544,6 +585,16 @@ na_sm_progress_accept(
     na_bool_t *progressed
     );
 
+/**
+ * Set up accepted connection.
+ */
+static na_return_t
+na_sm_accept_conn(
+    na_class_t *na_class,
+    struct na_sm_addr *poll_addr,
+    int conn_sock
+    );
+
 /**
  * Progress on socket.
  */
@@ -855,6 +906,86 @@ na_sm_get(
     na_op_id_t *op_id
     );
 
+#ifdef NA_SM_HAS_CMA
+/**
+ * Translate offset of strided (or contiguous if stride is NULL) data to iovec.
+ */
+static na_return_t
+na_sm_stride_translate(
+    struct na_sm_mem_handle *mem_handle,
+    const struct na_stride *stride,
+    na_offset_t offset,
+    na_size_t length,
+    struct iovec **iov_ptr,
+    unsigned long *iovcnt_ptr
+    );
+
+/**
+ * Transfer strided data with a single process_vm_*() call.
+ */
+static na_return_t
+na_sm_rma_strided(
+    na_class_t *na_class,
+    na_context_t *context,
+    na_cb_type_t cb_type,
+    na_cb_t callback,
+    void *arg,
+    na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride,
+    na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle,
+    const struct na_stride *remote_stride,
+    na_offset_t remote_offset,
+    na_size_t length,
+    na_addr_t remote_addr,
+    na_op_id_t *op_id
+    );
+
+/* strided_max */
+static na_size_t
+na_sm_strided_max(
+    na_class_t *na_class
+    );
+
+/* put_strided */
+static na_return_t
+na_sm_put_strided(
+    na_class_t *na_class,
+    na_context_t *context,
+    na_cb_t callback,
+    void *arg,
+    na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride,
+    na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle,
+    const struct na_stride *remote_stride,
+    na_offset_t remote_offset,
+    na_size_t length,
+    na_addr_t remote_addr,
+    na_uint8_t remote_id,
+    na_op_id_t *op_id
+    );
+
+/* get_strided */
+static na_return_t
+na_sm_get_strided(
+    na_class_t *na_class,
+    na_context_t *context,
+    na_cb_t callback,
+    void *arg,
+    na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride,
+    na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle,
+    const struct na_stride *remote_stride,
+    na_offset_t remote_offset,
+    na_size_t length,
+    na_addr_t remote_addr,
+    na_uint8_t remote_id,
+    na_op_id_t *op_id
+    );
+#endif
+
 /* poll_get_fd */
 static NA_INLINE int
 na_sm_poll_get_fd(
@@ -942,7 +1073,21 @@ NA_PLUGIN_OPS(sm) = {
     na_sm_poll_get_fd,                      /* poll_get_fd */
     na_sm_poll_try_wait,                    /* poll_try_wait */
     na_sm_progress,                         /* progress */
-    na_sm_cancel                            /* cancel */
+    na_sm_cancel,                           /* cancel */
+    /* Not supported: memory handles describe private memory of the remote
+     * process (only reachable through process_vm_readv/writev() copies),
+     * not a region shared with the peer on which a word could be updated
+     * atomically. Atomics are therefore emulated by upper layer */
+    NULL,                                   /* atomic */
+#ifdef NA_SM_HAS_CMA
+    na_sm_strided_max,                      /* strided_max */
+    na_sm_put_strided,                      /* put_strided */
+    na_sm_get_strided                       /* get_strided */
+#else
+    NULL,                                   /* strided_max */
+    NULL,                                   /* put_strided */
+    NULL                                    /* get_strided */
+#endif
 };
 
 /********************/
@@ -1119,7 +1264,7 @@ na_sm_close_sock(int sock, const char *pathname)
 {
     na_return_t ret = NA_SUCCESS;
 
-    if (close(sock) == -1) {
+    if (sock >= 0 && close(sock) == -1) {
         NA_LOG_ERROR("close() failed (%s)", strerror(errno));
         ret = NA_PROTOCOL_ERROR;
         goto done;
@@ -1804,6 +1949,65 @@ na_sm_offset_translate(struct na_sm_mem_handle *mem_handle, na_offset_t offset,
     *iovcnt = i;
 }
 
+/*---------------------------------------------------------------------------*/
+#ifdef NA_SM_HAS_CMA
+static int
+na_sm_cma_split_part(void *arg, size_t offset, size_t len)
+{
+    struct na_sm_cma_split *split = (struct na_sm_cma_split *) arg;
+    struct iovec *local_iov, *remote_iov;
+    unsigned long liovcnt, riovcnt;
+    ssize_t nbytes;
+
+    local_iov = (struct iovec *) alloca(
+        split->local->iovcnt * sizeof(struct iovec));
+    na_sm_offset_translate(split->local, split->local_offset + offset, len,
+        local_iov, &liovcnt);
+    remote_iov = (struct iovec *) alloca(
+        split->remote->iovcnt * sizeof(struct iovec));
+    na_sm_offset_translate(split->remote, split->remote_offset + offset, len,
+        remote_iov, &riovcnt);
+
+    if (split->write)
+        nbytes = process_vm_writev(split->pid, local_iov, liovcnt, remote_iov,
+            riovcnt, /* unused */0);
+    else
+        nbytes = process_vm_readv(split->pid, local_iov, liovcnt, remote_iov,
+            riovcnt, /* unused */0);
+    if (nbytes < 0 || (size_t) nbytes != len) {
+        hg_atomic_set32(&split->error, (nbytes < 0) ? errno : EFAULT);
+        return HG_UTIL_FAIL;
+    }
+
+    return HG_UTIL_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static ssize_t
+na_sm_cma_split(pid_t pid, struct na_sm_mem_handle *local,
+    na_offset_t local_offset, struct na_sm_mem_handle *remote,
+    na_offset_t remote_offset, na_size_t length, na_bool_t write)
+{
+    struct na_sm_cma_split split;
+
+    split.pid = pid;
+    split.local = local;
+    split.local_offset = local_offset;
+    split.remote = remote;
+    split.remote_offset = remote_offset;
+    split.write = write;
+    hg_atomic_init32(&split.error, 0);
+
+    if (hg_mem_copy_split(length, HG_MEM_COPY_SPLIT_SIZE, na_sm_cma_split_part,
+        &split) != HG_UTIL_SUCCESS) {
+        errno = hg_atomic_get32(&split.error);
+        return -1;
+    }
+
+    return (ssize_t) length;
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 static int
 na_sm_progress_cb(void *arg, int error, hg_util_bool_t *progressed)
@@ -1888,14 +2092,13 @@ static na_return_t
 na_sm_progress_accept(na_class_t *na_class, struct na_sm_addr *poll_addr,
     na_bool_t *progressed)
 {
-    struct na_sm_addr *na_sm_addr = NULL;
-    struct na_sm_ring_buf *na_sm_ring_buf = NULL;
-    char filename[NA_SM_MAX_FILENAME];
-    int conn_sock, local_notify, remote_notify;
+    int conn_sock, i;
     hg_time_t now;
     double elapsed_ms;
     na_return_t ret = NA_SUCCESS;
 
+    *progressed = NA_FALSE;
+
     if (poll_addr != NA_SM_CLASS(na_class)->self_addr) {
         NA_LOG_ERROR("Unrecognized poll addr");
         ret = NA_PROTOCOL_ERROR;
@@ -1906,34 +2109,56 @@ na_sm_progress_accept(na_class_t *na_class, struct na_sm_addr *poll_addr,
     hg_time_get_current(&now);
     elapsed_ms = hg_time_to_double(hg_time_subtract(now,
         NA_SM_CLASS(na_class)->last_accept_time)) * 1000.0;
-    if (elapsed_ms < NA_SM_ACCEPT_INTERVAL) {
-        *progressed = NA_FALSE;
+    if (elapsed_ms < NA_SM_ACCEPT_INTERVAL)
         goto done;
-    }
     NA_SM_CLASS(na_class)->last_accept_time = now;
 
+    /* Drain backlog so that peers connecting concurrently (e.g., at startup)
+     * do not each wait for another accept interval */
+    for (i = 0; i < NA_SM_LISTEN_BACKLOG; i++) {
 #ifdef SOCK_NONBLOCK
-    conn_sock = accept4(poll_addr->sock, NULL, NULL, SOCK_NONBLOCK);
+        conn_sock = accept4(poll_addr->sock, NULL, NULL, SOCK_NONBLOCK);
 #else
-    conn_sock = accept(poll_addr->sock, NULL, NULL);
+        conn_sock = accept(poll_addr->sock, NULL, NULL);
 #endif
-    if (conn_sock == -1) {
-        if (errno == EAGAIN) {
-            *progressed = NA_FALSE;
+        if (conn_sock == -1) {
+            if (errno == EAGAIN)
+                break;
+            NA_LOG_ERROR("accept() failed (%s)", strerror(errno));
+            ret = NA_PROTOCOL_ERROR;
             goto done;
         }
-        NA_LOG_ERROR("accept() failed (%s)", strerror(errno));
-        ret = NA_PROTOCOL_ERROR;
-        goto done;
-    }
 #ifndef SOCK_NONBLOCK
-    if (fcntl(conn_sock, F_SETFL, O_NONBLOCK) == -1) {
-        NA_LOG_ERROR("fcntl() failed (%s)", strerror(errno));
-        ret = NA_PROTOCOL_ERROR;
-        goto done;
-    };
+        if (fcntl(conn_sock, F_SETFL, O_NONBLOCK) == -1) {
+            NA_LOG_ERROR("fcntl() failed (%s)", strerror(errno));
+            ret = NA_PROTOCOL_ERROR;
+            goto done;
+        };
 #endif
 
+        ret = na_sm_accept_conn(na_class, poll_addr, conn_sock);
+        if (ret != NA_SUCCESS) {
+            NA_LOG_ERROR("Could not set up accepted connection");
+            goto done;
+        }
+        *progressed = NA_TRUE;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_accept_conn(na_class_t *na_class, struct na_sm_addr *poll_addr,
+    int conn_sock)
+{
+    struct na_sm_addr *na_sm_addr = NULL;
+    struct na_sm_ring_buf *na_sm_ring_buf = NULL;
+    char filename[NA_SM_MAX_FILENAME];
+    int local_notify, remote_notify;
+    na_return_t ret = NA_SUCCESS;
+
     /* Allocate new addr and pass it to poll set */
     na_sm_addr = (struct na_sm_addr *) malloc(sizeof(struct na_sm_addr));
     if (!na_sm_addr) {
@@ -2057,8 +2282,6 @@ na_sm_progress_accept(na_class_t *na_class, struct na_sm_addr *poll_addr,
         entry);
     hg_thread_spin_unlock(&NA_SM_CLASS(na_class)->accepted_addr_queue_lock);
 
-    *progressed = NA_TRUE;
-
 done:
     return ret;
 }
@@ -2120,7 +2343,6 @@ na_sm_progress_sock(na_class_t *na_class, struct na_sm_addr *poll_addr,
                 *progressed = NA_FALSE;
                 goto done;
             }
-            poll_addr->sock_progress = NA_SM_SOCK_DONE;
 
             /* Find op ID that corresponds to addr */
             hg_thread_spin_lock(&NA_SM_CLASS(na_class)->lookup_op_queue_lock);
@@ -2173,6 +2395,7 @@ na_sm_progress_sock(na_class_t *na_class, struct na_sm_addr *poll_addr,
             }
 
             /* Add addr to poll addr queue */
+            poll_addr->sock_progress = NA_SM_SOCK_DONE;
             hg_thread_spin_lock(&NA_SM_CLASS(na_class)->poll_addr_queue_lock);
             HG_QUEUE_PUSH_TAIL(&NA_SM_CLASS(na_class)->poll_addr_queue,
                 poll_addr, poll_entry);
@@ -2552,6 +2775,7 @@ na_sm_initialize(na_class_t *na_class, const struct na_info NA_UNUSED *na_info,
     na_sm_addr->pid = pid;
     na_sm_addr->id = (unsigned int) hg_atomic_incr32(&id) - 1;
     na_sm_addr->self = NA_TRUE;
+    na_sm_addr->sock = -1; /* Only set if listening */
     hg_atomic_init32(&na_sm_addr->ref_count, 1);
     /* If we're listening, create a new shm region */
     if (listen) {
@@ -2927,11 +3151,16 @@ na_sm_addr_free(na_class_t *na_class, na_addr_t addr)
             goto done;
         }
 
-        /* Remove addr from poll addr queue */
-        hg_thread_spin_lock(&NA_SM_CLASS(na_class)->poll_addr_queue_lock);
-        HG_QUEUE_REMOVE(&NA_SM_CLASS(na_class)->poll_addr_queue, na_sm_addr,
-            na_sm_addr, poll_entry);
-        hg_thread_spin_unlock(&NA_SM_CLASS(na_class)->poll_addr_queue_lock);
+        /* Remove addr from poll addr queue (addrs only get queued once their
+         * sock progress is done, an accepted addr may be freed before its
+         * addr info was received, e.g., when finalizing) */
+        if (na_sm_addr->sock_progress == NA_SM_SOCK_DONE) {
+            hg_thread_spin_lock(&NA_SM_CLASS(na_class)->poll_addr_queue_lock);
+            HG_QUEUE_REMOVE(&NA_SM_CLASS(na_class)->poll_addr_queue,
+                na_sm_addr, na_sm_addr, poll_entry);
+            hg_thread_spin_unlock(
+                &NA_SM_CLASS(na_class)->poll_addr_queue_lock);
+        }
 
         if (na_sm_addr->accepted) { /* Created by accept */
             /* Get file names from ring bufs / events to delete files */
@@ -3729,8 +3958,14 @@ na_sm_put(na_class_t *na_class, na_context_t *context, na_cb_t callback,
     }
 
 #if defined(NA_SM_HAS_CMA)
-    nwrite = process_vm_writev(na_sm_addr->pid, local_iov, liovcnt, remote_iov,
-        riovcnt, /* unused */0);
+    /* Large transfers are split across copy engine threads */
+    if (length >= 2 * HG_MEM_COPY_SPLIT_SIZE && hg_mem_copy_get_threads() > 1)
+        nwrite = na_sm_cma_split(na_sm_addr->pid, na_sm_mem_handle_local,
+            local_offset, na_sm_mem_handle_remote, remote_offset, length,
+            NA_TRUE);
+    else
+        nwrite = process_vm_writev(na_sm_addr->pid, local_iov, liovcnt,
+            remote_iov, riovcnt, /* unused */0);
     if (nwrite < 0) {
         NA_LOG_ERROR("process_vm_writev() failed (%s)", strerror(errno));
         ret = NA_PROTOCOL_ERROR;
@@ -3886,8 +4121,14 @@ na_sm_get(na_class_t *na_class, na_context_t *context, na_cb_t callback,
     }
 
 #if defined(NA_SM_HAS_CMA)
-    nread = process_vm_readv(na_sm_addr->pid, local_iov, liovcnt, remote_iov,
-        riovcnt, /* unused */0);
+    /* Large transfers are split across copy engine threads */
+    if (length >= 2 * HG_MEM_COPY_SPLIT_SIZE && hg_mem_copy_get_threads() > 1)
+        nread = na_sm_cma_split(na_sm_addr->pid, na_sm_mem_handle_local,
+            local_offset, na_sm_mem_handle_remote, remote_offset, length,
+            NA_FALSE);
+    else
+        nread = process_vm_readv(na_sm_addr->pid, local_iov, liovcnt,
+            remote_iov, riovcnt, /* unused */0);
     if (nread < 0) {
         NA_LOG_ERROR("process_vm_readv() failed (%s)", strerror(errno));
         ret = NA_PROTOCOL_ERROR;
@@ -3948,6 +4189,242 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+#ifdef NA_SM_HAS_CMA
+static na_return_t
+na_sm_stride_translate(struct na_sm_mem_handle *mem_handle,
+    const struct na_stride *stride, na_offset_t offset, na_size_t length,
+    struct iovec **iov_ptr, unsigned long *iovcnt_ptr)
+{
+    struct iovec *iov = NULL;
+    na_size_t block_offset, remaining_len = length, first_index, last_len;
+    unsigned long i, iovcnt;
+    na_return_t ret = NA_SUCCESS;
+
+    /* Contiguous data may still span multiple segments */
+    if (!stride) {
+        iov = (struct iovec *) malloc(
+            mem_handle->iovcnt * sizeof(struct iovec));
+        if (!iov) {
+            NA_LOG_ERROR("Could not allocate iovec");
+            ret = NA_NOMEM_ERROR;
+            goto done;
+        }
+        na_sm_offset_translate(mem_handle, offset, length, iov, &iovcnt);
+        goto done;
+    }
+
+    if (mem_handle->iovcnt != 1 || !stride->block_size
+        || stride->stride < stride->block_size) {
+        NA_LOG_ERROR("Invalid strided layout");
+        ret = NA_INVALID_PARAM;
+        goto done;
+    }
+
+    /* First and last blocks may be partially accessed */
+    first_index = offset / stride->block_size;
+    block_offset = offset % stride->block_size;
+    iovcnt = (unsigned long) ((block_offset + length + stride->block_size - 1)
+        / stride->block_size);
+    if (iovcnt > (unsigned long) sysconf(_SC_IOV_MAX)) {
+        NA_LOG_ERROR("Block count exceeds IOV_MAX limit");
+        ret = NA_INVALID_PARAM;
+        goto done;
+    }
+    last_len = NA_SM_MIN(stride->block_size, block_offset + length);
+    if (stride->offset + (first_index + iovcnt - 1) * stride->stride
+        + last_len > mem_handle->len) {
+        NA_LOG_ERROR("Strided data exceeds registered memory");
+        ret = NA_SIZE_ERROR;
+        goto done;
+    }
+
+    iov = (struct iovec *) malloc(iovcnt * sizeof(struct iovec));
+    if (!iov) {
+        NA_LOG_ERROR("Could not allocate iovec");
+        ret = NA_NOMEM_ERROR;
+        goto done;
+    }
+    for (i = 0; i < iovcnt; i++) {
+        iov[i].iov_base = (char *) mem_handle->iov[0].iov_base
+            + stride->offset + (first_index + i) * stride->stride
+            + block_offset;
+        iov[i].iov_len = NA_SM_MIN(remaining_len,
+            stride->block_size - block_offset);
+        remaining_len -= iov[i].iov_len;
+        block_offset = 0;
+    }
+
+done:
+    if (ret == NA_SUCCESS) {
+        *iov_ptr = iov;
+        *iovcnt_ptr = iovcnt;
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_rma_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_type_t cb_type, na_cb_t callback, void *arg,
+    na_mem_handle_t local_mem_handle, const struct na_stride *local_stride,
+    na_offset_t local_offset, na_mem_handle_t remote_mem_handle,
+    const struct na_stride *remote_stride, na_offset_t remote_offset,
+    na_size_t length, na_addr_t remote_addr, na_op_id_t *op_id)
+{
+    struct na_sm_op_id *na_sm_op_id = NULL;
+    struct na_sm_mem_handle *na_sm_mem_handle_local =
+        (struct na_sm_mem_handle *) local_mem_handle;
+    struct na_sm_mem_handle *na_sm_mem_handle_remote =
+        (struct na_sm_mem_handle *) remote_mem_handle;
+    struct na_sm_addr *na_sm_addr = (struct na_sm_addr *) remote_addr;
+    struct iovec *local_iov = NULL, *remote_iov = NULL;
+    unsigned long liovcnt, riovcnt;
+    ssize_t nbytes;
+    na_return_t ret = NA_SUCCESS;
+
+    switch (na_sm_mem_handle_remote->flags) {
+        case NA_MEM_READ_ONLY:
+            if (cb_type == NA_CB_PUT) {
+                NA_LOG_ERROR("Registered memory requires write permission");
+                ret = NA_PERMISSION_ERROR;
+                goto done;
+            }
+            break;
+        case NA_MEM_WRITE_ONLY:
+            if (cb_type == NA_CB_GET) {
+                NA_LOG_ERROR("Registered memory requires read permission");
+                ret = NA_PERMISSION_ERROR;
+                goto done;
+            }
+            break;
+        case NA_MEM_READWRITE:
+            break;
+        default:
+            NA_LOG_ERROR("Invalid memory access flag");
+            ret = NA_INVALID_PARAM;
+            goto done;
+    }
+
+    ret = na_sm_stride_translate(na_sm_mem_handle_local, local_stride,
+        local_offset, length, &local_iov, &liovcnt);
+    if (ret != NA_SUCCESS) {
+        NA_LOG_ERROR("Could not translate local offset");
+        goto done;
+    }
+    ret = na_sm_stride_translate(na_sm_mem_handle_remote, remote_stride,
+        remote_offset, length, &remote_iov, &riovcnt);
+    if (ret != NA_SUCCESS) {
+        NA_LOG_ERROR("Could not translate remote offset");
+        goto done;
+    }
+
+    /* Allocate op_id if not provided */
+    if (op_id && op_id != NA_OP_ID_IGNORE && *op_id != NA_OP_ID_NULL) {
+        na_sm_op_id = (struct na_sm_op_id *) *op_id;
+        /* Make sure op ID can be safely re-used */
+        while (hg_atomic_cas32(&na_sm_op_id->ref_count, 1, 2) != HG_UTIL_TRUE)
+            cpu_spinwait();
+    } else {
+        na_sm_op_id = (struct na_sm_op_id *) na_sm_op_create(na_class);
+        if (!na_sm_op_id) {
+            NA_LOG_ERROR("Could not allocate NA SM operation ID");
+            ret = NA_NOMEM_ERROR;
+            goto done;
+        }
+    }
+    na_sm_op_id->context = context;
+    na_sm_op_id->completion_data.callback_info.type = cb_type;
+    na_sm_op_id->completion_data.callback = callback;
+    na_sm_op_id->completion_data.callback_info.arg = arg;
+    hg_atomic_set32(&na_sm_op_id->completed, NA_FALSE);
+    hg_atomic_set32(&na_sm_op_id->canceled, NA_FALSE);
+
+    /* Assign op_id */
+    if (op_id && op_id != NA_OP_ID_IGNORE && *op_id == NA_OP_ID_NULL)
+        *op_id = na_sm_op_id;
+
+    if (cb_type == NA_CB_PUT)
+        nbytes = process_vm_writev(na_sm_addr->pid, local_iov, liovcnt,
+            remote_iov, riovcnt, /* unused */0);
+    else
+        nbytes = process_vm_readv(na_sm_addr->pid, local_iov, liovcnt,
+            remote_iov, riovcnt, /* unused */0);
+    if (nbytes < 0) {
+        NA_LOG_ERROR("process_vm_%s() failed (%s)",
+            (cb_type == NA_CB_PUT) ? "writev" : "readv", strerror(errno));
+        ret = NA_PROTOCOL_ERROR;
+        goto done;
+    }
+    if ((na_size_t) nbytes != length) {
+        NA_LOG_ERROR("Transferred %ld bytes, was expecting %lu bytes", nbytes,
+            length);
+        ret = NA_SIZE_ERROR;
+        goto done;
+    }
+
+    /* Immediate completion */
+    ret = na_sm_complete(na_sm_op_id);
+    if (ret != NA_SUCCESS) {
+        NA_LOG_ERROR("Could not complete operation");
+        goto done;
+    }
+
+    /* Notify local completion */
+    if (!NA_SM_CLASS(na_class)->no_wait
+        && (hg_event_set(NA_SM_CLASS(na_class)->self_addr->local_notify)
+        != HG_UTIL_SUCCESS)) {
+        NA_LOG_ERROR("Could not signal local completion");
+        ret = NA_PROTOCOL_ERROR;
+        goto done;
+    }
+
+done:
+    free(local_iov);
+    free(remote_iov);
+    if (ret != NA_SUCCESS && na_sm_op_id) {
+        na_sm_op_destroy(na_class, (na_op_id_t) na_sm_op_id);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_size_t
+na_sm_strided_max(na_class_t NA_UNUSED *na_class)
+{
+    /* Each block is an iovec entry of process_vm_*() */
+    return (na_size_t) sysconf(_SC_IOV_MAX);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_put_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
+    na_uint8_t NA_UNUSED remote_id, na_op_id_t *op_id)
+{
+    return na_sm_rma_strided(na_class, context, NA_CB_PUT, callback, arg,
+        local_mem_handle, local_stride, local_offset, remote_mem_handle,
+        remote_stride, remote_offset, length, remote_addr, op_id);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_get_strided(na_class_t *na_class, na_context_t *context,
+    na_cb_t callback, void *arg, na_mem_handle_t local_mem_handle,
+    const struct na_stride *local_stride, na_offset_t local_offset,
+    na_mem_handle_t remote_mem_handle, const struct na_stride *remote_stride,
+    na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
+    na_uint8_t NA_UNUSED remote_id, na_op_id_t *op_id)
+{
+    return na_sm_rma_strided(na_class, context, NA_CB_GET, callback, arg,
+        local_mem_handle, local_stride, local_offset, remote_mem_handle,
+        remote_stride, remote_offset, length, remote_addr, op_id);
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE int
 na_sm_poll_get_fd(na_class_t *na_class, na_context_t NA_UNUSED *context)
@@ -40,6 +40,7 @@ struct na_init_info {
     na_progress_mode_t progress_mode;   /* Progress mode */
     na_uint8_t max_contexts;            /* Max contexts */
     const char *auth_key;               /* Authorization key */
+    na_bool_t atomics;                  /* Request native atomics (ofi) */
 };
 
 /* Segment */
@@ -48,6 +49,13 @@ struct na_segment {
     na_size_t size;     /* Size of the segment in bytes */
 };
 
+/* Strided layout, blocks of block_size bytes start every stride bytes */
+struct na_stride {
+    na_offset_t offset;     /* Offset of first block in memory handle */
+    na_size_t block_size;   /* Size of blocks in bytes */
+    na_size_t stride;       /* Distance between the start of two blocks */
+};
+
 /* Error return codes:
  * Functions return 0 for success or NA_XXX_ERROR for failure */
 typedef enum na_return {
@@ -61,7 +69,8 @@ typedef enum na_return {
     NA_PROTOCOL_ERROR,      /*!< unknown error reported from the protocol layer */
     NA_CANCELED,            /*!< operation was canceled */
     NA_CANCEL_ERROR,        /*!< operation could not be canceled */
-    NA_ADDRINUSE_ERROR      /*!< address already in use */
+    NA_ADDRINUSE_ERROR,     /*!< address already in use */
+    NA_OPNOTSUPPORTED       /*!< operation not supported by plugin */
 } na_return_t;
 
 /* Callback operation type */
@@ -72,9 +81,17 @@ typedef enum na_cb_type {
     NA_CB_SEND_EXPECTED,    /*!< expected send callback */
     NA_CB_RECV_EXPECTED,    /*!< expected recv callback */
     NA_CB_PUT,              /*!< put callback */
-    NA_CB_GET               /*!< get callback */
+    NA_CB_GET,              /*!< get callback */
+    NA_CB_ATOMIC            /*!< atomic callback */
 } na_cb_type_t;
 
+/* Atomic operation type */
+typedef enum na_atomic_op {
+    NA_ATOMIC_FADD,         /*!< fetch and add */
+    NA_ATOMIC_CSWAP,        /*!< compare and swap */
+    NA_ATOMIC_SWAP          /*!< swap */
+} na_atomic_op_t;
+
 /* Callback info structs */
 struct na_cb_info_lookup {
     na_addr_t addr;
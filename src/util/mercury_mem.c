@@ -13,6 +13,7 @@
 
 #ifdef _WIN32
 # include <windows.h>
+# include <io.h>
 #else
 # include <sys/mman.h>
 # include <unistd.h>
@@ -24,6 +25,13 @@
 #endif
 #include <stdlib.h>
 
+/****************/
+/* Local Macros */
+/****************/
+
+/* Huge page size used to round huge page mappings */
+#define HG_MEM_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
 /*---------------------------------------------------------------------------*/
 long
 hg_mem_get_page_size(void)
@@ -191,3 +199,267 @@ hg_mem_shm_unmap(const char *name, void *mem_ptr, size_t size)
 done:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+void *
+hg_mem_file_map(const char *path, size_t size, hg_util_bool_t create)
+{
+    void *mem_ptr = NULL;
+#ifdef _WIN32
+    HANDLE fh = INVALID_HANDLE_VALUE, fd = NULL;
+    LARGE_INTEGER large = {.QuadPart = size};
+    DWORD access = FILE_MAP_READ | FILE_MAP_WRITE;
+
+    fh = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL,
+        create ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE) {
+        HG_UTIL_LOG_ERROR("CreateFileA() failed");
+        goto done;
+    }
+
+    /* File is extended to size if it is smaller */
+    fd = CreateFileMappingA(fh, 0, PAGE_READWRITE, large.HighPart,
+        large.LowPart, NULL);
+    if (!fd) {
+        HG_UTIL_LOG_ERROR("CreateFileMappingA() failed");
+        goto done;
+    }
+
+    mem_ptr = MapViewOfFile(fd, access, 0, 0, size);
+    if (!mem_ptr) {
+        HG_UTIL_LOG_ERROR("MapViewOfFile() failed");
+        goto done;
+    }
+
+done:
+    /* The handles can be closed without affecting the memory mapping */
+    if (fd)
+        CloseHandle(fd);
+    if (fh != INVALID_HANDLE_VALUE)
+        CloseHandle(fh);
+#else
+    int fd;
+    int flags = O_RDWR | (create ? O_CREAT : 0);
+    struct stat file_stat;
+
+    fd = open(path, flags, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        HG_UTIL_LOG_ERROR("open() failed (%s)", strerror(errno));
+        goto done;
+    }
+
+    if (fstat(fd, &file_stat)) {
+        HG_UTIL_LOG_ERROR("fstat() failed (%s)", strerror(errno));
+        goto done;
+    }
+
+    if (file_stat.st_size < (off_t) size && ftruncate(fd, (off_t) size) < 0) {
+        HG_UTIL_LOG_ERROR("ftruncate() failed (%s)", strerror(errno));
+        goto done;
+    }
+
+    mem_ptr = mmap(NULL, size, PROT_WRITE | PROT_READ, MAP_SHARED, fd, 0);
+    if (mem_ptr == MAP_FAILED) {
+        HG_UTIL_LOG_ERROR("mmap() failed (%s)", strerror(errno));
+        mem_ptr = NULL;
+        goto done;
+    }
+
+done:
+    /* The file descriptor can be closed without affecting the memory mapping */
+    if (fd >= 0 && close(fd) == -1)
+        HG_UTIL_LOG_ERROR("close() failed (%s)", strerror(errno));
+#endif
+
+    return mem_ptr;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_file_unmap(void *mem_ptr, size_t size)
+{
+    int ret = HG_UTIL_SUCCESS;
+
+#ifdef _WIN32
+    (void) size;
+    if (mem_ptr) {
+        FlushViewOfFile(mem_ptr, 0);
+        UnmapViewOfFile(mem_ptr);
+    }
+#else
+    if (!mem_ptr)
+        goto done;
+
+    if (msync(mem_ptr, size, MS_SYNC) == -1) {
+        HG_UTIL_LOG_ERROR("msync() failed (%s)", strerror(errno));
+        ret = HG_UTIL_FAIL;
+    }
+
+    if (munmap(mem_ptr, size) == -1) {
+        HG_UTIL_LOG_ERROR("munmap() failed (%s)", strerror(errno));
+        ret = HG_UTIL_FAIL;
+        goto done;
+    }
+
+done:
+#endif
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static size_t
+hg_mem_get_map_granularity(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo (&system_info);
+    return (size_t) system_info.dwAllocationGranularity;
+#else
+    return (size_t) hg_mem_get_page_size();
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+void *
+hg_mem_fd_map(int fd, hg_util_uint64_t offset, size_t size,
+    hg_util_bool_t writable)
+{
+    /* Mappings must start on a boundary of the map granularity */
+    size_t granularity = hg_mem_get_map_granularity();
+    size_t delta = (size_t) (offset % granularity);
+    hg_util_uint64_t map_offset = offset - delta;
+    void *mem_ptr = NULL;
+#ifdef _WIN32
+    HANDLE fh = (HANDLE) _get_osfhandle(fd), fm = NULL;
+
+    if (fh == INVALID_HANDLE_VALUE) {
+        HG_UTIL_LOG_ERROR("_get_osfhandle() failed");
+        goto done;
+    }
+
+    fm = CreateFileMappingA(fh, NULL,
+        writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+    if (!fm) {
+        HG_UTIL_LOG_ERROR("CreateFileMappingA() failed");
+        goto done;
+    }
+
+    mem_ptr = MapViewOfFile(fm, writable ? FILE_MAP_WRITE : FILE_MAP_READ,
+        (DWORD) (map_offset >> 32), (DWORD) (map_offset & 0xffffffff),
+        size + delta);
+    if (!mem_ptr) {
+        HG_UTIL_LOG_ERROR("MapViewOfFile() failed");
+        goto done;
+    }
+    mem_ptr = (char *) mem_ptr + delta;
+
+done:
+    /* The mapping handle can be closed without affecting the view */
+    if (fm)
+        CloseHandle(fm);
+#else
+    mem_ptr = mmap(NULL, size + delta,
+        writable ? PROT_WRITE | PROT_READ : PROT_READ, MAP_SHARED, fd,
+        (off_t) map_offset);
+    if (mem_ptr == MAP_FAILED) {
+        HG_UTIL_LOG_ERROR("mmap() failed (%s)", strerror(errno));
+        return NULL;
+    }
+    mem_ptr = (char *) mem_ptr + delta;
+#endif
+
+    return mem_ptr;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_fd_unmap(void *mem_ptr, size_t size)
+{
+    size_t delta;
+    int ret = HG_UTIL_SUCCESS;
+
+    if (!mem_ptr)
+        goto done;
+
+    /* Mappings start on a boundary of the map granularity */
+    delta = (size_t) mem_ptr % hg_mem_get_map_granularity();
+#ifdef _WIN32
+    (void) size;
+    if (!UnmapViewOfFile((char *) mem_ptr - delta)) {
+        HG_UTIL_LOG_ERROR("UnmapViewOfFile() failed");
+        ret = HG_UTIL_FAIL;
+    }
+#else
+    if (munmap((char *) mem_ptr - delta, size + delta) == -1) {
+        HG_UTIL_LOG_ERROR("munmap() failed (%s)", strerror(errno));
+        ret = HG_UTIL_FAIL;
+    }
+#endif
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void *
+hg_mem_huge_alloc(size_t size)
+{
+    void *mem_ptr = NULL;
+
+#ifdef _WIN32
+    mem_ptr = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE,
+        PAGE_READWRITE);
+    if (!mem_ptr)
+        HG_UTIL_LOG_ERROR("VirtualAlloc() failed");
+#else
+    size_t huge_size = (size + HG_MEM_HUGE_PAGE_SIZE - 1)
+        & ~((size_t) HG_MEM_HUGE_PAGE_SIZE - 1);
+
+#ifdef MAP_HUGETLB
+    /* Explicit huge pages, fails if none are reserved */
+    mem_ptr = mmap(NULL, huge_size, PROT_WRITE | PROT_READ,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mem_ptr != MAP_FAILED)
+        goto done;
+#endif
+
+    /* Fall back to transparent huge pages if available */
+    mem_ptr = mmap(NULL, huge_size, PROT_WRITE | PROT_READ,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem_ptr == MAP_FAILED) {
+        HG_UTIL_LOG_ERROR("mmap() failed (%s)", strerror(errno));
+        mem_ptr = NULL;
+        goto done;
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(mem_ptr, huge_size, MADV_HUGEPAGE);
+#endif
+
+done:
+#endif
+    return mem_ptr;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_huge_free(void *mem_ptr, size_t size)
+{
+    int ret = HG_UTIL_SUCCESS;
+
+#ifdef _WIN32
+    (void) size;
+    if (mem_ptr && !VirtualFree(mem_ptr, 0, MEM_RELEASE)) {
+        HG_UTIL_LOG_ERROR("VirtualFree() failed");
+        ret = HG_UTIL_FAIL;
+    }
+#else
+    size_t huge_size = (size + HG_MEM_HUGE_PAGE_SIZE - 1)
+        & ~((size_t) HG_MEM_HUGE_PAGE_SIZE - 1);
+
+    if (mem_ptr && munmap(mem_ptr, huge_size) == -1) {
+        HG_UTIL_LOG_ERROR("munmap() failed (%s)", strerror(errno));
+        ret = HG_UTIL_FAIL;
+    }
+#endif
+    return ret;
+}
@@ -74,6 +74,83 @@ hg_mem_shm_map(const char *name, size_t size, hg_util_bool_t create);
 HG_UTIL_EXPORT int
 hg_mem_shm_unmap(const char *name, void *mem_ptr, size_t size);
 
+/**
+ * Map file \path of size \size into memory, changes to the mapped region are
+ * written back to the file. The file is extended to \size if it is smaller.
+ *
+ * \param path [IN]             path of file
+ * \param size [IN]             total requested size
+ * \param create [IN]           create file if not existing
+ *
+ * \return a pointer to the mapped memory region, or NULL in case of failure
+ */
+HG_UTIL_EXPORT void *
+hg_mem_file_map(const char *path, size_t size, hg_util_bool_t create);
+
+/**
+ * Flush and unmap a region previously mapped with hg_mem_file_map().
+ *
+ * \param mem_ptr [IN]          pointer to mapped memory region
+ * \param size [IN]             size range of the mapped region
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_EXPORT int
+hg_mem_file_unmap(void *mem_ptr, size_t size);
+
+/**
+ * Map \size bytes of an open file descriptor starting at \offset, offset
+ * does not need to be page aligned. The mapping is shared, pages of the
+ * mapping are the pages of the file cache and remain valid after fd is
+ * closed. Accessing pages beyond the end of the file (e.g., if the file is
+ * truncated while mapped) results in a bus error.
+ *
+ * \param fd [IN]               file descriptor
+ * \param offset [IN]           offset in file
+ * \param size [IN]             size of mapped range
+ * \param writable [IN]         map range writable (fd must be open for
+ *                              writing)
+ *
+ * \return a pointer to the mapped memory at offset, or NULL in case of failure
+ */
+HG_UTIL_EXPORT void *
+hg_mem_fd_map(int fd, hg_util_uint64_t offset, size_t size,
+    hg_util_bool_t writable);
+
+/**
+ * Unmap a range previously mapped with hg_mem_fd_map().
+ *
+ * \param mem_ptr [IN]          pointer returned by hg_mem_fd_map()
+ * \param size [IN]             size of mapped range
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_EXPORT int
+hg_mem_fd_unmap(void *mem_ptr, size_t size);
+
+/**
+ * Allocate \size bytes backed by huge pages. Explicit huge pages are used
+ * if reserved by the system, otherwise transparent huge pages are requested.
+ * Memory is zero-initialized.
+ *
+ * \param size [IN]             total requested size
+ *
+ * \return a pointer to the allocated memory, or NULL in case of failure
+ */
+HG_UTIL_EXPORT void *
+hg_mem_huge_alloc(size_t size);
+
+/**
+ * Free memory allocated with hg_mem_huge_alloc().
+ *
+ * \param mem_ptr [IN]          pointer to allocated memory
+ * \param size [IN]             size that was requested
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_EXPORT int
+hg_mem_huge_free(void *mem_ptr, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_mem_copy.h"
+#include "mercury_thread_pool.h"
+#include "mercury_thread_mutex.h"
+#include "mercury_atomic.h"
+#include "mercury_util_error.h"
+
+#include <string.h>
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Parts are aligned to cache lines so that threads do not share lines */
+#define HG_MEM_COPY_ALIGN 64
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/* Part of a split range */
+struct hg_mem_copy_part {
+    struct hg_thread_work work;         /* Posted to helper pool */
+    hg_mem_copy_func_t func;            /* Range callback */
+    void *arg;                          /* Callback argument */
+    size_t offset;                      /* Offset of part */
+    size_t len;                         /* Length of part */
+    hg_atomic_int32_t *remaining;       /* Parts not yet completed */
+    hg_atomic_int32_t *failed;          /* Set if any part failed */
+};
+
+/* Copy arguments passed to range callback */
+struct hg_mem_copy_args {
+    char *dest;
+    const char *src;
+    hg_util_bool_t nt;
+};
+
+/* Engine state */
+struct hg_mem_copy_engine {
+    hg_thread_pool_t *pool;             /* Helper threads */
+    unsigned int thread_count;          /* Threads per copy (with caller) */
+    size_t nt_size;                     /* Non-temporal threshold */
+    unsigned int refcount;              /* Init reference count */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Copy using non-temporal stores.
+ */
+static void
+hg_mem_copy_nt(
+        void *dest,
+        const void *src,
+        size_t n
+        );
+
+/**
+ * Range callback of hg_mem_copy().
+ */
+static int
+hg_mem_copy_range(
+        void *arg,
+        size_t offset,
+        size_t len
+        );
+
+/**
+ * Run part on helper thread.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_mem_copy_part_run(
+        void *arg
+        );
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Default engine, copies are not split */
+static struct hg_mem_copy_engine hg_mem_copy_engine_g = { NULL, 1, 0, 0 };
+
+/* Protects engine init/finalize */
+static hg_thread_mutex_t hg_mem_copy_mutex_g = HG_THREAD_MUTEX_INITIALIZER;
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_mem_copy_nt(void *dest, const void *src, size_t n)
+{
+#if defined(__SSE2__)
+    char *dest_ptr = (char *) dest;
+    const char *src_ptr = (const char *) src;
+    size_t head = (16 - ((size_t) dest_ptr & 15)) & 15;
+
+    if (n < head + 64) {
+        memcpy(dest, src, n);
+        return;
+    }
+
+    /* Align destination on 16 bytes */
+    memcpy(dest_ptr, src_ptr, head);
+    dest_ptr += head;
+    src_ptr += head;
+    n -= head;
+
+    for (; n >= 64; n -= 64, dest_ptr += 64, src_ptr += 64) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *) src_ptr);
+        __m128i x1 = _mm_loadu_si128((const __m128i *) (src_ptr + 16));
+        __m128i x2 = _mm_loadu_si128((const __m128i *) (src_ptr + 32));
+        __m128i x3 = _mm_loadu_si128((const __m128i *) (src_ptr + 48));
+
+        _mm_stream_si128((__m128i *) dest_ptr, x0);
+        _mm_stream_si128((__m128i *) (dest_ptr + 16), x1);
+        _mm_stream_si128((__m128i *) (dest_ptr + 32), x2);
+        _mm_stream_si128((__m128i *) (dest_ptr + 48), x3);
+    }
+    /* Order streaming stores before anything that follows */
+    _mm_sfence();
+
+    memcpy(dest_ptr, src_ptr, n);
+#else
+    memcpy(dest, src, n);
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_mem_copy_range(void *arg, size_t offset, size_t len)
+{
+    struct hg_mem_copy_args *args = (struct hg_mem_copy_args *) arg;
+
+    if (args->nt)
+        hg_mem_copy_nt(args->dest + offset, args->src + offset, len);
+    else
+        memcpy(args->dest + offset, args->src + offset, len);
+
+    return HG_UTIL_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_mem_copy_part_run(void *arg)
+{
+    struct hg_mem_copy_part *part = (struct hg_mem_copy_part *) arg;
+    hg_atomic_int32_t *remaining = part->remaining;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+
+    if (part->func(part->arg, part->offset, part->len) != HG_UTIL_SUCCESS)
+        hg_atomic_set32(part->failed, 1);
+
+    /* Part may be released by waiter from this point */
+    hg_atomic_decr32(remaining);
+
+    return thread_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_copy_init(unsigned int thread_count, size_t nt_size)
+{
+    int ret = HG_UTIL_SUCCESS;
+
+    if (thread_count > HG_MEM_COPY_MAX_THREADS)
+        thread_count = HG_MEM_COPY_MAX_THREADS;
+    else if (thread_count == 0)
+        thread_count = 1;
+
+    hg_thread_mutex_lock(&hg_mem_copy_mutex_g);
+
+    if (hg_mem_copy_engine_g.refcount == 0) {
+        if (thread_count > 1) {
+            if (hg_thread_pool_init(thread_count - 1,
+                &hg_mem_copy_engine_g.pool) != HG_UTIL_SUCCESS) {
+                HG_UTIL_LOG_ERROR("Could not create copy thread pool");
+                ret = HG_UTIL_FAIL;
+                goto unlock;
+            }
+            hg_mem_copy_engine_g.thread_count = thread_count;
+        }
+        hg_mem_copy_engine_g.nt_size = nt_size;
+    } else if (thread_count != hg_mem_copy_engine_g.thread_count
+        || nt_size != hg_mem_copy_engine_g.nt_size) {
+        /* Engine is shared by the whole process */
+        HG_UTIL_LOG_WARNING("Copy engine already uses %u thread(s) and a "
+            "non-temporal size of %zu byte(s), ignoring %u thread(s) and "
+            "%zu byte(s)", hg_mem_copy_engine_g.thread_count,
+            hg_mem_copy_engine_g.nt_size, thread_count, nt_size);
+    }
+    hg_mem_copy_engine_g.refcount++;
+
+unlock:
+    hg_thread_mutex_unlock(&hg_mem_copy_mutex_g);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_copy_finalize(void)
+{
+    int ret = HG_UTIL_SUCCESS;
+
+    hg_thread_mutex_lock(&hg_mem_copy_mutex_g);
+
+    if (hg_mem_copy_engine_g.refcount == 0) {
+        HG_UTIL_LOG_ERROR("Copy engine was not initialized");
+        ret = HG_UTIL_FAIL;
+        goto unlock;
+    }
+
+    if (--hg_mem_copy_engine_g.refcount == 0) {
+        hg_mem_copy_engine_g.thread_count = 1;
+        hg_mem_copy_engine_g.nt_size = 0;
+        if (hg_mem_copy_engine_g.pool
+            && hg_thread_pool_destroy(hg_mem_copy_engine_g.pool)
+                != HG_UTIL_SUCCESS) {
+            HG_UTIL_LOG_ERROR("Could not destroy copy thread pool");
+            ret = HG_UTIL_FAIL;
+        }
+        hg_mem_copy_engine_g.pool = NULL;
+    }
+
+unlock:
+    hg_thread_mutex_unlock(&hg_mem_copy_mutex_g);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+unsigned int
+hg_mem_copy_get_threads(void)
+{
+    return hg_mem_copy_engine_g.thread_count;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_mem_copy(void *dest, const void *src, size_t n)
+{
+    struct hg_mem_copy_args args;
+
+    args.dest = (char *) dest;
+    args.src = (const char *) src;
+    args.nt = (hg_util_bool_t) (hg_mem_copy_engine_g.nt_size
+        && n >= hg_mem_copy_engine_g.nt_size);
+
+    if (hg_mem_copy_engine_g.thread_count > 1
+        && n >= 2 * HG_MEM_COPY_SPLIT_SIZE)
+        (void) hg_mem_copy_split(n, HG_MEM_COPY_SPLIT_SIZE, hg_mem_copy_range,
+            &args);
+    else
+        (void) hg_mem_copy_range(&args, 0, n);
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_copy_split(size_t n, size_t min_size, hg_mem_copy_func_t func,
+    void *arg)
+{
+    struct hg_mem_copy_part parts[HG_MEM_COPY_MAX_THREADS];
+    hg_thread_pool_t *pool = hg_mem_copy_engine_g.pool;
+    size_t part_count = hg_mem_copy_engine_g.thread_count;
+    size_t part_size, offset;
+    hg_atomic_int32_t remaining, failed;
+    size_t i;
+
+    if (min_size && n / min_size < part_count)
+        part_count = n / min_size;
+    if (part_count <= 1 || !pool)
+        return func(arg, 0, n);
+
+    part_size = (n / part_count + HG_MEM_COPY_ALIGN - 1)
+        & ~((size_t) HG_MEM_COPY_ALIGN - 1);
+    hg_atomic_init32(&remaining, 0);
+    hg_atomic_init32(&failed, 0);
+
+    /* First part is run by the calling thread */
+    for (i = 0, offset = 0; i < part_count && offset < n; i++) {
+        parts[i].func = func;
+        parts[i].arg = arg;
+        parts[i].offset = offset;
+        parts[i].len = (n - offset < part_size) ? n - offset : part_size;
+        parts[i].remaining = &remaining;
+        parts[i].failed = &failed;
+        offset += parts[i].len;
+    }
+    part_count = i;
+    hg_atomic_set32(&remaining, (hg_util_int32_t) (part_count - 1));
+
+    for (i = 1; i < part_count; i++) {
+        parts[i].work.func = hg_mem_copy_part_run;
+        parts[i].work.args = &parts[i];
+        if (hg_thread_pool_post(pool, &parts[i].work) != HG_UTIL_SUCCESS)
+            hg_mem_copy_part_run(&parts[i]);
+    }
+
+    if (func(arg, parts[0].offset, parts[0].len) != HG_UTIL_SUCCESS)
+        hg_atomic_set32(&failed, 1);
+
+    /* Parts live on this stack, wait for all of them */
+    while (hg_atomic_get32(&remaining) > 0)
+        hg_thread_yield();
+
+    return hg_atomic_get32(&failed) ? HG_UTIL_FAIL : HG_UTIL_SUCCESS;
+}
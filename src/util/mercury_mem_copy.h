@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2013-2019 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_MEM_COPY_H
+#define MERCURY_MEM_COPY_H
+
+#include "mercury_util_config.h"
+
+#include <stddef.h>
+
+/**
+ * Purpose: process-wide local copy engine. Large copies can use non-temporal
+ * stores and be split across a small pool of helper threads. The engine is
+ * disabled (plain memcpy) until hg_mem_copy_init() is called.
+ */
+
+/* Smallest range given to a single thread when splitting copies */
+#define HG_MEM_COPY_SPLIT_SIZE (256 * 1024)
+
+/* Max number of threads (including caller) a range is split across */
+#define HG_MEM_COPY_MAX_THREADS 16
+
+/**
+ * Range callback used by hg_mem_copy_split(), must return HG_UTIL_SUCCESS
+ * or HG_UTIL_FAIL.
+ */
+typedef int (*hg_mem_copy_func_t)(void *arg, size_t offset, size_t len);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initialize the copy engine. Calls are reference counted, only the first
+ * call sets the configuration, later calls keep the existing one and log a
+ * warning if they request a different one.
+ *
+ * \param thread_count [IN]     number of threads used per copy, including
+ *                              the calling thread (0 or 1 disables helpers)
+ * \param nt_size [IN]          size from which copies use non-temporal stores
+ *                              (0 disables non-temporal stores)
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_EXPORT int
+hg_mem_copy_init(unsigned int thread_count, size_t nt_size);
+
+/**
+ * Release a reference to the copy engine, helper threads are stopped when
+ * the last reference is released.
+ *
+ * \return non-negative on success, or negative in case of failure
+ */
+HG_UTIL_EXPORT int
+hg_mem_copy_finalize(void);
+
+/**
+ * Get number of threads used per copy, including the calling thread.
+ *
+ * \return thread count (1 when the engine is not initialized)
+ */
+HG_UTIL_EXPORT unsigned int
+hg_mem_copy_get_threads(void);
+
+/**
+ * Copy n bytes from src to dest, regions must not overlap.
+ *
+ * \param dest [OUT]            pointer to destination
+ * \param src [IN]              pointer to source
+ * \param n [IN]                number of bytes
+ */
+HG_UTIL_EXPORT void
+hg_mem_copy(void *dest, const void *src, size_t n);
+
+/**
+ * Split range [0, n) into parts of at least min_size bytes and call func
+ * on each part, parts are run concurrently on helper threads and on the
+ * calling thread. Returns once all parts have completed.
+ *
+ * \param n [IN]                size of range
+ * \param min_size [IN]         minimum size of a part
+ * \param func [IN]             range callback
+ * \param arg [IN]              callback argument
+ *
+ * \return non-negative on success, or negative if any part failed
+ */
+HG_UTIL_EXPORT int
+hg_mem_copy_split(size_t n, size_t min_size, hg_mem_copy_func_t func,
+    void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_MEM_COPY_H */